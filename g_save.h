@@ -20,3 +20,9 @@ typedef struct {
 	const char *funcStr;
 	uint8_t *funcPtr;
 } funcList_t;
+
+// a savegame built in memory by G_SaveGame, written out on a background thread
+typedef struct saveSnapshot_s saveSnapshot_t;
+
+// a savegame being parsed by G_LoadGame, held in memory
+typedef struct saveReader_s saveReader_t;
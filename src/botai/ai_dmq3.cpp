@@ -94,21 +94,21 @@ int max_bspmodelindex;  //maximum BSP model index
 
 /*
 ==================
-BotPointAreaNum
+BotPointAreaNumInWorld
 ==================
 */
-int BotPointAreaNum( vec3_t origin ) {
+int BotPointAreaNumInWorld( int world, vec3_t origin ) {
 	int areanum, numareas, areas[1];
 	vec3_t end, ofs;
 	#define BOTAREA_JIGGLE_DIST     32
 
-	areanum = trap_AAS_PointAreaNum( origin );
+	areanum = trap_AAS_PointAreaNumInWorld( world, origin );
 	if ( areanum ) {
 		return areanum;
 	}
 	VectorCopy( origin, end );
 	end[2] += 10;
-	numareas = trap_AAS_TraceAreas( origin, end, areas, nullptr, 1 );
+	numareas = trap_AAS_TraceAreasInWorld( world, origin, end, areas, nullptr, 1 );
 	if ( numareas > 0 ) {
 		return areas[0];
 	}
@@ -118,7 +118,7 @@ int BotPointAreaNum( vec3_t origin ) {
 	for ( ofs[0] = -BOTAREA_JIGGLE_DIST; ofs[0] <= BOTAREA_JIGGLE_DIST; ofs[0] += BOTAREA_JIGGLE_DIST * 2 ) {
 		for ( ofs[1] = -BOTAREA_JIGGLE_DIST; ofs[1] <= BOTAREA_JIGGLE_DIST; ofs[1] += BOTAREA_JIGGLE_DIST * 2 ) {
 			VectorAdd( origin, ofs, end );
-			numareas = trap_AAS_TraceAreas( origin, end, areas, nullptr, 1 );
+			numareas = trap_AAS_TraceAreasInWorld( world, origin, end, areas, nullptr, 1 );
 			if ( numareas > 0 ) {
 				return areas[0];
 			}
@@ -128,6 +128,15 @@ int BotPointAreaNum( vec3_t origin ) {
 	return 0;
 }
 
+/*
+==================
+BotPointAreaNum
+==================
+*/
+int BotPointAreaNum( vec3_t origin ) {
+	return BotPointAreaNumInWorld( AAS_CurrentWorld(), origin );
+}
+
 /*
 ==================
 ClientName
@@ -125,6 +125,8 @@ char *stristr( char *str, char *charset );
 int ClientFromName( char *name );
 //
 int BotPointAreaNum( vec3_t origin );
+// same, in the given AAS world rather than the current one
+int BotPointAreaNumInWorld( int world, vec3_t origin );
 //
 void BotMapScripts( bot_state_t *bs );
 
@@ -65,6 +65,10 @@ void AAS_SetCurrentWorld( int index ) {
 	aasworld = &aasworlds[index];
 }
 
+int AAS_CurrentWorld( void ) {
+	return (int)( aasworld - aasworlds );
+}
+
 int AAS_IndexFromString( char *indexname, char *stringindex[], int numindexes, char *string ) {
 	int i;
 	if ( !( *aasworld ).indexessetup ) {
@@ -30,6 +30,7 @@ If you have questions concerning this license or the applicable additional terms
 
 
 #include "be_aas_def.h"
+extern aas_t aasworlds[MAX_AAS_WORLDS];
 extern aas_t( *aasworld );
 
 //AAS error message
@@ -65,4 +66,7 @@ float AAS_Time( void );
 // Ridah
 void AAS_SetCurrentWorld( int index );
 // done.
+// the index of the world AAS_SetCurrentWorld last set, for the functions that take
+// a world instead, which jobs use since the current world is shared
+int AAS_CurrentWorld( void );
 
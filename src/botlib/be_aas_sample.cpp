@@ -205,13 +205,14 @@ void AAS_FreeAASLinkedEntities( void ) {
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-int AAS_PointAreaNum( vec3_t point ) {
+int AAS_PointAreaNumInWorld( int world, vec3_t point ) {
+	const aas_t *aas = &aasworlds[world];
 	int nodenum;
 	vec_t dist;
 	aas_node_t *node;
 	aas_plane_t *plane;
 
-	if ( !( *aasworld ).loaded ) {
+	if ( !( *aas ).loaded ) {
 		BotImport_Print( PRT_ERROR, "AAS_PointAreaNum: aas not loaded\n" );
 		return 0;
 	} //end if
@@ -222,19 +223,19 @@ int AAS_PointAreaNum( vec3_t point ) {
 	{
 //		BotImport_Print(PRT_MESSAGE, "[%d]", nodenum);
 #ifdef AAS_SAMPLE_DEBUG
-		if ( nodenum >= ( *aasworld ).numnodes ) {
-			BotImport_Print( PRT_ERROR, "nodenum = %d >= (*aasworld).numnodes = %d\n", nodenum, ( *aasworld ).numnodes );
+		if ( nodenum >= ( *aas ).numnodes ) {
+			BotImport_Print( PRT_ERROR, "nodenum = %d >= (*aasworld).numnodes = %d\n", nodenum, ( *aas ).numnodes );
 			return 0;
 		} //end if
 #endif //AAS_SAMPLE_DEBUG
-		node = &( *aasworld ).nodes[nodenum];
+		node = &( *aas ).nodes[nodenum];
 #ifdef AAS_SAMPLE_DEBUG
-		if ( node->planenum < 0 || node->planenum >= ( *aasworld ).numplanes ) {
-			BotImport_Print( PRT_ERROR, "node->planenum = %d >= (*aasworld).numplanes = %d\n", node->planenum, ( *aasworld ).numplanes );
+		if ( node->planenum < 0 || node->planenum >= ( *aas ).numplanes ) {
+			BotImport_Print( PRT_ERROR, "node->planenum = %d >= (*aasworld).numplanes = %d\n", node->planenum, ( *aas ).numplanes );
 			return 0;
 		} //end if
 #endif //AAS_SAMPLE_DEBUG
-		plane = &( *aasworld ).planes[node->planenum];
+		plane = &( *aas ).planes[node->planenum];
 		dist = DotProduct( point, plane->normal ) - plane->dist;
 		if ( dist > 0 ) {
 			nodenum = node->children[0];
@@ -247,6 +248,16 @@ int AAS_PointAreaNum( vec3_t point ) {
 		return 0;
 	} //end if
 	return -nodenum;
+} //end of the function AAS_PointAreaNumInWorld
+//===========================================================================
+// returns the AAS area the point is in, in the current world
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_PointAreaNum( vec3_t point ) {
+	return AAS_PointAreaNumInWorld( AAS_CurrentWorld(), point );
 } //end of the function AAS_PointAreaNum
 //===========================================================================
 //
@@ -609,7 +620,8 @@ aas_trace_t AAS_TraceClientBBox( vec3_t start, vec3_t end, int presencetype,
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-int AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas ) {
+int AAS_TraceAreasInWorld( int world, vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas ) {
+	const aas_t *aas = &aasworlds[world];
 	int side, nodenum, tmpplanenum;
 	int numareas;
 	float front, back, frac;
@@ -621,7 +633,7 @@ int AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int ma
 
 	numareas = 0;
 	areas[0] = 0;
-	if ( !( *aasworld ).loaded ) {
+	if ( !( *aas ).loaded ) {
 		return numareas;
 	}
 
@@ -648,7 +660,7 @@ int AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int ma
 		//if it is an area
 		if ( nodenum < 0 ) {
 #ifdef AAS_SAMPLE_DEBUG
-			if ( -nodenum > ( *aasworld ).numareasettings ) {
+			if ( -nodenum > ( *aas ).numareasettings ) {
 				BotImport_Print( PRT_ERROR, "AAS_TraceAreas: -nodenum = %d out of range\n", -nodenum );
 				return numareas;
 			} //end if
@@ -669,19 +681,19 @@ int AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int ma
 			continue;
 		} //end if
 #ifdef AAS_SAMPLE_DEBUG
-		if ( nodenum > ( *aasworld ).numnodes ) {
+		if ( nodenum > ( *aas ).numnodes ) {
 			BotImport_Print( PRT_ERROR, "AAS_TraceAreas: nodenum out of range\n" );
 			return numareas;
 		} //end if
 #endif //AAS_SAMPLE_DEBUG
 	   //the node to test against
-		aasnode = &( *aasworld ).nodes[nodenum];
+		aasnode = &( *aas ).nodes[nodenum];
 		//start point of current line to test against node
 		VectorCopy( tstack_p->start, cur_start );
 		//end point of the current line to test against node
 		VectorCopy( tstack_p->end, cur_end );
 		//the current node plane
-		plane = &( *aasworld ).planes[aasnode->planenum];
+		plane = &( *aas ).planes[aasnode->planenum];
 
 		switch ( plane->type )
 		{/*FIXME: wtf doesn't this work? obviously the node planes aren't always facing positive!!!
@@ -785,6 +797,16 @@ int AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int ma
 		} //end else
 	} //end while
 //	return numareas;
+} //end of the function AAS_TraceAreasInWorld
+//===========================================================================
+// AAS_TraceAreasInWorld in the current world
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas ) {
+	return AAS_TraceAreasInWorld( AAS_CurrentWorld(), start, end, areas, points, maxareas );
 } //end of the function AAS_TraceAreas
 //===========================================================================
 // a simple cross product
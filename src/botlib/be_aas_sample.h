@@ -52,8 +52,10 @@ int AAS_PointPresenceType( vec3_t point );
 aas_trace_t AAS_TraceClientBBox( vec3_t start, vec3_t end, int presencetype, int passent );
 //stores the areas the trace went through and returns the number of passed areas
 int AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas );
+int AAS_TraceAreasInWorld( int world, vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas );
 //returns the area the point is in
 int AAS_PointAreaNum( vec3_t point );
+int AAS_PointAreaNumInWorld( int world, vec3_t point );
 //returns the plane the given face is in
 void AAS_FacePlane( int facenum, vec3_t normal, float *dist );
 
@@ -40,6 +40,14 @@ If you have questions concerning this license or the applicable additional terms
 #include "l_precomp.h"
 #include "l_log.h"
 
+#include "../qcommon/qcommon.h"
+#include "../qcommon/token_cache.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #define MAX_DEFINEPARMS         128
 
 #define DEFINEHASHING           1
@@ -61,6 +69,11 @@ int numtokens;
 //list with global defines added to every source loaded
 define_t *globaldefines;
 
+//errors and warnings reported, so sources that have any aren't cached
+static int sourceMessages;
+
+static void PC_NoteScript( source_t *source, const char *filename );
+
 
 void  SourceError( source_t *source, const char *str, ... ) {
 	char text[1024];
@@ -70,6 +83,7 @@ void  SourceError( source_t *source, const char *str, ... ) {
 	vsnprintf( text, sizeof(text), str, ap );
 	va_end( ap );
 	BotImport_Print( PRT_ERROR, "file %s, line %d: %s\n", source->scriptstack->filename, source->scriptstack->line, text );
+	sourceMessages++;
 }
 
 void  SourceWarning( source_t *source, const char *str, ... ) {
@@ -81,6 +95,7 @@ void  SourceWarning( source_t *source, const char *str, ... ) {
 	va_end( ap );
 
 	BotImport_Print( PRT_WARNING, "file %s, line %d: %s\n", source->scriptstack->filename, source->scriptstack->line, text );
+	sourceMessages++;
 }
 
 void PC_PushIndent( source_t *source, int type, int skip ) {
@@ -141,6 +156,7 @@ void PC_PushScript( source_t *source, script_t *script ) {
 	  //push the script on the script stack
 	script->next = source->scriptstack;
 	source->scriptstack = script;
+	PC_NoteScript( source, script->filename );
 } //end of the function PC_PushScript
 //============================================================================
 //
@@ -2731,25 +2747,184 @@ void FreeSource( source_t *source ) {
 
 source_t *sourceFiles[MAX_SOURCEFILES];
 
+/*
+The token streams of the sources loaded through handles, which are the menus,
+are kept in memory and under tokencache/, and replayed for as long as the files
+they came from and the global defines are unchanged (see TokenStream). A handle
+either replays a stream or reads its source and records what it reads.
+pc_tokenCache 0 turns this off.
+*/
+
+typedef struct sourceCache_s
+{
+	std::string filename;                           //file name of the source
+	std::shared_ptr<const TokenStream> replay;      //stream replayed instead of reading a source
+	int next;                                       //next token of the replay
+	std::unique_ptr<TokenStream> record;            //tokens read from the source so far
+	std::vector<std::string> scripts;               //files the recorded tokens came from
+	bool complete;                                  //the source has been read to the end
+	int messages;                                   //sourceMessages when the source was loaded
+} sourceCache_t;
+
+static sourceCache_t sourceCache[MAX_SOURCEFILES];
+static std::map<std::string, std::shared_ptr<const TokenStream>> tokenCache;
+static cvar_t *pc_tokenCache;
+
+static void PC_NoteScript( source_t *source, const char *filename ) {
+	int i;
+
+	for ( i = 1; i < MAX_SOURCEFILES; i++ )
+	{
+		if ( sourceFiles[i] == source ) {
+			if ( sourceCache[i].record ) {
+				sourceCache[i].scripts.push_back( filename );
+			} //end if
+			return;
+		} //end if
+	} //end for
+} //end of the function PC_NoteScript
+
+static uint32_t PC_GlobalDefinesChecksum( void ) {
+	define_t *define;
+	token_t *token;
+	uint32_t checksum;
+
+	checksum = TokenStream::hash( nullptr, 0 );
+	for ( define = globaldefines; define; define = define->next )
+	{
+		checksum = TokenStream::hash( define->name, strlen( define->name ) + 1, checksum );
+		for ( token = define->parms; token; token = token->next )
+		{
+			checksum = TokenStream::hash( token->string, strlen( token->string ) + 1, checksum );
+		} //end for
+		checksum = TokenStream::hash( "#", 1, checksum );
+		for ( token = define->tokens; token; token = token->next )
+		{
+			checksum = TokenStream::hash( token->string, strlen( token->string ) + 1, checksum );
+		} //end for
+		checksum = TokenStream::hash( "\n", 1, checksum );
+	} //end for
+	return checksum;
+} //end of the function PC_GlobalDefinesChecksum
+
+static bool PC_FileChecksum( const char *filename, uint32_t &checksum ) {
+	void *buffer;
+	size_t length;
+
+	length = FS_ReadFile( filename, &buffer );
+	if ( !buffer ) {
+		return false;
+	}
+	checksum = TokenStream::hash( buffer, length );
+	FS_FreeFile( buffer );
+	return true;
+} //end of the function PC_FileChecksum
+
+static std::string PC_TokenCacheKey( const char *filename ) {
+	std::string key = filename;
+	for ( char &c : key )
+	{
+		c = ( c == '\\' ) ? '/' : tolower( c );
+	} //end for
+	return key;
+} //end of the function PC_TokenCacheKey
+
+static std::string PC_TokenCachePath( const std::string &key ) {
+	return "tokencache/" + key + ".tok";
+} //end of the function PC_TokenCachePath
+
+static std::shared_ptr<const TokenStream> PC_FindTokenStream( const char *filename ) {
+	const std::string key = PC_TokenCacheKey( filename );
+	const uint32_t defines = PC_GlobalDefinesChecksum();
+
+	auto it = tokenCache.find( key );
+	if ( it != tokenCache.end() ) {
+		if ( it->second->upToDate( defines, PC_FileChecksum ) ) {
+			return it->second;
+		} //end if
+		return nullptr;
+	} //end if
+
+	//recorded by an earlier run
+	void *buffer;
+	size_t length = FS_ReadFile( PC_TokenCachePath( key ).c_str(), &buffer );
+	if ( !buffer ) {
+		return nullptr;
+	} //end if
+	std::shared_ptr<TokenStream> stream = std::make_shared<TokenStream>();
+	bool valid = stream->read( (const uint8_t *)buffer, length ) && stream->upToDate( defines, PC_FileChecksum );
+	FS_FreeFile( buffer );
+	if ( !valid ) {
+		return nullptr;
+	} //end if
+	tokenCache[key] = stream;
+	return stream;
+} //end of the function PC_FindTokenStream
+
+static void PC_StoreTokenStream( sourceCache_t &cache ) {
+	uint32_t checksum;
+
+	//anything the preprocessor complained about should be seen again next time
+	if ( sourceMessages != cache.messages ) {
+		return;
+	} //end if
+	for ( const std::string &script : cache.scripts )
+	{
+		if ( !PC_FileChecksum( script.c_str(), checksum ) ) {
+			return;
+		} //end if
+		cache.record->addSource( script.c_str(), checksum );
+	} //end for
+
+	const std::string key = PC_TokenCacheKey( cache.filename.c_str() );
+	std::shared_ptr<const TokenStream> stream( cache.record.release() );
+	tokenCache[key] = stream;
+
+	std::vector<uint8_t> data;
+	stream->write( data );
+	FS_WriteFile( PC_TokenCachePath( key ).c_str(), data.data(), data.size() );
+} //end of the function PC_StoreTokenStream
+
 int PC_LoadSourceHandle( const char *filename ) {
 	source_t *source;
 	int i;
 
 	for ( i = 1; i < MAX_SOURCEFILES; i++ )
 	{
-		if ( !sourceFiles[i] ) {
+		if ( !sourceFiles[i] && !sourceCache[i].replay ) {
 			break;
 		}
 	} //end for
 	if ( i >= MAX_SOURCEFILES ) {
 		return 0;
 	}
+	if ( !pc_tokenCache ) {
+		pc_tokenCache = Cvar_Get( "pc_tokenCache", "1", 0 );
+	}
+
+	sourceCache_t &cache = sourceCache[i];
+	cache.filename = filename;
+	if ( pc_tokenCache->integer ) {
+		cache.replay = PC_FindTokenStream( filename );
+		if ( cache.replay ) {
+			cache.next = 0;
+			return i;
+		}
+	}
+
 	PS_SetBaseFolder( "" );
 	source = LoadSourceFile( filename );
 	if ( !source ) {
 		return 0;
 	}
 	sourceFiles[i] = source;
+	if ( pc_tokenCache->integer ) {
+		cache.record.reset( new TokenStream );
+		cache.record->setDefines( PC_GlobalDefinesChecksum() );
+		cache.scripts.assign( 1, filename );
+		cache.complete = false;
+		cache.messages = sourceMessages;
+	}
 	return i;
 } //end of the function PC_LoadSourceHandle
 //============================================================================
@@ -2759,13 +2934,30 @@ int PC_LoadSourceHandle( const char *filename ) {
 // Changes Globals:		-
 //============================================================================
 int PC_FreeSourceHandle( int handle ) {
+	pc_token_t token;
+
 	if ( handle < 1 || handle >= MAX_SOURCEFILES ) {
 		return false;
 	}
+	sourceCache_t &cache = sourceCache[handle];
+	if ( cache.replay ) {
+		cache.replay.reset();
+		return true;
+	}
 	if ( !sourceFiles[handle] ) {
 		return false;
 	}
 
+	if ( cache.record ) {
+		//the rest of the source, which whoever loads it next may read
+		while ( !cache.complete && PC_ReadTokenHandle( handle, &token ) )
+		{
+		} //end while
+		PC_StoreTokenStream( cache );
+		cache.record.reset();
+		cache.scripts.clear();
+	}
+
 	FreeSource( sourceFiles[handle] );
 	sourceFiles[handle] = nullptr;
 	return true;
@@ -2778,16 +2970,32 @@ int PC_FreeSourceHandle( int handle ) {
 //============================================================================
 int PC_ReadTokenHandle( int handle, pc_token_t *pc_token ) {
 	token_t token;
+	source_t *source;
 	int ret;
 
 	if ( handle < 1 || handle >= MAX_SOURCEFILES ) {
 		return 0;
 	}
-	if ( !sourceFiles[handle] ) {
+	sourceCache_t &cache = sourceCache[handle];
+	if ( cache.replay ) {
+		if ( cache.next >= cache.replay->size() ) {
+			pc_token->string[0] = 0;
+			return 0;
+		}
+		const TokenStream::Token &t = cache.replay->token( cache.next++ );
+		strcpy( pc_token->string, cache.replay->string( t ) );
+		pc_token->type = t.type;
+		pc_token->subtype = t.subtype;
+		pc_token->intvalue = t.intvalue;
+		pc_token->floatvalue = t.floatvalue;
+		return 1;
+	}
+	source = sourceFiles[handle];
+	if ( !source ) {
 		return 0;
 	}
 
-	ret = PC_ReadToken( sourceFiles[handle], &token );
+	ret = PC_ReadToken( source, &token );
 	strcpy( pc_token->string, token.string );
 	pc_token->type = token.type;
 	pc_token->subtype = token.subtype;
@@ -2796,6 +3004,15 @@ int PC_ReadTokenHandle( int handle, pc_token_t *pc_token ) {
 	if ( pc_token->type == TT_STRING ) {
 		StripDoubleQuotes( pc_token->string );
 	}
+
+	if ( cache.record && !cache.complete ) {
+		if ( ret ) {
+			cache.record->add( pc_token->type, pc_token->subtype, pc_token->intvalue, pc_token->floatvalue,
+							   source->scriptstack ? source->scriptstack->line : 0, pc_token->string );
+		} else {
+			cache.complete = true;
+		}
+	}
 	return ret;
 } //end of the function PC_ReadTokenHandle
 
@@ -2803,6 +3020,12 @@ int PC_SourceFileAndLine( int handle, char *filename, int *line ) {
 	if ( handle < 1 || handle >= MAX_SOURCEFILES ) {
 		return false;
 	}
+	sourceCache_t &cache = sourceCache[handle];
+	if ( cache.replay ) {
+		strcpy( filename, cache.filename.c_str() );
+		*line = cache.next ? cache.replay->token( cache.next - 1 ).line : 0;
+		return true;
+	}
 	if ( !sourceFiles[handle] ) {
 		return false;
 	}
@@ -2833,5 +3056,8 @@ void PC_CheckOpenSourceHandles( void ) {
 		if ( sourceFiles[i] ) {
 			BotImport_Print( PRT_ERROR, "file %s still open in precompiler\n", sourceFiles[i]->scriptstack->filename );
 		} //end if
+		else if ( sourceCache[i].replay ) {
+			BotImport_Print( PRT_ERROR, "file %s still open in precompiler\n", sourceCache[i].filename.c_str() );
+		} //end else if
 	} //end for
 }
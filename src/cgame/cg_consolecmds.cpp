@@ -256,6 +256,8 @@ static consoleCommand_t commands[] = {
 	{ "camera", CG_Camera_f },   // duffy
 	{ "fade", CG_Fade_f },   // duffy
 
+	{ "predictbench", CG_PredictBench_f },
+
 };
 
 
@@ -178,6 +178,38 @@ static float CG_DrawTimer( float y ) {
 }
 
 
+/*
+=================
+CG_DrawPoolStats
+
+cg_drawPoolStats: usage of the fixed size effect pools
+=================
+*/
+static float CG_DrawPoolStats( float y ) {
+	static const struct {
+		const char *name;
+		const FixedPoolStats *( *stats )( void );
+	} pools[] = {
+		{ "localents", CG_LocalEntityPoolStats },
+		{ "marks", CG_MarkPoolStats },
+		{ "trails", CG_TrailPoolStats },
+		{ "flames", CG_FlameChunkPoolStats },
+	};
+
+	for ( int i = 0 ; i < (int)( sizeof( pools ) / sizeof( pools[0] ) ) ; i++ ) {
+		const FixedPoolStats *ps = pools[i].stats();
+		char *s = va( "%-9s %4i/%-4i hi:%4i steal:%i fail:%i", pools[i].name,
+					  ps->count, ps->capacity, ps->highWater, ps->steals, ps->failures );
+		int w = CG_DrawStrlen( s ) * SMALLCHAR_WIDTH;
+
+		CG_DrawSmallString( UPPERRIGHT_X - w, y + 2, s, 1.0F );
+		y += SMALLCHAR_HEIGHT + 2;
+	}
+
+	return y + 2;
+}
+
+
 /*
 =====================
 CG_DrawUpperRight
@@ -197,6 +229,9 @@ static void CG_DrawUpperRight( void )
 	if ( cg_drawTimer.integer ) {
 		y = CG_DrawTimer( y );
 	}
+	if ( cg_drawPoolStats.integer ) {
+		y = CG_DrawPoolStats( y );
+	}
 }
 
 
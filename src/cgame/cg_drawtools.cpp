@@ -332,19 +332,46 @@ void CG_DrawChar2( int x, int y, int width, int height, int ch ) {
 						   cgs.media.menucharsetShader );
 }
 
-// JOSEPH 4-25-00
 /*
 ==================
-CG_DrawStringExt
+CG_AddCharQuad
 
-Draws a multi-colored string with a drop shadow, optionally forcing
-to a fixed color.
+Adds a character of a 16x16 charset to a batch, like CG_DrawChar
+==================
+*/
+static void CG_AddCharQuad( textBatch_t &batch, int x, int y, int width, int height, int ch,
+							qhandle_t charset, const float *color ) {
+	float frow, fcol;
+	float ax, ay, aw, ah;
 
-Coordinates are at 640 by 480 virtual resolution
+	ch &= 255;
+
+	if ( ch == ' ' ) {
+		return;
+	}
+
+	ax = x;
+	ay = y;
+	aw = width;
+	ah = height;
+	CG_AdjustFrom640( &ax, &ay, &aw, &ah );
+
+	frow = ( ch >> 4 ) * 0.0625;
+	fcol = ( ch & 15 ) * 0.0625;
+
+	batch.add( charset, ax, ay, aw, ah, fcol, frow, fcol + 0.0625, frow + 0.0625, color );
+}
+
+/*
+==================
+CG_DrawCharsetString
+
+The drop shadow and the text of a string in one batch, see CG_DrawStringExt
 ==================
 */
-void CG_DrawStringExt( int x, int y, const char *string, const float *setColor,
-					   bool forceColor, bool shadow, int charWidth, int charHeight, int maxChars ) {
+static void CG_DrawCharsetString( int x, int y, const char *string, const float *setColor,
+								  bool forceColor, bool shadow, int charWidth, int charHeight, int maxChars, qhandle_t charset ) {
+	textBatch_t batch( trap_R_DrawStretchQuads );
 	vec4_t color;
 	const char *s;
 	int xx;
@@ -358,7 +385,6 @@ void CG_DrawStringExt( int x, int y, const char *string, const float *setColor,
 	if ( shadow ) {
 		color[0] = color[1] = color[2] = 0;
 		color[3] = setColor[3];
-		RE_SetColor( color );
 		s = string;
 		xx = x;
 		cnt = 0;
@@ -367,7 +393,7 @@ void CG_DrawStringExt( int x, int y, const char *string, const float *setColor,
 				s += 2;
 				continue;
 			}
-			CG_DrawChar( xx + 2, y + 2, charWidth, charHeight, *s );
+			CG_AddCharQuad( batch, xx + 2, y + 2, charWidth, charHeight, *s, charset, color );
 			cnt++;
 			xx += charWidth;
 			s++;
@@ -378,25 +404,41 @@ void CG_DrawStringExt( int x, int y, const char *string, const float *setColor,
 	s = string;
 	xx = x;
 	cnt = 0;
-	RE_SetColor( setColor );
+	Vector4Copy( setColor, color );
 	while ( *s && cnt < maxChars ) {
 		if ( Q_IsColorString( s ) ) {
 			if ( !forceColor ) {
 				memcpy( color, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( color ) );
 				color[3] = setColor[3];
-				RE_SetColor( color );
 			}
 			s += 2;
 			continue;
 		}
-		CG_DrawChar( xx, y, charWidth, charHeight, *s );
+		CG_AddCharQuad( batch, xx, y, charWidth, charHeight, *s, charset, color );
 		xx += charWidth;
 		cnt++;
 		s++;
 	}
+	batch.flush();
 	RE_SetColor( nullptr );
 }
 
+// JOSEPH 4-25-00
+/*
+==================
+CG_DrawStringExt
+
+Draws a multi-colored string with a drop shadow, optionally forcing
+to a fixed color.
+
+Coordinates are at 640 by 480 virtual resolution
+==================
+*/
+void CG_DrawStringExt( int x, int y, const char *string, const float *setColor,
+					   bool forceColor, bool shadow, int charWidth, int charHeight, int maxChars ) {
+	CG_DrawCharsetString( x, y, string, setColor, forceColor, shadow, charWidth, charHeight, maxChars, cgs.media.charsetShader );
+}
+
 /*==================
 CG_DrawStringExt2
 
@@ -408,56 +450,7 @@ Coordinates are at 640 by 480 virtual resolution
 */
 void CG_DrawStringExt2( int x, int y, const char *string, const float *setColor,
 						bool forceColor, bool shadow, int charWidth, int charHeight, int maxChars ) {
-	vec4_t color;
-	const char *s;
-	int xx;
-	int cnt;
-
-	if ( maxChars <= 0 ) {
-		maxChars = 32767; // do them all!
-
-	}
-	// draw the drop shadow
-	if ( shadow ) {
-		color[0] = color[1] = color[2] = 0;
-		color[3] = setColor[3];
-		RE_SetColor( color );
-		s = string;
-		xx = x;
-		cnt = 0;
-		while ( *s && cnt < maxChars ) {
-			if ( Q_IsColorString( s ) ) {
-				s += 2;
-				continue;
-			}
-			CG_DrawChar2( xx + 2, y + 2, charWidth, charHeight, *s );
-			cnt++;
-			xx += charWidth;
-			s++;
-		}
-	}
-
-	// draw the colored text
-	s = string;
-	xx = x;
-	cnt = 0;
-	RE_SetColor( setColor );
-	while ( *s && cnt < maxChars ) {
-		if ( Q_IsColorString( s ) ) {
-			if ( !forceColor ) {
-				memcpy( color, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( color ) );
-				color[3] = setColor[3];
-				RE_SetColor( color );
-			}
-			s += 2;
-			continue;
-		}
-		CG_DrawChar2( xx, y, charWidth, charHeight, *s );
-		xx += charWidth;
-		cnt++;
-		s++;
-	}
-	RE_SetColor( nullptr );
+	CG_DrawCharsetString( x, y, string, setColor, forceColor, shadow, charWidth, charHeight, maxChars, cgs.media.menucharsetShader );
 }
 
 /*==================
@@ -471,69 +464,14 @@ Coordinates are at 640 by 480 virtual resolution
 */
 void CG_DrawStringExt3( int x, int y, const char *string, const float *setColor,
 						bool forceColor, bool shadow, int charWidth, int charHeight, int maxChars ) {
-	vec4_t color;
 	const char *s;
-	int xx;
-	int cnt;
-
-	if ( maxChars <= 0 ) {
-		maxChars = 32767; // do them all!
-
-	}
-	s = string;
-	xx = 0;
-
-	while ( *s ) {
-		xx += charWidth;
-		s++;
-	}
-
-	x -= xx;
-
-	s = string;
-	xx = x;
 
-	// draw the drop shadow
-	if ( shadow ) {
-		color[0] = color[1] = color[2] = 0;
-		color[3] = setColor[3];
-		RE_SetColor( color );
-		s = string;
-		xx = x;
-		cnt = 0;
-		while ( *s && cnt < maxChars ) {
-			if ( Q_IsColorString( s ) ) {
-				s += 2;
-				continue;
-			}
-			CG_DrawChar2( xx + 2, y + 2, charWidth, charHeight, *s );
-			cnt++;
-			xx += charWidth;
-			s++;
-		}
+	// right aligned
+	for ( s = string; *s; s++ ) {
+		x -= charWidth;
 	}
 
-	// draw the colored text
-	s = string;
-	xx = x;
-	cnt = 0;
-	RE_SetColor( setColor );
-	while ( *s && cnt < maxChars ) {
-		if ( Q_IsColorString( s ) ) {
-			if ( !forceColor ) {
-				memcpy( color, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( color ) );
-				color[3] = setColor[3];
-				RE_SetColor( color );
-			}
-			s += 2;
-			continue;
-		}
-		CG_DrawChar2( xx, y, charWidth, charHeight, *s );
-		xx += charWidth;
-		cnt++;
-		s++;
-	}
-	RE_SetColor( nullptr );
+	CG_DrawCharsetString( x, y, string, setColor, forceColor, shadow, charWidth, charHeight, maxChars, cgs.media.menucharsetShader );
 }
 
 
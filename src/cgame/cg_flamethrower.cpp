@@ -43,7 +43,6 @@ If you have questions concerning this license or the applicable additional terms
 // merged so that less overdraw occurs
 typedef struct flameChunk_s
 {
-	struct flameChunk_s *nextGlobal, *prevGlobal;   // next junction in the global list it is in (free or used)
 	struct flameChunk_s *nextFlameChunk;            // next junction in the trail
 	struct flameChunk_s *nextHead, *prevHead;       // next head junc in the world
 
@@ -77,13 +76,11 @@ typedef struct flameChunk_s
 } flameChunk_t;
 
 #define MAX_FLAME_CHUNKS    2048
-static flameChunk_t flameChunks[MAX_FLAME_CHUNKS];
-static flameChunk_t *freeFlameChunks, *activeFlameChunks, *headFlameChunks;
+static FixedPool<flameChunk_t, MAX_FLAME_CHUNKS> flameChunks;
+static flameChunk_t *headFlameChunks;
 
 static bool initFlameChunks = false;
 
-static int numFlameChunksInuse;
-
 // this structure stores information relevant to each cent in the game, this way we keep
 // the flamethrower data seperate to the rest of the code, which helps if we decide against
 // using this weapon in the game
@@ -466,31 +463,21 @@ CG_ClearFlameChunks
 ===============
 */
 void CG_ClearFlameChunks( void ) {
-	int i;
-
-	memset( flameChunks, 0, sizeof( flameChunks ) );
 	memset( centFlameInfo, 0, sizeof( centFlameInfo ) );
 
-	freeFlameChunks = flameChunks;
-	activeFlameChunks = nullptr;
+	flameChunks.clear();
 	headFlameChunks = nullptr;
 
-	for ( i = 0 ; i < MAX_FLAME_CHUNKS ; i++ )
-	{
-		flameChunks[i].nextGlobal = &flameChunks[i + 1];
-
-		if ( i > 0 ) {
-			flameChunks[i].prevGlobal = &flameChunks[i - 1];
-		} else {
-			flameChunks[i].prevGlobal = nullptr;
-		}
-
-		flameChunks[i].inuse = false;
-	}
-	flameChunks[MAX_FLAME_CHUNKS - 1].nextGlobal = nullptr;
-
 	initFlameChunks = true;
-	numFlameChunksInuse = 0;
+}
+
+/*
+===============
+CG_FlameChunkPoolStats
+===============
+*/
+const FixedPoolStats *CG_FlameChunkPoolStats( void ) {
+	return &flameChunks.getStats();
 }
 
 /*
@@ -501,8 +488,8 @@ CG_SpawnFlameChunk
 flameChunk_t *CG_SpawnFlameChunk( flameChunk_t *headFlameChunk ) {
 	flameChunk_t    *f;
 
-	if ( !freeFlameChunks ) {
-		//CG_ClearFlameChunks();
+	f = flameChunks.alloc();
+	if ( !f ) {
 		return nullptr;
 	}
 
@@ -510,19 +497,6 @@ flameChunk_t *CG_SpawnFlameChunk( flameChunk_t *headFlameChunk ) {
 		headFlameChunks = nullptr;
 	}
 
-	// select the first free trail, and remove it from the list
-	f = freeFlameChunks;
-	freeFlameChunks = f->nextGlobal;
-	if ( freeFlameChunks ) {
-		freeFlameChunks->prevGlobal = nullptr;
-	}
-
-	f->nextGlobal = activeFlameChunks;
-	if ( activeFlameChunks ) {
-		activeFlameChunks->prevGlobal = f;
-	}
-	activeFlameChunks = f;
-	f->prevGlobal = nullptr;
 	f->inuse = true;
 	f->dead = false;
 
@@ -555,11 +529,9 @@ flameChunk_t *CG_SpawnFlameChunk( flameChunk_t *headFlameChunk ) {
 
 	f->nextFlameChunk = headFlameChunk; // if headJunc is nullptr, then we'll just be the end of the list
 
-	numFlameChunksInuse++;
-
 	// debugging
-	if ( cg_drawRewards.integer > 1 && numFlameChunksInuse > cg_drawRewards.integer ) {
-		Com_Printf( "NumFlameChunks: %i\n", numFlameChunksInuse );
+	if ( cg_drawRewards.integer > 1 && flameChunks.count() > cg_drawRewards.integer ) {
+		Com_Printf( "NumFlameChunks: %i\n", flameChunks.count() );
 	}
 
 	return f;
@@ -583,15 +555,6 @@ void CG_FreeFlameChunk( flameChunk_t *f ) {
 	// make it non-active
 	f->inuse = false;
 	f->dead = false;
-	if ( f->nextGlobal ) {
-		f->nextGlobal->prevGlobal = f->prevGlobal;
-	}
-	if ( f->prevGlobal ) {
-		f->prevGlobal->nextGlobal = f->nextGlobal;
-	}
-	if ( f == activeFlameChunks ) {
-		activeFlameChunks = f->nextGlobal;
-	}
 
 	// if it's a head, remove it
 	if ( f == headFlameChunks ) {
@@ -606,15 +569,7 @@ void CG_FreeFlameChunk( flameChunk_t *f ) {
 	f->nextHead = nullptr;
 	f->prevHead = nullptr;
 
-	// stick it in the free list
-	f->prevGlobal = nullptr;
-	f->nextGlobal = freeFlameChunks;
-	if ( freeFlameChunks ) {
-		freeFlameChunks->prevGlobal = f;
-	}
-	freeFlameChunks = f;
-
-	numFlameChunksInuse--;
+	flameChunks.free( f );
 }
 
 /*
@@ -1527,8 +1482,7 @@ void CG_AddFlameChunks( void ) {
 	numClippedFlames = 0;
 
 	// age them
-	f = activeFlameChunks;
-	while ( f ) {
+	for ( f = flameChunks.first() ; f ; f = flameChunks.next() ) {
 		if ( !f->dead ) {
 			if ( cg.time > f->timeEnd ) {
 				f->dead = true;
@@ -1547,7 +1501,6 @@ void CG_AddFlameChunks( void ) {
 				f->lifeFrac = (float)( f->baseOrgTime - f->timeStart ) / (float)( f->timeEnd - f->timeStart );
 			}
 		}
-		f = f->nextGlobal;
 	}
 
 	// draw each of the headFlameChunk's
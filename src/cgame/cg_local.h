@@ -44,6 +44,7 @@ If you have questions concerning this license or the applicable additional terms
 #include "tr_types.h"
 #include "../game/bg_public.h"
 #include "cg_public.h"
+#include "../qcommon/fixed_pool.h"
 
 
 #define POWERUP_BLINKS      5
@@ -349,7 +350,6 @@ typedef struct centity_s {
 // and live independantly from all server transmitted entities
 
 typedef struct markPoly_s {
-	struct markPoly_s   *prevMark, *nextMark;
 	int time;
 	qhandle_t markShader;
 	bool alphaFade;         // fade alpha instead of rgb
@@ -427,7 +427,6 @@ typedef enum {
 #define MAX_OLD_POS     3
 
 typedef struct localEntity_s {
-	struct localEntity_s    *prev, *next;
 	leType_t leType;
 	int leFlags;
 
@@ -1547,7 +1546,6 @@ extern cg_t cg;
 extern centity_t cg_entities[MAX_GENTITIES];
 extern weaponInfo_t cg_weapons[MAX_WEAPONS];
 extern itemInfo_t cg_items[MAX_ITEMS];
-extern markPoly_t cg_markPolys[MAX_MARK_POLYS];
 
 extern vmCvar_t cg_centertime;
 extern vmCvar_t cg_runpitch;
@@ -1559,6 +1557,7 @@ extern vmCvar_t cg_swingSpeed;
 extern vmCvar_t cg_shadows;
 extern vmCvar_t cg_gibs;
 extern vmCvar_t cg_drawTimer;
+extern vmCvar_t cg_drawPoolStats;
 extern vmCvar_t cg_drawFPS;
 extern vmCvar_t cg_drawSnapshot;
 extern vmCvar_t cg_draw3dIcons;
@@ -1593,6 +1592,8 @@ extern vmCvar_t cg_errorDecay;
 extern vmCvar_t cg_nopredict;
 extern vmCvar_t cg_noPlayerAnims;
 extern vmCvar_t cg_showmiss;
+extern vmCvar_t cg_predictGrid;
+extern vmCvar_t cg_predictCache;
 extern vmCvar_t cg_footsteps;
 extern vmCvar_t cg_markTime;
 extern vmCvar_t cg_brassTime;
@@ -1805,6 +1806,7 @@ void CG_RunMenuScript( char **args );
 
 void CG_Draw3DModel( float x, float y, float w, float h, qhandle_t model, qhandle_t skin, vec3_t origin, vec3_t angles );
 void Text_PaintChar( float x, float y, float scale, glyphInfo_t *glyph );   // FIXME - in ui code
+void Text_AddChar( textBatch_t &batch, float x, float y, float scale, const glyphInfo_t *glyph, const float *color );   // FIXME - in ui code
 void CG_Fade( int r, int g, int b, int a, int time, int duration );
 
 void CG_CalcShakeCamera();
@@ -1832,6 +1834,7 @@ int CG_PointContents( const vec3_t point, int passEntityNum );
 void CG_Trace( trace_t *result, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end,
 			   int skipNumber, int mask );
 void CG_PredictPlayerState( void );
+void CG_PredictBench_f( void );
 
 //
 // cg_events.c
@@ -1930,6 +1933,7 @@ void CG_AddBulletParticles( vec3_t origin, vec3_t dir, int speed, int duration,
 //
 void    CG_InitMarkPolys( void );
 void    CG_AddMarks( void );
+const FixedPoolStats *CG_MarkPoolStats( void );
 void    CG_ImpactMark( qhandle_t markShader,
 					   const vec3_t origin, const vec3_t dir,
 					   float orientation,
@@ -1987,6 +1991,7 @@ int CG_AddSmokeJunc( int headJuncIndex, qhandle_t shader, vec3_t pos, int trailL
 int CG_AddFireJunc( int headJuncIndex, qhandle_t shader, vec3_t pos, int trailLife, float alpha, float startWidth, float endWidth );
 void CG_AddTrails( void );
 void CG_ClearTrails( void );
+const FixedPoolStats *CG_TrailPoolStats( void );
 // done.
 
 // Ridah, sound scripting
@@ -2010,6 +2015,7 @@ void CG_FlameDamage( int owner, vec3_t org, float radius );
 void    CG_InitLocalEntities( void );
 localEntity_t   *CG_AllocLocalEntity( void );
 void    CG_AddLocalEntities( void );
+const FixedPoolStats *CG_LocalEntityPoolStats( void );
 
 //
 // cg_effects.c
@@ -2040,6 +2046,7 @@ localEntity_t *CG_MakeExplosion( vec3_t origin, vec3_t dir,
 void CG_DynamicLightningBolt( qhandle_t shader, vec3_t start, vec3_t pend, int numBolts, float maxWidth, bool fade, float startAlpha, int recursion, int randseed );
 void CG_SparklerSparks( vec3_t origin, int count );
 void CG_ClearFlameChunks( void );
+const FixedPoolStats *CG_FlameChunkPoolStats( void );
 void CG_ProjectedSpotLight( vec3_t start, vec3_t dir );
 // done.
 
@@ -2189,6 +2196,7 @@ void        trap_R_DrawStretchPic( float x, float y, float w, float h,
 								   float s1, float t1, float s2, float t2, qhandle_t hShader );
 void        trap_R_DrawStretchPicGradient( float x, float y, float w, float h,
 										   float s1, float t1, float s2, float t2, qhandle_t hShader, const float *gradientColor, int gradientType );
+void        trap_R_DrawStretchQuads( qhandle_t hShader, const stretchQuad_t *quads, int numQuads );
 
 void        trap_R_ModelBounds( clipHandle_t model, vec3_t mins, vec3_t maxs );
 int         trap_R_LerpTag( orientation_t *tag, const refEntity_t *refent, const char *tagName, int startIndex );
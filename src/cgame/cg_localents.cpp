@@ -40,12 +40,7 @@ If you have questions concerning this license or the applicable additional terms
 									// overwriting game entities
 // done.
 
-localEntity_t cg_localEntities[MAX_LOCAL_ENTITIES];
-localEntity_t cg_activeLocalEntities;       // double linked list
-localEntity_t   *cg_freeLocalEntities;      // single linked list
-
-// Ridah, debugging
-int localEntCount = 0;
+static FixedPool<localEntity_t, MAX_LOCAL_ENTITIES> cg_localEntities;
 
 /*
 ===================
@@ -55,18 +50,7 @@ This is called at startup and for tournement restarts
 ===================
 */
 void    CG_InitLocalEntities( void ) {
-	int i;
-
-	memset( cg_localEntities, 0, sizeof( cg_localEntities ) );
-	cg_activeLocalEntities.next = &cg_activeLocalEntities;
-	cg_activeLocalEntities.prev = &cg_activeLocalEntities;
-	cg_freeLocalEntities = cg_localEntities;
-	for ( i = 0 ; i < MAX_LOCAL_ENTITIES - 1 ; i++ ) {
-		cg_localEntities[i].next = &cg_localEntities[i + 1];
-	}
-
-	// Ridah, debugging
-	localEntCount = 0;
+	cg_localEntities.clear();
 }
 
 
@@ -76,21 +60,12 @@ CG_FreeLocalEntity
 ==================
 */
 void CG_FreeLocalEntity( localEntity_t *le ) {
-	if ( !le->prev ) {
+	if ( !cg_localEntities.isActive( le ) ) {
 		Com_Error( ERR_DROP, "CG_FreeLocalEntity: not active" );
         return;  // Keep linter happy. ERR_DROP does not return
 	}
 
-	// Ridah, debugging
-	localEntCount--;
-
-	// remove from the doubly linked active list
-	le->prev->next = le->next;
-	le->next->prev = le->prev;
-
-	// the free list is only singly linked
-	le->next = cg_freeLocalEntities;
-	cg_freeLocalEntities = le;
+	cg_localEntities.free( le );
 }
 
 /*
@@ -103,28 +78,27 @@ Will allways succeed, even if it requires freeing an old active entity
 localEntity_t   *CG_AllocLocalEntity( void ) {
 	localEntity_t   *le;
 
-	if ( !cg_freeLocalEntities ) {
-		// no free entities, so free the one at the end of the chain
-		// remove the oldest active entity
-		CG_FreeLocalEntity( cg_activeLocalEntities.prev );
+	if ( cg_localEntities.full() ) {
+		// no free entities, so remove the oldest active entity
+		cg_localEntities.steal( cg_localEntities.oldest() );
 	}
 
-	// Ridah, debugging
-	localEntCount++;
-
-	le = cg_freeLocalEntities;
-	cg_freeLocalEntities = cg_freeLocalEntities->next;
+	le = cg_localEntities.alloc();
 
 	memset( le, 0, sizeof( *le ) );
 
-	// link into the active list
-	le->next = cg_activeLocalEntities.next;
-	le->prev = &cg_activeLocalEntities;
-	cg_activeLocalEntities.next->prev = le;
-	cg_activeLocalEntities.next = le;
 	return le;
 }
 
+/*
+===================
+CG_LocalEntityPoolStats
+===================
+*/
+const FixedPoolStats *CG_LocalEntityPoolStats( void ) {
+	return &cg_localEntities.getStats();
+}
+
 
 /*
 ====================================================================================
@@ -1688,18 +1662,13 @@ CG_AddLocalEntities
 ===================
 */
 void CG_AddLocalEntities( void ) {
-	localEntity_t   *le, *next;
+	localEntity_t   *le;
 
 	cg.viewFade = 0.0;
 
-	// walk the list backwards, so any new local entities generated
+	// walk from the oldest, so any new local entities generated
 	// (trails, marks, etc) will be present this frame
-	le = cg_activeLocalEntities.prev;
-	for ( ; le != &cg_activeLocalEntities ; le = next ) {
-		// grab next now, so if the local entity is freed we
-		// still have it
-		next = le->prev;
-
+	for ( le = cg_localEntities.first() ; le ; le = cg_localEntities.next() ) {
 		if ( cg.time >= le->endTime ) {
 			CG_FreeLocalEntity( le );
 			continue;
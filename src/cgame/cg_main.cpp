@@ -66,6 +66,7 @@ vmCvar_t cg_swingSpeed;
 vmCvar_t cg_shadows;
 vmCvar_t cg_gibs;
 vmCvar_t cg_drawTimer;
+vmCvar_t cg_drawPoolStats;
 vmCvar_t cg_drawFPS;
 vmCvar_t cg_drawSnapshot;
 vmCvar_t cg_draw3dIcons;
@@ -99,6 +100,8 @@ vmCvar_t cg_errorDecay;
 vmCvar_t cg_nopredict;
 vmCvar_t cg_noPlayerAnims;
 vmCvar_t cg_showmiss;
+vmCvar_t cg_predictGrid;
+vmCvar_t cg_predictCache;
 vmCvar_t cg_footsteps;
 vmCvar_t cg_markTime;
 vmCvar_t cg_brassTime;
@@ -240,6 +243,7 @@ static cvarTable_t cvarTable[] = {
 	{ &cg_drawFrags, "cg_drawFrags", "1", CVAR_ARCHIVE },
 	{ &cg_drawStatus, "cg_drawStatus", "1", CVAR_ARCHIVE  },
 	{ &cg_drawTimer, "cg_drawTimer", "0", CVAR_ARCHIVE  },
+	{ &cg_drawPoolStats, "cg_drawPoolStats", "0", 0 },
 	{ &cg_drawFPS, "cg_drawFPS", "0", CVAR_ARCHIVE  },
 	{ &cg_drawSnapshot, "cg_drawSnapshot", "0", CVAR_ARCHIVE  },
 	{ &cg_draw3dIcons, "cg_draw3dIcons", "1", CVAR_ARCHIVE  },
@@ -304,6 +308,8 @@ static cvarTable_t cvarTable[] = {
 	{ &cg_nopredict, "cg_nopredict", "0", 0 },
 	{ &cg_noPlayerAnims, "cg_noplayeranims", "0", CVAR_CHEAT },
 	{ &cg_showmiss, "cg_showmiss", "0", 0 },
+	{ &cg_predictGrid, "cg_predictGrid", "1", 0 },
+	{ &cg_predictCache, "cg_predictCache", "1", 0 },    // 2 = validate against full replay
 	{ &cg_footsteps, "cg_footsteps", "1", CVAR_CHEAT },
 	{ &cg_tracerChance, "cg_tracerchance", "0.4", CVAR_CHEAT },
 	{ &cg_tracerWidth, "cg_tracerwidth", "0.8", CVAR_CHEAT },
@@ -377,6 +383,9 @@ static cvarTable_t cvarTable[] = {
 };
 static int cvarTableSize = sizeof( cvarTable ) / sizeof( cvarTable[0] );
 
+// cvar_modificationCount as of the last full update of the cvar table
+static int cvarModificationCount = -1;
+
 /*
 =================
 CG_RegisterCvars
@@ -387,6 +396,8 @@ void CG_RegisterCvars( void ) {
 	cvarTable_t *cv;
 	char var[MAX_TOKEN_CHARS];
 
+	cvarModificationCount = -1;
+
 	Cvar_Set( "cg_letterbox", "0" ); // force this for people who might have it in their
 
 	for ( i = 0, cv = cvarTable ; i < cvarTableSize ; i++, cv++ ) {
@@ -409,6 +420,12 @@ void CG_UpdateCvars( void ) {
 	int i;
 	cvarTable_t *cv;
 
+	// no cvar has changed since the last update
+	if ( cvarModificationCount == cvar_modificationCount ) {
+		return;
+	}
+	cvarModificationCount = cvar_modificationCount;
+
 	for ( i = 0, cv = cvarTable ; i < cvarTableSize ; i++, cv++ ) {
 		Cvar_Update( cv->vmCvar );
 	}
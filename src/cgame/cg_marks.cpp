@@ -40,9 +40,7 @@ MARK POLYS
 */
 
 
-markPoly_t cg_activeMarkPolys;          // double linked list
-markPoly_t  *cg_freeMarkPolys;          // single linked list
-markPoly_t cg_markPolys[MAX_MARK_POLYS];
+static FixedPool<markPoly_t, MAX_MARK_POLYS> cg_markPolys;
 
 /*
 ===================
@@ -53,18 +51,7 @@ This is called at startup and for tournement restarts
 */
 void CG_InitMarkPolys()
 {
-	memset( cg_markPolys, 0, sizeof( cg_markPolys ) );
-
-	cg_activeMarkPolys.nextMark = &cg_activeMarkPolys;
-	cg_activeMarkPolys.prevMark = &cg_activeMarkPolys;
-	cg_freeMarkPolys = cg_markPolys;
-	
-	markPoly_t* lasttrav = cg_markPolys;
-	for (int i = 1; i < MAX_MARK_POLYS; i++ ) {
-		markPoly_t* trav = &cg_markPolys[i];
-		lasttrav->nextMark = trav;
-		lasttrav = trav;
-	}
+	cg_markPolys.clear();
 }
 
 
@@ -75,18 +62,12 @@ CG_FreeMarkPoly
 */
 void CG_FreeMarkPoly( markPoly_t *le )
 {
-	if ( !le->prevMark ) {
-		Com_Error( ERR_DROP, "CG_FreeLocalEntity: not active" );
+	if ( !cg_markPolys.isActive( le ) ) {
+		Com_Error( ERR_DROP, "CG_FreeMarkPoly: not active" );
         return;  // Keep linter happy. ERR_DROP does not return
 	}
 
-	// remove from the doubly linked active list
-	le->prevMark->nextMark = le->nextMark;
-	le->nextMark->prevMark = le->prevMark;
-
-	// the free list is only singly linked
-	le->nextMark = cg_freeMarkPolys;
-	cg_freeMarkPolys = le;
+	cg_markPolys.free( le );
 }
 
 /*
@@ -98,34 +79,34 @@ Will allways succeed, even if it requires freeing an old active mark
 */
 markPoly_t  *CG_AllocMark( int endTime )
 {
-	if ( !cg_freeMarkPolys ) {
-		// no free entities, so free the one at the end of the chain
-		// remove the oldest active entity
-		int time = cg_activeMarkPolys.prevMark->time;
-		while ( cg_activeMarkPolys.prevMark && time == cg_activeMarkPolys.prevMark->time ) {
-			CG_FreeMarkPoly( cg_activeMarkPolys.prevMark );
+	if ( cg_markPolys.full() ) {
+		// no free marks, so remove the oldest impact, which may have
+		// left several polys at the same time
+		int time = cg_markPolys.oldest()->time;
+		while ( cg_markPolys.oldest() && time == cg_markPolys.oldest()->time ) {
+			cg_markPolys.steal( cg_markPolys.oldest() );
 		}
 	}
 
-	markPoly_t* le = cg_freeMarkPolys;
-	cg_freeMarkPolys = cg_freeMarkPolys->nextMark;
+	markPoly_t* le = cg_markPolys.alloc();
 
 	memset( le, 0, sizeof( *le ) );
 
 	// Ridah, TODO: sort this, so the list is always sorted by longest duration -> shortest duration,
 	// this way the shortest duration mark will always get overwritten first
-	//for (trav = cg_activeMarkPolys.nextMark; (trav->duration + trav->time > endTime) && (trav != cg_activeMarkPolys.prevMark) ; lastTrav = trav, trav++ ) {
-	// Respect the FOR loop
-	//}
-
-	// link into the active list
-	le->nextMark = cg_activeMarkPolys.nextMark;
-	le->prevMark = &cg_activeMarkPolys;
-	cg_activeMarkPolys.nextMark->prevMark = le;
-	cg_activeMarkPolys.nextMark = le;
 	return le;
 }
 
+/*
+===================
+CG_MarkPoolStats
+===================
+*/
+const FixedPoolStats *CG_MarkPoolStats( void )
+{
+	return &cg_markPolys.getStats();
+}
+
 
 
 /*
@@ -271,18 +252,11 @@ CG_AddMarks
 
 void CG_AddMarks()
 {
-	markPoly_t *next;
-
 	if ( !cg_markTime.integer ) {
 		return;
 	}
 
-	markPoly_t* mp = cg_activeMarkPolys.nextMark;
-	for ( ; mp != &cg_activeMarkPolys ; mp = next ) {
-		// grab next now, so if the local entity is freed we
-		// still have it
-		next = mp->nextMark;
-
+	for ( markPoly_t* mp = cg_markPolys.first() ; mp ; mp = cg_markPolys.next() ) {
 		// see if it is time to completely remove it
 		if ( cg.time > mp->time + mp->duration ) {
 			CG_FreeMarkPoly( mp );
@@ -632,18 +632,18 @@ static void CG_Text_Paint_Limit( float *maxX, float x, float y, int font, float
 		}
 
 		useScale = scale * fnt->glyphScale;
-		RE_SetColor( color );
+		textBatch_t batch( trap_R_DrawStretchQuads );
+		Vector4Copy( color, newColor );
 		len = strlen( text );
 		if ( limit > 0 && len > limit ) {
 			len = limit;
 		}
 		count = 0;
 		while ( s && *s && count < len ) {
-			glyph = &fnt->glyphs[*s];
+			glyph = &fnt->glyphs[(unsigned char)*s];
 			if ( Q_IsColorString( s ) ) {
 				memcpy( newColor, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( newColor ) );
 				newColor[3] = color[3];
-				RE_SetColor( newColor );
 				s += 2;
 				continue;
 			} else {
@@ -652,13 +652,14 @@ static void CG_Text_Paint_Limit( float *maxX, float x, float y, int font, float
 					*maxX = 0;
 					break;
 				}
-				Text_PaintChar( x, y - yadj, useScale, glyph );
+				Text_AddChar( batch, x, y - yadj, useScale, glyph, newColor );
 				x += ( glyph->xSkip * useScale ) + adjust;
 				*maxX = x;
 				count++;
 				s++;
 			}
 		}
+		batch.flush();
 		RE_SetColor( nullptr );
 	}
 }
@@ -38,6 +38,7 @@ If you have questions concerning this license or the applicable additional terms
 #include "../qcommon/cm_public.h"
 #include "../client/client.h"
 #include "../qcommon/clip_model.h"
+#include "../qcommon/spatial_grid.h"
 
 static pmove_t cg_pmove;
 
@@ -46,6 +47,154 @@ static centity_t   *cg_solidEntities[MAX_ENTITIES_IN_SNAPSHOT];
 static int cg_numTriggerEntities;
 static centity_t   *cg_triggerEntities[MAX_ENTITIES_IN_SNAPSHOT];
 
+// broadphase over cg_solidEntities, indexed by position in that list
+static SpatialGrid cg_solidGrid( MAX_ENTITIES_IN_SNAPSHOT );
+static int cg_numEntityClips;   // for predictbench
+
+#define MAX_PREDICT_CACHE_SOLIDS    16
+
+// a non-bmodel solid as CG_ClipMoveToEntities clips against it
+typedef struct {
+	int number;
+	int solid;                  // encoded bbox
+	int capsule;
+	vec3_t origin;              // lerpOrigin
+} predictSolid_t;
+
+// Pmove results by command number, so commands that run on exactly the
+// same PlayerState and inputs as last frame don't need another Pmove
+typedef struct {
+	int cmdNum;
+	int physicsTime;
+	pmove_t pm;                 // inputs before, results after
+	PlayerState before;
+	PlayerState after;
+
+	// bmodels are placed at physicsTime, other solids at their lerpOrigin,
+	// so the ones the Pmove traced through are part of the key too
+	vec3_t traceMins, traceMaxs;
+	int numSolids;              // -1 if there were too many to keep
+	predictSolid_t solids[MAX_PREDICT_CACHE_SOLIDS];
+} predictCache_t;
+
+static predictCache_t cg_predictCacheEntries[CMD_BACKUP];
+static predictCache_t *cg_predictCacheRecording;    // the entry whose Pmove is running
+static int cg_predictCacheHits;
+static int cg_predictCacheMisses;
+static int cg_predictCacheValidated;
+static int cg_predictCacheDivergences;
+
+/*
+====================
+CG_StateSolidBounds
+
+Absolute bounds of one state of a solid entity, exactly as
+CG_ClipMoveToEntities will place it. Returns false if the entity
+can move before the next CG_BuildSolidList.
+====================
+*/
+static bool CG_StateSolidBounds( const EntityState *s, vec3_t absmin, vec3_t absmax ) {
+	if ( ( s->pos.trType != TR_STATIONARY && s->pos.trType != TR_INTERPOLATE )
+		 || ( s->apos.trType != TR_STATIONARY && s->apos.trType != TR_INTERPOLATE ) ) {
+		return false;
+	}
+
+	if ( s->solid == SOLID_BMODEL ) {
+		// CG_ClipMoveToEntities places bmodels by trajectory, CG_PointContents by origin/angles
+		idVec3 mins, maxs;
+		TheClipModel::get().modelBounds( TheClipModel::get().inlineModel( s->modelindex ), mins, maxs );
+		if ( !VectorCompare( s->apos.trBase, vec3_origin ) || !VectorCompare( s->angles, vec3_origin ) ) {
+			// rotated, so use the radius of the model
+			float radius = RadiusFromBounds( mins.ToFloatPtr(), maxs.ToFloatPtr() );
+			VectorSet( mins, -radius, -radius, -radius );
+			VectorSet( maxs, radius, radius, radius );
+		}
+		VectorAdd( s->pos.trBase, mins, absmin );
+		VectorAdd( s->pos.trBase, maxs, absmax );
+		vec3_t p;
+		VectorAdd( s->origin, mins, p );
+		AddPointToBounds( p, absmin, absmax );
+		VectorAdd( s->origin, maxs, p );
+		AddPointToBounds( p, absmin, absmax );
+	} else {
+		// lerpOrigin is adjusted for riding movers and tag parents every frame
+		if ( ( s->groundEntityNum != ENTITYNUM_WORLD && s->groundEntityNum != ENTITYNUM_NONE )
+			 || ( s->eFlags & EF_TAGCONNECT ) ) {
+			return false;
+		}
+
+		int x = ( s->solid & 255 );
+		int zd = ( ( s->solid >> 8 ) & 255 );
+		int zu = ( ( s->solid >> 16 ) & 255 ) - 32;
+
+		absmin[0] = s->pos.trBase[0] - x;
+		absmin[1] = s->pos.trBase[1] - x;
+		absmin[2] = s->pos.trBase[2] - zd;
+		absmax[0] = s->pos.trBase[0] + x;
+		absmax[1] = s->pos.trBase[1] + x;
+		absmax[2] = s->pos.trBase[2] + zu;
+	}
+
+	return true;
+}
+
+/*
+====================
+CG_AddSolidToGrid
+
+The clip code uses currentState while lerpOrigin moves between
+currentState and nextState, so the grid bounds cover both.
+====================
+*/
+static void CG_AddSolidToGrid( int index ) {
+	centity_t *cent = cg_solidEntities[index];
+	vec3_t mins, maxs, nextMins, nextMaxs;
+
+	if ( !CG_StateSolidBounds( &cent->nextState, nextMins, nextMaxs ) ) {
+		cg_solidGrid.insertAlways( index );
+		return;
+	}
+
+	if ( cent->currentValid ) {
+		if ( !CG_StateSolidBounds( &cent->currentState, mins, maxs ) ) {
+			cg_solidGrid.insertAlways( index );
+			return;
+		}
+		AddPointToBounds( nextMins, mins, maxs );
+		AddPointToBounds( nextMaxs, mins, maxs );
+	} else {
+		VectorCopy( nextMins, mins );
+		VectorCopy( nextMaxs, maxs );
+	}
+
+	// slack for float error in the trajectory evaluation
+	for ( int i = 0 ; i < 3 ; i++ ) {
+		mins[i] -= 1;
+		maxs[i] += 1;
+	}
+
+	cg_solidGrid.insert( index, mins, maxs );
+}
+
+/*
+====================
+CG_SolidCandidates
+
+Fills list with the indexes into cg_solidEntities that may touch
+the given box, in ascending order.
+====================
+*/
+static int CG_SolidCandidates( const vec3_t mins, const vec3_t maxs, int *list ) {
+	if ( !cg_predictGrid.integer ) {
+		for ( int i = 0 ; i < cg_numSolidEntities ; i++ ) {
+			list[i] = i;
+		}
+		return cg_numSolidEntities;
+	}
+
+	return cg_solidGrid.query( mins, maxs, list, MAX_ENTITIES_IN_SNAPSHOT );
+}
+
 /*
 ====================
 CG_BuildSolidList
@@ -91,6 +240,11 @@ void CG_BuildSolidList( void ) {
 			continue;
 		}
 	}
+
+	cg_solidGrid.clear();
+	for ( i = 0 ; i < cg_numSolidEntities ; i++ ) {
+		CG_AddSolidToGrid( i );
+	}
 }
 
 /*
@@ -108,9 +262,24 @@ static void CG_ClipMoveToEntities( const vec3_t start, const vec3_t mins, const
 	vec3_t bmins, bmaxs;
 	vec3_t origin, angles;
 	centity_t   *cent;
+	vec3_t moveMins, moveMaxs;
+	int candidates[MAX_ENTITIES_IN_SNAPSHOT];
+	int numCandidates;
 
-	for ( i = 0 ; i < cg_numSolidEntities ; i++ ) {
-		cent = cg_solidEntities[ i ];
+	// bounds of the whole move
+	for ( i = 0 ; i < 3 ; i++ ) {
+		moveMins[i] = std::min( start[i], end[i] ) + mins[i] - 1;
+		moveMaxs[i] = std::max( start[i], end[i] ) + maxs[i] + 1;
+	}
+	numCandidates = CG_SolidCandidates( moveMins, moveMaxs, candidates );
+
+	if ( cg_predictCacheRecording ) {
+		AddPointToBounds( moveMins, cg_predictCacheRecording->traceMins, cg_predictCacheRecording->traceMaxs );
+		AddPointToBounds( moveMaxs, cg_predictCacheRecording->traceMins, cg_predictCacheRecording->traceMaxs );
+	}
+
+	for ( i = 0 ; i < numCandidates ; i++ ) {
+		cent = cg_solidEntities[ candidates[ i ] ];
 		ent = &cent->currentState;
 
 		if ( ent->number == skipNumber ) {
@@ -147,6 +316,8 @@ static void CG_ClipMoveToEntities( const vec3_t start, const vec3_t mins, const
 			VectorCopy( vec3_origin, angles );
 			VectorCopy( cent->lerpOrigin, origin );
 		}
+		cg_numEntityClips++;
+
 		// MrE: use bbox of capsule
 		if ( capsule ) {
 			CM_TransformedBoxTrace( &trace, start, end,
@@ -213,13 +384,16 @@ int     CG_PointContents( const vec3_t point, int passEntityNum ) {
 	centity_t   *cent;
 	clipHandle_t cmodel;
 	int contents;
+	int candidates[MAX_ENTITIES_IN_SNAPSHOT];
+	int numCandidates;
 
 	ClipModel& clipModel = TheClipModel::get();
 
 	contents = CM_PointContents( point, 0 );
 
-	for ( i = 0 ; i < cg_numSolidEntities ; i++ ) {
-		cent = cg_solidEntities[ i ];
+	numCandidates = CG_SolidCandidates( point, point, candidates );
+	for ( i = 0 ; i < numCandidates ; i++ ) {
+		cent = cg_solidEntities[ candidates[ i ] ];
 
 		ent = &cent->currentState;
 
@@ -469,6 +643,169 @@ static void CG_TouchTriggerPrediction()
 
 
 
+/*
+=================
+CG_PredictCacheSolids
+
+Lists the non-bmodel solids inside the bounds of the traces of a Pmove,
+as they are now. Returns -1 if there are more than an entry keeps.
+=================
+*/
+static int CG_PredictCacheSolids( const vec3_t mins, const vec3_t maxs, int skipNumber, predictSolid_t *solids ) {
+	int candidates[MAX_ENTITIES_IN_SNAPSHOT];
+	int numCandidates;
+	int count;
+
+	// nothing was traced
+	if ( mins[0] > maxs[0] ) {
+		return 0;
+	}
+
+	count = 0;
+	numCandidates = CG_SolidCandidates( mins, maxs, candidates );
+	for ( int i = 0 ; i < numCandidates ; i++ ) {
+		centity_t *cent = cg_solidEntities[ candidates[ i ] ];
+		EntityState *ent = &cent->currentState;
+
+		// skipped the same way CG_ClipMoveToEntities skips them
+		if ( ent->solid == SOLID_BMODEL || ent->number == skipNumber ) {
+			continue;
+		}
+		if ( ent->eType == ET_PROP && ent->otherEntityNum == skipNumber + 1 ) {
+			continue;
+		}
+
+		int x = ( ent->solid & 255 );
+		int zd = ( ( ent->solid >> 8 ) & 255 );
+		int zu = ( ( ent->solid >> 16 ) & 255 ) - 32;
+		if ( cent->lerpOrigin[0] + x < mins[0] || cent->lerpOrigin[0] - x > maxs[0]
+			 || cent->lerpOrigin[1] + x < mins[1] || cent->lerpOrigin[1] - x > maxs[1]
+			 || cent->lerpOrigin[2] + zu < mins[2] || cent->lerpOrigin[2] - zd > maxs[2] ) {
+			continue;
+		}
+
+		if ( count == MAX_PREDICT_CACHE_SOLIDS ) {
+			return -1;
+		}
+		solids[count].number = ent->number;
+		solids[count].solid = ent->solid;
+		solids[count].capsule = ( ent->eFlags & EF_CAPSULE ) != 0;
+		VectorCopy( cent->lerpOrigin, solids[count].origin );
+		count++;
+	}
+
+	return count;
+}
+
+/*
+=================
+CG_PredictCacheMatches
+
+True if the cached Pmove was run from the same PlayerState
+with the same inputs as cg_pmove holds now
+=================
+*/
+static bool CG_PredictCacheMatches( const predictCache_t *entry, int cmdNum ) {
+	const pmove_t *pm = &entry->pm;
+
+	if ( entry->cmdNum != cmdNum || entry->physicsTime != cg.physicsTime ) {
+		return false;
+	}
+
+	if ( pm->tracemask != cg_pmove.tracemask || pm->noFootsteps != cg_pmove.noFootsteps
+		 || pm->noWeapClips != cg_pmove.noWeapClips || pm->gauntletHit != cg_pmove.gauntletHit
+		 || pm->pmove_fixed != cg_pmove.pmove_fixed || pm->pmove_msec != cg_pmove.pmove_msec ) {
+		return false;
+	}
+
+	if ( memcmp( &pm->cmd, &cg_pmove.cmd, sizeof( UserCmd ) )
+		 || memcmp( &pm->oldcmd, &cg_pmove.oldcmd, sizeof( UserCmd ) ) ) {
+		return false;
+	}
+
+	if ( memcmp( &entry->before, cg_pmove.ps, sizeof( PlayerState ) ) ) {
+		return false;
+	}
+
+	// the solids the traces went through are where they were, and no others came in
+	predictSolid_t solids[MAX_PREDICT_CACHE_SOLIDS];
+	int numSolids = CG_PredictCacheSolids( entry->traceMins, entry->traceMaxs, entry->before.clientNum, solids );
+	if ( entry->numSolids < 0 || numSolids != entry->numSolids ) {
+		return false;
+	}
+	return !memcmp( solids, entry->solids, numSolids * sizeof( predictSolid_t ) );
+}
+
+/*
+=================
+CG_CachedPmove
+
+Pmove for cg_predictCache. A command only needs to run again if its
+inputs, the state it starts from or the solids around its traces differ
+from the last time it ran, so usually only the newest command is simulated
+each frame.
+With cg_predictCache 2 every cache hit is also simulated and compared.
+=================
+*/
+static void CG_CachedPmove( int cmdNum ) {
+	predictCache_t *entry = &cg_predictCacheEntries[ cmdNum & CMD_MASK ];
+
+	if ( CG_PredictCacheMatches( entry, cmdNum ) ) {
+		cg_predictCacheHits++;
+
+		if ( cg_predictCache.integer > 1 ) {
+			PlayerState check = entry->before;
+			pmove_t pm = cg_pmove;
+
+			pm.ps = &check;
+			Pmove( &pm );
+
+			cg_predictCacheValidated++;
+			if ( memcmp( &check, &entry->after, sizeof( PlayerState ) ) ) {
+				cg_predictCacheDivergences++;
+				Com_Printf( "prediction cache divergence on cmd %i (%i of %i validated)\n",
+							cmdNum, cg_predictCacheDivergences, cg_predictCacheValidated );
+				// keep the full replay result
+				UserCmd cmd = entry->pm.cmd;
+				entry->after = check;
+				entry->pm = pm;
+				entry->pm.cmd = cmd;
+				entry->pm.ps = nullptr;
+			}
+		}
+
+		*cg_pmove.ps = entry->after;
+		VectorCopy( entry->pm.mins, cg_pmove.mins );
+		VectorCopy( entry->pm.maxs, cg_pmove.maxs );
+		cg_pmove.numtouch = entry->pm.numtouch;
+		memcpy( cg_pmove.touchents, entry->pm.touchents, sizeof( cg_pmove.touchents ) );
+		cg_pmove.watertype = entry->pm.watertype;
+		cg_pmove.waterlevel = entry->pm.waterlevel;
+		cg_pmove.xyspeed = entry->pm.xyspeed;
+		return;
+	}
+
+	cg_predictCacheMisses++;
+
+	entry->cmdNum = cmdNum;
+	entry->physicsTime = cg.physicsTime;
+	entry->before = *cg_pmove.ps;
+	// Pmove can change the cmd, so key on the cmd as it was passed in
+	entry->pm = cg_pmove;
+
+	ClearBounds( entry->traceMins, entry->traceMaxs );
+	cg_predictCacheRecording = entry;
+	Pmove( &cg_pmove );
+	cg_predictCacheRecording = nullptr;
+	entry->numSolids = CG_PredictCacheSolids( entry->traceMins, entry->traceMaxs, entry->before.clientNum, entry->solids );
+
+	UserCmd cmd = entry->pm.cmd;
+	entry->pm = cg_pmove;
+	entry->pm.cmd = cmd;
+	entry->pm.ps = nullptr;
+	entry->after = *cg_pmove.ps;
+}
+
 /*
 =================
 CG_PredictPlayerState
@@ -487,10 +824,10 @@ but we simulate all unacknowledged commands each time, not just the new ones.
 This means that on an internet connection, quite a few pmoves may be issued
 each frame.
 
-OPTIMIZE: don't re-simulate unless the newly arrived snapshot PlayerState
-differs from the predicted one.  Would require saving all intermediate
-PlayerState during prediction. (this is "dead reckoning" and would definately
-be nice to have in there (SA))
+With cg_predictCache, the intermediate PlayerState of every command is
+saved, and a command is only re-simulated when the state it starts from,
+its inputs or the solids it moved near differ from the last frame (see
+CG_CachedPmove).
 
 We detect prediction errors and allow them to be decayed off over several frames
 to ease the jerk.
@@ -713,7 +1050,11 @@ void CG_PredictPlayerState( void ) {
 			}
 		}
 
-		Pmove( &cg_pmove );
+		if ( cg_predictCache.integer ) {
+			CG_CachedPmove( cmdNum );
+		} else {
+			Pmove( &cg_pmove );
+		}
 
 		moved = true;
 
@@ -723,7 +1064,12 @@ void CG_PredictPlayerState( void ) {
 
 	if ( cg_showmiss.integer > 1 ) {
 		Com_Printf( "[%i : %i] ", cg_pmove.cmd.serverTime, cg.time );
+		if ( cg_predictCache.integer ) {
+			Com_Printf( "cache %i/%i ", cg_predictCacheHits, cg_predictCacheHits + cg_predictCacheMisses );
+		}
 	}
+	cg_predictCacheHits = 0;
+	cg_predictCacheMisses = 0;
 
 	if ( !moved ) {
 		if ( cg_showmiss.integer ) {
@@ -741,3 +1087,104 @@ void CG_PredictPlayerState( void ) {
 	CG_TransitionPlayerState( &cg.predictedPlayerState, &oldPlayerState );
 }
 
+
+/*
+=================
+CG_ReplayCommands
+
+Runs every stored usercmd on top of the current snapshot PlayerState,
+without any of the side effects of CG_PredictPlayerState.
+Returns the number of pmoves.
+=================
+*/
+static int CG_ReplayCommands( void ) {
+	int current, cmdNum, count;
+	UserCmd latestCmd;
+
+	cg.predictedPlayerState = cg.snap->ps;
+	cg.physicsTime = cg.snap->serverTime;
+
+	cg_pmove.ps = &cg.predictedPlayerState;
+	cg_pmove.trace = CG_TraceCapsule;
+	cg_pmove.pointcontents = CG_PointContents;
+	cg_pmove.tracemask = MASK_PLAYERSOLID;
+	cg_pmove.noFootsteps = ( cgs.dmflags & DF_NO_FOOTSTEPS ) != 0;
+	cg_pmove.noWeapClips = ( cgs.dmflags & DF_NO_WEAPRELOAD ) != 0;
+	cg_pmove.pmove_fixed = pmove_fixed.integer;
+	cg_pmove.pmove_msec = pmove_msec.integer;
+	cg_pmove.gauntletHit = false;
+
+	current = trap_GetCurrentCmdNumber();
+	CL_GetUserCmd( current, &latestCmd );
+
+	count = 0;
+	for ( cmdNum = current - CMD_BACKUP + 1 ; cmdNum <= current ; cmdNum++ ) {
+		CL_GetUserCmd( cmdNum, &cg_pmove.cmd );
+		CL_GetUserCmd( cmdNum - 1, &cg_pmove.oldcmd );
+
+		if ( cg_pmove.cmd.serverTime <= cg.predictedPlayerState.commandTime
+			 || cg_pmove.cmd.serverTime > latestCmd.serverTime ) {
+			continue;
+		}
+
+		Pmove( &cg_pmove );
+		count++;
+	}
+
+	return count;
+}
+
+/*
+=================
+CG_PredictBench_f
+
+predictbench [iterations]
+
+Replays the recorded usercmds against the current snapshot with the
+linear solid scan and with the solid grid, and checks that both
+produce the same PlayerState.
+=================
+*/
+void CG_PredictBench_f( void ) {
+	PlayerState savedState, results[2];
+	int savedGrid, savedPhysicsTime;
+	int msec[2], clips[2];
+	int iterations, numMoves = 0;
+
+	if ( !cg.snap ) {
+		Com_Printf( "predictbench: no snapshot\n" );
+		return;
+	}
+
+	iterations = Cmd_Argc() > 1 ? atoi( CG_Argv( 1 ) ) : 100;
+	if ( iterations < 1 ) {
+		iterations = 1;
+	}
+
+	savedState = cg.predictedPlayerState;
+	savedPhysicsTime = cg.physicsTime;
+	savedGrid = cg_predictGrid.integer;
+
+	for ( int pass = 0 ; pass < 2 ; pass++ ) {
+		cg_predictGrid.integer = pass;
+		cg_numEntityClips = 0;
+
+		int start = Sys_Milliseconds();
+		for ( int i = 0 ; i < iterations ; i++ ) {
+			numMoves = CG_ReplayCommands();
+		}
+		msec[pass] = Sys_Milliseconds() - start;
+		clips[pass] = cg_numEntityClips;
+		results[pass] = cg.predictedPlayerState;
+	}
+
+	cg_predictGrid.integer = savedGrid;
+	cg.predictedPlayerState = savedState;
+	cg.physicsTime = savedPhysicsTime;
+
+	Com_Printf( "predictbench: %i pmoves x %i, %i solids (%i unbounded)\n",
+				numMoves, iterations, cg_numSolidEntities, cg_solidGrid.debug_getAlwaysCount() );
+	Com_Printf( "  linear: %5i msec, %8i entity clips\n", msec[0], clips[0] );
+	Com_Printf( "  grid:   %5i msec, %8i entity clips\n", msec[1], clips[1] );
+	Com_Printf( "  results %s\n", memcmp( &results[0], &results[1], sizeof( PlayerState ) ) ? "DIFFER" : "match" );
+}
@@ -166,6 +166,10 @@ void    trap_R_DrawStretchPicGradient(  float x, float y, float w, float h,
 	RE_StretchPicGradient(x, y, w, h, s1, t1, s2, t2, hShader, gradientColor, gradientType  );
 }
 
+void    trap_R_DrawStretchQuads( qhandle_t hShader, const stretchQuad_t *quads, int numQuads ) {
+	RE_StretchQuads( hShader, quads, numQuads );
+}
+
 void    trap_R_ModelBounds( clipHandle_t model, vec3_t mins, vec3_t maxs ) {
 	R_ModelBounds(model, mins, maxs );
 }
@@ -32,7 +32,6 @@ If you have questions concerning this license or the applicable additional terms
 
 typedef struct trailJunc_s
 {
-	struct trailJunc_s *nextGlobal, *prevGlobal;    // next junction in the global list it is in (free or used)
 	struct trailJunc_s *nextJunc;                   // next junction in the trail
 	struct trailJunc_s *nextHead, *prevHead;        // next head junc in the world
 
@@ -58,44 +57,30 @@ typedef struct trailJunc_s
 
 #define MAX_TRAILJUNCS  4096
 
-trailJunc_t trailJuncs[MAX_TRAILJUNCS];
-trailJunc_t *freeTrails, *activeTrails;
+static FixedPool<trailJunc_t, MAX_TRAILJUNCS> trailJuncs;
 trailJunc_t *headTrails;
 
 bool initTrails = false;
 
-int numTrailsInuse;
-
 /*
 ===============
 CG_ClearTrails
 ===============
 */
 void CG_ClearTrails( void ) {
-	int i;
-
-	memset( trailJuncs, 0, sizeof( trailJunc_t ) * MAX_TRAILJUNCS );
-
-	freeTrails = trailJuncs;
-	activeTrails = nullptr;
+	trailJuncs.clear();
 	headTrails = nullptr;
 
-	for ( i = 0 ; i < MAX_TRAILJUNCS ; i++ )
-	{
-		trailJuncs[i].nextGlobal = &trailJuncs[i + 1];
-
-		if ( i > 0 ) {
-			trailJuncs[i].prevGlobal = &trailJuncs[i - 1];
-		} else {
-			trailJuncs[i].prevGlobal = nullptr;
-		}
-
-		trailJuncs[i].inuse = false;
-	}
-	trailJuncs[MAX_TRAILJUNCS - 1].nextGlobal = nullptr;
-
 	initTrails = true;
-	numTrailsInuse = 0;
+}
+
+/*
+===============
+CG_TrailPoolStats
+===============
+*/
+const FixedPoolStats *CG_TrailPoolStats( void ) {
+	return &trailJuncs.getStats();
 }
 
 /*
@@ -106,27 +91,15 @@ CG_SpawnTrailJunc
 trailJunc_t *CG_SpawnTrailJunc( trailJunc_t *headJunc ) {
 	trailJunc_t *j;
 
-	if ( !freeTrails ) {
-		return nullptr;
-	}
-
 	if ( cg_paused.integer ) {
 		return nullptr;
 	}
 
-	// select the first free trail, and remove it from the list
-	j = freeTrails;
-	freeTrails = j->nextGlobal;
-	if ( freeTrails ) {
-		freeTrails->prevGlobal = nullptr;
+	j = trailJuncs.alloc();
+	if ( !j ) {
+		return nullptr;
 	}
 
-	j->nextGlobal = activeTrails;
-	if ( activeTrails ) {
-		activeTrails->prevGlobal = j;
-	}
-	activeTrails = j;
-	j->prevGlobal = nullptr;
 	j->inuse = true;
 	j->freed = false;
 
@@ -159,11 +132,6 @@ trailJunc_t *CG_SpawnTrailJunc( trailJunc_t *headJunc ) {
 
 	j->nextJunc = headJunc; // if headJunc is nullptr, then we'll just be the end of the list
 
-	numTrailsInuse++;
-
-	// debugging
-//	Com_Printf( "NumTrails: %i\n", numTrailsInuse );
-
 	return j;
 }
 
@@ -180,13 +148,8 @@ CG_AddTrailJunc
 int CG_AddTrailJunc( int headJuncIndex, qhandle_t shader, int spawnTime, int sType, vec3_t pos, int trailLife, float alphaStart, float alphaEnd, float startWidth, float endWidth, int flags, vec3_t colorStart, vec3_t colorEnd, float sRatio, float animSpeed ) {
 	trailJunc_t *j, *headJunc;
 
-	if ( headJuncIndex > 0 ) {
-		headJunc = &trailJuncs[headJuncIndex - 1];
-
-		if ( !headJunc->inuse ) {
-			headJunc = nullptr;
-		}
-	} else {
+	headJunc = trailJuncs.get( headJuncIndex );
+	if ( headJunc && !headJunc->inuse ) {
 		headJunc = nullptr;
 	}
 
@@ -237,7 +200,7 @@ int CG_AddTrailJunc( int headJuncIndex, qhandle_t shader, int spawnTime, int sTy
 		}
 	}
 
-	return ( (int)( j - trailJuncs ) + 1 );
+	return trailJuncs.handleFor( j );
 }
 
 /*
@@ -250,13 +213,8 @@ CG_AddSparkJunc
 int CG_AddSparkJunc( int headJuncIndex, qhandle_t shader, vec3_t pos, int trailLife, float alphaStart, float alphaEnd, float startWidth, float endWidth ) {
 	trailJunc_t *j, *headJunc;
 
-	if ( headJuncIndex > 0 ) {
-		headJunc = &trailJuncs[headJuncIndex - 1];
-
-		if ( !headJunc->inuse ) {
-			headJunc = nullptr;
-		}
-	} else {
+	headJunc = trailJuncs.get( headJuncIndex );
+	if ( headJunc && !headJunc->inuse ) {
 		headJunc = nullptr;
 	}
 
@@ -287,7 +245,7 @@ int CG_AddSparkJunc( int headJuncIndex, qhandle_t shader, vec3_t pos, int trailL
 	j->widthStart = startWidth;
 	j->widthEnd = endWidth;
 
-	return ( (int)( j - trailJuncs ) + 1 );
+	return trailJuncs.handleFor( j );
 }
 
 /*
@@ -301,13 +259,8 @@ int CG_AddSmokeJunc( int headJuncIndex, qhandle_t shader, vec3_t pos, int trailL
 #define ST_RATIO    4.0     // sprite image: width / height
 	trailJunc_t *j, *headJunc;
 
-	if ( headJuncIndex > 0 ) {
-		headJunc = &trailJuncs[headJuncIndex - 1];
-
-		if ( !headJunc->inuse ) {
-			headJunc = nullptr;
-		}
-	} else {
+	headJunc = trailJuncs.get( headJuncIndex );
+	if ( headJunc && !headJunc->inuse ) {
 		headJunc = nullptr;
 	}
 
@@ -345,7 +298,7 @@ int CG_AddSmokeJunc( int headJuncIndex, qhandle_t shader, vec3_t pos, int trailL
 		j->alphaEnd = 0.0;
 	}
 
-	return ( (int)( j - trailJuncs ) + 1 );
+	return trailJuncs.handleFor( j );
 }
 
 void CG_KillTrail( trailJunc_t *t );
@@ -364,15 +317,6 @@ void CG_FreeTrailJunc( trailJunc_t *junc ) {
 	// make it non-active
 	junc->inuse = false;
 	junc->freed = true;
-	if ( junc->nextGlobal ) {
-		junc->nextGlobal->prevGlobal = junc->prevGlobal;
-	}
-	if ( junc->prevGlobal ) {
-		junc->prevGlobal->nextGlobal = junc->nextGlobal;
-	}
-	if ( junc == activeTrails ) {
-		activeTrails = junc->nextGlobal;
-	}
 
 	// if it's a head, remove it
 	if ( junc == headTrails ) {
@@ -387,15 +331,7 @@ void CG_FreeTrailJunc( trailJunc_t *junc ) {
 	junc->nextHead = nullptr;
 	junc->prevHead = nullptr;
 
-	// stick it in the free list
-	junc->prevGlobal = nullptr;
-	junc->nextGlobal = freeTrails;
-	if ( freeTrails ) {
-		freeTrails->prevGlobal = junc;
-	}
-	freeTrails = junc;
-
-	numTrailsInuse--;
+	trailJuncs.free( junc );
 }
 
 /*
@@ -743,8 +679,7 @@ void CG_AddTrails( void ) {
 	VectorCopy( cg.refdef.viewaxis[2], vup );
 
 	// update the settings for each junc
-	j = activeTrails;
-	while ( j ) {
+	for ( j = trailJuncs.first() ; j ; j = trailJuncs.next() ) {
 		lifeFrac = (float)( cg.time - j->spawnTime ) / (float)( j->endTime - j->spawnTime );
 		if ( lifeFrac >= 1.0 ) {
 			j->inuse = false;          // flag it as dead
@@ -767,8 +702,6 @@ void CG_AddTrails( void ) {
 			VectorSubtract( j->colorEnd, j->colorStart, j->color );
 			VectorMA( j->colorStart, lifeFrac, j->color, j->color );
 		}
-
-		j = j->nextGlobal;
 	}
 
 	// draw the trailHeads
@@ -29,6 +29,7 @@ If you have questions concerning this license or the applicable additional terms
 #ifndef __TR_TYPES_H
 #define __TR_TYPES_H
 
+#include "../qcommon/glyph_batch.h"
 
 #define MAX_CORONAS     32          //----(SA)	not really a reason to limit this other than trying to keep a reasonable count
 #define MAX_DLIGHTS     32          // can't be increased, because bit flags are used on surfaces
@@ -73,6 +74,18 @@ typedef struct {
 	uint8_t modulate[4];
 } polyVert_t;
 
+// a 2D quad in screen coordinates, as drawn by DrawStretchPic, with its own color
+typedef struct {
+	float x, y;
+	float w, h;
+	float s1, t1;
+	float s2, t2;
+	uint8_t modulate[4];
+} stretchQuad_t;
+
+// the quads of a string or a few, see QuadBatch
+typedef QuadBatch<stretchQuad_t, 256> textBatch_t;
+
 typedef struct poly_s {
 	qhandle_t hShader;
 	int numVerts;
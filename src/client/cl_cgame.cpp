@@ -541,6 +541,8 @@ void CL_FirstSnapshot()
 	cl.serverTimeDelta = cl.snap.serverTime - cls.realtime;
 	cl.oldServerTime = cl.snap.serverTime;
 
+	clc.timeDemoBaseTime = cl.snap.serverTime;
+
 	// if this is the first frame of active play,
 	// execute the contents of activeAction now
 	// this is to allow scripting a timedemo to start right
@@ -563,6 +565,15 @@ void CL_SetCGameTime()
 		if ( cls.state != CA_PRIMED ) {
 			return;
 		}
+		if ( clc.demoplaying ) {
+			// we shouldn't get the first snapshot on the same frame
+			// as the gamestate, because it causes a bad time skip
+			if ( !clc.firstDemoFrameSkipped ) {
+				clc.firstDemoFrameSkipped = true;
+				return;
+			}
+			CL_ReadDemoMessage();
+		}
 		if ( cl.newSnapshots ) {
 			cl.newSnapshots = false;
 			CL_FirstSnapshot();
@@ -625,6 +636,33 @@ void CL_SetCGameTime()
 	if ( cl.newSnapshots ) {
 		CL_AdjustTimeDelta();
 	}
-	return;
+
+	if ( !clc.demoplaying ) {
+		return;
+	}
+
+	// a timedemo will always use a deterministic set of time samples
+	// no matter what speed machine it is run on,
+	// while a normal demo may have different time samples
+	// each time it is played back
+	if ( cl_timedemo->integer ) {
+		if ( !clc.timeDemoStart ) {
+			clc.timeDemoStart = Sys_Milliseconds();
+		}
+		clc.timeDemoFrames++;
+		cl.serverTime = clc.timeDemoBaseTime + clc.timeDemoFrames * 50;
+	}
+
+	// if we are playing a demo back, we can just keep reading
+	// messages from the demo file until the cgame definately
+	// has valid snapshots to interpolate between
+	while ( cl.serverTime >= cl.snap.serverTime ) {
+		// feed another messag, which should change
+		// the contents of cl.snap
+		CL_ReadDemoMessage();
+		if ( cls.state != CA_ACTIVE ) {
+			return;     // end of demo
+		}
+	}
 }
 
@@ -28,6 +28,8 @@ If you have questions concerning this license or the applicable additional terms
 
 #include "client.h"
 #include "snd_local.h"
+#include "roq_decoder.h"
+#include "../qcommon/job_system.h"
 #include <stdint.h>
 
 #define MAXSIZE             8
@@ -58,16 +60,10 @@ extern int s_soundtime;
 
 #define CIN_STREAM 0
 static void RoQ_init( void );
+static void CIN_FinishFrame( void );
 
 
-static int ROQ_YY_tab[256];
-static int ROQ_UB_tab[256];
-static int ROQ_UG_tab[256];
-static int ROQ_VG_tab[256];
-static int ROQ_VR_tab[256];
-static unsigned short vq2[256 * 16 * 4];
-static unsigned short vq4[256 * 64 * 4];
-static unsigned short vq8[256 * 256 * 4];
+static RoqDecoder roq;
 
 
 typedef struct {
@@ -103,11 +99,6 @@ typedef struct
 	unsigned int roq_id;
 	int screenDelta;
 
-	void ( *VQ0 )( uint8_t *status, void *qdata );
-	void ( *VQ1 )( uint8_t *status, void *qdata );
-	void ( *VQNormal )( uint8_t *status, void *qdata );
-	void ( *VQBuffer )( uint8_t *status, void *qdata );
-
 	int samplesPerPixel;                               // defaults to 2
 	uint8_t*               gray;
 	unsigned int xsize, ysize, maxsize, minsize;
@@ -137,6 +128,7 @@ void CIN_CloseAllVideos(  ) {
 			CIN_StopCinematic( i );
 		}
 	}
+	CIN_FinishFrame();
 }
 
 
@@ -307,491 +299,78 @@ long RllDecodeStereoToMono( unsigned char *from,short *to,unsigned int size,char
 	return size;
 }
 
-
-static void move8_32( uint8_t *src, uint8_t *dst, int spl )
-{
-	for( int i = 0; i < 8; ++i )
-	{
-		memcpy( dst, src, 32 );
-		src += spl;
-		dst += spl;
-	}
-}
-
-static void move4_32( uint8_t* src, uint8_t* dst, int spl )
-{
-	for(int i = 0; i < 4; ++i )
-	{
-		memcpy( dst, src, 16 );
-		src += spl;
-		dst += spl;
-	}
-}
-
-static void blit8_32( uint8_t *src, uint8_t *dst, int spl  ) {
-	for(int i = 0; i < 8; ++i )
-	{
-		memcpy( dst, src, 32 );
-		src += 32;
-		dst += spl;
-	}
-}
-
-
-static void blit4_32( uint8_t *src, uint8_t *dst, int spl  ) {
-	for(int i = 0; i < 4; ++i )
-	{
-		memmove( dst, src, 16 );
-		src += 16;
-		dst += spl;
-	}
-}
-
-static void blit2_32( uint8_t *src, uint8_t *dst, int spl  ) {
-	memcpy( dst, src, 8 );
-	memcpy( dst + spl, src + 8, 8 );
+/*
+VQ frames are decoded by a job: RoQInterrupt hands a frame to CIN_DecodeFrame
+and returns, and the frame is shown once CIN_FinishFrame has waited for it, at
+the start of the next CIN_RunCinematic at the latest. In the meantime the
+renderer uploads the last frame, which is in the other half of linbuf, so the
+job writes to its own half only. Anything else that touches the codebook, the
+quads or the buffers calls CIN_FinishFrame first.
+*/
+typedef struct {
+	uint8_t data[65536];
+	uint8_t **status;
+	int samplesPerLine;
+	int mcomp[256];
+	uint8_t *buf;               // the half of linbuf the frame is decoded to
+	uint8_t *firstFrameCopy;    // the first frame is copied to the other half as well
+	int firstFrameSize;
+	int handle;
+} cinDecode_t;
+
+static cinDecode_t cinDecode;
+static JobSystem::Fence cinDecodeFence;
+static bool cinDecoding;
+
+static void CIN_DecodeFrame( void ) {
+	roq.decodeVQ( cinDecode.status, cinDecode.data, cinDecode.samplesPerLine, cinDecode.mcomp );
 }
 
+/*
+==================
+CIN_FinishFrame
 
-static void blitVQQuad32fs( uint8_t **status, unsigned char *data )
-{
-	unsigned short newd    = 0;
-	unsigned short celdata = 0;
-	unsigned int index   = 0;
-
-	int spl = cinTable[currentHandle].samplesPerLine;
-
-	do {
-		if ( !newd ) {
-			newd = 7;
-			celdata = data[0] + data[1] * 256;
-			data += 2;
-		} else {
-			newd--;
-		}
-
-		unsigned short code = ( unsigned short )( celdata & 0xc000 );
-		celdata <<= 2;
-
-		switch ( code ) {
-		case    0x8000:                                                     // vq code
-			blit8_32( (uint8_t *)&vq8[( *data ) * 128], status[index], spl );
-			data++;
-			index += 5;
-			break;
-		case    0xc000:                                                     // drop
-			index++;                                                        // skip 8x8
-			for (int i = 0; i < 4; i++ ) {
-				if ( !newd ) {
-					newd = 7;
-					celdata = data[0] + data[1] * 256;
-					data += 2;
-				} else {
-					newd--;
-				}
-
-				code = ( unsigned short )( celdata & 0xc000 );
-				celdata <<= 2;
-
-				switch ( code ) {                                           // code in top two bits of code
-				case    0x8000:                                             // 4x4 vq code
-					blit4_32( (uint8_t *)&vq4[( *data ) * 32], status[index], spl );
-					data++;
-					break;
-				case    0xc000:                                             // 2x2 vq code
-					blit2_32( (uint8_t *)&vq2[( *data ) * 8], status[index], spl );
-					data++;
-					blit2_32( (uint8_t *)&vq2[( *data ) * 8], status[index] + 8, spl );
-					data++;
-					blit2_32( (uint8_t *)&vq2[( *data ) * 8], status[index] + spl * 2, spl );
-					data++;
-					blit2_32( (uint8_t *)&vq2[( *data ) * 8], status[index] + spl * 2 + 8, spl );
-					data++;
-					break;
-				case    0x4000:                                             // motion compensation
-					move4_32( status[index] + cin.mcomp[( *data )], status[index], spl );
-					data++;
-					break;
-				}
-				index++;
-			}
-			break;
-		case    0x4000:                                                     // motion compensation
-			move8_32( status[index] + cin.mcomp[( *data )], status[index], spl );
-			data++;
-			index += 5;
-			break;
-		case    0x0000:
-			index += 5;
-			break;
-		}
-	} while ( status[index] != nullptr );
-}
-
-static void ROQ_GenYUVTables()
-{
-	float t_ub = ( 1.77200f / 2.0f ) * (float)( 1 << 6 ) + 0.5f;
-	float t_vr = ( 1.40200f / 2.0f ) * (float)( 1 << 6 ) + 0.5f;
-	float t_ug = ( 0.34414f / 2.0f ) * (float)( 1 << 6 ) + 0.5f;
-	float t_vg = ( 0.71414f / 2.0f ) * (float)( 1 << 6 ) + 0.5f;
-	for (int i = 0; i < 256; i++ ) {
-		float x = (float)( 2 * i - 255 );
-
-		ROQ_UB_tab[i] = (int)( ( t_ub * x ) + ( 1 << 5 ) );
-		ROQ_VR_tab[i] = (int)( ( t_vr * x ) + ( 1 << 5 ) );
-		ROQ_UG_tab[i] = (int)( ( -t_ug * x )      );
-		ROQ_VG_tab[i] = (int)( ( -t_vg * x ) + ( 1 << 5 ) );
-		ROQ_YY_tab[i] = (int)( ( i << 6 ) | ( i >> 2 ) );
+  waits for the frame being decoded, if any, and shows it
+==================
+*/
+static void CIN_FinishFrame( void ) {
+	if ( !cinDecoding ) {
+		return;
 	}
-}
-
-#define VQ2TO4( a,b,c,d ) {	\
-		*c++ = a[0];	\
-		*d++ = a[0];	\
-		*d++ = a[0];	\
-		*c++ = a[1];	\
-		*d++ = a[1];	\
-		*d++ = a[1];	\
-		*c++ = b[0];	\
-		*d++ = b[0];	\
-		*d++ = b[0];	\
-		*c++ = b[1];	\
-		*d++ = b[1];	\
-		*d++ = b[1];	\
-		*d++ = a[0];	\
-		*d++ = a[0];	\
-		*d++ = a[1];	\
-		*d++ = a[1];	\
-		*d++ = b[0];	\
-		*d++ = b[0];	\
-		*d++ = b[1];	\
-		*d++ = b[1];	\
-		a += 2; b += 2; }
-
-#define VQ2TO2( a,b,c,d ) {	\
-		*c++ = *a;	\
-		*d++ = *a;	\
-		*d++ = *a;	\
-		*c++ = *b;	\
-		*d++ = *b;	\
-		*d++ = *b;	\
-		*d++ = *a;	\
-		*d++ = *a;	\
-		*d++ = *b;	\
-		*d++ = *b;	\
-		a++; b++; }
-
-static unsigned short yuv_to_rgb( long y, long u, long v )
-{
-	int YY =  ROQ_YY_tab[( y )];
-
-	int r = ( YY + ROQ_VR_tab[v] ) >> 9;
-	int g = ( YY + ROQ_UG_tab[u] + ROQ_VG_tab[v] ) >> 8;
-	int b = ( YY + ROQ_UB_tab[u] ) >> 9;
+	Com_Jobs().wait( cinDecodeFence );
+	cinDecoding = false;
 
-	if ( r < 0 ) {
-		r = 0;
-	}
-	if ( g < 0 ) {
-		g = 0;
-	}
-	if ( b < 0 ) {
-		b = 0;
+	// the other half may still have been uploading while the job ran
+	if ( cinDecode.firstFrameSize ) {
+		memcpy( cinDecode.firstFrameCopy, cinDecode.buf, cinDecode.firstFrameSize );
 	}
-	if ( r > 31 ) {
-		r = 31;
-	}
-	if ( g > 63 ) {
-		g = 63;
-	}
-	if ( b > 31 ) {
-		b = 31;
-	}
-
-	return ( unsigned short )( ( r << 11 ) | ( g << 5 ) |  b  );
+	cinTable[cinDecode.handle].buf = cinDecode.buf;
+	cinTable[cinDecode.handle].dirty = true;
 }
 
-static unsigned int yuv_to_rgb24( long y, long u, long v ) {
-	int r,g,b,YY =  ROQ_YY_tab[( y )];
+static void CIN_StartFrame( uint8_t *framedata, int status ) {
+	CIN_FinishFrame();
 
-	r = ( YY + ROQ_VR_tab[v] ) >> 6;
-	g = ( YY + ROQ_UG_tab[u] + ROQ_VG_tab[v] ) >> 6;
-	b = ( YY + ROQ_UB_tab[u] ) >> 6;
-
-	if ( r < 0 ) {
-		r = 0;
-	}
-	if ( g < 0 ) {
-		g = 0;
-	}
-	if ( b < 0 ) {
-		b = 0;
-	}
-	if ( r > 255 ) {
-		r = 255;
+	int size = cinTable[currentHandle].RoQFrameSize;
+	if ( size > (int)sizeof( cinDecode.data ) ) {
+		size = sizeof( cinDecode.data );
 	}
-	if ( g > 255 ) {
-		g = 255;
-	}
-	if ( b > 255 ) {
-		b = 255;
+	memcpy( cinDecode.data, framedata, size );
+	memcpy( cinDecode.mcomp, cin.mcomp, sizeof( cinDecode.mcomp ) );
+	cinDecode.status = cin.qStatus[status];
+	cinDecode.samplesPerLine = cinTable[currentHandle].samplesPerLine;
+	cinDecode.buf = status ? cin.linbuf + cinTable[currentHandle].screenDelta : cin.linbuf;
+	cinDecode.firstFrameCopy = cin.linbuf + cinTable[currentHandle].screenDelta;
+	cinDecode.firstFrameSize = 0;
+	if ( cinTable[currentHandle].numQuads == 0 ) {
+		cinDecode.firstFrameSize = cinTable[currentHandle].samplesPerLine * cinTable[currentHandle].ysize;
 	}
+	cinDecode.handle = currentHandle;
 
-	return  0xFF000000 |  ( b << 16 ) | ( g << 8 )  | r;
+	cinDecoding = true;
+	Com_Jobs().submit( CIN_DecodeFrame, &cinDecodeFence );
 }
 
-static void decodeCodeBook( uint8_t *input, unsigned short roq_flags ) {
-	int i, j, two, four;
-	unsigned short  *aptr, *bptr, *cptr, *dptr;
-	int y0,y1,y2,y3,cr,cb;
-	uint8_t    *bbptr, *baptr, *bcptr, *bdptr;
-	unsigned int *iaptr, *ibptr, *icptr, *idptr;
-
-	if ( !roq_flags ) {
-		two = four = 256;
-	} else {
-		two  = roq_flags >> 8;
-		if ( !two ) {
-			two = 256;
-		}
-		four = roq_flags & 0xff;
-	}
-
-	four *= 2;
-
-	bptr = (unsigned short *)vq2;
-
-	if ( !cinTable[currentHandle].half ) {
-		if ( !cinTable[currentHandle].smootheddouble ) {
-//
-// normal height
-//
-			if ( cinTable[currentHandle].samplesPerPixel == 2 ) {
-				for ( i = 0; i < two; i++ ) {
-					y0 = *input++;
-					y1 = *input++;
-					y2 = *input++;
-					y3 = *input++;
-					cr = *input++;
-					cb = *input++;
-					*bptr++ = yuv_to_rgb( y0, cr, cb );
-					*bptr++ = yuv_to_rgb( y1, cr, cb );
-					*bptr++ = yuv_to_rgb( y2, cr, cb );
-					*bptr++ = yuv_to_rgb( y3, cr, cb );
-				}
-
-				cptr = (unsigned short *)vq4;
-				dptr = (unsigned short *)vq8;
-
-				for ( i = 0; i < four; i++ ) {
-					aptr = (unsigned short *)vq2 + ( *input++ ) * 4;
-					bptr = (unsigned short *)vq2 + ( *input++ ) * 4;
-					for ( j = 0; j < 2; j++ )
-						VQ2TO4( aptr,bptr,cptr,dptr );
-				}
-			} else if ( cinTable[currentHandle].samplesPerPixel == 4 ) {
-				ibptr = (unsigned int *)bptr;
-				for ( i = 0; i < two; i++ ) {
-					y0 = *input++;
-					y1 = *input++;
-					y2 = *input++;
-					y3 = *input++;
-					cr = *input++;
-					cb = *input++;
-					*ibptr++ = yuv_to_rgb24( y0, cr, cb );
-					*ibptr++ = yuv_to_rgb24( y1, cr, cb );
-					*ibptr++ = yuv_to_rgb24( y2, cr, cb );
-					*ibptr++ = yuv_to_rgb24( y3, cr, cb );
-				}
-
-				icptr = (unsigned int *)vq4;
-				idptr = (unsigned int *)vq8;
-
-				for ( i = 0; i < four; i++ ) {
-					iaptr = (unsigned int *)vq2 + ( *input++ ) * 4;
-					ibptr = (unsigned int *)vq2 + ( *input++ ) * 4;
-					for ( j = 0; j < 2; j++ )
-						VQ2TO4( iaptr, ibptr, icptr, idptr );
-				}
-			} else if ( cinTable[currentHandle].samplesPerPixel == 1 ) {
-				bbptr = (uint8_t *)bptr;
-				for ( i = 0; i < two; i++ ) {
-					*bbptr++ = cinTable[currentHandle].gray[*input++];
-					*bbptr++ = cinTable[currentHandle].gray[*input++];
-					*bbptr++ = cinTable[currentHandle].gray[*input++];
-					*bbptr++ = cinTable[currentHandle].gray[*input]; input += 3;
-				}
-
-				bcptr = (uint8_t *)vq4;
-				bdptr = (uint8_t *)vq8;
-
-				for ( i = 0; i < four; i++ ) {
-					baptr = (uint8_t *)vq2 + ( *input++ ) * 4;
-					bbptr = (uint8_t *)vq2 + ( *input++ ) * 4;
-					for ( j = 0; j < 2; j++ )
-						VQ2TO4( baptr,bbptr,bcptr,bdptr );
-				}
-			}
-		} else {
-//
-// double height, smoothed
-//
-			if ( cinTable[currentHandle].samplesPerPixel == 2 ) {
-				for ( i = 0; i < two; i++ ) {
-					y0 = *input++;
-					y1 = *input++;
-					y2 = *input++;
-					y3 = *input++;
-					cr = *input++;
-					cb = *input++;
-					*bptr++ = yuv_to_rgb( y0, cr, cb );
-					*bptr++ = yuv_to_rgb( y1, cr, cb );
-					*bptr++ = yuv_to_rgb( ( ( y0 * 3 ) + y2 ) / 4, cr, cb );
-					*bptr++ = yuv_to_rgb( ( ( y1 * 3 ) + y3 ) / 4, cr, cb );
-					*bptr++ = yuv_to_rgb( ( y0 + ( y2 * 3 ) ) / 4, cr, cb );
-					*bptr++ = yuv_to_rgb( ( y1 + ( y3 * 3 ) ) / 4, cr, cb );
-					*bptr++ = yuv_to_rgb( y2, cr, cb );
-					*bptr++ = yuv_to_rgb( y3, cr, cb );
-				}
-
-				cptr = (unsigned short *)vq4;
-				dptr = (unsigned short *)vq8;
-
-				for ( i = 0; i < four; i++ ) {
-					aptr = (unsigned short *)vq2 + ( *input++ ) * 8;
-					bptr = (unsigned short *)vq2 + ( *input++ ) * 8;
-					for ( j = 0; j < 2; j++ ) {
-						VQ2TO4( aptr,bptr,cptr,dptr );
-						VQ2TO4( aptr,bptr,cptr,dptr );
-					}
-				}
-			} else if ( cinTable[currentHandle].samplesPerPixel == 4 ) {
-				ibptr = (unsigned int *)bptr;
-				for ( i = 0; i < two; i++ ) {
-					y0 = *input++;
-					y1 = *input++;
-					y2 = *input++;
-					y3 = *input++;
-					cr = *input++;
-					cb = *input++;
-					*ibptr++ = yuv_to_rgb24( y0, cr, cb );
-					*ibptr++ = yuv_to_rgb24( y1, cr, cb );
-					*ibptr++ = yuv_to_rgb24( ( ( y0 * 3 ) + y2 ) / 4, cr, cb );
-					*ibptr++ = yuv_to_rgb24( ( ( y1 * 3 ) + y3 ) / 4, cr, cb );
-					*ibptr++ = yuv_to_rgb24( ( y0 + ( y2 * 3 ) ) / 4, cr, cb );
-					*ibptr++ = yuv_to_rgb24( ( y1 + ( y3 * 3 ) ) / 4, cr, cb );
-					*ibptr++ = yuv_to_rgb24( y2, cr, cb );
-					*ibptr++ = yuv_to_rgb24( y3, cr, cb );
-				}
-
-				icptr = (unsigned int *)vq4;
-				idptr = (unsigned int *)vq8;
-
-				for ( i = 0; i < four; i++ ) {
-					iaptr = (unsigned int *)vq2 + ( *input++ ) * 8;
-					ibptr = (unsigned int *)vq2 + ( *input++ ) * 8;
-					for ( j = 0; j < 2; j++ ) {
-						VQ2TO4( iaptr, ibptr, icptr, idptr );
-						VQ2TO4( iaptr, ibptr, icptr, idptr );
-					}
-				}
-			} else if ( cinTable[currentHandle].samplesPerPixel == 1 ) {
-				bbptr = (uint8_t *)bptr;
-				for ( i = 0; i < two; i++ ) {
-					y0 = *input++;
-					y1 = *input++;
-					y2 = *input++;
-					y3 = *input;
-					input += 3;
-					*bbptr++ = cinTable[currentHandle].gray[y0];
-					*bbptr++ = cinTable[currentHandle].gray[y1];
-					*bbptr++ = cinTable[currentHandle].gray[( ( y0 * 3 ) + y2 ) / 4];
-					*bbptr++ = cinTable[currentHandle].gray[( ( y1 * 3 ) + y3 ) / 4];
-					*bbptr++ = cinTable[currentHandle].gray[( y0 + ( y2 * 3 ) ) / 4];
-					*bbptr++ = cinTable[currentHandle].gray[( y1 + ( y3 * 3 ) ) / 4];
-					*bbptr++ = cinTable[currentHandle].gray[y2];
-					*bbptr++ = cinTable[currentHandle].gray[y3];
-				}
-
-				bcptr = (uint8_t *)vq4;
-				bdptr = (uint8_t *)vq8;
-
-				for ( i = 0; i < four; i++ ) {
-					baptr = (uint8_t *)vq2 + ( *input++ ) * 8;
-					bbptr = (uint8_t *)vq2 + ( *input++ ) * 8;
-					for ( j = 0; j < 2; j++ ) {
-						VQ2TO4( baptr,bbptr,bcptr,bdptr );
-						VQ2TO4( baptr,bbptr,bcptr,bdptr );
-					}
-				}
-			}
-		}
-	} else {
-//
-// 1/4 screen
-//
-		if ( cinTable[currentHandle].samplesPerPixel == 2 ) {
-			for ( i = 0; i < two; i++ ) {
-				y0 = *input; input += 2;
-				y2 = *input; input += 2;
-				cr = *input++;
-				cb = *input++;
-				*bptr++ = yuv_to_rgb( y0, cr, cb );
-				*bptr++ = yuv_to_rgb( y2, cr, cb );
-			}
-
-			cptr = (unsigned short *)vq4;
-			dptr = (unsigned short *)vq8;
-
-			for ( i = 0; i < four; i++ ) {
-				aptr = (unsigned short *)vq2 + ( *input++ ) * 2;
-				bptr = (unsigned short *)vq2 + ( *input++ ) * 2;
-				for ( j = 0; j < 2; j++ ) {
-					VQ2TO2( aptr,bptr,cptr,dptr );
-				}
-			}
-		} else if ( cinTable[currentHandle].samplesPerPixel == 1 ) {
-			bbptr = (uint8_t *)bptr;
-
-			for ( i = 0; i < two; i++ ) {
-				*bbptr++ = cinTable[currentHandle].gray[*input]; input += 2;
-				*bbptr++ = cinTable[currentHandle].gray[*input]; input += 4;
-			}
-
-			bcptr = (uint8_t *)vq4;
-			bdptr = (uint8_t *)vq8;
-
-			for ( i = 0; i < four; i++ ) {
-				baptr = (uint8_t *)vq2 + ( *input++ ) * 2;
-				bbptr = (uint8_t *)vq2 + ( *input++ ) * 2;
-				for ( j = 0; j < 2; j++ ) {
-					VQ2TO2( baptr,bbptr,bcptr,bdptr );
-				}
-			}
-		} else if ( cinTable[currentHandle].samplesPerPixel == 4 ) {
-			ibptr = (unsigned int *) bptr;
-			for ( i = 0; i < two; i++ ) {
-				y0 = *input; input += 2;
-				y2 = *input; input += 2;
-				cr = *input++;
-				cb = *input++;
-				*ibptr++ = yuv_to_rgb24( y0, cr, cb );
-				*ibptr++ = yuv_to_rgb24( y2, cr, cb );
-			}
-
-			icptr = (unsigned int *)vq4;
-			idptr = (unsigned int *)vq8;
-
-			for ( i = 0; i < four; i++ ) {
-				iaptr = (unsigned int *)vq2 + ( *input++ ) * 2;
-				ibptr = (unsigned int *)vq2 + ( *input++ ) * 2;
-				for ( j = 0; j < 2; j++ ) {
-					VQ2TO2( iaptr,ibptr,icptr,idptr );
-				}
-			}
-		}
-	}
-}
 
 static void recurseQuad( long startX, long startY, long quadSize, long xOff, long yOff ) {
 	uint8_t *scroff;
@@ -882,9 +461,6 @@ static void readQuadInfo( uint8_t *qData ) {
 	cinTable[currentHandle].half = false;
 	cinTable[currentHandle].smootheddouble = false;
 
-	cinTable[currentHandle].VQ0 = cinTable[currentHandle].VQNormal;
-	cinTable[currentHandle].VQ1 = cinTable[currentHandle].VQBuffer;
-	
 	cinTable[currentHandle].t[0] = cinTable[currentHandle].screenDelta;
 	cinTable[currentHandle].t[1] = -cinTable[currentHandle].screenDelta;
 
@@ -915,10 +491,8 @@ static void initRoQ() {
 		return;
 	}
 
-	cinTable[currentHandle].VQNormal = ( void( * ) ( uint8_t *, void * ) )blitVQQuad32fs;
-	cinTable[currentHandle].VQBuffer = ( void( * ) ( uint8_t *, void * ) )blitVQQuad32fs;
 	cinTable[currentHandle].samplesPerPixel = 4;
-	ROQ_GenYUVTables();
+	roq.init();
 	RllSetupTable();
 }
 
@@ -928,6 +502,7 @@ static void RoQReset() {
 		return;
 	}
 
+	CIN_FinishFrame();
 	FS_FCloseFile( cinTable[currentHandle].iFile );
 	FS_FOpenFileRead( cinTable[currentHandle].fileName, &cinTable[currentHandle].iFile, true );
 	FS_Read( cin.file, 16, cinTable[currentHandle].iFile );
@@ -967,22 +542,17 @@ redump:
 		if ( ( cinTable[currentHandle].numQuads & 1 ) ) {
 			cinTable[currentHandle].normalBuffer0 = cinTable[currentHandle].t[1];
 			RoQPrepMcomp( cinTable[currentHandle].roqF0, cinTable[currentHandle].roqF1 );
-			cinTable[currentHandle].VQ1( (uint8_t *)cin.qStatus[1], framedata );
-			cinTable[currentHandle].buf =   cin.linbuf + cinTable[currentHandle].screenDelta;
+			CIN_StartFrame( framedata, 1 );
 		} else {
 			cinTable[currentHandle].normalBuffer0 = cinTable[currentHandle].t[0];
 			RoQPrepMcomp( cinTable[currentHandle].roqF0, cinTable[currentHandle].roqF1 );
-			cinTable[currentHandle].VQ0( (uint8_t *)cin.qStatus[0], framedata );
-			cinTable[currentHandle].buf =   cin.linbuf;
-		}
-		if ( cinTable[currentHandle].numQuads == 0 ) {          // first frame
-			Com_Memcpy( cin.linbuf + cinTable[currentHandle].screenDelta, cin.linbuf, cinTable[currentHandle].samplesPerLine * cinTable[currentHandle].ysize );
+			CIN_StartFrame( framedata, 0 );
 		}
 		cinTable[currentHandle].numQuads++;
-		cinTable[currentHandle].dirty = true;
 		break;
 	case    ROQ_CODEBOOK:
-		decodeCodeBook( framedata, (unsigned short)cinTable[currentHandle].roq_flags );
+		CIN_FinishFrame();
+		roq.decodeCodeBook( framedata, (unsigned short)cinTable[currentHandle].roq_flags );
 		break;
 	case    ZA_SOUND_MONO:
 		if ( !cinTable[currentHandle].silent ) {
@@ -1006,6 +576,7 @@ redump:
 		break;
 	case    ROQ_QUAD_INFO:
 		if ( cinTable[currentHandle].numQuads == -1 ) {
+			CIN_FinishFrame();
 			readQuadInfo( framedata );
 			setupQuad( 0, 0 );
 			// we need to use CL_ScaledMilliseconds because of the smp mode calls from the renderer
@@ -1099,6 +670,7 @@ static void RoQ_init( void ) {
 static void RoQShutdown( void ) {
 	const char *s;
 
+	CIN_FinishFrame();
 	if ( !cinTable[currentHandle].buf ) {
 		return;
 	}
@@ -1145,6 +717,7 @@ e_status CIN_StopCinematic( int handle ) {
 
 	Com_DPrintf( "trFMV::stop(), closing %s\n", cinTable[currentHandle].fileName );
 
+	CIN_FinishFrame();
 	if ( !cinTable[currentHandle].buf ) {
 		return FMV_EOF;
 	}
@@ -1177,6 +750,9 @@ e_status CIN_RunCinematic( int handle ) {
 		return FMV_EOF;
 	}
 
+	// show the frame decoded since the last call
+	CIN_FinishFrame();
+
 	if ( cin.currentHandle != handle ) {
 		currentHandle = handle;
 		cin.currentHandle = currentHandle;
@@ -1283,6 +859,7 @@ int CIN_PlayCinematic( const char *arg, int x, int y, int w, int h, int systemBi
 
 	Com_DPrintf( "SCR_PlayCinematic( %s )\n", arg );
 
+	CIN_FinishFrame();
 	Com_Memset( &cin, 0, sizeof( cinematics_t ) );
 	currentHandle = CIN_HandleForVideo();
 
@@ -490,8 +490,7 @@ Draws the last few lines of output transparently over the game top
 */
 void Con_DrawNotify()
 {
-	int currentColor = 7;
-	re.SetColor( g_color_table[currentColor] );
+	textBatch_t batch( re.DrawStretchQuads );
 
 	int v = 0;
 	for (int i = con.current - NUM_CON_TIMES + 1 ; i <= con.current ; i++ )
@@ -517,16 +516,13 @@ void Con_DrawNotify()
 			if ( ( text[x] & 0xff ) == ' ' ) {
 				continue;
 			}
-			if ( ( ( text[x] >> 8 ) & 7 ) != currentColor ) {
-				currentColor = ( text[x] >> 8 ) & 7;
-				re.SetColor( g_color_table[currentColor] );
-			}
-			SCR_DrawSmallChar( cl_conXOffset->integer + con.xadjust + ( x + 1 ) * SMALLCHAR_WIDTH, v, text[x] & 0xff );
+			SCR_AddSmallChar( batch, cl_conXOffset->integer + con.xadjust + ( x + 1 ) * SMALLCHAR_WIDTH, v, text[x] & 0xff, g_color_table[( text[x] >> 8 ) & 7] );
 		}
 
 		v += SMALLCHAR_HEIGHT;
 	}
 
+	batch.flush();
 	re.SetColor( nullptr );
 
 	if ( cls.keyCatchers & ( KEYCATCH_UI | KEYCATCH_CGAME ) ) {
@@ -601,17 +597,19 @@ void Con_DrawSolidConsole( float frac )
 	color[3] = 0.6f;
 	SCR_FillRect( 0, y, SCREEN_WIDTH, 2, color );
 
-	// draw the version number
+	// the version number and the text go to the renderer in one piece
+	textBatch_t batch( re.DrawStretchQuads );
 
-	re.SetColor( g_color_table[ColorIndex( CONSOLE_COLOR )] );
+	// draw the version number
 
 	int i = strlen( Q3_VERSION );
 
 	for (int x = 0 ; x < i ; x++ ) {
 
-		SCR_DrawSmallChar( cls.glconfig.vidWidth - ( i - x ) * SMALLCHAR_WIDTH,
+		SCR_AddSmallChar( batch, cls.glconfig.vidWidth - ( i - x ) * SMALLCHAR_WIDTH,
 
-						   ( lines - ( SMALLCHAR_HEIGHT + SMALLCHAR_HEIGHT / 2 ) ), Q3_VERSION[x] );
+						  ( lines - ( SMALLCHAR_HEIGHT + SMALLCHAR_HEIGHT / 2 ) ), Q3_VERSION[x],
+						  g_color_table[ColorIndex( CONSOLE_COLOR )] );
 
 	}
 
@@ -625,9 +623,8 @@ void Con_DrawSolidConsole( float frac )
 	// draw from the bottom up
 	if ( con.display != con.current ) {
 		// draw arrows to show the buffer is backscrolled
-		re.SetColor( g_color_table[ColorIndex( COLOR_WHITE )] );
 		for (int x = 0 ; x < con.linewidth ; x += 4 ) {
-			SCR_DrawSmallChar( con.xadjust + ( x + 1 ) * SMALLCHAR_WIDTH, y, '^' );
+			SCR_AddSmallChar( batch, con.xadjust + ( x + 1 ) * SMALLCHAR_WIDTH, y, '^', g_color_table[ColorIndex( COLOR_WHITE )] );
 		}
 		y -= SMALLCHAR_HEIGHT;
 		rows--;
@@ -639,9 +636,6 @@ void Con_DrawSolidConsole( float frac )
 		row--;
 	}
 
-	int currentColor = 7;
-	re.SetColor( g_color_table[currentColor] );
-
 	for ( i = 0 ; i < rows ; i++, y -= SMALLCHAR_HEIGHT, row-- )
 	{
 		if ( row < 0 ) {
@@ -659,13 +653,10 @@ void Con_DrawSolidConsole( float frac )
 				continue;
 			}
 
-			if ( ( ( text[x] >> 8 ) & 7 ) != currentColor ) {
-				currentColor = ( text[x] >> 8 ) & 7;
-				re.SetColor( g_color_table[currentColor] );
-			}
-			SCR_DrawSmallChar(  con.xadjust + ( x + 1 ) * SMALLCHAR_WIDTH, y, text[x] & 0xff );
+			SCR_AddSmallChar( batch, con.xadjust + ( x + 1 ) * SMALLCHAR_WIDTH, y, text[x] & 0xff, g_color_table[( text[x] >> 8 ) & 7] );
 		}
 	}
+	batch.flush();
 
 	// draw the input prompt, user text, and cursor if desired
 	Con_DrawInput();
@@ -730,7 +730,7 @@ bool CL_ReadyToSendPacket( void ) {
 	int delta;
 
 	// don't send anything if playing back a demo
-	if ( cls.state == CA_CINEMATIC ) {
+	if ( clc.demoplaying || cls.state == CA_CINEMATIC ) {
 		return false;
 	}
 
@@ -778,7 +778,7 @@ void CL_WritePacket( void ) {
 	int count, key;
 
 	// don't send anything if playing back a demo
-	if (cls.state == CA_CINEMATIC ) {
+	if ( clc.demoplaying || cls.state == CA_CINEMATIC ) {
 		return;
 	}
 
@@ -827,7 +827,7 @@ void CL_WritePacket( void ) {
 		}
 
 		// begin a client move command
-		if ( cl_nodelta->integer || !cl.snap.valid
+		if ( cl_nodelta->integer || !cl.snap.valid || clc.demowaiting
 			 || clc.serverMessageSequence != cl.snap.messageNum ) {
 			MSG_WriteByte( &buf, clc_moveNoDelta );
 		} else {
@@ -32,9 +32,11 @@ If you have questions concerning this license or the applicable additional terms
 #include <limits.h>
 
 #include "../qcommon/clip_model.h"
+#include "../qcommon/frame_histogram.h"
 
 cvar_t  *cl_nodelta;
 cvar_t  *cl_debugMove;
+cvar_t  *cl_timedemo;
 
 cvar_t  *cl_noprint;
 cvar_t  *cl_motd;
@@ -179,6 +181,418 @@ void CL_ChangeReliableCommand()
 }
 
 
+/*
+=======================================================================
+
+CLIENT SIDE DEMO RECORDING
+
+A demo is the stream of server messages as the client received them,
+after the netchan header: for each message the int sequence number and
+the int length, then the message itself. A sequence and length of -1 end
+the file. Recording starts with a gamestate message built from the
+client's own state, so a demo can be started at any point in a game.
+
+=======================================================================
+*/
+
+// timedemo frame times, see CL_TimeDemoSample
+enum {
+	TIMEDEMO_FRAME,
+	TIMEDEMO_GAME,
+	TIMEDEMO_FRONTEND,
+	TIMEDEMO_BACKEND,
+
+	NUM_TIMEDEMO_HISTOGRAMS
+};
+
+static FrameHistogram timeDemoHistograms[NUM_TIMEDEMO_HISTOGRAMS];
+static const char *timeDemoHistogramNames[NUM_TIMEDEMO_HISTOGRAMS] = { "frame", "game", "frontend", "backend" };
+
+/*
+====================
+CL_WriteDemoMessage
+
+Dumps the current net message, prefixed by the length
+====================
+*/
+void CL_WriteDemoMessage( msg_t *msg, int headerBytes )
+{
+	// write the packet sequence
+	int swlen = LittleLong( clc.serverMessageSequence );
+	FS_Write( &swlen, 4, clc.demofile );
+
+	// skip the packet sequencing information
+	int len = msg->cursize - headerBytes;
+	swlen = LittleLong( len );
+	FS_Write( &swlen, 4, clc.demofile );
+	FS_Write( msg->data + headerBytes, len, clc.demofile );
+}
+
+/*
+====================
+CL_StopRecord_f
+
+stop recording a demo
+====================
+*/
+void CL_StopRecord_f()
+{
+	if ( !clc.demorecording ) {
+		Com_Printf( "Not recording a demo.\n" );
+		return;
+	}
+
+	// finish up
+	int len = -1;
+	FS_Write( &len, 4, clc.demofile );
+	FS_Write( &len, 4, clc.demofile );
+	FS_FCloseFile( clc.demofile );
+	clc.demofile = 0;
+	clc.demorecording = false;
+	Com_Printf( "Stopped demo.\n" );
+}
+
+/*
+====================
+CL_Record_f
+
+record <demoname>
+
+Begins recording a demo from the current position
+====================
+*/
+void CL_Record_f()
+{
+	char name[MAX_OSPATH];
+	uint8_t bufData[MAX_MSGLEN];
+	msg_t buf;
+
+	if ( Cmd_Argc() > 2 ) {
+		Com_Printf( "record <demoname>\n" );
+		return;
+	}
+
+	if ( clc.demorecording ) {
+		Com_Printf( "Already recording.\n" );
+		return;
+	}
+
+	if ( cls.state != CA_ACTIVE ) {
+		Com_Printf( "You must be in a level to record.\n" );
+		return;
+	}
+
+	if ( Cmd_Argc() == 2 ) {
+		snprintf( name, sizeof( name ), "demos/%s.dm_%d", Cmd_Argv( 1 ), PROTOCOL_VERSION );
+		Q_strncpyz( clc.demoName, Cmd_Argv( 1 ), sizeof( clc.demoName ) );
+	} else {
+		// scan for a free demo name
+		int number;
+		for ( number = 0 ; number <= 9999 ; number++ ) {
+			snprintf( clc.demoName, sizeof( clc.demoName ), "demo%04i", number );
+			snprintf( name, sizeof( name ), "demos/%s.dm_%d", clc.demoName, PROTOCOL_VERSION );
+			if ( !FS_FileExists( name ) ) {
+				break;  // file doesn't exist
+			}
+		}
+		if ( number > 9999 ) {
+			Com_Printf( "Too many demos recorded.\n" );
+			return;
+		}
+	}
+
+	// open the demo file
+	Com_Printf( "recording to %s.\n", name );
+	clc.demofile = FS_FOpenFileWrite( name );
+	if ( !clc.demofile ) {
+		Com_Printf( "ERROR: couldn't open.\n" );
+		return;
+	}
+	clc.demorecording = true;
+
+	// don't start saving messages until a non-delta compressed message is received
+	clc.demowaiting = true;
+
+	// write out the gamestate message
+	MSG_Init( &buf, bufData, sizeof( bufData ) );
+	MSG_Bitstream( &buf );
+
+	// NOTE, MRE: all server->client messages now acknowledge
+	MSG_WriteLong( &buf, clc.reliableSequence );
+
+	MSG_WriteByte( &buf, svc_gamestate );
+	MSG_WriteLong( &buf, clc.serverCommandSequence );
+
+	// configstrings
+	for ( int i = 0 ; i < MAX_CONFIGSTRINGS ; i++ ) {
+		if ( !cl.gameState.stringOffsets[i] ) {
+			continue;
+		}
+		MSG_WriteByte( &buf, svc_configstring );
+		MSG_WriteShort( &buf, i );
+		MSG_WriteBigString( &buf, cl.gameState.stringData + cl.gameState.stringOffsets[i] );
+	}
+
+	// baselines
+	EntityState nullstate;
+	memset( &nullstate, 0, sizeof( nullstate ) );
+	for ( int i = 0; i < MAX_GENTITIES ; i++ ) {
+		EntityState *ent = &cl.entityBaselines[i];
+		if ( !ent->number ) {
+			continue;
+		}
+		MSG_WriteByte( &buf, svc_baseline );
+		MSG_WriteDeltaEntity( &buf, &nullstate, ent, true );
+	}
+
+	MSG_WriteByte( &buf, svc_EOF );
+
+	// finished writing the gamestate stuff
+
+	// write the client num
+	MSG_WriteLong( &buf, clc.clientNum );
+	// write the checksum feed
+	MSG_WriteLong( &buf, clc.checksumFeed );
+
+	// finished writing the client packet
+	MSG_WriteByte( &buf, svc_EOF );
+
+	// write it to the demo file
+	int len = LittleLong( clc.serverMessageSequence - 1 );
+	FS_Write( &len, 4, clc.demofile );
+
+	len = LittleLong( buf.cursize );
+	FS_Write( &len, 4, clc.demofile );
+	FS_Write( buf.data, buf.cursize, clc.demofile );
+
+	// the rest of the demo file will be copied from net messages
+}
+
+/*
+=======================================================================
+
+CLIENT SIDE DEMO PLAYBACK
+
+=======================================================================
+*/
+
+/*
+=================
+CL_TimeDemoSample
+
+Called by Com_Frame after each frame while com_timeFrames is set
+=================
+*/
+void CL_TimeDemoSample( int frameUsec )
+{
+	// only count the frames the timedemo drove, not loading
+	if ( !clc.demoplaying || !clc.timeDemoStart ) {
+		return;
+	}
+
+	timeDemoHistograms[TIMEDEMO_FRAME].add( frameUsec );
+	timeDemoHistograms[TIMEDEMO_GAME].add( time_game * 1000 );
+	timeDemoHistograms[TIMEDEMO_FRONTEND].add( time_frontend * 1000 );
+	timeDemoHistograms[TIMEDEMO_BACKEND].add( time_backend * 1000 );
+}
+
+/*
+=================
+CL_TimeDemoReport
+
+game is only nonzero if a local server was running alongside the demo.
+=================
+*/
+static void CL_TimeDemoReport()
+{
+	Com_Printf( "%-8s %8s %8s %8s %8s %8s %8s (msec)\n", "", "min", "mean", "p50", "p95", "p99", "max" );
+	for ( int i = 0 ; i < NUM_TIMEDEMO_HISTOGRAMS ; i++ ) {
+		const FrameHistogram& h = timeDemoHistograms[i];
+		Com_Printf( "%-8s %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n", timeDemoHistogramNames[i],
+					h.minUsec * 0.001f, h.mean() * 0.001f, h.percentile( 50 ) * 0.001f,
+					h.percentile( 95 ) * 0.001f, h.percentile( 99 ) * 0.001f, h.maxUsec * 0.001f );
+	}
+
+	// the whole frame distribution, one line per occupied bucket
+	const FrameHistogram& frame = timeDemoHistograms[TIMEDEMO_FRAME];
+	Com_Printf( "frame time histogram:\n" );
+	for ( int b = 0 ; b < FrameHistogram::NUM_BUCKETS ; b++ ) {
+		if ( !frame.buckets[b] ) {
+			continue;
+		}
+		char bar[41];
+		int width = frame.buckets[b] * 40 / frame.count;
+		memset( bar, '#', width );
+		bar[width] = 0;
+		if ( b == FrameHistogram::NUM_BUCKETS - 1 ) {
+			Com_Printf( "%8.2f +        %7i %s\n", FrameHistogram::lowerBound( b ) * 0.001f, frame.buckets[b], bar );
+		} else {
+			Com_Printf( "%8.2f - %6.2f %7i %s\n", FrameHistogram::lowerBound( b ) * 0.001f,
+						FrameHistogram::upperBound( b ) * 0.001f, frame.buckets[b], bar );
+		}
+	}
+}
+
+/*
+=================
+CL_DemoCompleted
+=================
+*/
+void CL_DemoCompleted()
+{
+	if ( cl_timedemo && cl_timedemo->integer ) {
+		int time = Sys_Milliseconds() - clc.timeDemoStart;
+		if ( time > 0 ) {
+			Com_Printf( "%i frames, %3.1f seconds: %3.1f fps\n", clc.timeDemoFrames,
+						time / 1000.0, clc.timeDemoFrames * 1000.0 / time );
+		}
+		CL_TimeDemoReport();
+		com_timeFrames = false;
+	}
+
+	CL_Disconnect( true );
+	CL_NextDemo();
+}
+
+/*
+=================
+CL_ReadDemoMessage
+=================
+*/
+void CL_ReadDemoMessage()
+{
+	uint8_t bufData[MAX_MSGLEN];
+	msg_t buf;
+	int s;
+
+	if ( !clc.demofile ) {
+		CL_DemoCompleted();
+		return;
+	}
+
+	// get the sequence number
+	size_t r = FS_Read( &s, 4, clc.demofile );
+	if ( r != 4 ) {
+		CL_DemoCompleted();
+		return;
+	}
+	clc.serverMessageSequence = LittleLong( s );
+
+	// init the message
+	MSG_Init( &buf, bufData, sizeof( bufData ) );
+
+	// get the length
+	r = FS_Read( &buf.cursize, 4, clc.demofile );
+	if ( r != 4 ) {
+		CL_DemoCompleted();
+		return;
+	}
+	buf.cursize = LittleLong( buf.cursize );
+	if ( buf.cursize == -1 ) {
+		CL_DemoCompleted();
+		return;
+	}
+	if ( buf.cursize < 0 || buf.cursize > buf.maxsize ) {
+		Com_Error( ERR_DROP, "CL_ReadDemoMessage: demoMsglen > MAX_MSGLEN" );
+		return;  // Keep linter happy. ERR_DROP does not return
+	}
+	r = FS_Read( buf.data, buf.cursize, clc.demofile );
+	if ( r != (size_t)buf.cursize ) {
+		Com_Printf( "Demo file was truncated.\n" );
+		CL_DemoCompleted();
+		return;
+	}
+
+	clc.lastPacketTime = cls.realtime;
+	buf.readcount = 0;
+	CL_ParseServerMessage( &buf );
+}
+
+/*
+====================
+CL_PlayDemo_f
+
+demo <demoname>
+
+With timedemo set the demo is played back as fast as possible and frame
+time statistics are reported at the end
+====================
+*/
+void CL_PlayDemo_f()
+{
+	char name[MAX_OSPATH];
+
+	if ( Cmd_Argc() != 2 ) {
+		Com_Printf( "demo <demoname>\n" );
+		return;
+	}
+
+	// make sure a local server is killed, demos are played without one
+	if ( com_sv_running->integer ) {
+		SV_Shutdown( "Server quit\n" );
+	}
+	Cvar_Set( "sv_killserver", "1" );
+	SV_Frame( 0 );
+
+	CL_Disconnect( true );
+
+	// open the demo file
+	const char *arg = Cmd_Argv( 1 );
+	snprintf( name, sizeof( name ), "demos/%s.dm_%d", arg, PROTOCOL_VERSION );
+	FS_FOpenFileRead( name, &clc.demofile, true );
+	if ( !clc.demofile ) {
+		Com_Error( ERR_DROP, "couldn't open %s", name );
+		return;  // Keep linter happy. ERR_DROP does not return
+	}
+	Q_strncpyz( clc.demoName, arg, sizeof( clc.demoName ) );
+
+	Con_Close();
+
+	cls.state = CA_CONNECTED;
+	clc.demoplaying = true;
+	Q_strncpyz( cls.servername, arg, sizeof( cls.servername ) );
+
+	if ( cl_timedemo->integer ) {
+		for ( int i = 0 ; i < NUM_TIMEDEMO_HISTOGRAMS ; i++ ) {
+			timeDemoHistograms[i].clear();
+		}
+		com_timeFrames = true;
+	}
+
+	// read demo messages until connected
+	while ( cls.state >= CA_CONNECTED && cls.state < CA_PRIMED ) {
+		CL_ReadDemoMessage();
+	}
+	// don't get the first snapshot this frame, to prevent the long
+	// time from the gamestate load from messing causing a time skip
+	clc.firstDemoFrameSkipped = false;
+}
+
+/*
+==================
+CL_NextDemo
+
+Called when a demo finishes
+If the "nextdemo" cvar is set, that command will be issued
+==================
+*/
+void CL_NextDemo()
+{
+	char v[MAX_STRING_CHARS];
+
+	Q_strncpyz( v, Cvar_VariableString( "nextdemo" ), sizeof( v ) );
+	v[MAX_STRING_CHARS - 1] = 0;
+	Com_DPrintf( "CL_NextDemo: %s\n", v );
+	if ( !v[0] ) {
+		return;
+	}
+
+	Cvar_Set( "nextdemo","" );
+	Cbuf_AddText( v );
+	Cbuf_AddText( "\n" );
+	Cbuf_Execute();
+}
+
 /*
 =====================
 CL_ShutdownAll
@@ -306,9 +720,19 @@ void CL_Disconnect( bool showMainMenu )
 	SCR_StopCinematic();
 	S_ClearSoundBuffer( true );
 
+	// stop recording any demo
+	if ( clc.demorecording ) {
+		CL_StopRecord_f();
+	}
+
+	if ( clc.demofile ) {
+		FS_FCloseFile( clc.demofile );
+		clc.demofile = 0;
+	}
+
 	// send a disconnect message to the server
 	// send it a few times in case one is dropped
-	if ( cls.state >= CA_CONNECTED ) {
+	if ( cls.state >= CA_CONNECTED && !clc.demoplaying ) {
 		CL_AddReliableCommand( "disconnect" );
 		CL_WritePacket();
 		CL_WritePacket();
@@ -1088,6 +1512,14 @@ void CL_PacketEvent( netadr_t from, msg_t *msg )
 
 	clc.lastPacketTime = cls.realtime;
 	CL_ParseServerMessage( msg );
+
+	//
+	// we don't know if it is ok to save a demo message until
+	// after we have parsed the frame
+	//
+	if ( clc.demorecording && !clc.demowaiting ) {
+		CL_WriteDemoMessage( msg, headerBytes );
+	}
 }
 
 /*
@@ -1561,6 +1993,8 @@ void CL_Init()
 
 	cl_timeout = Cvar_Get( "cl_timeout", "200", 0 );
 
+	cl_timedemo = Cvar_Get( "timedemo", "0", 0 );
+
 	cl_timeNudge = Cvar_Get( "cl_timeNudge", "0", CVAR_TEMP );
 
 	cl_showSend = Cvar_Get( "cl_showSend", "0", CVAR_TEMP );
@@ -1680,6 +2114,9 @@ void CL_Init()
 	Cmd_AddCommand( "snd_restart", CL_Snd_Restart_f );
 	Cmd_AddCommand( "vid_restart", CL_Vid_Restart_f );
 	Cmd_AddCommand( "disconnect", CL_Disconnect_f );
+	Cmd_AddCommand( "record", CL_Record_f );
+	Cmd_AddCommand( "stoprecord", CL_StopRecord_f );
+	Cmd_AddCommand( "demo", CL_PlayDemo_f );
 	Cmd_AddCommand( "cinematic", CL_PlayCinematic_f );
 	Cmd_AddCommand( "connect", CL_Connect_f );
 	Cmd_AddCommand( "reconnect", CL_Reconnect_f );
@@ -1736,6 +2173,7 @@ void CL_Shutdown()
 	recursive = true;
 
 	CL_Disconnect( true );
+	CIN_CloseAllVideos();
 
 	S_Shutdown();
 	CL_ShutdownRef();
@@ -1751,6 +2189,7 @@ void CL_Shutdown()
 	Cmd_RemoveCommand( "record" );
 	Cmd_RemoveCommand( "cinematic" );
 	Cmd_RemoveCommand( "stoprecord" );
+	Cmd_RemoveCommand( "demo" );
 	Cmd_RemoveCommand( "connect" );
 	Cmd_RemoveCommand( "rcon" );
 	Cmd_RemoveCommand( "setenv" );
@@ -214,6 +214,7 @@ void CL_ParseSnapshot( msg_t *msg )
 	if ( newSnap.deltaNum <= 0 ) {
 		newSnap.valid = true;      // uncompressed frame
 		old = nullptr;
+		clc.demowaiting = false;   // we can start recording now
 
 	} else {
 		old = &cl.snapshots[newSnap.deltaNum & PACKET_MASK];
@@ -90,10 +90,10 @@ void SCR_DrawPic( float x, float y, float width, float height, qhandle_t hShader
 }
 
 /*
-** SCR_DrawChar
-** chars are drawn at 640*480 virtual screen size
+** SCR_DrawSmallChar
+** small chars are drawn at native screen resolution
 */
-static void SCR_DrawChar( int x, int y, float size, int ch )
+void SCR_DrawSmallChar( int x, int y, int ch )
 {
 	ch &= 255;
 
@@ -101,34 +101,29 @@ static void SCR_DrawChar( int x, int y, float size, int ch )
 		return;
 	}
 
-	if ( y < -size ) {
+	if ( y < -SMALLCHAR_HEIGHT ) {
 		return;
 	}
 
-	float ax = x;
-	float ay = y;
-	float aw = size;
-	float ah = size;
-	SCR_AdjustFrom640( &ax, &ay, &aw, &ah );
-
 	int row = ch >> 4;
 	int col = ch & 15;
 
 	float frow = row * 0.0625;
 	float fcol = col * 0.0625;
-	size = 0.0625;
+	float size = 0.0625;
 
-	re.DrawStretchPic( ax, ay, aw, ah,
+	re.DrawStretchPic( x, y, SMALLCHAR_WIDTH, SMALLCHAR_HEIGHT,
 					   fcol, frow,
 					   fcol + size, frow + size,
 					   cls.charSetShader );
 }
 
+
 /*
-** SCR_DrawSmallChar
-** small chars are drawn at native screen resolution
+** SCR_AddChar
+** chars are drawn at 640*480 virtual screen size
 */
-void SCR_DrawSmallChar( int x, int y, int ch )
+static void SCR_AddChar( textBatch_t &batch, int x, int y, float size, int ch, const float *color )
 {
 	ch &= 255;
 
@@ -136,21 +131,42 @@ void SCR_DrawSmallChar( int x, int y, int ch )
 		return;
 	}
 
-	if ( y < -SMALLCHAR_HEIGHT ) {
+	if ( y < -size ) {
 		return;
 	}
 
-	int row = ch >> 4;
-	int col = ch & 15;
+	float ax = x;
+	float ay = y;
+	float aw = size;
+	float ah = size;
+	SCR_AdjustFrom640( &ax, &ay, &aw, &ah );
 
-	float frow = row * 0.0625;
-	float fcol = col * 0.0625;
-	float size = 0.0625;
+	float frow = ( ch >> 4 ) * 0.0625;
+	float fcol = ( ch & 15 ) * 0.0625;
 
-	re.DrawStretchPic( x, y, SMALLCHAR_WIDTH, SMALLCHAR_HEIGHT,
-					   fcol, frow,
-					   fcol + size, frow + size,
-					   cls.charSetShader );
+	batch.add( cls.charSetShader, ax, ay, aw, ah, fcol, frow, fcol + 0.0625, frow + 0.0625, color );
+}
+
+/*
+** SCR_AddSmallChar
+** SCR_DrawSmallChar into a batch, for drawing a line at a time
+*/
+void SCR_AddSmallChar( textBatch_t &batch, int x, int y, int ch, const float *color )
+{
+	ch &= 255;
+
+	if ( ch == ' ' ) {
+		return;
+	}
+
+	if ( y < -SMALLCHAR_HEIGHT ) {
+		return;
+	}
+
+	float frow = ( ch >> 4 ) * 0.0625;
+	float fcol = ( ch & 15 ) * 0.0625;
+
+	batch.add( cls.charSetShader, x, y, SMALLCHAR_WIDTH, SMALLCHAR_HEIGHT, fcol, frow, fcol + 0.0625, frow + 0.0625, color );
 }
 
 
@@ -166,11 +182,11 @@ Coordinates are at 640 by 480 virtual resolution
 */
 void SCR_DrawStringExt( int x, int y, float size, const char *string, float *setColor, bool forceColor )
 {
+	textBatch_t batch( re.DrawStretchQuads );
 	vec4_t color;
 	// draw the drop shadow
 	color[0] = color[1] = color[2] = 0;
 	color[3] = setColor[3];
-	re.SetColor( color );
 	const char* s = string;
 	int xx = x;
 	while ( *s ) {
@@ -178,7 +194,7 @@ void SCR_DrawStringExt( int x, int y, float size, const char *string, float *set
 			s += 2;
 			continue;
 		}
-		SCR_DrawChar( xx + 2, y + 2, size, *s );
+		SCR_AddChar( batch, xx + 2, y + 2, size, *s, color );
 		xx += size;
 		s++;
 	}
@@ -187,21 +203,21 @@ void SCR_DrawStringExt( int x, int y, float size, const char *string, float *set
 	// draw the colored text
 	s = string;
 	xx = x;
-	re.SetColor( setColor );
+	Vector4Copy( setColor, color );
 	while ( *s ) {
 		if ( Q_IsColorString( s ) ) {
 			if ( !forceColor ) {
 				memcpy( color, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( color ) );
 				color[3] = setColor[3];
-				re.SetColor( color );
 			}
 			s += 2;
 			continue;
 		}
-		SCR_DrawChar( xx, y, size, *s );
+		SCR_AddChar( batch, xx, y, size, *s, color );
 		xx += size;
 		s++;
 	}
+	batch.flush();
 	re.SetColor( nullptr );
 }
 
@@ -232,25 +248,26 @@ Coordinates are at 640 by 480 virtual resolution
 */
 void SCR_DrawSmallStringExt( int x, int y, const char *string, float *setColor, bool forceColor )
 {
+	textBatch_t batch( re.DrawStretchQuads );
 	vec4_t color;
 	// draw the colored text
 	const char*s = string;
 	int xx = x;
-	re.SetColor( setColor );
+	Vector4Copy( setColor, color );
 	while ( *s ) {
 		if ( Q_IsColorString( s ) ) {
 			if ( !forceColor ) {
 				memcpy( color, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( color ) );
 				color[3] = setColor[3];
-				re.SetColor( color );
 			}
 			s += 2;
 		} else {
-			SCR_DrawSmallChar( xx, y, *s );
+			SCR_AddSmallChar( batch, xx, y, *s, color );
 			xx += SMALLCHAR_WIDTH;
 			s++;
 		}
 	}
+	batch.flush();
 	re.SetColor( nullptr );
 }
 
@@ -359,7 +376,7 @@ void SCR_UpdateScreen()
 		SCR_DrawScreenField( STEREO_CENTER );
 	}
 
-	if ( com_speeds->integer ) {
+	if ( com_speeds->integer || com_timeFrames ) {
 		re.EndFrame( &time_frontend, &time_backend );
 	} else {
 		re.EndFrame( nullptr, nullptr );
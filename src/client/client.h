@@ -193,6 +193,18 @@ typedef struct {
 	int lastExecutedServerCommand;              // last server command grabbed or executed with CL_GetServerCommand
 	char serverCommands[MAX_RELIABLE_COMMANDS][MAX_TOKEN_CHARS];
 
+	// demo information
+	char demoName[MAX_QPATH];
+	bool demorecording;
+	bool demoplaying;
+	bool demowaiting;                       // don't record until a non-delta message is received
+	bool firstDemoFrameSkipped;
+	fileHandle_t demofile;
+
+	int timeDemoFrames;                     // counter of rendered frames
+	int timeDemoStart;                      // Sys_Milliseconds() before first frame
+	int timeDemoBaseTime;                   // each frame will be at this time + frameNum * 50
+
 	// big stuff at end of structure so most offsets are 15 bits or less
 	netchan_t netchan;
 } clientConnection_t;
@@ -380,6 +392,7 @@ void CL_Snd_Restart_f( void );
 void CL_StartDemoLoop( void );
 void CL_NextDemo( void );
 void CL_ReadDemoMessage( void );
+void CL_StopRecord_f( void );
 
 void CL_ShutdownRef( void );
 void CL_InitRef( void );
@@ -502,6 +515,7 @@ void    SCR_DrawBigString( int x, int y, const char *s, float alpha );
 void    SCR_DrawBigStringColor( int x, int y, const char *s, vec4_t color );    // ignores embedded color control characters
 void    SCR_DrawSmallStringExt( int x, int y, const char *string, float *setColor, bool forceColor );
 void    SCR_DrawSmallChar( int x, int y, int ch );
+void    SCR_AddSmallChar( textBatch_t &batch, int x, int y, int ch, const float *color );
 
 
 //
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define ROQ_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief The video half of a RoQ decoder: codebooks and VQ frames, 32 bit pixels.
+ *
+ * A codebook chunk is a list of 2x2 cells, four Y and one Cr and Cb each,
+ * followed by 4x4 cells made of four 2x2 cells. decodeCodeBook converts the
+ * 2x2 cells to RGBA and builds the 4x4 cells, and the 4x4 cells doubled to
+ * 8x8, which is what a frame blits. With SSE2 the four pixels of a cell are
+ * converted at once and the cells are expanded a row at a time; the results
+ * are the same bit for bit as decodeCodeBookScalar, which does it pixel by
+ * pixel the way the original decoder did.
+ *
+ * decodeVQ draws a VQ frame. status is the list of the 8x8 blocks of the
+ * frame, each followed by its four 4x4 blocks and ending with a null, and
+ * mcomp the offsets from a block to where motion compensation copies it from,
+ * which is in the other frame buffer. It only reads the tables, so a frame can
+ * be decoded on another thread as long as nothing decodes a codebook meanwhile.
+ *
+ * Call init() once to build the YUV tables.
+ */
+class RoqDecoder
+{
+public:
+    void init() {
+        const float ub = (1.77200f / 2.0f) * (float)(1 << 6) + 0.5f;
+        const float vr = (1.40200f / 2.0f) * (float)(1 << 6) + 0.5f;
+        const float ug = (0.34414f / 2.0f) * (float)(1 << 6) + 0.5f;
+        const float vg = (0.71414f / 2.0f) * (float)(1 << 6) + 0.5f;
+        for (int i = 0; i < 256; i++) {
+            const float x = (float)(2 * i - 255);
+            ubTab[i] = (int)((ub * x) + (1 << 5));
+            vrTab[i] = (int)((vr * x) + (1 << 5));
+            ugTab[i] = (int)((-ug * x));
+            vgTab[i] = (int)((-vg * x) + (1 << 5));
+            yyTab[i] = (int)((i << 6) | (i >> 2));
+        }
+    }
+
+    void decodeCodeBook(const uint8_t* input, unsigned roqFlags) {
+#ifdef ROQ_SSE2
+        int two, four;
+        cellCounts(roqFlags, two, four);
+
+        const __m128i alpha = _mm_set1_epi32(255);
+        for (int i = 0; i < two; i++, input += 6) {
+            const int cr = input[4];
+            const int cb = input[5];
+            const __m128i yy = _mm_setr_epi32(yyTab[input[0]], yyTab[input[1]], yyTab[input[2]], yyTab[input[3]]);
+            const __m128i r = _mm_srai_epi32(_mm_add_epi32(yy, _mm_set1_epi32(vrTab[cb])), 6);
+            const __m128i g = _mm_srai_epi32(_mm_add_epi32(yy, _mm_set1_epi32(ugTab[cr] + vgTab[cb])), 6);
+            const __m128i b = _mm_srai_epi32(_mm_add_epi32(yy, _mm_set1_epi32(ubTab[cr])), 6);
+            // clamped to bytes as r0-3 b0-3 g0-3 a0-3, then interleaved to r g b a per pixel
+            __m128i p = _mm_packus_epi16(_mm_packs_epi32(r, b), _mm_packs_epi32(g, alpha));
+            p = _mm_unpacklo_epi8(p, _mm_srli_si128(p, 8));
+            p = _mm_unpacklo_epi16(p, _mm_srli_si128(p, 8));
+            _mm_store_si128((__m128i*)&cells2[i * 4], p);
+        }
+
+        // two 2x2 cells side by side are two rows of a 4x4 cell, and doubled four rows of an 8x8 one
+        uint32_t* c = cells4;
+        uint32_t* d = cells8;
+        for (int i = 0; i < four; i++, input += 2, c += 8, d += 32) {
+            const __m128i a = _mm_load_si128((const __m128i*)&cells2[input[0] * 4]);
+            const __m128i b = _mm_load_si128((const __m128i*)&cells2[input[1] * 4]);
+            _mm_store_si128((__m128i*)(c + 0), _mm_unpacklo_epi64(a, b));
+            _mm_store_si128((__m128i*)(c + 4), _mm_unpackhi_epi64(a, b));
+
+            const __m128i topA = _mm_unpacklo_epi32(a, a);
+            const __m128i topB = _mm_unpacklo_epi32(b, b);
+            const __m128i bottomA = _mm_unpackhi_epi32(a, a);
+            const __m128i bottomB = _mm_unpackhi_epi32(b, b);
+            _mm_store_si128((__m128i*)(d + 0), topA);
+            _mm_store_si128((__m128i*)(d + 4), topB);
+            _mm_store_si128((__m128i*)(d + 8), topA);
+            _mm_store_si128((__m128i*)(d + 12), topB);
+            _mm_store_si128((__m128i*)(d + 16), bottomA);
+            _mm_store_si128((__m128i*)(d + 20), bottomB);
+            _mm_store_si128((__m128i*)(d + 24), bottomA);
+            _mm_store_si128((__m128i*)(d + 28), bottomB);
+        }
+#else
+        decodeCodeBookScalar(input, roqFlags);
+#endif
+    }
+
+    void decodeCodeBookScalar(const uint8_t* input, unsigned roqFlags) {
+        int two, four;
+        cellCounts(roqFlags, two, four);
+
+        uint32_t* cell = cells2;
+        for (int i = 0; i < two; i++, input += 6) {
+            const int cr = input[4];
+            const int cb = input[5];
+            for (int j = 0; j < 4; j++) {
+                *cell++ = yuvToRgba(input[j], cr, cb);
+            }
+        }
+
+        uint32_t* c = cells4;
+        uint32_t* d = cells8;
+        for (int i = 0; i < four; i++, input += 2) {
+            const uint32_t* a = &cells2[input[0] * 4];
+            const uint32_t* b = &cells2[input[1] * 4];
+            for (int j = 0; j < 2; j++, a += 2, b += 2) {
+                *c++ = a[0];
+                *c++ = a[1];
+                *c++ = b[0];
+                *c++ = b[1];
+                for (int row = 0; row < 2; row++) {
+                    *d++ = a[0];
+                    *d++ = a[0];
+                    *d++ = a[1];
+                    *d++ = a[1];
+                    *d++ = b[0];
+                    *d++ = b[0];
+                    *d++ = b[1];
+                    *d++ = b[1];
+                }
+            }
+        }
+    }
+
+    // spl is the bytes per line of the frame buffers
+    void decodeVQ(uint8_t* const* status, const uint8_t* data, int spl, const int mcomp[256]) const {
+        uint16_t newd = 0;
+        uint16_t celdata = 0;
+        unsigned index = 0;
+
+        // the codes are two bits each, eight to a little endian word
+        auto nextCode = [&]() {
+            if (!newd) {
+                newd = 7;
+                celdata = (uint16_t)(data[0] + data[1] * 256);
+                data += 2;
+            } else {
+                newd--;
+            }
+            const unsigned code = celdata & 0xc000;
+            celdata = (uint16_t)(celdata << 2);
+            return code;
+        };
+
+        do {
+            switch (nextCode()) {
+            case 0x8000:                                // 8x8 vq code
+                copyBlock<8>(status[index], spl, (const uint8_t*)&cells8[*data++ * 64], 32);
+                index += 5;
+                break;
+            case 0xc000:                                // split into 4x4 blocks
+                index++;
+                for (int i = 0; i < 4; i++, index++) {
+                    uint8_t* block = status[index];
+                    switch (nextCode()) {
+                    case 0x8000:                        // 4x4 vq code
+                        copyBlock<4>(block, spl, (const uint8_t*)&cells4[*data++ * 16], 16);
+                        break;
+                    case 0xc000:                        // four 2x2 vq codes
+                        copyBlock<2>(block, spl, (const uint8_t*)&cells2[*data++ * 4], 8);
+                        copyBlock<2>(block + 8, spl, (const uint8_t*)&cells2[*data++ * 4], 8);
+                        copyBlock<2>(block + spl * 2, spl, (const uint8_t*)&cells2[*data++ * 4], 8);
+                        copyBlock<2>(block + spl * 2 + 8, spl, (const uint8_t*)&cells2[*data++ * 4], 8);
+                        break;
+                    case 0x4000:                        // motion compensation
+                        copyBlock<4>(block, spl, block + mcomp[*data++], spl);
+                        break;
+                    }
+                }
+                break;
+            case 0x4000:                                // motion compensation
+                copyBlock<8>(status[index], spl, status[index] + mcomp[*data++], spl);
+                index += 5;
+                break;
+            case 0x0000:                                // unchanged
+                index += 5;
+                break;
+            }
+        } while (status[index] != nullptr);
+    }
+
+    const uint32_t* codeBook2() const {
+        return cells2;
+    }
+
+    const uint32_t* codeBook4() const {
+        return cells4;
+    }
+
+    const uint32_t* codeBook8() const {
+        return cells8;
+    }
+
+private:
+    // 0 for both means a full codebook
+    static void cellCounts(unsigned roqFlags, int& two, int& four) {
+        if (!roqFlags) {
+            two = four = 256;
+        } else {
+            two = (roqFlags >> 8) & 0xff;
+            if (!two) {
+                two = 256;
+            }
+            four = roqFlags & 0xff;
+        }
+        four *= 2;                                      // half a 4x4 cell at a time
+    }
+
+    uint32_t yuvToRgba(int y, int u, int v) const {
+        const int yy = yyTab[y];
+        int r = (yy + vrTab[v]) >> 6;
+        int g = (yy + ugTab[u] + vgTab[v]) >> 6;
+        int b = (yy + ubTab[u]) >> 6;
+        r = r < 0 ? 0 : r > 255 ? 255 : r;
+        g = g < 0 ? 0 : g > 255 ? 255 : g;
+        b = b < 0 ? 0 : b > 255 ? 255 : b;
+        return 0xff000000u | (b << 16) | (g << 8) | r;
+    }
+
+    // a block of SIZE x SIZE pixels
+    template <int SIZE>
+    static void copyBlock(uint8_t* dst, int dstPitch, const uint8_t* src, int srcPitch) {
+        for (int y = 0; y < SIZE; y++, dst += dstPitch, src += srcPitch) {
+#ifdef ROQ_SSE2
+            if (SIZE == 2) {
+                _mm_storel_epi64((__m128i*)dst, _mm_loadl_epi64((const __m128i*)src));
+            } else {
+                for (int x = 0; x < SIZE * 4; x += 16) {
+                    _mm_storeu_si128((__m128i*)(dst + x), _mm_loadu_si128((const __m128i*)(src + x)));
+                }
+            }
+#else
+            std::memcpy(dst, src, SIZE * 4);
+#endif
+        }
+    }
+
+    int yyTab[256];
+    int ubTab[256];
+    int ugTab[256];
+    int vgTab[256];
+    int vrTab[256];
+
+    alignas(16) uint32_t cells2[256 * 4];
+    alignas(16) uint32_t cells4[256 * 16];
+    alignas(16) uint32_t cells8[256 * 64];
+};
@@ -38,6 +38,7 @@ If you have questions concerning this license or the applicable additional terms
 
 #include "snd_local.h"
 #include "client.h"
+#include "../qcommon/profiler.h"
 
 void S_Play_f( void );
 void S_SoundList_f( void );
@@ -1545,6 +1546,8 @@ void S_Update_Mix( void ) {
 	float ma, op;
 	float thisTime, sane;
 
+	PROFILE_ZONE( "S_Update_Mix" );
+
 	if ( !snd.s_soundStarted || ( snd.s_soundMute == 1 ) ) {
 		return;
 	}
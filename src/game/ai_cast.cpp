@@ -82,6 +82,8 @@ float aicast_skillscale;
 vmCvar_t aicast_debug;
 vmCvar_t aicast_debugname;
 vmCvar_t aicast_scripts;
+vmCvar_t aicast_speeds;
+vmCvar_t aicast_viscache;
 
 // string versions of the attributes used for per-level, per-character definitions
 const char *castAttributeStrings[] =
@@ -117,25 +119,16 @@ AICast_Printf
 ============
 */
 void AICast_Printf( int type, const char *fmt, ... ) {
-	char str[2048];
 	va_list ap;
 
+	// don't format what won't be printed
+	if ( type != AICAST_PRT_ALWAYS && aicast_debug.integer < type ) {
+		return;
+	}
+
 	va_start( ap, fmt );
-	vsnprintf( str, 2048, fmt, ap );
+	Com_LogVPrintf( LOG_AI, type == AICAST_PRT_ALWAYS ? LOG_INFO : LOG_DEBUG, fmt, ap );
 	va_end( ap );
-
-	switch ( type ) {
-	case AICAST_PRT_ALWAYS: {
-		Com_Printf( "%s", str );
-		break;
-	}
-	default: {
-		if ( aicast_debug.integer >= type ) {
-			Com_Printf( "%s", str );
-		}
-		break;
-	}
-	}
 }
 
 /*
@@ -400,6 +393,7 @@ GameEntity *AICast_CreateCharacter( GameEntity *ent, float *attributes, cast_wea
 	newent->aiName = ent->aiName;
 	newent->aiTeam = ent->aiTeam;
 	newent->targetname = ent->targetname;
+	G_IndexEntity( newent );
 	//
 	newent->AIScript_AlertEntity = ent->AIScript_AlertEntity;
 	newent->aiInactive = ent->aiInactive;
@@ -476,6 +470,8 @@ void AICast_Init( void ) {
 	Cvar_Register( &aicast_debug, "aicast_debug", "1", 0 );
 	Cvar_Register( &aicast_debugname, "aicast_debugname", "", 0 );
 	Cvar_Register( &aicast_scripts, "aicast_scripts", "1", 0 );
+	Cvar_Register( &aicast_speeds, "aicast_speeds", "0", 0 );
+	Cvar_Register( &aicast_viscache, "aicast_viscache", "1", 0 );  // 2 = validate against fresh traces
 
 	// (aicast_thinktime / sv_fps) * aicast_maxthink = number of cast's to think between each aicast frame
 	// so..
@@ -495,6 +491,7 @@ void AICast_Init( void ) {
 
 	caststates = (cast_state_t *)G_Alloc( aicast_maxclients * sizeof( cast_state_t ) );
 	memset( caststates, 0, aicast_maxclients * sizeof( cast_state_t ) );
+	AICast_InitVisCache();
 	for ( i = 0; i < MAX_CLIENTS; i++ ) {
 		caststates[i].entityNum = i;
 	}
@@ -648,7 +645,7 @@ void AICast_DelayedSpawnCast( GameEntity *ent, int castType )
 	// otherwise the server will just delete it, since it's treated like a client
 	// have to wait more than 3 frames, since the server runs 3 frames before it clears all clients
 	ent->think = AIChar_spawn;
-	ent->nextthink = level.time + FRAMETIME * 4;
+	G_SetNextThink( ent, level.time + FRAMETIME * 4 );
 
 	// we don't really want to start this character right away, but if we don't spawn the client
 	// now, if the game gets saved after the character spawns in, when it gets re-loaded, the client
@@ -661,7 +658,7 @@ void AICast_DelayedSpawnCast( GameEntity *ent, int castType )
 	// RF, had to move this down since some dev maps don't properly spawn the guys in, so we
 	// get a crash when transitioning between levels after they all spawn at once (overloading
 	// the client/server command buffers)
-	ent->nextthink += FRAMETIME * ( ( numSpawningCast + 1 ) / 3 );
+	G_SetNextThink( ent, ent->nextthink + FRAMETIME * ( ( numSpawningCast + 1 ) / 3 ) );
 
 	ent->aiCharacter = castType;
 	numSpawningCast++;
@@ -711,7 +708,7 @@ AICast_CheckLoadGame
 ==================
 */
 void AICast_CheckLoadGame( void ) {
-	char loading[4];
+	int loading;
 	GameEntity *ent = nullptr;
 	bool ready;
 	cast_state_t *pcs;
@@ -724,15 +721,15 @@ void AICast_CheckLoadGame( void ) {
 	// tell the cgame NOT to render the scene while we are waiting for things to settle
 	Cvar_Set( "cg_norender", "1" );
 
-	Cvar_VariableStringBuffer( "savegame_loading", loading, sizeof( loading ) );
+	loading = com_savegameLoading->integer;
 
 	Cvar_Set( "g_reloading", "1" );
 
-	if ( strlen( loading ) > 0 && atoi( loading ) != 0 ) {
+	if ( loading ) {
 		// screen should be black if we are at this stage
 		SV_SetConfigstring( CS_SCREENFADE, va( "1 %i 1", level.time - 10 ) );
 
-		if ( !( g_reloading.integer ) && atoi( loading ) == 2 ) {
+		if ( !( g_reloading.integer ) && loading == 2 ) {
 			// (SA) hmm, this seems redundant when it sets it above...
 			Cvar_Set( "g_reloading", "1" );
 		}
@@ -753,7 +750,7 @@ void AICast_CheckLoadGame( void ) {
 
 			// RF, spawn a thinker that will enable rendering after the client has had time to process the entities and setup the display
 			ent = G_Spawn();
-			ent->nextthink = level.time + 200;
+			G_SetNextThink( ent, level.time + 200 );
 			ent->think = AICast_EnableRenderingThink;
 
 			// wait for the clients to return from faded screen
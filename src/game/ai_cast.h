@@ -37,7 +37,7 @@ If you have questions concerning this license or the applicable additional terms
 
 #pragma once
 
-
+#include <atomic>
 
 #include "../botai/ai_main.h"    // just so we can use the structures
 #include "../botai/ai_dmq3.h"    // just so we can use the structures
@@ -257,7 +257,8 @@ typedef struct
 typedef struct
 {
 	const char    *actionString;
-	bool ( *actionFunc )( struct cast_state_s *cs, char *params );
+	bool ( *actionFunc )( struct cast_state_s *cs, char *params, g_script_args_t *args );
+	g_script_profile_t profile;
 } cast_script_stack_action_t;
 //
 typedef struct
@@ -266,6 +267,7 @@ typedef struct
 	// set during script parsing
 	cast_script_stack_action_t      *action;            // points to an action to perform
 	char                            *params;
+	g_script_args_t                 *args;              // params, already tokenized
 } cast_script_stack_item_t;
 //
 #define AICAST_MAX_SCRIPT_STACK_ITEMS   64
@@ -609,6 +611,19 @@ extern float aicast_skillscale;
 extern vmCvar_t aicast_debug;
 extern vmCvar_t aicast_debugname;
 extern vmCvar_t aicast_scripts;
+extern vmCvar_t aicast_speeds;
+extern vmCvar_t aicast_viscache;
+//
+// sight trace savings from the visibility cache, reset by aicast_speeds each server frame,
+// atomic since the sight checks run in jobs
+typedef struct {
+	std::atomic<int> hits;
+	std::atomic<int> misses;
+	std::atomic<int> mismatches;    // only counted with aicast_viscache 2
+	std::atomic<int> traces;
+} aicast_viscounters_t;
+
+extern aicast_viscounters_t aicastVisCounters;
 //
 //
 // procedure defines
@@ -628,6 +643,8 @@ bool AICast_VisibleFromPos( vec3_t srcpos, int srcnum,
 								vec3_t destpos, int destnum, bool updateVisPos );
 void    AICast_UpdateVisibility( GameEntity *srcent, GameEntity *destent, bool shareVis, bool directview );
 bool AICast_CheckVisibility( GameEntity *srcent, GameEntity *destent );
+void    AICast_InitVisCache( void );
+void    AICast_ResetVisCounters( void );
 //
 // ai_cast_debug.c
 void    AICast_DBG_InitAIFuncs( void );
@@ -724,6 +741,7 @@ void    AICast_ProcessActivate( int entNum, int activatorNum );
 //
 // ai_cast_think.c
 void AICast_Think( int client, float thinktime );
+void AICast_GetInput( cast_state_t *cs, int time );
 void AICast_UpdateInput( cast_state_t *cs, int time );
 void AICast_InputToUserCommand( cast_state_t * cs, bot_input_t * bi, UserCmd * ucmd, int delta_angles[3] );
 void AICast_PredictMovement( cast_state_t *cs, int numframes, float frametime, aicast_predictmove_t *move, UserCmd *ucmd, int checkHitEnt );
@@ -1327,19 +1327,19 @@ void AIChar_spawn( GameEntity *ent ) {
 			break;      // we are the first in line
 		}
 		// still waiting for someone else
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 		return;
 	}
 
 	// if the client hasn't connected yet, wait around
 	if ( !AICast_FindEntityForName( "player" ) ) {
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 		return;
 	}
 
 	if ( lastCall == level.time ) {
 		if ( numCalls++ > 2 ) {
-			ent->nextthink = level.time + FRAMETIME;
+			G_SetNextThink( ent, level.time + FRAMETIME );
 			return;     // spawned enough this frame already
 		}
 	} else {
@@ -1384,6 +1384,7 @@ void AIChar_spawn( GameEntity *ent ) {
 	newent->target = ent->target;
 	//
 	newent->classname = ent->classname;
+	G_IndexEntity( newent );
 	newent->shared.r.svFlags |= ( ent->shared.r.svFlags & SVF_NOFOOTSTEPS );
 	newent->aiCharacter = ent->aiCharacter;
 	newent->client->ps.aiChar = ent->aiCharacter;
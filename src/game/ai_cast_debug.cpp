@@ -155,6 +155,7 @@ void AICast_DBG_Spawn_f( GameClient *client, char *cmd ) {
 	ent = G_Spawn();
 	ent->classname = (char *)G_Alloc( strlen( cmd ) + 1 );
 	strcpy( (char *)ent->classname, cmd );
+	G_IndexEntity( ent );
 	AngleVectors( client->ps.viewangles, dir, nullptr, nullptr );
 	VectorMA( client->ps.origin, 96, dir, ent->shared.s.origin );
 
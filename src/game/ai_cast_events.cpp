@@ -526,6 +526,7 @@ void AICast_ProcessActivate( int entNum, int activatorNum ) {
 		// create a goal at this position
 		newent = G_Spawn();
 		newent->classname = "AI_wait_goal";
+		G_IndexEntity( newent );
 		newent->shared.r.ownerNum = entNum;
 		G_SetOrigin( newent, cs->bs->origin );
 		AIFunc_ChaseGoalStart( cs, newent->shared.s.number, 128, true );
@@ -54,6 +54,7 @@ bool AICast_AIDamageOK( struct cast_state_s *cs, struct cast_state_s *ocs );
 GameEntity *AICast_FindEntityForName( const char *name );
 GameEntity *AICast_TravEntityForName( GameEntity *startent, char *name );
 void AICast_ScriptParse( struct cast_state_s *cs );
+void AICast_ScriptProfileReport( void );
 void AICast_StartFrame( int time );
 void AICast_StartServerFrame( int time );
 void AICast_RecordWeaponFire( GameEntity *ent );
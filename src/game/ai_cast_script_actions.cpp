@@ -93,9 +93,9 @@ AICast_ScriptAction_GotoMarker
   syntax: gotomarker <targetname> [firetarget [noattack]] [nostop] OR runtomarker <targetname> [firetarget [noattack]] [nostop]
 ===============
 */
-bool AICast_ScriptAction_GotoMarker( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_GotoMarker( cast_state_t *cs, char *params, g_script_args_t *args ) {
 #define SCRIPT_REACHGOAL_DIST   8
-	char    *token;
+	const char *token;
 	GameEntity *ent;
 	vec3_t vec, org;
 	int i, diff;
@@ -112,17 +112,16 @@ bool AICast_ScriptAction_GotoMarker( cast_state_t *cs, char *params ) {
 		return false;
 	}
 
-	const char *pString = (const char*)params;
-	token = COM_ParseExt( &pString, false );
-	if ( !token[0] ) {
+	if ( !args->numArgs ) {
 		Com_Error( ERR_DROP, "AI scripting: gotomarker must have an targetname\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
 	}
+	token = args->argv[0];
 
 	// if we already are going to the marker, just use that, and check if we're in range
 	if ( cs->castScriptStatus.scriptGotoEnt >= 0 && cs->castScriptStatus.scriptGotoId == cs->thinkFuncChangeTime ) {
 		ent = &g_entities[cs->castScriptStatus.scriptGotoEnt];
-		if ( ent->targetname && !Q_strcasecmp( ent->targetname, token ) ) {
+		if ( ent->targetname && !Q_strcasecmp( ent->targetname, args->argv[0] ) ) {
 			// if we're not slowing down, then check for passing the marker, otherwise check distance only
 			VectorSubtract( ent->shared.r.currentOrigin, cs->bs->origin, vec );
 			//
@@ -137,12 +136,12 @@ bool AICast_ScriptAction_GotoMarker( cast_state_t *cs, char *params ) {
 			} else
 			{
 				// do we have a firetarget ?
-				token = COM_ParseExt( &pString, false );
+				token = args->numArgs > 1 ? args->argv[1] : "";
 				if ( !token[0] || !Q_stricmp( token,"nostop" ) ) {
 					AICast_NoAttackIfNotHurtSinceLastScriptAction( cs );
 				} else {    // yes we do
 					// find this targetname
-					ent = G_Find( nullptr, FOFS( targetname ), token );
+					ent = G_Script_ArgEntity( args, 1, nullptr );
 					if ( !ent ) {
 						ent = AICast_FindEntityForName( token );
 						if ( !ent ) {
@@ -156,7 +155,7 @@ bool AICast_ScriptAction_GotoMarker( cast_state_t *cs, char *params ) {
 					VectorNormalize( vec );
 					vectoangles( vec, cs->ideal_viewangles );
 					// noattack?
-					token = COM_ParseExt( &pString, false );
+					token = args->numArgs > 2 ? args->argv[2] : "";
 					if ( !token[0] || Q_stricmp( token,"noattack" ) ) {
 						bool fire = true;
 						// if it's an AI, and they aren't visible, dont shoot
@@ -192,16 +191,10 @@ bool AICast_ScriptAction_GotoMarker( cast_state_t *cs, char *params ) {
 	}
 
 	// find the ai_marker with the given "targetname"
-	// TTimo: gcc: suggest () around assignment used as truth value
-	while ( ( ent = G_Find( ent, FOFS( classname ), "ai_marker" ) ) )
-	{
-		if ( ent->targetname && !Q_strcasecmp( ent->targetname, token ) ) {
-			break;
-		}
-	}
+	ent = G_Script_ArgEntity( args, 0, "ai_marker" );
 
 	if ( !ent ) {
-		Com_Error( ERR_DROP, "AI Scripting: can't find ai_marker with \"targetname\" = \"%s\"\n", token );
+		Com_Error( ERR_DROP, "AI Scripting: can't find ai_marker with \"targetname\" = \"%s\"\n", args->argv[0] );
         return false;  // Keep linter happy. ERR_DROP does not return
 	}
 
@@ -213,7 +206,7 @@ bool AICast_ScriptAction_GotoMarker( cast_state_t *cs, char *params ) {
 	cs->castScriptStatus.scriptGotoEnt = ent->shared.s.number;
 	//
 	// slow approach to the goal?
-	if ( !params || !strstr( params," nostop" ) ) {
+	if ( !G_Script_ArgFind( args, 1, "nostop" ) ) {
 		slowApproach = true;
 	} else {
 		slowApproach = false;
@@ -235,7 +228,7 @@ AICast_ScriptAction_WalkToMarker
   syntax: walktomarker <targetname> [firetarget [noattack]] [nostop]
 ===============
 */
-bool AICast_ScriptAction_WalkToMarker( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_WalkToMarker( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	// if we are avoiding danger, then wait for the danger to pass
 	if ( cs->castScriptStatus.scriptGotoId < 0 && cs->dangerEntityValidTime > level.time ) {
 		return false;
@@ -244,7 +237,7 @@ bool AICast_ScriptAction_WalkToMarker( cast_state_t *cs, char *params ) {
 	if ( cs->aiFlags & AIFL_SPECIAL_FUNC ) {
 		return false;
 	}
-	if ( !AICast_ScriptAction_GotoMarker( cs, params ) || ( !strstr( params, " nostop" ) && VectorLength( cs->bs->cur_ps.velocity ) ) ) {
+	if ( !AICast_ScriptAction_GotoMarker( cs, params, args ) || ( !G_Script_ArgFind( args, 1, "nostop" ) && VectorLength( cs->bs->cur_ps.velocity ) ) ) {
 		cs->movestate = MS_WALK;
 		cs->movestateType = MSTYPE_TEMPORARY;
 		AICast_NoAttackIfNotHurtSinceLastScriptAction( cs );
@@ -262,7 +255,7 @@ AICast_ScriptAction_CrouchToMarker
   syntax: crouchtomarker <targetname> [firetarget [noattack]] [nostop]
 ===============
 */
-bool AICast_ScriptAction_CrouchToMarker( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_CrouchToMarker( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	// if we are avoiding danger, then wait for the danger to pass
 	if ( cs->castScriptStatus.scriptGotoId < 0 && cs->dangerEntityValidTime > level.time ) {
 		return false;
@@ -271,7 +264,7 @@ bool AICast_ScriptAction_CrouchToMarker( cast_state_t *cs, char *params ) {
 	if ( cs->aiFlags & AIFL_SPECIAL_FUNC ) {
 		return false;
 	}
-	if ( !AICast_ScriptAction_GotoMarker( cs, params ) || ( !strstr( params, " nostop" ) && VectorLength( cs->bs->cur_ps.velocity ) ) ) {
+	if ( !AICast_ScriptAction_GotoMarker( cs, params, args ) || ( !G_Script_ArgFind( args, 1, "nostop" ) && VectorLength( cs->bs->cur_ps.velocity ) ) ) {
 		cs->movestate = MS_CROUCH;
 		cs->movestateType = MSTYPE_TEMPORARY;
 		AICast_NoAttackIfNotHurtSinceLastScriptAction( cs );
@@ -288,9 +281,9 @@ AICast_ScriptAction_GotoCast
   syntax: gotocast <ainame> [firetarget [noattack]] OR runtocast <ainame> [firetarget [noattack]]
 ===============
 */
-bool AICast_ScriptAction_GotoCast( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_GotoCast( cast_state_t *cs, char *params, g_script_args_t *args ) {
 #define SCRIPT_REACHCAST_DIST   64
-	char  *token;
+	const char *token;
 	GameEntity *ent;
 	vec3_t vec, org;
 	int i, diff;
@@ -306,17 +299,16 @@ bool AICast_ScriptAction_GotoCast( cast_state_t *cs, char *params ) {
 		return false;
 	}
 
-	const char *pString = params;
-	token = COM_ParseExt( &pString, false );
-	if ( !token[0] ) {
+	if ( !args->numArgs ) {
 		Com_Error( ERR_DROP, "AI scripting: gotocast must have an ainame\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
 	}
+	token = args->argv[0];
 
 	// if we already are going to the marker, just use that, and check if we're in range
 	if ( cs->castScriptStatus.scriptGotoEnt >= 0 && cs->castScriptStatus.scriptGotoId == cs->thinkFuncChangeTime ) {
 		ent = &g_entities[cs->castScriptStatus.scriptGotoEnt];
-		if ( ent->targetname && !Q_strcasecmp( ent->targetname, token ) ) {
+		if ( ent->targetname && !Q_strcasecmp( ent->targetname, args->argv[0] ) ) {
 			if ( Distance( cs->bs->origin, ent->shared.r.currentOrigin ) < cs->followDist ) {
 				cs->followTime = 0;
 				AIFunc_IdleStart( cs );   // resume normal AI
@@ -324,12 +316,12 @@ bool AICast_ScriptAction_GotoCast( cast_state_t *cs, char *params ) {
 			} else
 			{
 				// do we have a firetarget ?
-				token = COM_ParseExt( &pString, false );
+				token = args->numArgs > 1 ? args->argv[1] : "";
 				if ( !token[0] ) {
 					AICast_NoAttackIfNotHurtSinceLastScriptAction( cs );
 				} else {    // yes we do
 					// find this targetname
-					ent = G_Find( nullptr, FOFS( targetname ), token );
+					ent = G_Script_ArgEntity( args, 1, nullptr );
 					if ( !ent ) {
 						ent = AICast_FindEntityForName( token );
 						if ( !ent ) {
@@ -344,7 +336,7 @@ bool AICast_ScriptAction_GotoCast( cast_state_t *cs, char *params ) {
 					VectorNormalize( vec );
 					vectoangles( vec, cs->ideal_viewangles );
 					// noattack?
-					token = COM_ParseExt( &pString, false );
+					token = args->numArgs > 2 ? args->argv[2] : "";
 					if ( !token[0] || Q_stricmp( token,"noattack" ) ) {
 						bool fire = true;
 						// if it's an AI, and they aren't visible, dont shoot
@@ -413,7 +405,7 @@ AICast_ScriptAction_WalkToCast
   syntax: walktocast <ainame> [firetarget [noattack]]
 ===============
 */
-bool AICast_ScriptAction_WalkToCast( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_WalkToCast( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	// if we are avoiding danger, then wait for the danger to pass
 	if ( cs->castScriptStatus.scriptGotoId < 0 && cs->dangerEntityValidTime > level.time ) {
 		return false;
@@ -422,7 +414,7 @@ bool AICast_ScriptAction_WalkToCast( cast_state_t *cs, char *params ) {
 	if ( cs->aiFlags & AIFL_SPECIAL_FUNC ) {
 		return false;
 	}
-	if ( !AICast_ScriptAction_GotoCast( cs, params ) ) {
+	if ( !AICast_ScriptAction_GotoCast( cs, params, args ) ) {
 		cs->movestate = MS_WALK;
 		cs->movestateType = MSTYPE_TEMPORARY;
 		AICast_NoAttackIfNotHurtSinceLastScriptAction( cs );
@@ -440,7 +432,7 @@ AICast_ScriptAction_CrouchToCast
   syntax: crouchtocast <ainame> [firetarget [noattack]]
 ===============
 */
-bool AICast_ScriptAction_CrouchToCast( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_CrouchToCast( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	// if we are avoiding danger, then wait for the danger to pass
 	if ( cs->castScriptStatus.scriptGotoId < 0 && cs->dangerEntityValidTime > level.time ) {
 		return false;
@@ -449,7 +441,7 @@ bool AICast_ScriptAction_CrouchToCast( cast_state_t *cs, char *params ) {
 	if ( cs->aiFlags & AIFL_SPECIAL_FUNC ) {
 		return false;
 	}
-	if ( !AICast_ScriptAction_GotoCast( cs, params ) ) {
+	if ( !AICast_ScriptAction_GotoCast( cs, params, args ) ) {
 		cs->movestate = MS_CROUCH;
 		cs->movestateType = MSTYPE_TEMPORARY;
 		AICast_NoAttackIfNotHurtSinceLastScriptAction( cs );
@@ -465,12 +457,8 @@ bool AICast_ScriptAction_CrouchToCast( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_AbortIfLoadgame
 ==============
 */
-bool AICast_ScriptAction_AbortIfLoadgame( cast_state_t *cs, char *params ) {
-	char loading[4];
-
-	Cvar_VariableStringBuffer( "savegame_loading", loading, sizeof( loading ) );
-
-	if ( strlen( loading ) > 0 && atoi( loading ) != 0 ) {
+bool AICast_ScriptAction_AbortIfLoadgame( cast_state_t *cs, char *params, g_script_args_t *args ) {
+	if ( com_savegameLoading->integer ) {
 		// abort the current script
 		cs->castScriptStatus.castScriptStackHead = cs->castScriptEvents[cs->castScriptStatus.castScriptEventIndex].stack.numItems;
 	}
@@ -488,7 +476,7 @@ AICast_ScriptAction_Wait
   moverange defaults to 200, allows some monouverability to avoid fire or attack
 =================
 */
-bool AICast_ScriptAction_Wait( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Wait( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	int duration;
 	float moverange;
@@ -512,16 +500,14 @@ bool AICast_ScriptAction_Wait( cast_state_t *cs, char *params ) {
 	}
 
 	// get the duration
-	const char* pString = params;
-	const char* token = COM_ParseExt( &pString, false );
-	if ( !token[0] ) {
+	if ( !args->numArgs ) {
 		Com_Error( ERR_DROP, "AI scripting: wait must have a duration\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
 	}
-	if ( !Q_stricmp( token, "forever" ) ) {
+	if ( !Q_stricmp( args->argv[0], "forever" ) ) {
 		duration = level.time + 10000;
 	} else {
-		duration = atoi( token );
+		duration = args->argi[0];
 	}
 
 	// if this is for the player, don't worry about enforcing the moverange
@@ -529,18 +515,17 @@ bool AICast_ScriptAction_Wait( cast_state_t *cs, char *params ) {
 		return ( cs->castScriptStatus.castScriptStackChangeTime + duration < level.time );
 	}
 
-	token = COM_ParseExt( &pString, false );
 	// if this token is a number, then assume it is the moverange, otherwise we have a default moverange with a facetarget
 	moverange = -999;
-	const char* facetarget = nullptr;
-	if ( token[0] ) {
+	int facetarget = 0;
+	if ( args->numArgs > 1 ) {
+		const char *token = args->argv[1];
 		if ( toupper( token[0] ) >= 'A' && toupper( token[0] ) <= 'Z' ) {
-			facetarget = token;
+			facetarget = 1;
 		} else {    // we found a moverange
-			moverange = atof( token );
-			token = COM_ParseExt( &pString, false );
-			if ( token[0] ) {
-				facetarget = token;
+			moverange = args->argf[1];
+			if ( args->numArgs > 2 ) {
+				facetarget = 2;
 			}
 		}
 	}
@@ -590,11 +575,11 @@ bool AICast_ScriptAction_Wait( cast_state_t *cs, char *params ) {
 	// do we have a facetarget ?
 	if ( facetarget ) {   // yes we do
 		// find this targetname
-		ent = G_Find( nullptr, FOFS( targetname ), facetarget );
+		ent = G_Script_ArgEntity( args, facetarget, nullptr );
 		if ( !ent ) {
-			ent = AICast_FindEntityForName( facetarget );
+			ent = AICast_FindEntityForName( args->argv[facetarget] );
 			if ( !ent ) {
-				Com_Error( ERR_DROP, "AI Scripting: wait cannot find targetname \"%s\"\n", token );
+				Com_Error( ERR_DROP, "AI Scripting: wait cannot find targetname \"%s\"\n", args->argv[facetarget] );
                 return false;  // Keep linter happy. ERR_DROP does not return
 			}
 		}
@@ -617,7 +602,7 @@ AICast_ScriptAction_Trigger
   Calls the specified trigger for the given ai character
 =================
 */
-bool AICast_ScriptAction_Trigger( cast_state_t *cs, char *params )
+bool AICast_ScriptAction_Trigger( cast_state_t *cs, char *params, g_script_args_t *args )
 {
 	// get the cast name
 	const char* pString = params;
@@ -631,7 +616,7 @@ bool AICast_ScriptAction_Trigger( cast_state_t *cs, char *params )
 	if ( !ent ) {
 		ent = G_Find( &g_entities[MAX_CLIENTS], FOFS( scriptName ), token );
 		if ( !ent ) {
-			if ( Cvar_VariableIntegerValue( "developer" ) ) {
+			if ( com_developer->integer ) {
 				Com_Printf( "AI Scripting: can't find AI cast with \"ainame\" = \"%s\"\n", params );
 			}
 			return true;
@@ -662,7 +647,7 @@ AICast_ScriptAction_FollowCast
   syntax: followcast <ainame>
 ===================
 */
-bool AICast_ScriptAction_FollowCast( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_FollowCast( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity *ent;
 
 	// find the cast/player with the given "name"
@@ -686,7 +671,7 @@ AICast_ScriptAction_PlaySound
   Currently only allows playing on the VOICE channel, unless you use a sound script (yay)
 ================
 */
-bool AICast_ScriptAction_PlaySound( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_PlaySound( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params ) {
 		Com_Error( ERR_DROP, "AI Scripting: syntax error\n\nplaysound <soundname OR scriptname>\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -716,7 +701,7 @@ AICast_ScriptAction_NoAttack
   syntax: noattack <duration>
 =================
 */
-bool AICast_ScriptAction_NoAttack( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_NoAttack( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params ) {
 		Com_Error( ERR_DROP, "AI Scripting: syntax error\n\nnoattack <duration>\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -738,7 +723,7 @@ AICast_ScriptAction_Attack
   if ainame is given, we will attack only that entity as long as they are alive
 =================
 */
-bool AICast_ScriptAction_Attack( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Attack( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity *ent;
 
 	cs->castScriptStatus.scriptNoAttackTime = 0;
@@ -768,7 +753,7 @@ AICast_ScriptAction_PlayAnim
   NOTE: any new animations that are needed by the scripting system, will need to be added here
 =================
 */
-bool AICast_ScriptAction_PlayAnim( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_PlayAnim( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	char tokens[3][MAX_QPATH];
 	int i, endtime, duration, numLoops;
 	GameClient *client;
@@ -1009,7 +994,7 @@ AICast_ScriptAction_ClearAnim
   stops any animation that is currently playing
 =================
 */
-bool AICast_ScriptAction_ClearAnim( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_ClearAnim( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameClient *client;
 
 	client = &level.clients[cs->entityNum];
@@ -1030,7 +1015,7 @@ AICast_ScriptAction_SetAmmo
   syntax: setammo <pickupname> <count>
 =================
 */
-bool AICast_ScriptAction_SetAmmo( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SetAmmo( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	const char* pString= params;
 	const char* token = COM_ParseExt( &pString, false );
@@ -1097,7 +1082,7 @@ AICast_ScriptAction_SetClip
 
 =================
 */
-bool AICast_ScriptAction_SetClip( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SetClip( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	int weapon;
 	int i;
@@ -1160,7 +1145,7 @@ bool AICast_ScriptAction_SetClip( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_SuggestWeapon
 ==============
 */
-bool AICast_ScriptAction_SuggestWeapon( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SuggestWeapon( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	int weapon;
 	int i;
 	//int		suggestedweaps = 0; // TTimo: unused
@@ -1200,7 +1185,7 @@ AICast_ScriptAction_SelectWeapon
   syntax: selectweapon <pickupname>
 =================
 */
-bool AICast_ScriptAction_SelectWeapon( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SelectWeapon( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	int weapon;
 	int i;
 
@@ -1258,7 +1243,7 @@ AICast_ScriptAction_GiveArmor
 
 ==============
 */
-bool AICast_ScriptAction_SetArmor( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SetArmor( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "AI Scripting: setarmor requires an armor value" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -1279,7 +1264,7 @@ AICast_ScriptAction_GiveArmor
 		syntax: givearmor <type> <amount>
 ==============
 */
-bool AICast_ScriptAction_GiveArmor( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_GiveArmor( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	int i;
 	gitem_t     *item = 0;
 
@@ -1319,7 +1304,7 @@ AICast_ScriptAction_GiveWeapon
   syntax: giveweapon <pickupname>
 =================
 */
-bool AICast_ScriptAction_GiveWeapon( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_GiveWeapon( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	int weapon;
 	int i;
 	GameEntity   *ent = &g_entities[cs->entityNum];
@@ -1392,7 +1377,7 @@ AICast_ScriptAction_TakeWeapon
   syntax: takeweapon <pickupname>
 =================
 */
-bool AICast_ScriptAction_TakeWeapon( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_TakeWeapon( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	int weapon;
 	int i;
 
@@ -1480,7 +1465,7 @@ bool AICast_ScriptAction_TakeWeapon( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_GiveInventory
 ==============
 */
-bool AICast_ScriptAction_GiveInventory( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_GiveInventory( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	int i;
 	gitem_t     *item = 0;
 
@@ -1523,7 +1508,7 @@ AICast_ScriptAction_Movetype
   Sets this character's movement type, will exist until another movetype command is called
 =================
 */
-bool AICast_ScriptAction_Movetype( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Movetype( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !Q_strcasecmp( params, "walk" ) ) {
 		cs->movestate = MS_WALK;
 		cs->movestateType = MSTYPE_PERMANENT;
@@ -1554,7 +1539,7 @@ AICast_ScriptAction_AlertEntity
   syntax: alertentity <targetname>
 =================
 */
-bool AICast_ScriptAction_AlertEntity( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_AlertEntity( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity   *ent;
 
 	if ( !params || !params[0] ) {
@@ -1599,7 +1584,7 @@ AICast_ScriptAction_SaveGame
   syntax: savegame
 =================
 */
-bool AICast_ScriptAction_SaveGame( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SaveGame( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	const char* pString = params;
 
 	if ( cs->bs ) {
@@ -1626,7 +1611,7 @@ AICast_ScriptAction_FireAtTarget
   syntax: fireattarget <targetname> [duration]
 =================
 */
-bool AICast_ScriptAction_FireAtTarget( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_FireAtTarget( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity   *ent;
 	vec3_t vec, org, src;
 
@@ -1718,7 +1703,7 @@ AICast_ScriptAction_GodMode
   syntax: godmode <on/off>
 =================
 */
-bool AICast_ScriptAction_GodMode( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_GodMode( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "AI Scripting: godmode requires an on/off specifier\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -1757,7 +1742,7 @@ AICast_ScriptAction_Accum
 	accum <n> abort_if_not_bitset <m>
 =================
 */
-bool AICast_ScriptAction_Accum( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Accum( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	char lastToken[MAX_QPATH];
 	int bufferIndex;
 
@@ -1876,7 +1861,7 @@ bool AICast_ScriptAction_Accum( cast_state_t *cs, char *params ) {
 }
 
 
-bool AICast_ScriptAction_SpawnCast( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SpawnCast( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 
 	Com_Error( ERR_DROP, "AI Scripting: spawncast is no longer functional. Use trigger_spawn instead.\n" );
@@ -1891,7 +1876,7 @@ AICast_ScriptAction_MissionFailed
   syntax: missionfailed  <time>
 =================
 */
-bool AICast_ScriptAction_MissionFailed( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_MissionFailed( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	int time = 6, mof = 0;
 
@@ -1937,7 +1922,7 @@ AICast_ScriptAction_ObjectivesNeeded
   syntax: objectivesneeded <num_objectives>
 =================
 */
-bool AICast_ScriptAction_ObjectivesNeeded( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_ObjectivesNeeded( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	const char *pString = params;
 
@@ -1961,7 +1946,7 @@ AICast_ScriptAction_ObjectiveMet
   also (for backwards compaiblity): missionsuccess <num_objective> [nodisplay]
 =================
 */
-bool AICast_ScriptAction_ObjectiveMet( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_ObjectiveMet( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity   *player;
 	vmCvar_t cvar;
 	int lvl;
@@ -2013,7 +1998,7 @@ AICast_ScriptAction_NoAIDamage
   syntax: noaidamage <on/off>
 =================
 */
-bool AICast_ScriptAction_NoAIDamage( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_NoAIDamage( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "AI Scripting: noaidamage requires an on/off specifier\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -2039,7 +2024,7 @@ AICast_ScriptAction_Print
   Mostly for debugging purposes
 =================
 */
-bool AICast_ScriptAction_Print( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Print( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "AI Scripting: print requires some text\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -2058,7 +2043,7 @@ AICast_ScriptAction_FaceTargetAngles
   The AI will face the same direction that the target entity is facing
 =================
 */
-bool AICast_ScriptAction_FaceTargetAngles( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_FaceTargetAngles( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity   *targetEnt;
 
 	if ( !params || !params[0] ) {
@@ -2084,7 +2069,7 @@ AICast_ScriptAction_ResetScript
 	causes any currently running scripts to abort, in favour of the current script
 ===================
 */
-bool AICast_ScriptAction_ResetScript( cast_state_t *cs, char *params )
+bool AICast_ScriptAction_ResetScript( cast_state_t *cs, char *params, g_script_args_t *args )
 {
     GameClient* client = &level.clients[cs->entityNum];
 
@@ -2128,7 +2113,7 @@ AICast_ScriptAction_Mount
   Used to an AI to mount the MG42
 ===================
 */
-bool AICast_ScriptAction_Mount( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Mount( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity   *targetEnt, *ent;
 	vec3_t vec;
 	float dist;
@@ -2183,7 +2168,7 @@ AICast_ScriptAction_Unmount
   Stop using their current mounted entity
 ===================
 */
-bool AICast_ScriptAction_Unmount( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Unmount( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity   *ent, *mg42;
 
 	ent = &g_entities[cs->entityNum];
@@ -2217,7 +2202,7 @@ AICast_ScriptAction_SavePersistant
   accidentally read in persistant data that was intended for a different map.
 ====================
 */
-bool AICast_ScriptAction_SavePersistant( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SavePersistant( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	G_SavePersistant( params );
 	return true;
 }
@@ -2229,7 +2214,7 @@ bool AICast_ScriptAction_SavePersistant( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_Teleport
 ==============
 */
-bool AICast_ScriptAction_Teleport( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Teleport( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity   *dest;
 
 	dest =  G_PickTarget( params );
@@ -2252,7 +2237,7 @@ extern void G_EndGame( void );
 AICast_ScriptAction_EndGame
 ==============
 */
-bool AICast_ScriptAction_EndGame( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_EndGame( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	G_EndGame();
 	return true;
 }
@@ -2273,7 +2258,7 @@ AICast_ScriptAction_ChangeLevel
 
 ====================
 */
-bool AICast_ScriptAction_ChangeLevel( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_ChangeLevel( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	int i;
 	char *pch, *pch2, *newstr;
 	GameEntity   *player;
@@ -2376,7 +2361,7 @@ bool AICast_ScriptAction_ChangeLevel( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_FoundSecret
 ==================
 */
-bool AICast_ScriptAction_FoundSecret( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_FoundSecret( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity *player = AICast_FindEntityForName( "player" );
 //	level.numSecretsFound++;
 	player->numSecretsFound++;
@@ -2392,7 +2377,7 @@ AICast_ScriptAction_NoSight
   syntax: nosight <duration>
 ==================
 */
-bool AICast_ScriptAction_NoSight( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_NoSight( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params ) {
 		Com_Error( ERR_DROP, "AI Scripting: syntax error\n\nnosight <duration>\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -2410,7 +2395,7 @@ AICast_ScriptAction_Sight
   syntax: sight
 ==================
 */
-bool AICast_ScriptAction_Sight( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Sight( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	cs->castScriptStatus.scriptNoSightTime = 0;
 	return true;
 }
@@ -2422,7 +2407,7 @@ AICast_ScriptAction_NoAvoid
   syntax: noavoid
 ==================
 */
-bool AICast_ScriptAction_NoAvoid( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_NoAvoid( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	cs->aiFlags |= AIFL_NOAVOID;
 	return true;
 }
@@ -2434,7 +2419,7 @@ AICast_ScriptAction_Avoid
   syntax: avoid
 ==================
 */
-bool AICast_ScriptAction_Avoid( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Avoid( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	cs->aiFlags &= ~AIFL_NOAVOID;
 	return true;
 }
@@ -2446,7 +2431,7 @@ AICast_ScriptAction_Attrib
   syntax: attrib <attribute> <value>
 ==================
 */
-bool AICast_ScriptAction_Attrib( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Attrib( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	const char* pString = params;
 	const char* token = COM_ParseExt( &pString, false );
@@ -2479,7 +2464,7 @@ AICast_ScriptAction_DenyAction
   syntax: deny
 =================
 */
-bool AICast_ScriptAction_DenyAction( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_DenyAction( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	cs->aiFlags |= AIFL_DENYACTION;
 	return true;
 }
@@ -2489,7 +2474,7 @@ bool AICast_ScriptAction_DenyAction( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_LightningDamage
 =================
 */
-bool AICast_ScriptAction_LightningDamage( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_LightningDamage( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	Q_strlwr( params );
 	if ( !Q_stricmp( params, "on" ) ) {
 		cs->aiFlags |= AIFL_ROLL_ANIM;  // hijacking this since the player doesn't use it
@@ -2504,7 +2489,7 @@ bool AICast_ScriptAction_LightningDamage( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_Headlook
 =================
 */
-bool AICast_ScriptAction_Headlook( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Headlook( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	const char* pString = params;
 	char* token = COM_ParseExt( &pString, false );
@@ -2534,7 +2519,7 @@ AICast_ScriptAction_BackupScript
   were we left off (useful if player gets in our way)
 =================
 */
-bool AICast_ScriptAction_BackupScript( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_BackupScript( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	if ( !( cs->castScriptStatus.scriptFlags & SFL_WAITING_RESTORE ) ) {
 		cs->castScriptStatusBackup = cs->castScriptStatusCurrent;
@@ -2551,7 +2536,7 @@ AICast_ScriptAction_RestoreScript
   restores the state of the scripting to the previous backup
 =================
 */
-bool AICast_ScriptAction_RestoreScript( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_RestoreScript( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	cs->castScriptStatus = cs->castScriptStatusBackup;
 
@@ -2569,7 +2554,7 @@ AICast_ScriptAction_StateType
   set the current state for this character
 =================
 */
-bool AICast_ScriptAction_StateType( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_StateType( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	if ( !Q_stricmp( params, "alert" ) ) {
 		cs->aiState = AISTATE_ALERT;
@@ -2587,7 +2572,7 @@ AICast_ScriptAction_KnockBack
   syntax: knockback [ON/OFF]
 ================
 */
-bool AICast_ScriptAction_KnockBack( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_KnockBack( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	const char* pString = params;
 	char* token = COM_ParseExt( &pString, false );
@@ -2617,7 +2602,7 @@ AICast_ScriptAction_Zoom
   syntax: zoom [ON/OFF]
 ================
 */
-bool AICast_ScriptAction_Zoom( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Zoom( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	const char* pString = params;
 	char *token = COM_ParseExt( &pString, false );
@@ -2672,21 +2657,21 @@ bool ScriptStartCam( cast_state_t *cs, char *params, bool black ) {
 	return true;
 }
 
-bool AICast_ScriptAction_StartCam( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_StartCam( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	return ScriptStartCam( cs, params, false );
 }
-bool AICast_ScriptAction_StartCamBlack( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_StartCamBlack( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	return ScriptStartCam( cs, params, true );
 }
 
 
 //----(SA)	added
-bool AICast_ScriptAction_StopCamBlack( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_StopCamBlack( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	SV_GameSendServerCommand( cs->entityNum, "stopCamblack" );
 	return true;
 }
 
-bool AICast_ScriptAction_StopCam( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_StopCam( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	SV_GameSendServerCommand( cs->entityNum, "stopCam" );
 	return true;
 }
@@ -2694,7 +2679,7 @@ bool AICast_ScriptAction_StopCam( cast_state_t *cs, char *params ) {
 
 
 //----(SA)	added
-bool AICast_ScriptAction_Cigarette( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Cigarette( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 	
 	GameEntity *ent;
@@ -2729,7 +2714,7 @@ AICast_ScriptAction_Parachute
   syntax: parachute [ON/OFF]
 =================
 */
-bool AICast_ScriptAction_Parachute( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Parachute( cast_state_t *cs, char *params, g_script_args_t *args ) {
 
 
 	GameEntity *ent;
@@ -2762,7 +2747,7 @@ bool AICast_ScriptAction_Parachute( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_EntityScriptName
 =================
 */
-bool AICast_ScriptAction_EntityScriptName( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_EntityScriptName( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	Cvar_Set( "g_scriptName", params );
 	return true;
 }
@@ -2773,7 +2758,7 @@ bool AICast_ScriptAction_EntityScriptName( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_AIScriptName
 =================
 */
-bool AICast_ScriptAction_AIScriptName( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_AIScriptName( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	Cvar_Set( "ai_scriptName", params );
 	return true;
 }
@@ -2783,7 +2768,7 @@ bool AICast_ScriptAction_AIScriptName( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_SetHealth
 =================
 */
-bool AICast_ScriptAction_SetHealth( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_SetHealth( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "AI Scripting: sethealth requires a health value" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -2802,7 +2787,7 @@ AICast_ScriptAction_NoTarget
   syntax: notarget ON/OFF
 =================
 */
-bool AICast_ScriptAction_NoTarget( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_NoTarget( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "AI Scripting: notarget requires ON or OFF as parameter" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -2825,7 +2810,7 @@ bool AICast_ScriptAction_NoTarget( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_Cvar
 ==================
 */
-bool AICast_ScriptAction_Cvar( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_Cvar( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	vmCvar_t cvar;
 
 	char cvarName[MAX_QPATH];
@@ -2865,7 +2850,7 @@ AICast_ScriptAction_MusicStart
 
 ==================
 */
-bool AICast_ScriptAction_MusicStart( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_MusicStart( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	char cvarName[MAX_QPATH];
 	int fadeupTime = 0;
@@ -2894,7 +2879,7 @@ AICast_ScriptAction_MusicPlay
 
 ==================
 */
-bool AICast_ScriptAction_MusicPlay( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_MusicPlay( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	char cvarName[MAX_QPATH];
 	int fadeupTime = 0;
@@ -2918,7 +2903,7 @@ bool AICast_ScriptAction_MusicPlay( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_MusicStop
 ==================
 */
-bool AICast_ScriptAction_MusicStop( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_MusicStop( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	int fadeoutTime = 0;
 
@@ -2939,7 +2924,7 @@ bool AICast_ScriptAction_MusicStop( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_MusicFade
 ==================
 */
-bool AICast_ScriptAction_MusicFade( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_MusicFade( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	float targetvol;
 	int fadetime;
@@ -2970,7 +2955,7 @@ bool AICast_ScriptAction_MusicFade( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_MusicQueue
 ==================
 */
-bool AICast_ScriptAction_MusicQueue( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_MusicQueue( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	char cvarName[MAX_QPATH];
 
@@ -2996,7 +2981,7 @@ AICast_ScriptAction_ExplicitRouting
 =================
 */
 
-bool AICast_ScriptAction_ExplicitRouting( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_ExplicitRouting( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "AI Scripting: explicit_routing requires an on/off specifier\n" );
         return false;  // Keep linter happy. ERR_DROP does not return
@@ -3021,7 +3006,7 @@ AICast_ScriptAction_LockPlayer
   syntax: lockplayer <ON/OFF>
 =================
 */
-bool AICast_ScriptAction_LockPlayer( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_LockPlayer( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity *ent;
 
 	ent = &g_entities[cs->entityNum];
@@ -3050,7 +3035,7 @@ AICast_ScriptAction_AnimCondition
   syntax: anim_condition <condition> <string>
 ==================
 */
-bool AICast_ScriptAction_AnimCondition( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_AnimCondition( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	
 	char condition[MAX_QPATH];
 
@@ -3080,7 +3065,7 @@ AICast_ScriptAction_PushAway
   syntax: pushaway <ainame>
 ================
 */
-bool AICast_ScriptAction_PushAway( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_PushAway( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity *pushed;
 	vec3_t v, ang, f, r;
 
@@ -3112,7 +3097,7 @@ bool AICast_ScriptAction_PushAway( cast_state_t *cs, char *params ) {
 AICast_ScriptAction_CatchFire
 ==================
 */
-bool AICast_ScriptAction_CatchFire( cast_state_t *cs, char *params ) {
+bool AICast_ScriptAction_CatchFire( cast_state_t *cs, char *params, g_script_args_t *args ) {
 	GameEntity *ent = &g_entities[cs->entityNum];
 	//
 	ent->shared.s.onFireEnd = level.time + 99999;  // make sure it goes for longer than they need to die
@@ -110,7 +110,7 @@ void ai_effect_think( GameEntity *ent ) {
 	if ( !targ ) {
 		// keep waiting until they enter, if they never do, then we have no purpose, therefore no harm can be done
 		ent->think = ai_effect_think;
-		ent->nextthink = level.time + 200;
+		G_SetNextThink( ent, level.time + 200 );
 		return;
 	}
 
@@ -126,14 +126,14 @@ void ai_effect_think( GameEntity *ent ) {
 void SP_ai_effect( GameEntity *ent ) {
 	
 	ent->think = ai_effect_think;
-	ent->nextthink = level.time + 500;
+	G_SetNextThink( ent, level.time + 500 );
 }
 
 //===========================================================
 
 // the wait time has passed, so set back up for another activation
 void AICast_trigger_wait( GameEntity *ent ) {
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 }
 
 
@@ -153,12 +153,12 @@ void AICast_trigger_trigger( GameEntity *ent, GameEntity *activator ) {
 
 	if ( ent->wait > 0 ) {
 		ent->think = AICast_trigger_wait;
-		ent->nextthink = level.time + ( ent->wait + ent->random * crandom() ) * 1000;
+		G_SetNextThink( ent, level.time + ( ent->wait + ent->random * crandom() ) * 1000 );
 	} else {
 		// we can't just remove (self) here, because this is a touch function
 		// called while looping through area links...
 		ent->touch = 0;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 		ent->think = G_FreeEntity;
 	}
 }
@@ -34,6 +34,8 @@ If you have questions concerning this license or the applicable additional terms
 // Tab Size:		4 (real tabs)
 //===========================================================================
 
+#include <vector>
+
 #include "../game/g_local.h"
 #include "../game/q_shared.h"
 #include "../game/botlib.h"      //bot lib interface
@@ -49,6 +51,7 @@ If you have questions concerning this license or the applicable additional terms
 
 #include "../qcommon/qcommon.h"
 #include "../server/server.h"
+#include "../qcommon/job_system.h"
 
 /*
 Does sight checking for Cast AI's.
@@ -65,6 +68,34 @@ static float aiStateFovScales[] =
 orientation_t clientHeadTags[MAX_CLIENTS];
 int clientHeadTagTimes[MAX_CLIENTS];
 
+/*
+Visibility cache
+
+AICast_VisibleFromPos does up to five traces per pair. The result for a
+source/dest pair is kept until either end moves more than AIVIS_CACHE_MOVE
+units or changes PVS cluster, an area portal opens or closes, or the entry
+is AIVIS_CACHE_MAXAGE old. Movers that aren't area portals (and other
+characters) can still block a trace, so entries can't live forever.
+
+aicast_viscache 2 retraces on every hit and counts the disagreements.
+*/
+#define AIVIS_CACHE_MOVE    8
+#define AIVIS_CACHE_MAXAGE  500
+
+typedef struct {
+	int time;                   // 0 if the entry is empty
+	int portalGeneration;
+	int srcCluster, destCluster;
+	vec3_t srcPos, destPos;
+	short srcViewheight;
+	short destMins, destMaxs;   // crouching changes the points we trace to
+	bool visible;
+} aicast_viscache_t;
+
+static aicast_viscache_t *visCache;
+
+aicast_viscounters_t aicastVisCounters;
+
 /*
 ==============
 AICast_InFieldOfVision
@@ -103,6 +134,26 @@ bool AICast_InFieldOfVision( vec3_t viewangles, float fov, vec3_t angles ) {
 	return true;
 }
 
+/*
+==============
+AICast_SourceViewHeight
+==============
+*/
+static int AICast_SourceViewHeight( int srcnum ) {
+	cast_state_t *cs = nullptr;
+
+	if ( srcnum < aicast_maxclients ) {
+		cs = AICast_GetCastState( srcnum );
+	}
+	//
+	if ( cs && cs->bs ) {
+		return cs->bs->cur_ps.viewheight;
+	} else if ( g_entities[srcnum].client ) {
+		return g_entities[srcnum].client->ps.viewheight;
+	}
+	return 0;
+}
+
 /*
 ==============
 AICast_VisibleFromPos
@@ -126,14 +177,7 @@ bool AICast_VisibleFromPos( vec3_t srcpos, int srcnum,
 	if ( srcnum < aicast_maxclients ) {
 		cs = AICast_GetCastState( srcnum );
 	}
-	//
-	if ( cs && cs->bs ) {
-		srcviewheight = cs->bs->cur_ps.viewheight;
-	} else if ( g_entities[srcnum].client ) {
-		srcviewheight = g_entities[srcnum].client->ps.viewheight;
-	} else {
-		srcviewheight = 0;
-	}
+	srcviewheight = AICast_SourceViewHeight( srcnum );
 	//
 	VectorCopy( g_entities[destnum].shared.r.mins, destmins );
 	VectorCopy( g_entities[destnum].shared.r.maxs, destmaxs );
@@ -191,6 +235,7 @@ bool AICast_VisibleFromPos( vec3_t srcpos, int srcnum,
 		} //end if
 		  //trace from start to end
 		SV_Trace( &trace, start, nullptr, nullptr, end, ENTITYNUM_NONE /*passent*/, contents_mask, false );
+		aicastVisCounters.traces++;
 		//if water was hit
 		if ( trace.contents & ( CONTENTS_LAVA | CONTENTS_SLIME | CONTENTS_WATER ) ) {
 
@@ -198,6 +243,7 @@ bool AICast_VisibleFromPos( vec3_t srcpos, int srcnum,
 				//trace through the water
 				contents_mask &= ~( CONTENTS_LAVA | CONTENTS_SLIME | CONTENTS_WATER );
 				SV_Trace( &trace, trace.endpos, nullptr, nullptr, end, passent, contents_mask, false );
+				aicastVisCounters.traces++;
 			} //end if
 		} //end if
 		  //if a full trace or the hitent was hit
@@ -222,14 +268,106 @@ bool AICast_VisibleFromPos( vec3_t srcpos, int srcnum,
 
 /*
 ==============
-AICast_CheckVisibility
+AICast_InitVisCache
 ==============
 */
-bool AICast_CheckVisibility( GameEntity *srcent, GameEntity *destent ) {
-	vec3_t dir, entangles, middle, eye, viewangles;
-	cast_state_t        *cs, *ocs;
-	float fov, dist;
-	int viewer, ent;
+void AICast_InitVisCache( void ) {
+	visCache = (aicast_viscache_t *)G_Alloc( aicast_maxclients * aicast_maxclients * sizeof( aicast_viscache_t ) );
+	memset( visCache, 0, aicast_maxclients * aicast_maxclients * sizeof( aicast_viscache_t ) );
+	AICast_ResetVisCounters();
+}
+
+/*
+==============
+AICast_ResetVisCounters
+==============
+*/
+void AICast_ResetVisCounters( void ) {
+	aicastVisCounters.hits = 0;
+	aicastVisCounters.misses = 0;
+	aicastVisCounters.mismatches = 0;
+	aicastVisCounters.traces = 0;
+}
+
+/*
+==============
+AICast_CachedVisibleFromPos
+
+  AICast_VisibleFromPos between two clients, reusing the last result for
+  the pair while nothing that affects it has changed
+==============
+*/
+static bool AICast_CachedVisibleFromPos( GameEntity *srcent, GameEntity *destent ) {
+	int srcnum, destnum;
+	int srcCluster, destCluster, portalGeneration, srcViewheight;
+	aicast_viscache_t *vc;
+	bool visible;
+
+	srcnum = srcent->shared.s.number;
+	destnum = destent->shared.s.number;
+
+	if ( !aicast_viscache.integer || !visCache || srcnum >= aicast_maxclients || destnum >= aicast_maxclients ) {
+		return AICast_VisibleFromPos( srcent->client->ps.origin, srcnum, destent->client->ps.origin, destnum, true );
+	}
+
+	vc = &visCache[srcnum * aicast_maxclients + destnum];
+
+	// everything the traces depend on, apart from other entities
+	srcCluster = SV_PointCluster( srcent->client->ps.origin );
+	destCluster = SV_PointCluster( destent->client->ps.origin );
+	portalGeneration = SV_AreaPortalGeneration();
+	srcViewheight = AICast_SourceViewHeight( srcnum );
+
+	if (    vc->time
+			&&  vc->time <= level.time
+			&&  vc->time > level.time - AIVIS_CACHE_MAXAGE
+			&&  vc->time >= level.lastLoadTime
+			&&  vc->portalGeneration == portalGeneration
+			&&  vc->srcCluster == srcCluster
+			&&  vc->destCluster == destCluster
+			&&  vc->srcViewheight == srcViewheight
+			&&  vc->destMins == (short)destent->shared.r.mins[2]
+			&&  vc->destMaxs == (short)destent->shared.r.maxs[2]
+			&&  DistanceSquared( vc->srcPos, srcent->client->ps.origin ) < AIVIS_CACHE_MOVE * AIVIS_CACHE_MOVE
+			&&  DistanceSquared( vc->destPos, destent->client->ps.origin ) < AIVIS_CACHE_MOVE * AIVIS_CACHE_MOVE ) {
+		aicastVisCounters.hits++;
+		if ( aicast_viscache.integer == 2 ) {
+			visible = AICast_VisibleFromPos( srcent->client->ps.origin, srcnum, destent->client->ps.origin, destnum, true );
+			if ( visible != vc->visible ) {
+				aicastVisCounters.mismatches++;
+			}
+		}
+		return vc->visible;
+	}
+
+	aicastVisCounters.misses++;
+	visible = AICast_VisibleFromPos( srcent->client->ps.origin, srcnum, destent->client->ps.origin, destnum, true );
+
+	vc->time = level.time;
+	vc->portalGeneration = portalGeneration;
+	vc->srcCluster = srcCluster;
+	vc->destCluster = destCluster;
+	VectorCopy( srcent->client->ps.origin, vc->srcPos );
+	VectorCopy( destent->client->ps.origin, vc->destPos );
+	vc->srcViewheight = srcViewheight;
+	vc->destMins = (short)destent->shared.r.mins[2];
+	vc->destMaxs = (short)destent->shared.r.maxs[2];
+	vc->visible = visible;
+
+	return visible;
+}
+
+/*
+==============
+AICast_VisibilityEye
+
+  Where srcent looks from, and which way. False if it can't see destent
+  whatever the traces say. Looking up the head tag isn't safe in a job, so
+  this part of the check stays on the main thread
+==============
+*/
+static bool AICast_VisibilityEye( GameEntity *srcent, GameEntity *destent, vec3_t eye, vec3_t viewangles ) {
+	cast_state_t        *cs;
 	cast_visibility_t   *vis;
 	orientation_t       orientation;
 
@@ -237,42 +375,14 @@ bool AICast_CheckVisibility( GameEntity *srcent, GameEntity *destent ) {
 		return false;
 	}
 	//
-	viewer = srcent->shared.s.number;
-	ent = destent->shared.s.number;
-	//
-	cs = AICast_GetCastState( viewer );
-	ocs = AICast_GetCastState( ent );
+	cs = AICast_GetCastState( srcent->shared.s.number );
 	//
-	vis = &cs->vislist[ent];
+	vis = &cs->vislist[destent->shared.s.number];
 	//
 	// if the destent is the client, and they have just loaded a savegame, ignore them temporarily
 	if ( !destent->aiCharacter && level.lastLoadTime && ( level.lastLoadTime > level.time - 2000 ) && !vis->visible_timestamp ) {
 		return false;
 	}
-
-	//
-	// set the FOV
-	fov = cs->attributes[FOV] * aiStateFovScales[cs->aiState];
-	if ( !fov ) { // assume it's a player, give them a generic fov
-		fov = 180;
-	}
-	if ( cs->aiFlags & AIFL_ZOOMING ) {
-		fov *= 0.8;
-	} else {
-		if ( cs->lastEnemy >= 0 ) {   // they've already been in a fight, so give them a very large fov
-			if ( fov < 270 ) {
-				fov = 270;
-			}
-		}
-	}
-	// RF, if they were visible last check, then give us a full FOV, since we are aware of them
-	if ( cs->aiState >= AISTATE_ALERT && vis->visible_timestamp == vis->lastcheck_timestamp ) {
-		fov = 360;
-	}
-	//calculate middle of bounding box
-	VectorAdd( destent->shared.r.mins, destent->shared.r.maxs, middle );
-	VectorScale( middle, 0.5, middle );
-	VectorAdd( destent->client->ps.origin, middle, middle );
 	// calculate eye position
 	if ( ( level.lastLoadTime < level.time - 4000 ) && ( srcent->shared.r.svFlags & SVF_CASTAI ) ) {
 		if ( clientHeadTagTimes[srcent->shared.s.number] == level.time ) {
@@ -303,6 +413,49 @@ bool AICast_CheckVisibility( GameEntity *srcent, GameEntity *destent ) {
 		eye[2] += srcent->client->ps.viewheight;
 		VectorCopy( srcent->client->ps.viewangles, viewangles );
 	}
+	return true;
+}
+
+/*
+==============
+AICast_VisibleFromEye
+
+  The field of vision, range and line of sight checks. These only read
+  shared state (the cache entry is the pair's own), so they can run in jobs
+==============
+*/
+static bool AICast_VisibleFromEye( GameEntity *srcent, GameEntity *destent, const vec3_t eye, const vec3_t viewangles ) {
+	vec3_t dir, entangles, middle, angles;
+	cast_state_t        *cs;
+	float fov, dist;
+	cast_visibility_t   *vis;
+
+	cs = AICast_GetCastState( srcent->shared.s.number );
+	//
+	vis = &cs->vislist[destent->shared.s.number];
+	//
+	// set the FOV
+	fov = cs->attributes[FOV] * aiStateFovScales[cs->aiState];
+	if ( !fov ) { // assume it's a player, give them a generic fov
+		fov = 180;
+	}
+	if ( cs->aiFlags & AIFL_ZOOMING ) {
+		fov *= 0.8;
+	} else {
+		if ( cs->lastEnemy >= 0 ) {   // they've already been in a fight, so give them a very large fov
+			if ( fov < 270 ) {
+				fov = 270;
+			}
+		}
+	}
+	// RF, if they were visible last check, then give us a full FOV, since we are aware of them
+	if ( cs->aiState >= AISTATE_ALERT && vis->visible_timestamp == vis->lastcheck_timestamp ) {
+		fov = 360;
+	}
+	//calculate middle of bounding box
+	VectorAdd( destent->shared.r.mins, destent->shared.r.maxs, middle );
+	VectorScale( middle, 0.5, middle );
+	VectorAdd( destent->client->ps.origin, middle, middle );
 	//check if entity is within field of vision
 	VectorSubtract( middle, eye, dir );
 	vectoangles( dir, entangles );
@@ -314,17 +467,32 @@ bool AICast_CheckVisibility( GameEntity *srcent, GameEntity *destent ) {
 		return false;
 	}
 	// check FOV
-	if ( !AICast_InFieldOfVision( viewangles, fov, entangles ) ) {
+	VectorCopy( viewangles, angles );
+	if ( !AICast_InFieldOfVision( angles, fov, entangles ) ) {
 		return false;
 	}
 	//
-	if ( !AICast_VisibleFromPos( srcent->client->ps.origin, srcent->shared.s.number, destent->client->ps.origin, destent->shared.s.number, true ) ) {
+	if ( !AICast_CachedVisibleFromPos( srcent, destent ) ) {
 		return false;
 	}
 	//
 	return true;
 }
 
+/*
+==============
+AICast_CheckVisibility
+==============
+*/
+bool AICast_CheckVisibility( GameEntity *srcent, GameEntity *destent ) {
+	vec3_t eye, viewangles;
+
+	if ( !AICast_VisibilityEye( srcent, destent, eye, viewangles ) ) {
+		return false;
+	}
+	return AICast_VisibleFromEye( srcent, destent, eye, viewangles );
+}
+
 /*
 ==============
 AICast_UpdateVisibility
@@ -549,6 +717,70 @@ void AICast_UpdateNonVisibility( GameEntity *srcent, GameEntity *destent, bool d
 	}
 }
 
+// a pair AICast_SightUpdate picked, checked by AICast_RunSightChecks
+typedef struct {
+	GameEntity *srcent, *destent;
+	vec3_t eye, viewangles;
+	bool visible;           // false up front if AICast_VisibilityEye ruled it out
+} aicast_sightcheck_t;
+
+static std::vector<aicast_sightcheck_t> sightChecks;
+
+/*
+==============
+AICast_AddSightCheck
+==============
+*/
+static void AICast_AddSightCheck( GameEntity *srcent, GameEntity *destent ) {
+	aicast_sightcheck_t check;
+
+	check.srcent = srcent;
+	check.destent = destent;
+	check.visible = AICast_VisibilityEye( srcent, destent, check.eye, check.viewangles );
+	sightChecks.push_back( check );
+}
+
+/*
+==============
+AICast_RunSightChecks
+
+  Picking the pairs and recording what they saw both run scripts and touch
+  the vislists, so only the checks themselves run in jobs. The results are
+  recorded in the order the pairs were picked
+==============
+*/
+static void AICast_RunSightChecks( void ) {
+	Com_Jobs().parallelFor( 0, (int)sightChecks.size(), 1, []( int first, int last ) {
+		for ( int i = first; i < last; i++ ) {
+			aicast_sightcheck_t *check = &sightChecks[i];
+			if ( check->visible ) {
+				check->visible = AICast_VisibleFromEye( check->srcent, check->destent, check->eye, check->viewangles );
+			}
+		}
+	} );
+
+	for ( const aicast_sightcheck_t &check : sightChecks ) {
+		// an earlier sighting may have run a script that removed it
+		if ( !check.srcent->inuse ) {
+			continue;
+		}
+		// make sure we are using the right AAS data for this entity (one's that don't get set will default to the player's AAS data)
+		AAS_SetCurrentWorld( AICast_GetCastState( check.srcent->shared.s.number )->aasWorldIndex );
+
+		if ( check.visible ) {
+			// make sure they are still with us
+			if ( check.destent->inuse ) {
+				// record the sighting
+				AICast_UpdateVisibility( check.srcent, check.destent, true, true );
+			}
+		} else // if (vis->lastcheck_timestamp == vis->real_update_timestamp)
+		{
+			AICast_UpdateNonVisibility( check.srcent, check.destent, true );
+		}
+	}
+	sightChecks.clear();
+}
+
 /*
 ==============
 AICast_SightUpdate
@@ -571,7 +803,7 @@ void AICast_SightUpdate( int numchecks ) {
 		numchecks = 5;
 	}
 
-	if ( Cvar_VariableIntegerValue( "savegame_loading" ) ) {
+	if ( com_savegameLoading->integer ) {
 		return;
 	}
 
@@ -579,6 +811,8 @@ void AICast_SightUpdate( int numchecks ) {
 		return;
 	}
 
+	Cvar_Update( &aicast_viscache );
+
 	// First, check all REAL clients, so sighting player is only effected by reaction_time, not
 	// effected by framerate also
 	for (   srccount = 0, src = 0, srcent = &g_entities[0];
@@ -607,9 +841,6 @@ void AICast_SightUpdate( int numchecks ) {
 			continue;
 		}
 
-		// make sure we are using the right AAS data for this entity (one's that don't get set will default to the player's AAS data)
-		AAS_SetCurrentWorld( cs->aasWorldIndex );
-
 		for (   destcount = 0, dest = 0, destent = g_entities;
 				//dest < aicast_maxclients && destcount < level.numPlayingClients;
 				destent == g_entities;  // only check the player
@@ -649,16 +880,10 @@ void AICast_SightUpdate( int numchecks ) {
 			}
 
 			// check for visibility
-			if (    !( destent->flags & FL_NOTARGET )
-					&&  ( AICast_CheckVisibility( srcent, destent ) ) ) {
-				// record the sighting
-				AICast_UpdateVisibility( srcent, destent, true, true );
-			} else // if (vis->lastcheck_timestamp == vis->real_update_timestamp)
-			{
-				AICast_UpdateNonVisibility( srcent, destent, true );
-			}
+			AICast_AddSightCheck( srcent, destent );
 		}
 	}
+	AICast_RunSightChecks();
 
 	// Now do the normal timeslice checks
 	for (   srccount = 0, src = lastsrc, srcent = &g_entities[lastsrc];
@@ -684,9 +909,6 @@ void AICast_SightUpdate( int numchecks ) {
 			continue;
 		}
 
-		// make sure we are using the right AAS data for this entity (one's that don't get set will default to the player's AAS data)
-		AAS_SetCurrentWorld( cs->aasWorldIndex );
-
 		if ( lastdest < 0 ) {
 			lastdest = 0;
 		}
@@ -743,17 +965,7 @@ void AICast_SightUpdate( int numchecks ) {
 			}
 
 			// check for visibility
-			if (    !( destent->flags & FL_NOTARGET )
-					&&  ( AICast_CheckVisibility( srcent, destent ) ) ) {
-				// make sure they are still with us
-				if ( destent->inuse ) {
-					// record the sighting
-					AICast_UpdateVisibility( srcent, destent, true, true );
-				}
-			} else // if (vis->lastcheck_timestamp == vis->real_update_timestamp)
-			{
-				AICast_UpdateNonVisibility( srcent, destent, true );
-			}
+			AICast_AddSightCheck( srcent, destent );
 
 			// break if we've processed the maximum visibilities
 			if ( ++count > numchecks ) {
@@ -770,6 +982,8 @@ void AICast_SightUpdate( int numchecks ) {
 
 escape:
 
+	AICast_RunSightChecks();
+
 	if ( src >= aicast_maxclients ) {
 		src = 0;
 	}
@@ -47,6 +47,8 @@ If you have questions concerning this license or the applicable additional terms
 
 #include "../qcommon/qcommon.h"
 #include "../server/server.h"
+#include "../qcommon/profiler.h"
+#include "../qcommon/job_system.h"
 
 #include "ai_cast.h"
 
@@ -335,10 +337,13 @@ void AICast_InputToUserCommand( cast_state_t *cs, bot_input_t *bi, UserCmd *ucmd
 
 /*
 ==============
-AICast_UpdateInput
+AICast_GetInput
+
+  Works out the cast's movement command. Only touches the cast's own state
+  and bot input, so AICast_StartServerFrame gets them all in jobs
 ==============
 */
-void AICast_UpdateInput( cast_state_t *cs, int time ) {
+void AICast_GetInput( cast_state_t *cs, int time ) {
 	bot_input_t bi;
 	bot_state_t *bs;
 	int j;
@@ -357,7 +362,6 @@ void AICast_UpdateInput( cast_state_t *cs, int time ) {
 		trap_EA_View( bs->client, cs->viewangles );
 		trap_EA_GetInput( bs->client, (float) time / 1000, &bi );
 		AICast_InputToUserCommand( cs, &bi, &cs->lastucmd, bs->cur_ps.delta_angles );
-		g_entities[cs->bs->entitynum].client->ps.pm_flags &= ~PMF_RESPAWNED;
 		//
 		//subtract the delta angles
 		for ( j = 0; j < 3; j++ ) {
@@ -420,13 +424,35 @@ void AICast_UpdateInput( cast_state_t *cs, int time ) {
 	for ( j = 0; j < 3; j++ ) {
 		cs->viewangles[j] = AngleMod( cs->viewangles[j] - SHORT2ANGLE( bs->cur_ps.delta_angles[j] ) );
 	}
-	//
+}
+
+/*
+==============
+AICast_SetInputState
+
+  The client state that goes with the command AICast_GetInput made
+==============
+*/
+static void AICast_SetInputState( cast_state_t *cs ) {
 	// make sure the respawn flag is disabled (causes problems after multiple "map xxx" commands)
 	g_entities[cs->bs->entitynum].client->ps.pm_flags &= ~PMF_RESPAWNED;
+	if ( cs->pauseTime > level.time ) {
+		return;
+	}
 	// set the aiState
 	g_entities[cs->bs->entitynum].client->ps.aiState = cs->aiState;
 }
 
+/*
+==============
+AICast_UpdateInput
+==============
+*/
+void AICast_UpdateInput( cast_state_t *cs, int time ) {
+	AICast_GetInput( cs, time );
+	AICast_SetInputState( cs );
+}
+
 /*
 ============
 AICast_Think
@@ -764,6 +790,45 @@ void AICast_Think( int client, float thinktime ) {
 	}
 }
 
+/*
+============
+AI frame timing
+
+  Accumulated from AICast_StartFrame (which runs per client command) and
+  reported once per server frame by AICast_StartServerFrame when
+  aicast_speeds is set.
+============
+*/
+typedef struct {
+	int64_t sightUsec;
+	int64_t thinkUsec;
+	int numThinks;
+	int64_t scriptUsec;
+	int64_t gatherUsec;
+	int64_t inputUsec;
+	int64_t moveUsec;
+	int numMoves;
+} aicastFrameTimes_t;
+
+static aicastFrameTimes_t aicastTimes;
+
+static void AICast_ReportFrameTimes( int activeCount ) {
+	Cvar_Update( &aicast_speeds );
+	if ( aicast_speeds.integer ) {
+		Com_Printf( "AI: sight %4i think %4i (%i) script %4i gather %4i input %4i move %4i (%i) active %i usec\n",
+					(int)aicastTimes.sightUsec, (int)aicastTimes.thinkUsec, aicastTimes.numThinks,
+					(int)aicastTimes.scriptUsec, (int)aicastTimes.gatherUsec, (int)aicastTimes.inputUsec,
+					(int)aicastTimes.moveUsec, aicastTimes.numMoves, activeCount );
+		Com_Printf( "AI vis: %i hits %i misses %i traces", aicastVisCounters.hits.load(), aicastVisCounters.misses.load(), aicastVisCounters.traces.load() );
+		if ( aicast_viscache.integer == 2 ) {
+			Com_Printf( " %i mismatches", aicastVisCounters.mismatches.load() );
+		}
+		Com_Printf( "\n" );
+	}
+	memset( &aicastTimes, 0, sizeof( aicastTimes ) );
+	AICast_ResetVisCounters();
+}
+
 /*
 ============
 AICast_StartFrame
@@ -782,7 +847,7 @@ void AICast_StartFrame( int time )
 	static vmCvar_t aicast_disable;
 	GameEntity *ent;
 
-	if ( Cvar_VariableIntegerValue( "savegame_loading" ) ) {
+	if ( com_savegameLoading->integer ) {
 		return;
 	}
 
@@ -833,12 +898,14 @@ void AICast_StartFrame( int time )
 	if ( elapsed > 100 ) {
 		elapsed = 100;
 	}
+	int64_t startUsec = Sys_Microseconds();
 	AICast_SightUpdate( (int)( (float)SIGHT_PER_SEC * ( (float)elapsed / 1000 ) ) );
+	int64_t sightUsec = Sys_Microseconds();
+	aicastTimes.sightUsec += sightUsec - startUsec;
 	//
 	// update the player's area, only update if it's valid
 	for ( i = 0; i < 2; i++ ) {
-		AAS_SetCurrentWorld( i );
-		castcount = BotPointAreaNum( g_entities[0].shared.s.pos.trBase );
+		castcount = BotPointAreaNumInWorld( i, g_entities[0].shared.s.pos.trBase );
 		if ( castcount ) {
 			caststates[0].lastValidAreaNum[i] = castcount;
 			caststates[0].lastValidAreaTime[i] = level.time;
@@ -914,6 +981,9 @@ void AICast_StartFrame( int time )
 		}
 	}
 	//
+	aicastTimes.thinkUsec += Sys_Microseconds() - sightUsec;
+	aicastTimes.numThinks += count;
+	//
 	lasttime = time;
 }
 
@@ -925,17 +995,21 @@ AICast_StartServerFrame
 ============
 */
 void AICast_StartServerFrame( int time ) {
-	int i, elapsed, count, clCount, activeCount;
+	int i, j, elapsed, castcount, activeCount;
 	cast_state_t    *cs;
-	int castcount;
 	static int lasttime;
 	static vmCvar_t aicast_disable;
 	GameEntity *ent;
 	cast_state_t *pcs;
 	bool highPriority;
 	int oldLegsTimer;
+	int moveList[MAX_CLIENTS], moveElapsed[MAX_CLIENTS], numMoves;
+	bool moveInPVS[MAX_CLIENTS];
+	int64_t startUsec, scriptUsec, gatherUsec, inputUsec;
 
-	if ( Cvar_VariableIntegerValue( "savegame_loading" ) ) {
+	PROFILE_ZONE( "AICast_StartServerFrame" );
+
+	if ( com_savegameLoading->integer ) {
 		return;
 	}
 
@@ -988,14 +1062,18 @@ void AICast_StartServerFrame( int time ) {
 	}
 	//
 	// process player's current script if it exists
+	startUsec = Sys_Microseconds();
 	AICast_ScriptRun( AICast_GetCastState( 0 ), false );
+	scriptUsec = Sys_Microseconds();
 
-	count = 0;
 	castcount = 0;
-	clCount = 0;
 	activeCount = 0;
+	numMoves = 0;
 	//
-	//update the AI characters
+	// gather the AI characters that need to move this frame. This pass only
+	// reads shared state (apart from unlinking inactive casts), so the
+	// decisions don't depend on the order the moves are run in below. The
+	// ones that only the PVS check would let move are checked in jobs after
 	for ( i = 0, ent = g_entities; i < level.maxclients ; i++, ent++ )
 	{
 		cs = AICast_GetCastState( i );
@@ -1017,32 +1095,16 @@ void AICast_StartServerFrame( int time ) {
 					}
 					//
 					// optimization, if they're not in the player's PVS, and they aren't trying to move, then don't bother thinking
-					if (    ( highPriority && ( elapsed > 300 ) )
-							||  ( g_entities[0].client && g_entities[0].client->cameraPortal )
-							||  ( highPriority && ( cs->vislist[0].visible_timestamp == cs->vislist[0].lastcheck_timestamp ) )
-							||  ( highPriority && ( pcs->vislist[cs->entityNum].visible_timestamp == pcs->vislist[cs->entityNum].lastcheck_timestamp ) )
-							||  ( VectorLength( ent->client->ps.velocity ) > 0 )
-							||  ( highPriority && ( cs->lastucmd.forwardmove || cs->lastucmd.rightmove || cs->lastucmd.upmove > 0 || cs->lastucmd.buttons || cs->lastucmd.wbuttons ) )
-							// !!NOTE: always allow thinking if in PVS, otherwise bosses won't gib, and dead guys might not push away from clipped walls
-							||  ( SV_inPVS( cs->bs->origin, g_entities[0].shared.s.pos.trBase ) ) ) { // do pvs check last, since it's the most expensive to call
-						oldLegsTimer = ent->client->ps.legsTimer;
-						//
-						// send it's movement commands
-						//
-						serverTime = time;
-						AICast_UpdateInput( cs, elapsed );
-						trap_BotUserCommand( cs->bs->client, &( cs->lastucmd ) );
-						cs->lastMoveThink = level.time;
-						//
-						// check for anim changes that may require us to stay still
-						//
-						if ( oldLegsTimer < ent->client->ps.legsTimer && ent->client->ps.groundEntityNum == ENTITYNUM_WORLD ) {
-							// dont move until they are finished
-							if ( cs->castScriptStatus.scriptNoMoveTime < level.time + ent->client->ps.legsTimer ) {
-								cs->castScriptStatus.scriptNoMoveTime = level.time + ent->client->ps.legsTimer;
-							}
-						}
-					}
+					// !!NOTE: always allow thinking if in PVS, otherwise bosses won't gib, and dead guys might not push away from clipped walls
+					moveList[numMoves] = i;
+					moveElapsed[numMoves] = elapsed;
+					moveInPVS[numMoves] = ( highPriority && ( elapsed > 300 ) )
+										  ||  ( g_entities[0].client && g_entities[0].client->cameraPortal )
+										  ||  ( highPriority && ( cs->vislist[0].visible_timestamp == cs->vislist[0].lastcheck_timestamp ) )
+										  ||  ( highPriority && ( pcs->vislist[cs->entityNum].visible_timestamp == pcs->vislist[cs->entityNum].lastcheck_timestamp ) )
+										  ||  ( VectorLength( ent->client->ps.velocity ) > 0 )
+										  ||  ( highPriority && ( cs->lastucmd.forwardmove || cs->lastucmd.rightmove || cs->lastucmd.upmove > 0 || cs->lastucmd.buttons || cs->lastucmd.wbuttons ) );
+					numMoves++;
 				}
 			} else {
 				SV_UnlinkEntity( &ent->shared );
@@ -1054,41 +1116,91 @@ void AICast_StartServerFrame( int time ) {
 			}
 		}
 	}
+	// do pvs check last, since it's the most expensive to call
+	Com_Jobs().parallelFor( 0, numMoves, 1, [&]( int first, int last ) {
+		for ( int k = first; k < last; k++ ) {
+			if ( !moveInPVS[k] ) {
+				moveInPVS[k] = SV_inPVS( AICast_GetCastState( moveList[k] )->bs->origin, g_entities[0].shared.s.pos.trBase );
+			}
+		}
+	} );
+	for ( i = 0, j = 0; i < numMoves; i++ ) {
+		if ( moveInPVS[i] ) {
+			moveList[j] = moveList[i];
+			moveElapsed[j] = moveElapsed[i];
+			j++;
+		}
+	}
+	numMoves = j;
+	gatherUsec = Sys_Microseconds();
 	//
-	lasttime = time;
+	// work out everyone's movement commands first, that only touches their
+	// own cast state and bot input, so the moves below are all that's serial
+	serverTime = time;
+	Com_Jobs().parallelFor( 0, numMoves, 1, [&]( int first, int last ) {
+		for ( int k = first; k < last; k++ ) {
+			AICast_GetInput( AICast_GetCastState( moveList[k] ), moveElapsed[k] );
+		}
+	} );
+	inputUsec = Sys_Microseconds();
 	//
-	//if ( aicast_debug.integer == 3 ) {
-		//Com_Printf( "AI Active Count: %i\n", activeCount );
-	//}
+	// run the moves in entity order, they link entities and fire triggers
+	for ( j = 0; j < numMoves; j++ )
+	{
+		ent = &g_entities[moveList[j]];
+		cs = AICast_GetCastState( moveList[j] );
+		// an earlier move may have fired something that removed this one
+		if ( !cs->bs || !ent->inuse || ent->aiInactive ) {
+			continue;
+		}
+		oldLegsTimer = ent->client->ps.legsTimer;
+		//
+		// send it's movement commands
+		//
+		AICast_SetInputState( cs );
+		trap_BotUserCommand( cs->bs->client, &( cs->lastucmd ) );
+		cs->lastMoveThink = level.time;
+		//
+		// check for anim changes that may require us to stay still
+		//
+		if ( oldLegsTimer < ent->client->ps.legsTimer && ent->client->ps.groundEntityNum == ENTITYNUM_WORLD ) {
+			// dont move until they are finished
+			if ( cs->castScriptStatus.scriptNoMoveTime < level.time + ent->client->ps.legsTimer ) {
+				cs->castScriptStatus.scriptNoMoveTime = level.time + ent->client->ps.legsTimer;
+			}
+		}
+	}
+	//
+	aicastTimes.scriptUsec += scriptUsec - startUsec;
+	aicastTimes.gatherUsec += gatherUsec - scriptUsec;
+	aicastTimes.inputUsec += inputUsec - gatherUsec;
+	aicastTimes.moveUsec += Sys_Microseconds() - inputUsec;
+	aicastTimes.numMoves += numMoves;
+	AICast_ReportFrameTimes( activeCount );
+	//
+	lasttime = time;
 }
 
 /*
 ==============
-AICast_PredictMovement
+AICast_PredictMovementFrom
 
-  Simulates movement over a number of frames, returning the end position
+  AICast_PredictMovement from the given player state, which is moved, and
+  bot input. Without a checkHitEnt it only reads shared state, so it can
+  run in a job
 ==============
 */
-void AICast_PredictMovement( cast_state_t *cs, int numframes, float frametime, aicast_predictmove_t *move, UserCmd *ucmd, int checkHitEnt ) {
+static void AICast_PredictMovementFrom( cast_state_t *cs, PlayerState &ps, bot_input_t &bi, int numframes, float frametime, aicast_predictmove_t *move, UserCmd *ucmd, int checkHitEnt ) {
 	int frame, i;
-	PlayerState ps;
 	pmove_t pm;
 	trace_t tr;
 	vec3_t end, startHitVec, thisHitVec, lastOrg, projPoint;
 	bool checkReachMarker;
 	GameEntity   *ent = &g_entities[cs->entityNum];
-	bot_input_t bi;
 
 //int pretime = Sys_MilliSeconds();
 //Com_Printf("PredictMovement: %f duration, %i frames\n", frametime, numframes );
 
-	if ( cs->bs ) {
-		ps = cs->bs->cur_ps;
-		trap_EA_GetInput( cs->entityNum, (float) level.time / 1000, &bi );
-	} else {
-		ps = g_entities[cs->entityNum].client->ps;
-	}
-
 	ps.eFlags |= EF_DUMMY_PMOVE;
 
 	move->stopevent = PREDICTSTOP_NONE;
@@ -1175,10 +1287,10 @@ done:
 
 	// hack, if we are above ground, chances are it's because we only did one frame, and gravity isn't applied until
 	// after the frame, so try and drop us down some
-	if ( move->groundEntityNum == ENTITYNUM_NONE ) {
-		VectorCopy( move->endpos, end );
+	if ( pm.ps->groundEntityNum == ENTITYNUM_NONE ) {
+		VectorCopy( pm.ps->origin, end );
 		end[2] -= 32;
-		SV_Trace( &tr, move->endpos, pm.mins, pm.maxs, end, pm.ps->clientNum, pm.tracemask, false );
+		SV_Trace( &tr, pm.ps->origin, pm.mins, pm.maxs, end, pm.ps->clientNum, pm.tracemask, false );
 		if ( !tr.startsolid && !tr.allsolid && tr.fraction < 1 ) {
 			VectorCopy( tr.endpos, pm.ps->origin );
 			pm.ps->groundEntityNum = tr.entityNum;
@@ -1197,16 +1309,45 @@ done:
 //Com_Printf("PredictMovement: %i ms\n", -pretime + Sys_MilliSeconds() );
 }
 
+/*
+==============
+AICast_PredictMovement
+
+  Simulates movement over a number of frames, returning the end position
+==============
+*/
+void AICast_PredictMovement( cast_state_t *cs, int numframes, float frametime, aicast_predictmove_t *move, UserCmd *ucmd, int checkHitEnt ) {
+	PlayerState ps;
+	bot_input_t bi;
+
+	if ( cs->bs ) {
+		ps = cs->bs->cur_ps;
+		trap_EA_GetInput( cs->entityNum, (float) level.time / 1000, &bi );
+	} else {
+		ps = g_entities[cs->entityNum].client->ps;
+	}
+	AICast_PredictMovementFrom( cs, ps, bi, numframes, frametime, move, ucmd, checkHitEnt );
+}
+
 /*
 ============
 AICast_GetAvoid
 ============
 */
 bool AICast_GetAvoid( cast_state_t *cs, bot_goal_t *goal, vec3_t outpos, bool reverse, int blockEnt ) {
-	float yaw, oldyaw, distmoved, bestmoved, bestyaw;
+	float yaw, distmoved, bestmoved, bestyaw;
 	vec3_t bestpos;
-	aicast_predictmove_t castmove;
 	UserCmd ucmd;
+	bot_input_t bi;
+	// one per direction tried, all predicted at once
+	struct {
+		float yaw;
+		PlayerState ps;
+		UserCmd ucmd;
+		aicast_predictmove_t castmove;
+		int areanum;
+	} tries[16];
+	int numTries, i;
 	bool enemyVisible;
 	float angleDiff;
 	int starttraveltime = 0, besttraveltime, traveltime;         // TTimo: init
@@ -1274,16 +1415,32 @@ bool AICast_GetAvoid( cast_state_t *cs, bot_goal_t *goal, vec3_t outpos, bool re
 		simTime = 0.5;
 	}
 	//
-	for ( yaw = -angleDiff * invert; yaw*invert <= maxYaw; yaw += inc * invert ) {
+	trap_EA_GetInput( cs->entityNum, (float) level.time / 1000, &bi );
+	numTries = 0;
+	for ( yaw = -angleDiff * invert; yaw*invert <= maxYaw && numTries < (int)ARRAY_LEN( tries ); yaw += inc * invert ) {
 		if ( !averting && !yaw ) {
 			continue;
 		}
-		oldyaw = cs->bs->cur_ps.viewangles[YAW];
-		cs->bs->cur_ps.viewangles[YAW] += yaw + reverse * 180;
-		//
-		ucmd.angles[YAW] = ANGLE2SHORT( AngleMod( cs->bs->cur_ps.viewangles[YAW] ) );
+		tries[numTries].yaw = yaw;
+		tries[numTries].ps = cs->bs->cur_ps;
+		tries[numTries].ps.viewangles[YAW] += yaw + reverse * 180;
 		//
-		AICast_PredictMovement( cs, 5, 0.4, &castmove, &ucmd, -1 );
+		tries[numTries].ucmd = ucmd;
+		tries[numTries].ucmd.angles[YAW] = ANGLE2SHORT( AngleMod( tries[numTries].ps.viewangles[YAW] ) );
+		numTries++;
+	}
+	// the moves don't affect each other, so predict them all in jobs
+	Com_Jobs().parallelFor( 0, numTries, 1, [&]( int first, int last ) {
+		for ( int j = first; j < last; j++ ) {
+			bot_input_t tryInput = bi;
+			AICast_PredictMovementFrom( cs, tries[j].ps, tryInput, 5, 0.4, &tries[j].castmove, &tries[j].ucmd, -1 );
+			tries[j].areanum = goal ? BotPointAreaNumInWorld( cs->aasWorldIndex, tries[j].castmove.endpos ) : 0;
+		}
+	} );
+	//
+	for ( i = 0; i < numTries; i++ ) {
+		aicast_predictmove_t &castmove = tries[i].castmove;
+		yaw = tries[i].yaw;
 		// if we have a danger entity, try and get away from it at all costs
 		if ( cs->dangerEntity >= 0 && cs->dangerEntityValidTime >= level.time ) {
 			distmoved = Distance( castmove.endpos, cs->dangerEntityPos );
@@ -1298,7 +1455,7 @@ bool AICast_GetAvoid( cast_state_t *cs, bot_goal_t *goal, vec3_t outpos, bool re
 				&&  ( castmove.groundEntityNum != ENTITYNUM_NONE ) ) {
 			// they all passed, check any other stuff
 			if ( !enemyVisible || AICast_CheckAttackAtPos( cs->entityNum, cs->enemyNum, castmove.endpos, false, false ) ) {
-				if ( !goal || ( traveltime = trap_AAS_AreaTravelTimeToGoalArea( BotPointAreaNum( castmove.endpos ), castmove.endpos, goal->areanum, cs->travelflags ) ) < ( starttraveltime + 200 ) ) {
+				if ( !goal || ( traveltime = trap_AAS_AreaTravelTimeToGoalArea( tries[i].areanum, castmove.endpos, goal->areanum, cs->travelflags ) ) < ( starttraveltime + 200 ) ) {
 					bestyaw = yaw;
 					bestmoved = distmoved;
 					besttraveltime = traveltime;
@@ -1306,8 +1463,6 @@ bool AICast_GetAvoid( cast_state_t *cs, bot_goal_t *goal, vec3_t outpos, bool re
 				}
 			}
 		}
-		//
-		cs->bs->cur_ps.viewangles[YAW] = oldyaw;
 	}
 	//
 	if ( bestmoved > 0 ) {
@@ -1120,6 +1120,75 @@ void BG_ParseCommands( const char **input, animScriptItem_t *scriptItem, animMod
 	}
 }
 
+/*
+=================
+BG_CompileAnimScript
+
+  compiles the conditions of a script's items into the model's decision table,
+  returns false if it doesn't fit, the script is left to BG_EvaluateConditions then
+=================
+*/
+static bool BG_CompileAnimScript( animModelInfo_t *modelInfo, animScript_t *script ) {
+	static animScriptTable_t::Test tests[MAX_ANIMSCRIPT_ITEMS * NUM_ANIM_CONDITIONS];
+	animScriptCondition_t *cond;
+	int i, j, numTests;
+
+	numTests = 0;
+	for ( i = 0; i < script->numItems; i++ ) {
+		for ( j = 0, cond = script->items[i]->conditions; j < script->items[i]->numConditions; j++, cond++ ) {
+			switch ( animConditionsTable[cond->index].type ) {
+			case ANIM_CONDTYPE_BITFLAGS:
+				tests[numTests].type = animScriptTable_t::BITFLAGS;
+				break;
+			case ANIM_CONDTYPE_VALUE:
+				tests[numTests].type = animScriptTable_t::VALUE;
+				break;
+			default:
+				continue;   // never tested
+			}
+			tests[numTests].rule = i;
+			tests[numTests].condition = cond->index;
+			tests[numTests].value[0] = cond->value[0];
+			tests[numTests].value[1] = cond->value[1];
+			numTests++;
+		}
+	}
+
+	return modelInfo->scriptTable.compile( script->table, script->numItems, tests, numTests );
+}
+
+/*
+=================
+BG_CompileAnimScripts
+
+  rebuilds the decision table of a model after its scripts were parsed
+=================
+*/
+static void BG_CompileAnimScripts( animModelInfo_t *modelInfo ) {
+	int i, j, failed;
+
+	modelInfo->scriptTable.clear();
+	failed = 0;
+	for ( i = 0; i < MAX_AISTATES; i++ ) {
+		for ( j = 0; j < NUM_ANIM_MOVETYPES; j++ ) {
+			failed += !BG_CompileAnimScript( modelInfo, &modelInfo->scriptAnims[i][j] );
+			failed += !BG_CompileAnimScript( modelInfo, &modelInfo->scriptCannedAnims[i][j] );
+		}
+		for ( j = 0; j < MAX_AISTATES; j++ ) {
+			failed += !BG_CompileAnimScript( modelInfo, &modelInfo->scriptStateChange[i][j] );
+		}
+	}
+	for ( i = 0; i < NUM_ANIM_EVENTTYPES; i++ ) {
+		failed += !BG_CompileAnimScript( modelInfo, &modelInfo->scriptEvents[i] );
+	}
+	if ( failed ) {
+		Com_Printf( "BG_CompileAnimScripts: %i scripts of %s did not fit in the table\n", failed, modelInfo->modelname );
+	}
+
+	// items remembered from the old scripts are no good anymore
+	memset( globalScriptData->scriptCache, 0, sizeof( globalScriptData->scriptCache ) );
+}
+
 /*
 =================
 BG_AnimParseAnimScript
@@ -1513,6 +1582,8 @@ void BG_AnimParseAnimScript( animModelInfo_t *modelInfo, animScriptData_t *scrip
 
 	}
 
+	BG_CompileAnimScripts( modelInfo );
+
 	globalFilename = nullptr;
 
 }
@@ -1561,24 +1632,43 @@ bool BG_EvaluateConditions( int client, animScriptItem_t *scriptItem ) {
 ===============
 BG_FirstValidItem
 
-  scroll through the script items, returning the first script found to pass all conditions
+  find the first script item that passes all conditions, from the script's
+  decision table if it was compiled, scrolling through the items otherwise.
+  The item found is remembered for the client until one of its conditions changes.
 
   returns nullptr if no match found
 ===============
 */
 animScriptItem_t *BG_FirstValidItem( int client, animScript_t *script ) {
+	animScriptCache_t *cache;
 	animScriptItem_t **ppScriptItem;
-
 	int i;
 
+	cache = &globalScriptData->scriptCache[client][( (uintptr_t)script / sizeof( animScript_t ) ) & ( ANIMSCRIPT_CACHE_SIZE - 1 )];
+	if ( cache->script == script && cache->conditionsChanged == globalScriptData->conditionsChanged[client] ) {
+		return cache->item;
+	}
+	cache->script = script;
+	cache->conditionsChanged = globalScriptData->conditionsChanged[client];
+	cache->item = nullptr;
+
+	if ( script->table.compiled ) {
+		i = BG_ModelInfoForClient( client )->scriptTable.evaluate( script->table, globalScriptData->clientConditions[client] );
+		if ( i >= 0 ) {
+			cache->item = script->items[i];
+		}
+		return cache->item;
+	}
+
 	for ( i = 0, ppScriptItem = script->items; i < script->numItems; i++, ppScriptItem++ )
 	{
 		if ( BG_EvaluateConditions( client, *ppScriptItem ) ) {
-			return *ppScriptItem;
+			cache->item = *ppScriptItem;
+			break;
 		}
 	}
 	//
-	return nullptr;
+	return cache->item;
 }
 
 /*
@@ -1875,6 +1965,10 @@ int BG_AnimScriptEvent( PlayerState *ps, scriptAnimEventTypes_t event, bool isCo
 	if ( event != ANIM_ET_DEATH && ps->eFlags & EF_DEAD ) {
 		return -1;
 	}
+	// predicted moves don't animate, and can't play the sounds
+	if ( ps->eFlags & EF_DUMMY_PMOVE ) {
+		return -1;
+	}
 
 #ifdef DBGANIMEVENTS
 	Com_Printf( "script event: cl %i, ev %s, ", ps->clientNum, animEventTypesStr[event] );
@@ -1960,21 +2054,32 @@ BG_UpdateConditionValue
 ==============
 */
 void BG_UpdateConditionValue( int client, int condition, int value, bool checkConversion ) {
+	int *current = globalScriptData->clientConditions[client][condition];
+
 	if ( checkConversion ) {
 		// we may need to convert to bitflags
 		if ( animConditionsTable[condition].type == ANIM_CONDTYPE_BITFLAGS ) {
+			int bits[2];
 
 			// DHM - Nerve :: We want to set the ScriptData to the explicit value passed in.
 			//				COM_BitSet will OR values on top of each other, so clear it first.
-			globalScriptData->clientConditions[client][condition][0] = 0;
-			globalScriptData->clientConditions[client][condition][1] = 0;
+			bits[0] = 0;
+			bits[1] = 0;
 			// dhm - end
 
-			COM_BitSet( globalScriptData->clientConditions[client][condition], value );
+			COM_BitSet( bits, value );
+			if ( current[0] != bits[0] || current[1] != bits[1] ) {
+				current[0] = bits[0];
+				current[1] = bits[1];
+				globalScriptData->conditionsChanged[client]++;
+			}
 			return;
 		}
 	}
-	globalScriptData->clientConditions[client][condition][0] = value;
+	if ( current[0] != value ) {
+		current[0] = value;
+		globalScriptData->conditionsChanged[client]++;
+	}
 }
 
 
@@ -1989,7 +2094,7 @@ void BG_UpdateConditionValueStrings( int client, const char *conditionStr, const
 	condition = BG_IndexForString( conditionStr, animConditionsStr, false );
 	value = BG_IndexForString( valueStr, animConditionsTable[condition].values, false );
 	//
-	globalScriptData->clientConditions[client][condition][0] = value;
+	BG_UpdateConditionValue( client, condition, value, false );
 }
 
 /*
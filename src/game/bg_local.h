@@ -63,8 +63,8 @@ typedef struct {
 	bool ladder;
 } pml_t;
 
-extern pmove_t     *pm;
-extern pml_t pml;
+extern thread_local pmove_t     *pm;
+extern thread_local pml_t pml;
 
 // movement parameters
 extern float pm_stopspeed;
@@ -89,7 +89,7 @@ extern float pm_flightfriction;
 
 //----(SA)	end
 
-extern int c_pmove;
+extern thread_local int c_pmove;
 
 void PM_AddTouchEnt( int entityNum );
 void PM_AddEvent( int newEvent );
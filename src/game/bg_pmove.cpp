@@ -43,8 +43,9 @@ float Com_GetFlamethrowerRange( void ) {
 	return 1250; // single player range remains unchanged
 }
 
-pmove_t     *pm;
-pml_t pml;
+// per thread, AICast_PredictMovement runs dummy moves in jobs
+thread_local pmove_t     *pm;
+thread_local pml_t pml;
 
 // movement parameters
 float pm_stopspeed = 100;
@@ -72,7 +73,7 @@ float pm_spectatorfriction = 5.0f;
 
 //----(SA)	end
 
-int c_pmove = 0;
+thread_local int c_pmove = 0;
 
 
 /*
@@ -1390,7 +1391,9 @@ static void PM_SetWaterLevel( void ) {
 	// done.
 
 	// UNDERWATER
-	BG_UpdateConditionValue( pm->ps->clientNum, ANIM_COND_UNDERWATER, ( pm->waterlevel > 1 ), true );
+	if ( !( pm->ps->eFlags & EF_DUMMY_PMOVE ) ) {
+		BG_UpdateConditionValue( pm->ps->clientNum, ANIM_COND_UNDERWATER, ( pm->waterlevel > 1 ), true );
+	}
 
 }
 
@@ -35,6 +35,8 @@ If you have questions concerning this license or the applicable additional terms
 
 #pragma once
 
+#include "../qcommon/condition_table.h"
+
 // because games can change separately from the main system version, we need a
 // second version that must match between game and cgame
 
@@ -1486,6 +1488,9 @@ typedef enum {
 #define MAX_MODEL_ANIMATIONS                256     // animations per model
 #define MAX_ANIMSCRIPT_ANIMCOMMANDS         8
 #define MAX_ANIMSCRIPT_ITEMS                32
+#define MAX_ANIMSCRIPT_TABLE_CONDITIONS     1024    // compiled conditions per model, for all of its scripts
+#define MAX_ANIMSCRIPT_TABLE_TESTS          2048
+#define ANIMSCRIPT_CACHE_SIZE               16      // scripts each client remembers the item of, must be a power of two
 
 // NOTE: these must all be in sync with string tables in bg_animation.c
 
@@ -1611,12 +1616,24 @@ typedef struct
 	animScriptCommand_t commands[MAX_ANIMSCRIPT_ANIMCOMMANDS];
 } animScriptItem_t;
 
+// the item conditions of every script of a model, compiled when the script is parsed
+typedef ConditionTable<MAX_ANIMSCRIPT_TABLE_CONDITIONS, MAX_ANIMSCRIPT_TABLE_TESTS> animScriptTable_t;
+
 typedef struct
 {
 	int numItems;
 	animScriptItem_t    *items[MAX_ANIMSCRIPT_ITEMS];   // pointers into a global list of items
+	animScriptTable_t::RuleSet table;                   // the items in the model's table, if they fit
 } animScript_t;
 
+// the item a script picked for a client, good until one of the client's conditions changes
+typedef struct
+{
+	const animScript_t  *script;
+	int conditionsChanged;
+	animScriptItem_t    *item;
+} animScriptCache_t;
+
 typedef struct
 {
 	char modelname[MAX_QPATH];                              // name of the model
@@ -1642,6 +1659,7 @@ typedef struct
 	// global list of script items for this model
 	animScriptItem_t scriptItems[MAX_ANIMSCRIPT_ITEMS_PER_MODEL];
 	int numScriptItems;
+	animScriptTable_t scriptTable;
 
 } animModelInfo_t;
 
@@ -1651,6 +1669,8 @@ typedef struct
 	int clientModels[MAX_CLIENTS];                      // so we know which model each client is using
 	animModelInfo_t     *modelInfo[MAX_ANIMSCRIPT_MODELS];
 	int clientConditions[MAX_CLIENTS][NUM_ANIM_CONDITIONS][2];
+	int conditionsChanged[MAX_CLIENTS];                 // bumped when one of the client's conditions changes value
+	animScriptCache_t scriptCache[MAX_CLIENTS][ANIMSCRIPT_CACHE_SIZE];
 	//
 	// pointers to functions from the owning module
 	//
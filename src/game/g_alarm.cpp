@@ -250,7 +250,7 @@ void SP_alarm_box( GameEntity *ent ) {
 	ent->die        = alarmbox_die;
 	ent->use        = alarmbox_use;
 	ent->think      = alarmbox_finishspawning;
-	ent->nextthink  = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	SV_LinkEntity( &ent->shared );
 }
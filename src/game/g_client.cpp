@@ -76,6 +76,7 @@ equivelant to info_player_deathmatch
 */
 void SP_info_player_start( GameEntity *ent ) {
 	ent->classname = "info_player_deathmatch";
+	G_IndexEntity( ent );
 	SP_info_player_deathmatch( ent );
 }
 
@@ -290,6 +291,7 @@ void InitBodyQue( void ) {
 	for ( i = 0; i < BODY_QUEUE_SIZE ; i++ ) {
 		ent = G_Spawn();
 		ent->classname = "bodyque";
+		G_IndexEntity( ent );
 		ent->neverFree = true;
 		level.bodyQue[i] = ent;
 	}
@@ -309,7 +311,7 @@ void BodySink( GameEntity *ent ) {
 		ent->physicsObject = false;
 		return;
 	}
-	ent->nextthink = level.time + 100;
+	G_SetNextThink( ent, level.time + 100 );
 	ent->shared.s.pos.trBase[2] -= 1;
 }
 
@@ -377,7 +379,7 @@ void CopyToBodyQue( GameEntity *ent ) {
 	body->shared.r.contents = CONTENTS_CORPSE;
 	body->shared.r.ownerNum = ent->shared.r.ownerNum;
 
-	body->nextthink = level.time + 5000;
+	G_SetNextThink( body, level.time + 5000 );
 	body->think = BodySink;
 
 	body->die = body_die;
@@ -874,6 +876,7 @@ const char *ClientConnect( int clientNum, bool firstTime, bool isBot ) {
 	if ( isBot ) {
 		ent->shared.r.svFlags |= SVF_BOT;
 		ent->inuse = true;
+		G_IndexEntity( ent );
 		if ( !G_BotConnect( clientNum, !firstTime ) ) {
 			return "BotConnectfailed";
 		}
@@ -1095,6 +1098,7 @@ void ClientSpawn( GameEntity *ent ) {
 	if ( !( ent->shared.r.svFlags & SVF_CASTAI ) ) {
 		ent->classname = "player";
 	}
+	G_IndexEntity( ent );
 	ent->shared.r.contents = CONTENTS_BODY;
 
 	// RF, AI should be clipped by monsterclip brushes
@@ -1229,6 +1233,7 @@ void ClientDisconnect( int clientNum ) {
 	ent->shared.s.modelindex = 0;
 	ent->inuse = false;
 	ent->classname = "disconnected";
+	G_IndexEntity( ent );
 	ent->client->pers.connected = CON_DISCONNECTED;
 	ent->client->ps.persistant[PERS_TEAM] = TEAM_FREE;
 	ent->client->sess.sessionTeam = TEAM_FREE;
@@ -312,6 +312,7 @@ void Cmd_Give_f( GameEntity *ent ) {
 		it_ent = G_Spawn();
 		VectorCopy( ent->shared.r.currentOrigin, it_ent->shared.s.origin );
 		it_ent->classname = it->classname;
+		G_IndexEntity( it_ent );
 		G_SpawnItem( it_ent, it );
 		FinishSpawningItem( it_ent );
 		memset( &trace, 0, sizeof( trace ) );
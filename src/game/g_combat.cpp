@@ -125,7 +125,7 @@ void TossClientItems( GameEntity *self ) {
 	}
 
 	if ( drop ) {
-		drop->nextthink = 0;
+		G_SetNextThink( drop, 0 );
 	}
 
 	angle = 45;
@@ -141,7 +141,7 @@ void TossClientItems( GameEntity *self ) {
 			if ( drop->count < 1 ) {
 				drop->count = 1;
 			}
-			drop->nextthink = 0;    // stay forever
+			G_SetNextThink( drop, 0 );    // stay forever
 			angle += 45;
 		}
 	}
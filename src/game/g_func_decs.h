@@ -72,86 +72,86 @@ extern void GibHead ( GameEntity * self , int killer ) ;
 extern void LookAtKiller ( GameEntity * self , GameEntity * inflictor , GameEntity * attacker ) ;
 extern void TossClientItems ( GameEntity * self ) ;
 extern void AddScore ( GameEntity * ent , int score ) ;
-extern bool AICast_ScriptAction_CatchFire ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_PushAway ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_AnimCondition ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_LockPlayer ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_ExplicitRouting ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_MusicQueue ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_MusicFade ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_MusicStop ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_MusicPlay ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_MusicStart ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Cvar ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_NoTarget ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SetHealth ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_AIScriptName ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_EntityScriptName ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Parachute ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Cigarette ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_StopCam ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_StopCamBlack ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_StartCamBlack ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_StartCam ( cast_state_t * cs , char * params ) ;
+extern bool AICast_ScriptAction_CatchFire ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_PushAway ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_AnimCondition ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_LockPlayer ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_ExplicitRouting ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_MusicQueue ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_MusicFade ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_MusicStop ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_MusicPlay ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_MusicStart ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Cvar ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_NoTarget ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SetHealth ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_AIScriptName ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_EntityScriptName ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Parachute ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Cigarette ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_StopCam ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_StopCamBlack ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_StartCamBlack ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_StartCam ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
 extern bool ScriptStartCam ( cast_state_t * cs , char * params , bool black ) ;
-extern bool AICast_ScriptAction_Zoom ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_KnockBack ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_StateType ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_RestoreScript ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_BackupScript ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Headlook ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_LightningDamage ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_DenyAction ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Attrib ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Avoid ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_NoAvoid ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Sight ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_NoSight ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_FoundSecret ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_ChangeLevel ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_EndGame ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Teleport ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SavePersistant ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Unmount ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Mount ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_ResetScript ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_FaceTargetAngles ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Print ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_NoAIDamage ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_ObjectiveMet ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_ObjectivesNeeded ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_MissionFailed ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SpawnCast ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Accum ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_GodMode ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_FireAtTarget ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SaveGame ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_AlertEntity ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Movetype ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_GiveInventory ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_TakeWeapon ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_GiveWeapon ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_GiveArmor ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SetArmor ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SelectWeapon ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SuggestWeapon ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SetClip ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_SetAmmo ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_ClearAnim ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_PlayAnim ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Attack ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_NoAttack ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_PlaySound ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_FollowCast ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Trigger ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_Wait ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_AbortIfLoadgame ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_CrouchToCast ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_WalkToCast ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_GotoCast ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_CrouchToMarker ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_WalkToMarker ( cast_state_t * cs , char * params ) ;
-extern bool AICast_ScriptAction_GotoMarker ( cast_state_t * cs , char * params ) ;
+extern bool AICast_ScriptAction_Zoom ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_KnockBack ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_StateType ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_RestoreScript ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_BackupScript ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Headlook ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_LightningDamage ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_DenyAction ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Attrib ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Avoid ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_NoAvoid ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Sight ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_NoSight ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_FoundSecret ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_ChangeLevel ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_EndGame ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Teleport ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SavePersistant ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Unmount ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Mount ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_ResetScript ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_FaceTargetAngles ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Print ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_NoAIDamage ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_ObjectiveMet ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_ObjectivesNeeded ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_MissionFailed ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SpawnCast ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Accum ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_GodMode ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_FireAtTarget ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SaveGame ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_AlertEntity ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Movetype ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_GiveInventory ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_TakeWeapon ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_GiveWeapon ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_GiveArmor ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SetArmor ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SelectWeapon ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SuggestWeapon ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SetClip ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_SetAmmo ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_ClearAnim ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_PlayAnim ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Attack ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_NoAttack ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_PlaySound ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_FollowCast ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Trigger ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_Wait ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_AbortIfLoadgame ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_CrouchToCast ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_WalkToCast ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_GotoCast ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_CrouchToMarker ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_WalkToMarker ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
+extern bool AICast_ScriptAction_GotoMarker ( cast_state_t * cs , char * params , g_script_args_t * args ) ;
 extern void AICast_NoAttackIfNotHurtSinceLastScriptAction ( cast_state_t * cs ) ;
 
 
@@ -247,33 +247,33 @@ extern int BG_AnimationIndexForString ( const char * string , int client ) ;
 extern animModelInfo_t * BG_ModelInfoForModelname ( const char * modelname ) ;
 extern animModelInfo_t * BG_ModelInfoForClient ( int client ) ;
 
-extern bool G_ScriptAction_SetHealth ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_RestoreScript ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_BackupScript ( GameEntity * ent , char * params ) ;
+extern bool G_ScriptAction_SetHealth ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_RestoreScript ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_BackupScript ( GameEntity * ent , char * params , g_script_args_t * args ) ;
 
-extern bool G_ScriptAction_AIScriptName ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_EntityScriptName ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_StartCam ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_StopSound ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_Halt ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_TagConnect ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_ResetScript ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_FaceAngles ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_Print ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_MissionSuccess ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_MissionFailed ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_Accum ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_AlertEntity ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_PlayAnim ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_MusicQueue ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_MusicFade ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_MusicStop ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_MusicPlay ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_MusicStart ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_PlaySound ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_Trigger ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_Wait ( GameEntity * ent , char * params ) ;
-extern bool G_ScriptAction_GotoMarker ( GameEntity * ent , char * params ) ;
+extern bool G_ScriptAction_AIScriptName ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_EntityScriptName ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_StartCam ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_StopSound ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_Halt ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_TagConnect ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_ResetScript ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_FaceAngles ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_Print ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_MissionSuccess ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_MissionFailed ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_Accum ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_AlertEntity ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_PlayAnim ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_MusicQueue ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_MusicFade ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_MusicStop ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_MusicPlay ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_MusicStart ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_PlaySound ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_Trigger ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_Wait ( GameEntity * ent , char * params , g_script_args_t * args ) ;
+extern bool G_ScriptAction_GotoMarker ( GameEntity * ent , char * params , g_script_args_t * args ) ;
 extern void Info_SetValueForKey_Big ( char * s , const char * key , const char * value ) ;
 extern void Info_SetValueForKey ( char * s , const char * key , const char * value ) ;
 extern bool Info_Validate ( const char * s ) ;
@@ -441,6 +441,11 @@ extern char * vtos ( const vec3_t v ) ;
 extern void G_UseTargets ( GameEntity * ent , GameEntity * activator ) ;
 extern GameEntity * G_PickTarget ( char * targetname ) ;
 extern GameEntity * G_Find ( GameEntity * from , int fieldofs , const char * match ) ;
+extern void G_IndexAllEntities ( void ) ;
+extern void G_IndexEntity ( GameEntity * ent ) ;
+extern void G_SetNextThink ( GameEntity * ent , int time ) ;
+extern void G_AdvanceThinks ( void ) ;
+extern void G_CheckThinks ( void ) ;
 
 extern int G_SoundIndex ( const char * name ) ;
 extern int G_ModelIndex ( const char * name ) ;
@@ -558,6 +563,7 @@ extern void Weapon_Gauntlet ( GameEntity * ent ) ;
 
 
 extern void Weapon_Knife ( GameEntity * ent ) ;
+extern void AICast_ScriptProfileReport ( void ) ;
 extern bool AICast_ScriptRun ( cast_state_t * cs , bool force ) ;
 extern void AICast_ForceScriptEvent ( struct cast_state_s * cs ,const char * eventStr ,const char * params ) ;
 extern void AICast_ScriptEvent ( struct cast_state_s * cs , const char * eventStr , const char * params ) ;
@@ -598,6 +604,8 @@ extern void AICast_SightUpdate ( int numchecks ) ;
 extern void AICast_UpdateNonVisibility ( GameEntity * srcent , GameEntity * destent , bool directview ) ;
 extern void AICast_UpdateVisibility ( GameEntity * srcent , GameEntity * destent , bool shareVis , bool directview ) ;
 extern bool AICast_CheckVisibility ( GameEntity * srcent , GameEntity * destent ) ;
+extern void AICast_InitVisCache ( void ) ;
+extern void AICast_ResetVisCounters ( void ) ;
 extern bool AICast_VisibleFromPos ( vec3_t srcpos , int srcnum , vec3_t destpos , int destnum , bool updateVisPos ) ;
 extern bool AICast_InFieldOfVision ( vec3_t viewangles , float fov , vec3_t angles ) ;
 
@@ -615,6 +623,13 @@ extern void script_linkentity ( GameEntity * ent ) ;
 extern bool G_Script_ScriptRun ( GameEntity * ent ) ;
 extern void G_Script_ScriptEvent ( GameEntity * ent , const char * eventStr , const char * params ) ;
 extern void G_Script_ScriptChange ( GameEntity * ent , int newScriptNum ) ;
+extern void G_Script_ProfileReport_f ( void ) ;
+extern void G_Script_ProfilePrint ( const char * system , const char * actionString , g_script_profile_t * profile ) ;
+extern void G_Script_ProfileEnd ( g_script_profile_t * profile , int64_t start ) ;
+extern int64_t G_Script_ProfileStart ( void ) ;
+extern GameEntity * G_Script_ArgEntity ( g_script_args_t * args , int arg , const char * classname ) ;
+extern bool G_Script_ArgFind ( const g_script_args_t * args , int first , const char * keyword ) ;
+extern g_script_args_t * G_Script_CompileArgs ( const char * params ) ;
 extern void G_Script_ScriptParse ( GameEntity * ent ) ;
 extern void G_Script_ScriptLoad ( void ) ;
 extern g_script_stack_action_t * G_Script_ActionForString ( const char * string ) ;
@@ -849,6 +864,8 @@ extern int trap_AAS_NextBSPEntity ( int ent ) ;
 extern int trap_AAS_PointContents ( vec3_t point ) ;
 extern int trap_AAS_TraceAreas ( vec3_t start , vec3_t end , int * areas , vec3_t * points , int maxareas ) ;
 extern int trap_AAS_PointAreaNum ( vec3_t point ) ;
+extern int trap_AAS_TraceAreasInWorld ( int world , vec3_t start , vec3_t end , int * areas , vec3_t * points , int maxareas ) ;
+extern int trap_AAS_PointAreaNumInWorld ( int world , vec3_t point ) ;
 extern float trap_AAS_Time ( void ) ;
 extern void trap_AAS_PresenceTypeBoundingBox ( int presencetype , vec3_t mins , vec3_t maxs ) ;
 extern int trap_AAS_Initialized ( void ) ;
@@ -1181,6 +1198,7 @@ extern void AICast_StartServerFrame ( int time ) ;
 extern void AICast_StartFrame ( int time ) ;
 extern void AICast_Think ( int client , float thinktime ) ;
 extern void AICast_UpdateInput ( cast_state_t * cs , int time ) ;
+extern void AICast_GetInput ( cast_state_t * cs , int time ) ;
 extern void AICast_InputToUserCommand ( cast_state_t * cs , bot_input_t * bi , UserCmd * ucmd , int delta_angles [ 3 ] ) ;
 extern void AICast_ChangeViewAngles ( cast_state_t * cs , float thinktime ) ;
 extern void AICast_ProcessAIFunctions ( cast_state_t * cs , float thinktime ) ;
@@ -1303,24 +1321,30 @@ extern void PersWriteEntity ( fileHandle_t f , GameEntity * ent ) ;
 extern void PersReadClient ( fileHandle_t f , GameClient * cl ) ;
 extern void PersWriteClient ( fileHandle_t f , GameClient * cl ) ;
 extern void G_LoadGame ( const char * filename ) ;
+extern void G_SaveBench_f ( void ) ;
 extern bool G_SaveGame ( const char * username ) ;
 extern char * G_Save_DateStr ( void ) ;
 extern char * G_Save_TimeStr ( void ) ;
-extern void ReadTime ( fileHandle_t f , qtime_t * tm ) ;
-extern void WriteTime ( fileHandle_t f ) ;
-extern void ReadCastState ( fileHandle_t f , cast_state_t * cs , int size ) ;
-extern void WriteCastState ( fileHandle_t f , cast_state_t * cs ) ;
-extern void ReadEntity ( fileHandle_t f , GameEntity * ent , int size ) ;
-extern void WriteEntity ( fileHandle_t f , GameEntity * ent ) ;
-extern void ReadClient ( fileHandle_t f , GameClient * client , int size ) ;
-extern void WriteClient ( fileHandle_t f , GameClient * cl ) ;
+extern void ReadTime ( saveReader_t * r , qtime_t * tm ) ;
+extern void WriteTime ( saveSnapshot_t * snap ) ;
+extern void ReadCastState ( saveReader_t * r , cast_state_t * cs , int size ) ;
+extern void WriteCastState ( saveSnapshot_t * snap , cast_state_t * cs ) ;
+extern void ReadEntity ( saveReader_t * r , GameEntity * ent , int size ) ;
+extern void WriteEntity ( saveSnapshot_t * snap , GameEntity * ent ) ;
+extern void ReadClient ( saveReader_t * r , GameClient * client , int size ) ;
+extern void WriteClient ( saveSnapshot_t * snap , GameClient * cl ) ;
+extern void G_SaveGameCheck ( void ) ;
+extern void G_SaveGameFlush ( void ) ;
 extern void G_Save_Decode ( uint8_t * in , int insize , uint8_t * out , int outsize ) ;
 extern int G_Save_Encode ( uint8_t * raw , uint8_t * out , int rawsize , int outsize ) ;
-extern void ReadField ( fileHandle_t f , saveField_t * field , uint8_t * base ) ;
-extern void WriteField2 ( fileHandle_t f , saveField_t * field , uint8_t * base ) ;
+extern void ReadField ( saveReader_t * r , saveField_t * field , uint8_t * base ) ;
+extern void WriteField2 ( saveSnapshot_t * snap , saveField_t * field , uint8_t * base ) ;
 extern void WriteField1 ( saveField_t * field , uint8_t * base ) ;
 extern uint8_t * G_FindFuncByName ( char * name ) ;
 extern funcList_t * G_FindFuncAtAddress ( uint8_t * adr ) ;
+extern void G_SnapshotBeginBody ( saveSnapshot_t * snap ) ;
+extern void G_SnapshotWriteEncoded ( saveSnapshot_t * snap , const void * buffer , int len ) ;
+extern void G_SnapshotWrite ( saveSnapshot_t * snap , const void * buffer , int len ) ;
 extern int G_SaveWrite ( const void * buffer , int len , fileHandle_t f ) ;
 extern void G_SaveWriteError ( void ) ;
 extern void PM_StepSlideMove ( bool gravity ) ;
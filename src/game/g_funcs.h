@@ -434,6 +434,11 @@ If you have questions concerning this license or the applicable additional terms
 {"G_UseTargets", (uint8_t *)G_UseTargets},
 {"G_PickTarget", (uint8_t *)G_PickTarget},
 {"G_Find", (uint8_t *)G_Find},
+{"G_IndexAllEntities", (uint8_t *)G_IndexAllEntities},
+{"G_IndexEntity", (uint8_t *)G_IndexEntity},
+{"G_SetNextThink", (uint8_t *)G_SetNextThink},
+{"G_AdvanceThinks", (uint8_t *)G_AdvanceThinks},
+{"G_CheckThinks", (uint8_t *)G_CheckThinks},
 
 {"G_SoundIndex", (uint8_t *)G_SoundIndex},
 {"G_ModelIndex", (uint8_t *)G_ModelIndex},
@@ -550,6 +555,7 @@ If you have questions concerning this license or the applicable additional terms
 {"Weapon_Gauntlet", (uint8_t *)Weapon_Gauntlet},
 
 {"Weapon_Knife", (uint8_t *)Weapon_Knife},
+{"AICast_ScriptProfileReport", (uint8_t *)AICast_ScriptProfileReport},
 {"AICast_ScriptRun", (uint8_t *)AICast_ScriptRun},
 {"AICast_ForceScriptEvent", (uint8_t *)AICast_ForceScriptEvent},
 {"AICast_ScriptEvent", (uint8_t *)AICast_ScriptEvent},
@@ -590,6 +596,8 @@ If you have questions concerning this license or the applicable additional terms
 {"AICast_UpdateNonVisibility", (uint8_t *)AICast_UpdateNonVisibility},
 {"AICast_UpdateVisibility", (uint8_t *)AICast_UpdateVisibility},
 {"AICast_CheckVisibility", (uint8_t *)AICast_CheckVisibility},
+{"AICast_InitVisCache", (uint8_t *)AICast_InitVisCache},
+{"AICast_ResetVisCounters", (uint8_t *)AICast_ResetVisCounters},
 {"AICast_VisibleFromPos", (uint8_t *)AICast_VisibleFromPos},
 {"AICast_InFieldOfVision", (uint8_t *)AICast_InFieldOfVision},
 
@@ -607,6 +615,13 @@ If you have questions concerning this license or the applicable additional terms
 {"G_Script_ScriptRun", (uint8_t *)G_Script_ScriptRun},
 {"G_Script_ScriptEvent", (uint8_t *)G_Script_ScriptEvent},
 {"G_Script_ScriptChange", (uint8_t *)G_Script_ScriptChange},
+{"G_Script_ProfileReport_f", (uint8_t *)G_Script_ProfileReport_f},
+{"G_Script_ProfilePrint", (uint8_t *)G_Script_ProfilePrint},
+{"G_Script_ProfileEnd", (uint8_t *)G_Script_ProfileEnd},
+{"G_Script_ProfileStart", (uint8_t *)G_Script_ProfileStart},
+{"G_Script_ArgEntity", (uint8_t *)G_Script_ArgEntity},
+{"G_Script_ArgFind", (uint8_t *)G_Script_ArgFind},
+{"G_Script_CompileArgs", (uint8_t *)G_Script_CompileArgs},
 {"G_Script_ScriptParse", (uint8_t *)G_Script_ScriptParse},
 {"G_Script_ScriptLoad", (uint8_t *)G_Script_ScriptLoad},
 {"G_Script_ActionForString", (uint8_t *)G_Script_ActionForString},
@@ -841,6 +856,8 @@ If you have questions concerning this license or the applicable additional terms
 {"trap_AAS_PointContents", (uint8_t *)trap_AAS_PointContents},
 {"trap_AAS_TraceAreas", (uint8_t *)trap_AAS_TraceAreas},
 {"trap_AAS_PointAreaNum", (uint8_t *)trap_AAS_PointAreaNum},
+{"trap_AAS_TraceAreasInWorld", (uint8_t *)trap_AAS_TraceAreasInWorld},
+{"trap_AAS_PointAreaNumInWorld", (uint8_t *)trap_AAS_PointAreaNumInWorld},
 {"trap_AAS_Time", (uint8_t *)trap_AAS_Time},
 {"trap_AAS_PresenceTypeBoundingBox", (uint8_t *)trap_AAS_PresenceTypeBoundingBox},
 {"trap_AAS_Initialized", (uint8_t *)trap_AAS_Initialized},
@@ -1166,6 +1183,7 @@ If you have questions concerning this license or the applicable additional terms
 {"AICast_StartFrame", (uint8_t *)AICast_StartFrame},
 {"AICast_Think", (uint8_t *)AICast_Think},
 {"AICast_UpdateInput", (uint8_t *)AICast_UpdateInput},
+{"AICast_GetInput", (uint8_t *)AICast_GetInput},
 {"AICast_InputToUserCommand", (uint8_t *)AICast_InputToUserCommand},
 {"AICast_ChangeViewAngles", (uint8_t *)AICast_ChangeViewAngles},
 {"AICast_ProcessAIFunctions", (uint8_t *)AICast_ProcessAIFunctions},
@@ -1288,6 +1306,7 @@ If you have questions concerning this license or the applicable additional terms
 {"PersReadClient", (uint8_t *)PersReadClient},
 {"PersWriteClient", (uint8_t *)PersWriteClient},
 {"G_LoadGame", (uint8_t *)G_LoadGame},
+{"G_SaveBench_f", (uint8_t *)G_SaveBench_f},
 {"G_SaveGame", (uint8_t *)G_SaveGame},
 {"G_Save_DateStr", (uint8_t *)G_Save_DateStr},
 {"G_Save_TimeStr", (uint8_t *)G_Save_TimeStr},
@@ -1299,6 +1318,8 @@ If you have questions concerning this license or the applicable additional terms
 {"WriteEntity", (uint8_t *)WriteEntity},
 {"ReadClient", (uint8_t *)ReadClient},
 {"WriteClient", (uint8_t *)WriteClient},
+{"G_SaveGameCheck", (uint8_t *)G_SaveGameCheck},
+{"G_SaveGameFlush", (uint8_t *)G_SaveGameFlush},
 {"G_Save_Decode", (uint8_t *)G_Save_Decode},
 {"G_Save_Encode", (uint8_t *)G_Save_Encode},
 {"ReadField", (uint8_t *)ReadField},
@@ -1306,6 +1327,9 @@ If you have questions concerning this license or the applicable additional terms
 {"WriteField1", (uint8_t *)WriteField1},
 {"G_FindFuncByName", (uint8_t *)G_FindFuncByName},
 {"G_FindFuncAtAddress", (uint8_t *)G_FindFuncAtAddress},
+{"G_SnapshotBeginBody", (uint8_t *)G_SnapshotBeginBody},
+{"G_SnapshotWriteEncoded", (uint8_t *)G_SnapshotWriteEncoded},
+{"G_SnapshotWrite", (uint8_t *)G_SnapshotWrite},
 {"G_SaveWrite", (uint8_t *)G_SaveWrite},
 {"G_SaveWriteError", (uint8_t *)G_SaveWriteError},
 {"PM_StepSlideMove", (uint8_t *)PM_StepSlideMove},
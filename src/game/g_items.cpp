@@ -496,7 +496,7 @@ void RespawnItem( GameEntity *ent ) {
 	// play the normal respawn sound only to nearby clients
 	G_AddEvent( ent, EV_ITEM_RESPAWN, 0 );
 
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 }
 
 
@@ -692,10 +692,10 @@ void Touch_Item( GameEntity *ent, GameEntity *other, trace_t *trace ) {
 	// delete it).  This is used by items that are respawned by third party
 	// events such as ctf flags
 	if ( respawn <= 0 ) {
-		ent->nextthink = 0;
+		G_SetNextThink( ent, 0 );
 		ent->think = 0;
 	} else {
-		ent->nextthink = level.time + respawn * 1000;
+		G_SetNextThink( ent, level.time + respawn * 1000 );
 		ent->think = RespawnItem;
 	}
 	SV_LinkEntity( &ent->shared );
@@ -722,6 +722,7 @@ GameEntity *LaunchItem( gitem_t *item, vec3_t origin, vec3_t velocity ) {
 	dropped->shared.s.otherEntityNum2 = 1;     // DHM - Nerve :: this is taking modelindex2's place for signaling a dropped item
 
 	dropped->classname = item->classname;
+	G_IndexEntity( dropped );
 	dropped->item = item;
 //	VectorSet (dropped->shared.r.mins, -ITEM_RADIUS, -ITEM_RADIUS, -ITEM_RADIUS);
 //	VectorSet (dropped->shared.r.maxs, ITEM_RADIUS, ITEM_RADIUS, ITEM_RADIUS);
@@ -745,7 +746,7 @@ GameEntity *LaunchItem( gitem_t *item, vec3_t origin, vec3_t velocity ) {
 
 	 // auto-remove after 30 seconds
 		dropped->think = G_FreeEntity;
-		dropped->nextthink = level.time + 30000;
+		G_SetNextThink( dropped, level.time + 30000 );
 	
 
 	dropped->flags = FL_DROPPED_ITEM;
@@ -1011,7 +1012,7 @@ void G_SpawnItem( GameEntity *ent, gitem_t *item )
 	ent->item = item;
 	// some movers spawn on the second frame, so delay item
 	// spawns until the third frame so they can ride trains
-	ent->nextthink = level.time + FRAMETIME * 2;
+	G_SetNextThink( ent, level.time + FRAMETIME * 2 );
 	ent->think = FinishSpawningItem;
 
 	const char* noise;
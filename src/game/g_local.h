@@ -30,9 +30,12 @@ If you have questions concerning this license or the applicable additional terms
 
 // g_local.h -- local definitions for game module
 
+#include <cstdint>
+
 #include "q_shared.h"
 #include "bg_public.h"
 #include "g_public.h"
+#include "../qcommon/slot_mask.h"
 
 //==================================================================
 
@@ -116,10 +119,40 @@ class GameClient;
 //====================================================================
 //
 // Scripting, these structure are not saved into savegames (parsed each start)
+//
+// action parameters, split up once when the script is parsed so actions that
+// stay active for many frames don't tokenize their params or search for their
+// targets every frame. Shared by the entity and AI scripts.
+#define G_MAX_SCRIPT_ARGS   8
+//
+typedef struct
+{
+	int entityNum;                          // -1 until resolved
+	const char  *name;                      // the entity's own name string, changes if the slot is reused
+} g_script_entref_t;
+//
+typedef struct
+{
+	int numArgs;
+	char        *argv[G_MAX_SCRIPT_ARGS];
+	int argi[G_MAX_SCRIPT_ARGS];            // atoi() of each arg
+	float argf[G_MAX_SCRIPT_ARGS];          // atof() of each arg
+	g_script_entref_t ents[G_MAX_SCRIPT_ARGS];  // targetname lookups, see G_Script_ArgEntity
+} g_script_args_t;
+//
+// time spent in each action, for scriptprofile
+typedef struct
+{
+	int calls;
+	int64_t usec;
+	int maxUsec;
+} g_script_profile_t;
+//
 typedef struct
 {
 	const char    *actionString;
-	bool ( *actionFunc )( GameEntity *ent, char *params );
+	bool ( *actionFunc )( GameEntity *ent, char *params, g_script_args_t *args );
+	g_script_profile_t profile;
 } g_script_stack_action_t;
 //
 typedef struct
@@ -128,6 +161,7 @@ typedef struct
 	// set during script parsing
 	g_script_stack_action_t     *action;            // points to an action to perform
 	char                        *params;
+	g_script_args_t             *args;              // params, already tokenized
 } g_script_stack_item_t;
 //
 #define G_MAX_SCRIPT_STACK_ITEMS    64
@@ -170,11 +204,31 @@ typedef struct
 #define G_MAX_SCRIPT_ACCUM_BUFFERS  8
 //
 void G_Script_ScriptEvent( GameEntity *ent, const char *eventStr, const char *params );
+g_script_args_t *G_Script_CompileArgs( const char *params );
+bool G_Script_ArgFind( const g_script_args_t *args, int first, const char *keyword );
+GameEntity *G_Script_ArgEntity( g_script_args_t *args, int arg, const char *classname );
+int64_t G_Script_ProfileStart( void );
+void G_Script_ProfileEnd( g_script_profile_t *profile, int64_t start );
+void G_Script_ProfilePrint( const char *system, const char *actionString, g_script_profile_t *profile );
+void G_Script_ProfileReport_f( void );
 //====================================================================
 
 
 #define CFOFS( x ) ( (intptr_t)&( ( (GameClient *)0 )->x ) )
 
+// an entity's nextthink, read like an int but set only through G_SetNextThink
+// so that the think wheel always knows when the entity is next due
+class ThinkTime
+{
+public:
+	operator int() const { return time; }
+
+private:
+	friend void G_SetNextThink( GameEntity *ent, int time );
+	int time;
+};
+static_assert( sizeof( ThinkTime ) == sizeof( int ), "savegames hold GameEntity as it is laid out" );
+
 class GameEntity
 {
 public:
@@ -258,7 +312,7 @@ public:
 	vec3_t gDelta;
 	vec3_t gDeltaBack;
 
-	int nextthink;
+	ThinkTime nextthink;             // set with G_SetNextThink
 	void ( *think )( GameEntity *self );
 	void ( *reached )( GameEntity *self );       // movers call this when hitting endpoint
 	void ( *blocked )( GameEntity *self, GameEntity *other );
@@ -789,6 +843,11 @@ int     G_SoundIndex( const char *name );
 
 void    G_KillBox( GameEntity *ent );
 GameEntity *G_Find( GameEntity *from, int fieldofs, const char *match );
+void G_IndexEntity( GameEntity *ent );
+void G_IndexAllEntities( void );
+void G_SetNextThink( GameEntity *ent, int time );
+void G_AdvanceThinks( void );
+void G_CheckThinks( void );
 GameEntity *G_PickTarget( char *targetname );
 void    G_UseTargets( GameEntity *ent, GameEntity *activator );
 void    G_SetMovedir( vec3_t angles, vec3_t movedir );
@@ -1037,7 +1096,10 @@ int Cmd_WolfKick_f( GameEntity *ent );
 
 // g_save.c
 bool G_SaveGame( const char *username );
+void G_SaveGameFlush( void );
+void G_SaveGameCheck( void );
 void G_LoadGame( const char *username );
+void G_SaveBench_f( void );
 bool G_SavePersistant( char *nextmap );
 void G_LoadPersistant( void );
 
@@ -1054,6 +1116,8 @@ void Props_Chair_Skyboxtouch( GameEntity *ent );
 
 extern level_locals_t level;
 extern GameEntity g_entities[MAX_GENTITIES];
+extern SlotMask<MAX_GENTITIES> g_entitiesInUse;     // the inuse entities, kept by G_IndexEntity
+extern SlotMask<MAX_GENTITIES> g_thinksDue;         // the entities whose nextthink has come, kept by G_SetNextThink
 extern GameEntity       *g_camEnt;
 
 #define FOFS( x ) ( (intptr_t)&( ( (GameEntity *)0 )->x ) )
@@ -1084,6 +1148,7 @@ extern vmCvar_t g_forcerespawn;
 extern vmCvar_t g_inactivity;
 extern vmCvar_t g_debugMove;
 extern vmCvar_t g_debugAlloc;
+extern vmCvar_t g_debugThinks;
 extern vmCvar_t g_debugDamage;
 extern vmCvar_t g_debugBullets;     //----(SA)	added
 extern vmCvar_t g_debugAudibleEvents;       //----(SA)	added
@@ -1118,6 +1183,7 @@ extern vmCvar_t ai_scriptName;          // name of AI script file to run (instea
 extern vmCvar_t g_scriptName;           // name of script file to run (instead of default for that map)
 
 extern vmCvar_t g_scriptDebug;
+extern vmCvar_t g_scriptProfile;
 
 extern vmCvar_t g_userAim;
 
@@ -1127,6 +1193,7 @@ extern vmCvar_t g_mg42arc;
 
 extern vmCvar_t g_totalPlayTime;
 extern vmCvar_t g_attempts;
+extern vmCvar_t g_saveCompress;
 
 extern vmCvar_t g_footstepAudibleRange;
 
@@ -1139,6 +1206,8 @@ void    Cmd_ArgsBuffer( char *buffer, int bufferLength );
 void    Cvar_Set( const char *var_name, const char *value );
 
 bool SV_inPVS( const vec3_t p1, const vec3_t p2 );
+int SV_PointCluster( const vec3_t p );
+int SV_AreaPortalGeneration( void );
 
 int     trap_DebugPolygonCreate( int color, int numPoints, vec3_t *points );
 void    trap_DebugPolygonDelete( int id );
@@ -1164,6 +1233,8 @@ float       trap_AAS_Time( void );
 
 int         trap_AAS_PointAreaNum( vec3_t point );
 int         trap_AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas );
+int         trap_AAS_PointAreaNumInWorld( int world, vec3_t point );
+int         trap_AAS_TraceAreasInWorld( int world, vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas );
 
 int         trap_AAS_PointContents( vec3_t point );
 int         trap_AAS_NextBSPEntity( int ent );
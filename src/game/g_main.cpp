@@ -33,6 +33,7 @@ If you have questions concerning this license or the applicable additional terms
 #include "g_func_decs.h"
 #include "../qcommon/qcommon.h"
 #include "../server/server.h"
+#include "../qcommon/profiler.h"
 
 level_locals_t level;
 
@@ -47,6 +48,8 @@ typedef struct {
 } cvarTable_t;
 
 GameEntity g_entities[MAX_GENTITIES];
+SlotMask<MAX_GENTITIES> g_entitiesInUse;
+SlotMask<MAX_GENTITIES> g_thinksDue;
 GameClient g_clients[MAX_CLIENTS];
 
 GameEntity       *g_camEnt = nullptr;   //----(SA)	script camera
@@ -80,6 +83,7 @@ vmCvar_t g_inactivity;
 vmCvar_t g_debugMove;
 vmCvar_t g_debugDamage;
 vmCvar_t g_debugAlloc;
+vmCvar_t g_debugThinks;
 vmCvar_t g_debugBullets;
 vmCvar_t g_debugAudibleEvents;      //----(SA)	added
 vmCvar_t g_headshotMaxDist;     //----(SA)	added
@@ -116,6 +120,7 @@ vmCvar_t g_testPain;
 vmCvar_t g_missionStats;
 vmCvar_t ai_scriptName;         // name of AI script file to run (instead of default for that map)
 vmCvar_t g_scriptName;          // name of script file to run (instead of default for that map)
+vmCvar_t g_scriptProfile;       // time script actions, see scriptprofile
 
 vmCvar_t g_developer;
 
@@ -127,6 +132,7 @@ vmCvar_t g_mg42arc;
 
 vmCvar_t g_totalPlayTime;
 vmCvar_t g_attempts;
+vmCvar_t g_saveCompress;
 
 vmCvar_t g_footstepAudibleRange;
 
@@ -183,6 +189,7 @@ cvarTable_t gameCvarTable[] = {
 	{ &g_debugMove, "g_debugMove", "0", 0, 0, false },
 	{ &g_debugDamage, "g_debugDamage", "0", 0, 0, false },
 	{ &g_debugAlloc, "g_debugAlloc", "0", 0, 0, false },
+	{ &g_debugThinks, "g_debugThinks", "0", 0, 0, false },
 	{ &g_debugBullets, "g_debugBullets", "0", CVAR_CHEAT, 0, false},
 	{ &g_debugAudibleEvents, "g_debugAudibleEvents", "0", CVAR_CHEAT, 0, false},
 
@@ -220,11 +227,13 @@ cvarTable_t gameCvarTable[] = {
 
 	{&g_totalPlayTime, "g_totalPlayTime", "0", CVAR_ROM, 0, false},
 	{&g_attempts, "g_attempts", "0", CVAR_ROM, 0, false},
+	{&g_saveCompress, "g_saveCompress", "1", CVAR_ARCHIVE, 0, false},
 
 	{&g_footstepAudibleRange, "g_footstepAudibleRange", "256", CVAR_CHEAT, 0, false},
 
 	{&g_scriptName, "g_scriptName", "", CVAR_ROM, 0, false},
 	{&ai_scriptName, "ai_scriptName", "", CVAR_ROM, 0, false},
+	{&g_scriptProfile, "g_scriptProfile", "0", 0, 0, false},
 };
 
 // bk001129 - made static to avoid aliasing
@@ -750,6 +759,8 @@ void G_FindTeams( void ) {
 					if ( Q_stricmp( e2->classname, "func_door_rotating" ) ) {
 						e2->targetname = nullptr;
 					}
+					G_IndexEntity( e );
+					G_IndexEntity( e2 );
 				}
 			}
 		}
@@ -768,6 +779,9 @@ void G_RemapTeamShaders() {
 }
 
 
+// cvar_modificationCount as of the last full update of the cvar table
+static int cvarModificationCount = -1;
+
 /*
 =================
 G_RegisterCvars
@@ -778,6 +792,8 @@ void G_RegisterCvars( void ) {
 	cvarTable_t *cv;
 	bool remapped = false;
 
+	cvarModificationCount = -1;
+
 	for ( i = 0, cv = gameCvarTable ; i < gameCvarTableSize ; i++, cv++ ) {
 		Cvar_Register( cv->vmCvar, cv->cvarName,
 							cv->defaultString, cv->cvarFlags );
@@ -818,6 +834,12 @@ void G_UpdateCvars( void ) {
 	cvarTable_t *cv;
 	bool remapped = false;
 
+	// no cvar has changed since the last update
+	if ( cvarModificationCount == cvar_modificationCount ) {
+		return;
+	}
+	cvarModificationCount = cvar_modificationCount;
+
 	for ( i = 0, cv = gameCvarTable ; i < gameCvarTableSize ; i++, cv++ ) {
 		if ( cv->vmCvar ) {
 			Cvar_Update( cv->vmCvar );
@@ -894,6 +916,7 @@ void G_SpawnScriptCamera( void ) {
 	g_camEnt = G_Spawn();
 
 	g_camEnt->scriptName = "scriptcamera";
+	G_IndexEntity( g_camEnt );
 
 	g_camEnt->shared.s.eType = ET_CAMERA;
 	g_camEnt->shared.s.apos.trType = TR_STATIONARY;
@@ -1024,6 +1047,7 @@ void G_InitGame( int levelTime, int randomSeed, int restart )
 	// even if they aren't all used, so numbers inside that
 	// range are NEVER anything but clients
 	level.num_entities = MAX_CLIENTS;
+	G_IndexAllEntities();
 
 	// let the server system know where the entites are
 	SV_LocateGameData( &level.gentities[0].shared, level.num_entities, sizeof( GameEntity ),
@@ -1093,6 +1117,9 @@ void G_ShutdownGame( int restart ) {
 
 	AICast_AgePlayTime( 0 );
 
+	// don't leave a savegame half written
+	G_SaveGameFlush();
+
 	// Ridah, shutdown the Botlib, so weapons and things get reset upon doing a "map xxx" command
 	if ( Cvar_VariableIntegerValue( "bot_enable" ) ) {
 		int i;
@@ -1249,6 +1276,10 @@ void  G_LogPrintf( const char *fmt, ... ) {
 	char string[1024];
 	int min, tens, sec;
 
+	if ( !level.logFile ) {
+		return;
+	}
+
 	sec = level.time / 1000;
 
 	min = sec / 60;
@@ -1262,10 +1293,6 @@ void  G_LogPrintf( const char *fmt, ... ) {
 	vsnprintf( string + 7, 1024-7, fmt,argptr );
 	va_end( argptr );
 
-	if ( !level.logFile ) {
-		return;
-	}
-
 	FS_Write( string, strlen( string ), level.logFile );
 }
 
@@ -1377,12 +1404,12 @@ void G_RunThink( GameEntity *ent ) {
 		G_Script_ScriptRun( ent );
 	}
 
-	float thinktime = ent->nextthink;
-	if ( thinktime <= 0 || thinktime > level.time) {
+	// the think wheel has marked it if its nextthink has come
+	if ( !g_thinksDue.test( ent - g_entities ) ) {
 		return;
 	}
 
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 	if ( !ent->think ) {
 		Com_Error( ERR_DROP, "nullptr ent->think" );
         return; // keep the linter happy, ERR_DROP does not return
@@ -1390,6 +1417,131 @@ void G_RunThink( GameEntity *ent ) {
 	ent->think( ent );
 }
 
+/*
+=============
+G_RunEntity
+
+Advances one inuse entity for this frame
+=============
+*/
+static void G_RunEntity( int i ) {
+	GameEntity *ent = &g_entities[i];
+
+	// pick up any name change made without reindexing
+	G_IndexEntity( ent );
+
+	// check EF_NODRAW status for non-clients
+	if ( i > level.maxclients ) {
+		if ( ent->flags & FL_NODRAW ) {
+			ent->shared.s.eFlags |= EF_NODRAW;
+		} else {
+			ent->shared.s.eFlags &= ~EF_NODRAW;
+		}
+	}
+
+	// If this entity is attached to a parent, move it around with it,
+	// so the server thinks it's at least close to where the client will view it
+	if ( ent->tagParent ) {
+		vec3_t org;
+		BG_EvaluateTrajectory( &ent->tagParent->shared.s.pos, level.time, org );
+		G_SetOrigin( ent, org );
+		VectorCopy( org, ent->shared.s.origin );
+		if ( ent->shared.r.linked ) {    // update position
+			SV_LinkEntity( &ent->shared );
+		}
+	}
+
+	// clear events that are too old
+	if ( ent->eventTime && level.time - ent->eventTime > EVENT_VALID_MSEC ) {
+		if ( ent->shared.s.event ) {
+			ent->shared.s.event = 0;   // &= EV_EVENT_BITS;
+		}
+		// Clear all listed events (fixes hearing lots of sounds and events after vid_restart)
+		memset( ent->shared.s.events, 0, sizeof( ent->shared.s.events ) );
+		memset( ent->shared.s.eventParms, 0, sizeof( ent->shared.s.eventParms ) );
+		ent->shared.s.eventSequence = 0;
+		if ( ent->client ) {
+			memset( ent->client->ps.events, 0, sizeof( ent->client->ps.events ) );
+			memset( ent->client->ps.eventParms, 0, sizeof( ent->client->ps.eventParms ) );
+			ent->client->ps.eventSequence = 0;
+			ent->client->ps.oldEventSequence = 0;
+			ent->client->ps.entityEventSequence = 0;
+		}
+		if ( ent->freeAfterEvent ) {
+			// tempEntities or dropped items completely go away after their event
+			G_FreeEntity( ent );
+			return;
+		} else if ( ent->unlinkAfterEvent ) {
+			// items that will respawn will hide themselves after their pickup event
+			ent->unlinkAfterEvent = false;
+			SV_UnlinkEntity( &ent->shared );
+		}
+		ent->eventTime = 0;
+	}
+
+	// MrE: let the server know about bbox or capsule collision
+	if ( ent->shared.s.eFlags & EF_CAPSULE ) {
+		ent->shared.r.svFlags |= SVF_CAPSULE;
+	} else {
+		ent->shared.r.svFlags &= ~SVF_CAPSULE;
+	}
+
+	// temporary entities don't think
+	if ( ent->freeAfterEvent ) {
+		return;
+	}
+
+	if ( !ent->shared.r.linked && ent->neverFree ) {
+		return;
+	}
+
+	if ( ent->shared.s.eType == ET_MISSILE
+		 || ent->shared.s.eType == ET_FLAMEBARREL
+		 || ent->shared.s.eType == ET_FP_PARTS
+		 || ent->shared.s.eType == ET_FIRE_COLUMN
+		 || ent->shared.s.eType == ET_FIRE_COLUMN_SMOKE
+		 || ent->shared.s.eType == ET_EXPLO_PART
+		 || ent->shared.s.eType == ET_RAMJET ) {
+		G_RunMissile( ent );
+		return;
+	}
+
+	if ( ent->shared.s.eType == ET_ZOMBIESPIT ) {
+		G_RunSpit( ent );
+		return;
+	}
+
+	if ( ent->shared.s.eType == ET_CROWBAR ) {
+		G_RunCrowbar( ent );
+		return;
+	}
+
+	if ( ent->shared.s.eType == ET_ITEM || ent->physicsObject ) {
+		G_RunItem( ent );
+		return;
+	}
+
+	if ( ent->shared.s.eType == ET_ALARMBOX ) {
+		if ( ent->flags & FL_TEAMSLAVE ) {
+			return;
+		}
+		G_RunThink( ent );
+		return;
+	}
+
+	if ( ent->shared.s.eType == ET_MOVER || ent->shared.s.eType == ET_PROP ) {
+		G_RunMover( ent );
+		return;
+	}
+
+	if ( i < MAX_CLIENTS ) {
+		G_RunClient( ent );
+		return;
+	}
+
+	G_RunThink( ent );
+}
+
 /*
 ================
 G_RunFrame
@@ -1399,6 +1551,8 @@ Advances the non-player objects in the world
 */
 void G_RunFrame( int levelTime )
 {
+	PROFILE_ZONE( "G_RunFrame" );
+
 	// if we are waiting for the level to restart, do nothing
 	if ( level.restarted ) {
 		return;
@@ -1411,131 +1565,26 @@ void G_RunFrame( int levelTime )
 
 	AICast_CheckLoadGame();
 
+	// pick up a finished background save
+	G_SaveGameCheck();
+
 	// get any cvar changes
 	G_UpdateCvars();
 
+	// mark the entities due to think this frame
+	G_AdvanceThinks();
+	if ( g_debugThinks.integer ) {
+		G_CheckThinks();
+	}
+
 	//
 	// go through all allocated objects
 	//
 	//start = Sys_Milliseconds();
 
-	for (int i = 0 ; i < level.num_entities; i++) {
-		GameEntity* ent = &g_entities[i];
-		if ( !ent->inuse ) {
-			continue;
-		}
-
-		// check EF_NODRAW status for non-clients
-		if ( i > level.maxclients ) {
-			if ( ent->flags & FL_NODRAW ) {
-				ent->shared.s.eFlags |= EF_NODRAW;
-			} else {
-				ent->shared.s.eFlags &= ~EF_NODRAW;
-			}
-		}
-
-		// If this entity is attached to a parent, move it around with it,
-		// so the server thinks it's at least close to where the client will view it
-		if ( ent->tagParent ) {
-			vec3_t org;
-			BG_EvaluateTrajectory( &ent->tagParent->shared.s.pos, level.time, org );
-			G_SetOrigin( ent, org );
-			VectorCopy( org, ent->shared.s.origin );
-			if ( ent->shared.r.linked ) {    // update position
-				SV_LinkEntity( &ent->shared );
-			}
-		}
-
-		// clear events that are too old
-		if ( ent->eventTime && level.time - ent->eventTime > EVENT_VALID_MSEC ) {
-			if ( ent->shared.s.event ) {
-				ent->shared.s.event = 0;   // &= EV_EVENT_BITS;
-			}
-			// Clear all listed events (fixes hearing lots of sounds and events after vid_restart)
-			memset( ent->shared.s.events, 0, sizeof( ent->shared.s.events ) );
-			memset( ent->shared.s.eventParms, 0, sizeof( ent->shared.s.eventParms ) );
-			ent->shared.s.eventSequence = 0;
-			if ( ent->client ) {
-				memset( ent->client->ps.events, 0, sizeof( ent->client->ps.events ) );
-				memset( ent->client->ps.eventParms, 0, sizeof( ent->client->ps.eventParms ) );
-				ent->client->ps.eventSequence = 0;
-				ent->client->ps.oldEventSequence = 0;
-				ent->client->ps.entityEventSequence = 0;
-			}
-			if ( ent->freeAfterEvent ) {
-				// tempEntities or dropped items completely go away after their event
-				G_FreeEntity( ent );
-				continue;
-			} else if ( ent->unlinkAfterEvent ) {
-				// items that will respawn will hide themselves after their pickup event
-				ent->unlinkAfterEvent = false;
-				SV_UnlinkEntity( &ent->shared );
-			}
-			ent->eventTime = 0;
-		}
-
-		// MrE: let the server know about bbox or capsule collision
-		if ( ent->shared.s.eFlags & EF_CAPSULE ) {
-			ent->shared.r.svFlags |= SVF_CAPSULE;
-		} else {
-			ent->shared.r.svFlags &= ~SVF_CAPSULE;
-		}
-
-		// temporary entities don't think
-		if ( ent->freeAfterEvent ) {
-			continue;
-		}
-
-		if ( !ent->shared.r.linked && ent->neverFree ) {
-			continue;
-		}
-
-		if ( ent->shared.s.eType == ET_MISSILE
-			 || ent->shared.s.eType == ET_FLAMEBARREL
-			 || ent->shared.s.eType == ET_FP_PARTS
-			 || ent->shared.s.eType == ET_FIRE_COLUMN
-			 || ent->shared.s.eType == ET_FIRE_COLUMN_SMOKE
-			 || ent->shared.s.eType == ET_EXPLO_PART
-			 || ent->shared.s.eType == ET_RAMJET ) {
-			G_RunMissile( ent );
-			continue;
-		}
-
-		if ( ent->shared.s.eType == ET_ZOMBIESPIT ) {
-			G_RunSpit( ent );
-			continue;
-		}
-
-		if ( ent->shared.s.eType == ET_CROWBAR ) {
-			G_RunCrowbar( ent );
-			continue;
-		}
-
-		if ( ent->shared.s.eType == ET_ITEM || ent->physicsObject ) {
-			G_RunItem( ent );
-			continue;
-		}
-
-		if ( ent->shared.s.eType == ET_ALARMBOX ) {
-			if ( ent->flags & FL_TEAMSLAVE ) {
-				continue;
-			}
-			G_RunThink( ent );
-			continue;
-		}
-
-		if ( ent->shared.s.eType == ET_MOVER || ent->shared.s.eType == ET_PROP ) {
-			G_RunMover( ent );
-			continue;
-		}
-
-		if ( i < MAX_CLIENTS ) {
-			G_RunClient( ent );
-			continue;
-		}
-
-		G_RunThink( ent );
-	}
+	// only the slots in use, in order; entities freed or spawned by the ones before are
+	// skipped or run just as they would be by looking at every slot
+	g_entitiesInUse.forEach( level.num_entities, G_RunEntity );
 
 	// Ridah, move the AI
 	AICast_StartServerFrame( level.time );
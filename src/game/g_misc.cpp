@@ -201,7 +201,7 @@ void grabber_think_hit( GameEntity *ent ) {
 	G_RadiusDamage( ent->shared.s.pos.trBase, ent, ent->damage, ent->duration, ent, MOD_GRABBER );
 	G_AddEvent( ent, EV_GENERAL_SOUND, ent->sound2to1 ); // sound2to1 is the 'pain' sound
 
-	ent->nextthink  = level.time + ( attackDurations[( ent->shared.s.frame ) - 2] - attackHittimes[( ent->shared.s.frame ) - 2] );
+	G_SetNextThink( ent, level.time + ( attackDurations[( ent->shared.s.frame ) - 2] - attackHittimes[( ent->shared.s.frame ) - 2] ) );
 	ent->think      = grabber_think_idle;
 }
 
@@ -223,14 +223,14 @@ void grabber_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker,
 
 //	SV_UnlinkEntity(ent->enemy);
 	ent->enemy->think = G_FreeEntity;
-	ent->enemy->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent->enemy, level.time + FRAMETIME );
 //	G_FreeEntity(ent->enemy);
 
 	G_UseTargets( ent, attacker );
 
 //	SV_UnlinkEntity(ent);
 	ent->think = G_FreeEntity;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 //	G_FreeEntity(ent);
 }
 
@@ -246,7 +246,7 @@ grabber_attack
 void grabber_attack( GameEntity *ent ) {
 	ent->shared.s.frame    = ( rand() % 3 ) + 2;   // randomly choose an attack sequence
 
-	ent->nextthink  = level.time + attackHittimes[( ent->shared.s.frame ) - 2];
+	G_SetNextThink( ent, level.time + attackHittimes[( ent->shared.s.frame ) - 2] );
 	ent->think      = grabber_think_hit;
 }
 
@@ -313,7 +313,7 @@ void grabber_wake( GameEntity *ent ) {
 		ent->shared.s.frame        = 5;    // starting position
 
 		// go back to an idle if not attacking immediately
-		parent->nextthink   = level.time + FRAMETIME;
+		G_SetNextThink( parent, level.time + FRAMETIME );
 		parent->think       = grabber_think_idle;
 	}
 
@@ -485,7 +485,7 @@ void spotlight_finish_spawning( GameEntity *ent ) {
 	}
 	ent->takedamage = true;
 	ent->think      = 0;
-	ent->nextthink  = 0;
+	G_SetNextThink( ent, 0 );
 	ent->shared.s.frame    = 0;
 
 	ent->clipmask       = CONTENTS_SOLID;
@@ -509,7 +509,7 @@ void SP_misc_spotlight( GameEntity *ent ) {
 	ent->shared.s.eType        = ET_SPOTLIGHT_EF;
 
 	ent->think = spotlight_finish_spawning;
-	ent->nextthink = level.time + 100;
+	G_SetNextThink( ent, level.time + 100 );
 
 //----(SA)	model now tracked by client
 
@@ -635,7 +635,7 @@ void SP_misc_vis_dummy( GameEntity *ent ) {
 	SV_LinkEntity( &ent->shared );
 
 	ent->think = locateMaster;
-	ent->nextthink = level.time + 1000;
+	G_SetNextThink( ent, level.time + 1000 );
 
 }
 
@@ -728,7 +728,7 @@ void SP_misc_portal_surface( GameEntity *ent ) {
 		VectorCopy( ent->shared.s.origin, ent->shared.s.origin2 );
 	} else {
 		ent->think = locateCamera;
-		ent->nextthink = level.time + 100;
+		G_SetNextThink( ent, level.time + 100 );
 	}
 }
 
@@ -823,7 +823,7 @@ void Use_Shooter( GameEntity *ent, GameEntity *other, GameEntity *activator ) {
 static void InitShooter_Finish( GameEntity *ent ) {
 	ent->enemy = G_PickTarget( ent->target );
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 }
 
 void InitShooter( GameEntity *ent, int weapon ) {
@@ -849,7 +849,7 @@ void InitShooter( GameEntity *ent, int weapon ) {
 	// target might be a moving object, so we can't set movedir for it
 	if ( ent->target ) {
 		ent->think = InitShooter_Finish;
-		ent->nextthink = level.time + 500;
+		G_SetNextThink( ent, level.time + 500 );
 	}
 	SV_LinkEntity( &ent->shared );
 }
@@ -923,7 +923,7 @@ void shooter_tesla_finish_spawning( GameEntity *ent ) {
 	GameEntity   *tent;  // target ent
 
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 
 	// locate the target and set the location
 	tent = G_PickTarget( ent->target );
@@ -1017,7 +1017,7 @@ void SP_shooter_tesla( GameEntity *ent ) {
 
 	// finish up after everything has spawned in so we know all potential targets are ready
 	ent->think = shooter_tesla_finish_spawning;
-	ent->nextthink = level.time + 100;
+	G_SetNextThink( ent, level.time + 100 );
 }
 //----(SA)	end
 
@@ -1140,7 +1140,7 @@ this should be a volume that will encompase the area where the sniper target ass
 brush would fire at the player
 */
 void SP_sniper_brush( GameEntity *ent ) {
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->think = sniper_brush_init;
 	ent->touch = brush_activate_sniper;
 
@@ -1295,7 +1295,7 @@ void shutoff_dlight( GameEntity *ent ) {
 
 	SV_UnlinkEntity( &ent->shared );
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 }
 
 
@@ -1314,7 +1314,7 @@ void use_dlight( GameEntity *ent, GameEntity *other, GameEntity *activator ) {
 
 		if ( ent->spawnflags & 4 ) {   // ONETIME
 			ent->think = shutoff_dlight;
-			ent->nextthink = level.time + (  strlen( ent->dl_stylestring )  * 100 ) - 100;
+			G_SetNextThink( ent, level.time + (  strlen( ent->dl_stylestring )  * 100 ) - 100 );
 		}
 	}
 }
@@ -1367,7 +1367,7 @@ void SP_dlight( GameEntity *ent ) {
 	if ( !dlightstarttime ) {                      // sync up all the dlights
 		dlightstarttime = level.time + 100;
 	}
-	ent->nextthink  = dlightstarttime;
+	G_SetNextThink( ent, dlightstarttime );
 
 	if ( ent->dl_color[0] <= 0 &&                // if it's black or has no color assigned, make it white
 		 ent->dl_color[1] <= 0 &&
@@ -1431,7 +1431,7 @@ void snowInPVS( GameEntity *ent ) {
 
 	oldactive = ent->active;
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	player = AICast_FindEntityForName( "player" );
 
@@ -1505,13 +1505,13 @@ void snow_think( GameEntity *ent ) {
 	}
 
 	ent->think = snowInPVS;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 }
 
 void SP_Snow( GameEntity *ent ) {
 	ent->think = snow_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	G_SetOrigin( ent, ent->shared.s.origin );
 
@@ -1531,7 +1531,7 @@ void SP_Snow( GameEntity *ent ) {
 
 void SP_Bubbles( GameEntity *ent ) {
 	ent->think = snow_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	G_SetOrigin( ent, ent->shared.s.origin );
 
@@ -1605,7 +1605,7 @@ void mg42_muzzleflash( GameEntity *ent, vec3_t muzzlepos ) {  // cheezy, but let
 		flash->shared.s.eType = ET_GENERAL;
 
 		flash->think = G_FreeEntity;
-		flash->nextthink = level.time + 50;
+		G_SetNextThink( flash, level.time + 50 );
 
 		SV_LinkEntity( &flash->shared );
 	}
@@ -2115,7 +2115,7 @@ void mg42_think( GameEntity *self ) {
 				owner->client->ps.persistant[PERS_HWEAPON_USE] = 1;
 			}
 			mg42_track( self, owner );
-			self->nextthink = level.time + 50;
+			G_SetNextThink( self, level.time + 50 );
 
 			if ( !( owner->shared.r.svFlags & SVF_CASTAI ) ) {
 				clamp_playerbehindgun( self, owner, vec3_origin );
@@ -2170,7 +2170,7 @@ void mg42_think( GameEntity *self ) {
 	self->shared.s.apos.trTime = level.time;
 	self->shared.s.apos.trDuration = 50;
 
-	self->nextthink = level.time + 50;
+	G_SetNextThink( self, level.time + 50 );
 
 	// only let them go when it's pointing forward
 	if ( owner->client ) {
@@ -2326,13 +2326,14 @@ void mg42_spawn( GameEntity *ent ) {
 	VectorCopy( ent->shared.s.angles, gun->shared.s.angles2 );
 
 	gun->think = mg42_think;
-	gun->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( gun, level.time + FRAMETIME );
 	gun->shared.s.number = gun - g_entities;
 	gun->harc = ent->harc;
 	gun->varc = ent->varc;
 	gun->shared.s.apos.trType = TR_LINEAR_STOP;    // interpolate the angles
 	gun->takedamage = true;
 	gun->targetname = ent->targetname;      // need this for scripting
+	G_IndexEntity( gun );
 	gun->damage = ent->damage;
 	gun->health = ent->health;  //----(SA)	added
 	gun->accuracy = ent->accuracy;
@@ -2394,7 +2395,7 @@ void SP_mg42( GameEntity *self ) {
 	}
 
 	self->think = mg42_spawn;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 
 	snd_noammo = G_SoundIndex( "sound/weapons/noammo.wav" );
 
@@ -2438,13 +2439,14 @@ void flak_spawn( GameEntity *ent ) {
 	VectorCopy( gun->shared.s.angles, gun->shared.s.apos.trBase );
 	VectorCopy( gun->shared.s.angles, gun->shared.s.apos.trDelta );
 	gun->think = mg42_think;
-	gun->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( gun, level.time + FRAMETIME );
 	gun->shared.s.number = gun - g_entities;
 	gun->harc = ent->harc;
 	gun->varc = ent->varc;
 	gun->shared.s.apos.trType = TR_LINEAR_STOP;    // interpolate the angles
 	gun->takedamage = true;
 	gun->targetname = ent->targetname;      // need this for scripting
+	G_IndexEntity( gun );
 	gun->mg42BaseEnt = ent->shared.s.number;
 
 	SV_LinkEntity( &gun->shared );
@@ -2473,7 +2475,7 @@ void SP_misc_flak( GameEntity *self ) {
 	}
 
 	self->think = flak_spawn;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 
 	snd_noammo = G_SoundIndex( "sound/weapons/noammo.wav" );
 }
@@ -2506,7 +2508,7 @@ void misc_spawner_think( GameEntity *ent ) {
 void misc_spawner_use( GameEntity *ent, GameEntity *other, GameEntity *activator ) {
 
 	ent->think = misc_spawner_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 //	VectorCopy (other->shared.r.currentOrigin, ent->shared.r.currentOrigin);
 //	VectorCopy (ent->shared.r.currentOrigin, ent->shared.s.pos.trBase);
@@ -2586,6 +2588,7 @@ void misc_tagemitter_finishspawning( GameEntity *ent ) {
 	emitter->use = tagemitter_use;
 	emitter->AIScript_AlertEntity = tagemitter_die;
 	emitter->targetname = ent->targetname;
+	G_IndexEntity( emitter );
 	G_ProcessTagConnect( emitter, true );
 //	SV_LinkEntity( emitter );
 
@@ -2597,7 +2600,7 @@ void SP_misc_tagemitter( GameEntity *ent ) {
 	const char *tagName;
 
 	ent->think = misc_tagemitter_finishspawning;    // so it can find it's target
-	ent->nextthink = level.time + 100;
+	G_SetNextThink( ent, level.time + 100 );
 
 	if ( !G_SpawnString( "tag", nullptr, &tagName ) ) {
 		Com_Error( ERR_DROP, "misc_tagemitter: no 'tag' specified\n" );
@@ -2642,6 +2645,7 @@ void misc_firetrails_finishspawning( GameEntity *ent ) {
 	left->use = firetrail_use;
 	left->AIScript_AlertEntity = firetrail_die;
 	left->targetname = ent->targetname;
+	G_IndexEntity( left );
 	G_ProcessTagConnect( left, true );
 	SV_LinkEntity( &left->shared );
 
@@ -2656,6 +2660,7 @@ void misc_firetrails_finishspawning( GameEntity *ent ) {
 	right->use = firetrail_use;
 	right->AIScript_AlertEntity = firetrail_die;
 	right->targetname = ent->targetname;
+	G_IndexEntity( right );
 	G_ProcessTagConnect( right, true );
 	SV_LinkEntity( &right->shared );
 
@@ -2663,6 +2668,6 @@ void misc_firetrails_finishspawning( GameEntity *ent ) {
 
 void SP_misc_firetrails( GameEntity *ent ) {
 	ent->think = misc_firetrails_finishspawning;
-	ent->nextthink = level.time + 100;
+	G_SetNextThink( ent, level.time + 100 );
 
 }
@@ -265,7 +265,7 @@ void G_MissileImpact( GameEntity *ent, trace_t *trace, int impactDamage, vec3_t
 		Msmoke = G_Spawn();
 		VectorCopy( ent->shared.r.currentOrigin, Msmoke->shared.s.origin );
 		Msmoke->think = M_think;
-		Msmoke->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( Msmoke, level.time + FRAMETIME );
 		Msmoke->health = 5;
 	}
 }
@@ -287,7 +287,7 @@ void Concussive_think( GameEntity *ent ) {
 		ent->think = G_FreeEntity;
 	}
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	player = AICast_FindEntityForName( "player" );
 
@@ -347,7 +347,7 @@ void Concussive_fx( vec3_t origin ) {
 //	VectorCopy (ent->shared.s.origin, concussive->shared.s.origin);
 	VectorCopy( origin, concussive->shared.s.origin );
 	concussive->think = Concussive_think;
-	concussive->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( concussive, level.time + FRAMETIME );
 	concussive->delay = level.time + 500;
 
 	return;
@@ -410,7 +410,7 @@ void M_think( GameEntity *ent ) {
 	tent->shared.s.angles2[1] = 96;
 	tent->shared.s.angles2[2] = 50;
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 }
 
@@ -486,7 +486,7 @@ void G_ExplodeMissile( GameEntity *ent ) {
 			Msmoke->shared.s.density = 1;
 		}
 		Msmoke->think = M_think;
-		Msmoke->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( Msmoke, level.time + FRAMETIME );
 
 		if ( ent->parent && !Q_stricmp( ent->parent->classname, "props_flamebarrel" ) ) {
 			Msmoke->health = 10;
@@ -509,7 +509,7 @@ void G_MissileDie( GameEntity *self, GameEntity *inflictor, GameEntity *attacker
 	}
 	self->takedamage    = false;
 	self->think         = G_ExplodeMissile;
-	self->nextthink     = level.time + 10;
+	G_SetNextThink( self, level.time + 10 );
 }
 
 /*
@@ -539,7 +539,7 @@ void G_ExplodeMissilePoisonGas( GameEntity *ent ) {
 
 		gas = G_Spawn();
 		gas->think = gas_think;
-		gas->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( gas, level.time + FRAMETIME );
 		gas->shared.r.contents = CONTENTS_TRIGGER;
 		gas->touch = gas_touch;
 		gas->health = 100;
@@ -798,7 +798,7 @@ void G_RunSpit( GameEntity *ent ) {
 
 			gas = G_Spawn();
 			gas->think = gas_think;
-			gas->nextthink = level.time + FRAMETIME;
+			G_SetNextThink( gas, level.time + FRAMETIME );
 			gas->shared.r.contents = CONTENTS_TRIGGER;
 			gas->touch = gas_touch;
 			gas->health = 10;
@@ -900,16 +900,16 @@ GameEntity *fire_grenade( GameEntity *self, vec3_t start, vec3_t dir, int grenad
 		}
 
 		if ( !noExplode ) {
-			bolt->nextthink = level.time + self->client->ps.grenadeTimeLeft;
+			G_SetNextThink( bolt, level.time + self->client->ps.grenadeTimeLeft );
 		}
 	} else {
 		// let non-players throw the default duration
 		if ( grenadeWPID == WP_DYNAMITE ) {
 			if ( !noExplode ) {
-				bolt->nextthink = level.time + 5000;
+				G_SetNextThink( bolt, level.time + 5000 );
 			}
 		} else {
-			bolt->nextthink = level.time + 2500;
+			G_SetNextThink( bolt, level.time + 2500 );
 		}
 	}
 
@@ -987,6 +987,7 @@ GameEntity *fire_grenade( GameEntity *self, vec3_t start, vec3_t dir, int grenad
 
 		break;
 	}
+	G_IndexEntity( bolt );
 
 	bolt->clipmask = MASK_MISSILESHOT;
 
@@ -1017,7 +1018,8 @@ GameEntity *fire_rocket( GameEntity *self, vec3_t start, vec3_t dir ) {
 
 	bolt = G_Spawn();
 	bolt->classname = "rocket";
-	bolt->nextthink = level.time + 20000;   // push it out a little
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + 20000 );   // push it out a little
 	bolt->think = G_ExplodeMissile;
 	bolt->shared.s.eType = ET_MISSILE;
 	bolt->shared.r.svFlags = SVF_USE_CURRENT_ORIGIN | SVF_BROADCAST;
@@ -1076,7 +1078,8 @@ GameEntity *fire_zombiespit( GameEntity *self, vec3_t start, vec3_t dir ) {
 
 	bolt = G_Spawn();
 	bolt->classname = "zombiespit";
-	bolt->nextthink = level.time + 10000;
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + 10000 );
 
 	bolt->think = G_ExplodeMissile;
 
@@ -1120,7 +1123,8 @@ GameEntity *fire_zombiespirit( GameEntity *self, GameEntity *bolt, vec3_t start,
 	VectorNormalize( dir );
 
 	bolt->classname = "zombiespirit";
-	bolt->nextthink = level.time + 10000;
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + 10000 );
 
 	bolt->think = G_ExplodeMissile;
 
@@ -1160,7 +1164,8 @@ GameEntity *fire_crowbar( GameEntity *self, vec3_t start, vec3_t dir ) {
 
 	bolt = G_Spawn();
 	bolt->classname = "crowbar";
-	bolt->nextthink = level.time + 50000;
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + 50000 );
 	bolt->think = G_ExplodeMissile;
 	bolt->shared.s.eType = ET_CROWBAR;
 
@@ -1203,7 +1208,8 @@ GameEntity *fire_flamebarrel( GameEntity *self, vec3_t start, vec3_t dir ) {
 
 	bolt = G_Spawn();
 	bolt->classname = "flamebarrel";
-	bolt->nextthink = level.time + 3000;
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + 3000 );
 	bolt->think = G_ExplodeMissile;
 	bolt->shared.s.eType = ET_FLAMEBARREL;
 	bolt->shared.s.eFlags = EF_BOUNCE_HALF;
@@ -1362,7 +1368,8 @@ GameEntity *fire_mortar( GameEntity *self, vec3_t start, vec3_t dir ) {
 
 	bolt = G_Spawn();
 	bolt->classname = "mortar";
-	bolt->nextthink = level.time + 20000;   // push it out a little
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + 20000 );   // push it out a little
 	bolt->think = G_ExplodeMissile;
 	bolt->shared.s.eType = ET_MISSILE;
 
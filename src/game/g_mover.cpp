@@ -983,7 +983,7 @@ void Reached_BinaryMover( GameEntity *ent ) {
 		if ( ent->flags & FL_TOGGLE ) {
 			ent->active = false;   // enable door activation again
 			ent->think = ReturnToPos1;
-			ent->nextthink = 0;
+			G_SetNextThink( ent, 0 );
 			return;
 		}
 
@@ -991,7 +991,7 @@ void Reached_BinaryMover( GameEntity *ent ) {
 		// return to pos1 after a delay
 		if ( ent->wait != -1000 ) {
 			ent->think = ReturnToPos1;
-			ent->nextthink = level.time + ent->wait;
+			G_SetNextThink( ent, level.time + ent->wait );
 		}
 		// END JOSEPH
 	} else if ( ent->moverState == MOVER_2TO1 ) {
@@ -1031,14 +1031,14 @@ void Reached_BinaryMover( GameEntity *ent ) {
 		if ( ent->flags & FL_TOGGLE ) {
 			ent->active = false;   // enable door activation again
 			ent->think = ReturnToPos1Rotate;
-			ent->nextthink = 0;
+			G_SetNextThink( ent, 0 );
 			return;
 		}
 
 		if ( ent->wait != -1000 ) {
 			// return to pos1 after a delay (if not wait -1)
 			ent->think = ReturnToPos1Rotate;
-			ent->nextthink = level.time + ent->wait;
+			G_SetNextThink( ent, level.time + ent->wait );
 		}
 
 	} else if ( ent->moverState == MOVER_2TO1ROTATE )   {
@@ -1167,7 +1167,7 @@ void Reached_TrinaryMover( GameEntity *ent ) {
 
 		// goto pos 3
 		ent->think = GotoPos3;
-		ent->nextthink = level.time + 1000; //FRAMETIME;
+		G_SetNextThink( ent, level.time + 1000 ); //FRAMETIME;
 
 		// play sound
 		G_AddEvent( ent, EV_GENERAL_SOUND, ent->soundPos2 );
@@ -1192,7 +1192,7 @@ void Reached_TrinaryMover( GameEntity *ent ) {
 		// return to pos2 after a delay
 		if ( ent->wait != -1000 ) {
 			ent->think = ReturnToPos2;
-			ent->nextthink = level.time + ent->wait;
+			G_SetNextThink( ent, level.time + ent->wait );
 		}
 
 		// fire targets
@@ -1206,7 +1206,7 @@ void Reached_TrinaryMover( GameEntity *ent ) {
 
 		// return to pos1
 		ent->think = ReturnToPos1;
-		ent->nextthink = level.time + 1000; //FRAMETIME;
+		G_SetNextThink( ent, level.time + 1000 ); //FRAMETIME;
 
 		// play sound
 		G_AddEvent( ent, EV_GENERAL_SOUND, ent->soundPos3 );
@@ -1291,7 +1291,7 @@ void Use_TrinaryMover( GameEntity *ent, GameEntity *other, GameEntity *activator
 	// if all the way up, just delay before coming down
 	if ( ent->moverState == MOVER_POS3 ) {
 		if ( ent->wait != -1000 ) {
-			ent->nextthink = level.time + ent->wait;
+			G_SetNextThink( ent, level.time + ent->wait );
 		}
 		return;
 	}
@@ -1516,12 +1516,12 @@ void Use_BinaryMover( GameEntity *ent, GameEntity *other, GameEntity *activator
 	// JOSEPH 1-27-00
 	if ( ent->moverState == MOVER_POS2 ) {
 		if ( ent->flags & FL_TOGGLE ) {
-			ent->nextthink = level.time + 50;
+			G_SetNextThink( ent, level.time + 50 );
 			return;
 		}
 
 		if ( ent->wait != -1000 ) {
-			ent->nextthink = level.time + ent->wait;
+			G_SetNextThink( ent, level.time + ent->wait );
 		}
 		return;
 	}
@@ -1530,9 +1530,9 @@ void Use_BinaryMover( GameEntity *ent, GameEntity *other, GameEntity *activator
 	// if all the way up, just delay before coming down
 	if ( ent->moverState == MOVER_POS2ROTATE ) {
 		if ( ent->flags & FL_TOGGLE ) {
-			ent->nextthink = level.time + 50;   // do it *now* for toggles
+			G_SetNextThink( ent, level.time + 50 );   // do it *now* for toggles
 		} else {
-			ent->nextthink = level.time + ent->wait;
+			G_SetNextThink( ent, level.time + ent->wait );
 		}
 		return;
 	}
@@ -2032,7 +2032,7 @@ void finishSpawningKeyedMover( GameEntity *ent ) {
 		G_SetAASBlockingEntity( ent, true );
 	}
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	if ( !( ent->flags & FL_TEAMSLAVE ) ) {
 		if ( ent->targetname || ent->takedamage ) {  // non touch/shoot doors
@@ -2363,7 +2363,7 @@ void SP_func_door( GameEntity *ent ) {
 		}
 	}
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->think = finishSpawningKeyedMover;
 }
 
@@ -2479,7 +2479,7 @@ void SP_func_secret( GameEntity *ent ) {
 		}
 	}
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->think = finishSpawningKeyedMover;
 }
 // END JOSEPH
@@ -2506,7 +2506,7 @@ void Touch_Plat( GameEntity *ent, GameEntity *other, trace_t *trace ) {
 
 	// delay return-to-pos1 by one second
 	if ( ent->moverState == MOVER_POS2 ) {
-		ent->nextthink = level.time + 1000;
+		G_SetNextThink( ent, level.time + 1000 );
 	}
 }
 
@@ -2801,7 +2801,7 @@ void Reached_Train( GameEntity *ent ) {
 
 	// if there is a "wait" value on the target, don't start moving yet
 	if ( next->wait ) {
-		ent->nextthink = level.time + next->wait * 1000;
+		G_SetNextThink( ent, level.time + next->wait * 1000 );
 		ent->think = Think_BeginMoving;
 		ent->shared.s.pos.trType = TR_STATIONARY;
 	}
@@ -2989,7 +2989,7 @@ void SP_func_train( GameEntity *self ) {
 
 	// start trains on the second frame, to make sure their targets have had
 	// a chance to spawn
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 	self->think = Think_SetupTrainTargets;
 
 	self->blocked = Blocked_Door;
@@ -3065,7 +3065,7 @@ delay = (end map) wait in seconds this long after player steps outside, before s
 */
 void FuncBatsReached( GameEntity *self ) {
 	if ( self->active == 2 ) {
-		self->nextthink = -1;
+		G_SetNextThink( self, -1 );
 		self->think = nullptr;
 		return;
 	}
@@ -3135,13 +3135,13 @@ void BatMoveThink( GameEntity *bat ) {
 		G_FreeEntity( bat );
 		return;
 	}
-	bat->nextthink = level.time + 50;
+	G_SetNextThink( bat, level.time + 50 );
 }
 
 void BatDie( GameEntity *self, GameEntity *inflictor, GameEntity *attacker, int damage, int meansOfDeath ) {
 	G_AddEvent( self, EV_BATS_DEATH, 0 );
 	self->think = G_FreeEntity;
-	self->nextthink = level.time + 100;
+	G_SetNextThink( self, level.time + 100 );
 }
 
 void FuncBatsActivate( GameEntity *self, GameEntity * other, GameEntity * activator ) {
@@ -3156,6 +3156,7 @@ void FuncBatsActivate( GameEntity *self, GameEntity * other, GameEntity * activa
 		for ( i = 0; i < self->count; i++ ) {
 			bat = G_Spawn();
 			bat->classname = "func_bat";
+			G_IndexEntity( bat );
 			bat->shared.s.eType = ET_BAT;
 
 			VectorSet( vec, crandom(), crandom(), crandom() );
@@ -3179,7 +3180,7 @@ void FuncBatsActivate( GameEntity *self, GameEntity * other, GameEntity * activa
 			bat->radius = self->radius;
 
 			bat->think = BatMoveThink;
-			bat->nextthink = level.time + 50;
+			G_SetNextThink( bat, level.time + 50 );
 
 			SV_LinkEntity( &bat->shared );
 		}
@@ -3204,7 +3205,7 @@ void FuncEndSpiritsThink( GameEntity *self ) {
 	vec3_t enemyPos;
 	GameEntity *cEnt, *heinrich;
 	//
-	self->nextthink = level.time + (int)( ( 1.5 + 2.0 * random() ) * ( self->wait * 1000 ) );
+	G_SetNextThink( self, level.time + (int)( ( 1.5 + 2.0 * random() ) * ( self->wait * 1000 ) ) );
 	//
 	if ( !self->active ) {
 		return; // we are not allowed to release spirits yet
@@ -3243,7 +3244,7 @@ void FuncEndSpiritsThink( GameEntity *self ) {
 			if ( !self->botDelayBegin ) {
 				self->botDelayBegin = true;
 				// set the delay before we start spawning them
-				self->nextthink = level.time + (int)( self->delay * 1000.0 );
+				G_SetNextThink( self, level.time + (int)( self->delay * 1000.0 ) );
 			} else {
 				G_AddEvent( self, EV_SPAWN_SPIRIT, 0 );
 			}
@@ -3274,7 +3275,7 @@ void SP_func_bats( GameEntity *self ) {
 
 	self->damage = 0;
 
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 	self->think = Think_SetupTrainTargets;
 
 	// disable this to debug path
@@ -3292,7 +3293,7 @@ void SP_func_bats( GameEntity *self ) {
 		self->botDelayBegin = false;
 		//
 		self->think = FuncEndSpiritsThink;
-		self->nextthink = level.time + ( self->wait * 1000 );
+		G_SetNextThink( self, level.time + ( self->wait * 1000 ) );
 		//
 		self->shared.r.contents = 0;
 		SV_LinkEntity( &self->shared );
@@ -3420,7 +3421,7 @@ void Reached_Train_rotating( GameEntity *ent ) {
 
 	// if there is a "wait" value on the target, don't start moving yet
 	if ( next->wait ) {
-		ent->nextthink = level.time + next->wait * 1000;
+		G_SetNextThink( ent, level.time + next->wait * 1000 );
 		ent->think = Think_BeginMoving_rotating;
 		ent->shared.s.pos.trType = TR_STATIONARY;
 	}
@@ -3528,7 +3529,7 @@ void SP_func_train_rotating( GameEntity *self ) {
 
 	// start trains on the second frame, to make sure their targets have had
 	// a chance to spawn
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 	self->think = Think_SetupTrainTargets_rotating;
 }
 // END JOSEPH
@@ -4025,7 +4026,7 @@ void SP_func_door_rotating( GameEntity *ent ) {
 		}
 	}
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->think = finishSpawningKeyedMover;
 
 	VectorCopy( ent->shared.s.origin, ent->shared.s.pos.trBase );
@@ -4168,7 +4169,7 @@ void ClearExplosive( GameEntity *self ) {
 	self->pain  = nullptr;
 	self->touch = nullptr;
 	self->use   = nullptr;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 	self->think = G_FreeEntity;
 
 
@@ -4200,7 +4201,7 @@ void func_explosive_explode( GameEntity *self, GameEntity *inflictor, GameEntity
 
 		timeToDeath = (int)( self->wait * 1000.0f ) + FRAMETIME;
 
-		self->nextthink = level.time + timeToDeath; // delay removal until the animation has played out and leave as long as the user requested
+		G_SetNextThink( self, level.time + timeToDeath ); // delay removal until the animation has played out and leave as long as the user requested
 		self->shared.s.time = timeToDeath < 3000 ? timeToDeath : self->nextthink - 3000;   // 3 sec fade at end, unless the life time is less than 2 seconds, then fade from now to death
 		self->shared.s.time2 = self->nextthink;
 	}
@@ -4359,7 +4360,7 @@ void InitExplosive( GameEntity *ent ) {
 
 	if ( !( ent->spawnflags & 16 ) ) {
 		ent->think = G_BlockThink;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 	}
 }
 
@@ -56,7 +56,7 @@ void DropToFloorG( GameEntity *ent ) {
 
 	G_SetOrigin( ent, tr.endpos );
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 }
 
 void DropToFloor( GameEntity *ent ) {
@@ -79,7 +79,7 @@ void DropToFloor( GameEntity *ent ) {
 	G_SetOrigin( ent, tr.endpos );
 
 	ent->think = DropToFloorG;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 }
 
 void moveit( GameEntity *ent, float yaw, float dist ) {
@@ -152,7 +152,7 @@ void SP_props_box_32( GameEntity *self ) {
 	SV_LinkEntity( &self->shared );
 
 	self->think = DropToFloor;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 }
 
 void touch_props_box_48( GameEntity *self, GameEntity *other, trace_t *trace ) {
@@ -185,7 +185,7 @@ void SP_props_box_48( GameEntity *self ) {
 	SV_LinkEntity( &self->shared );
 
 	self->think = DropToFloor;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 }
 
 void touch_props_box_64( GameEntity *self, GameEntity *other, trace_t *trace ) {
@@ -218,7 +218,7 @@ void SP_props_box_64( GameEntity *self ) {
 	SV_LinkEntity( &self->shared );
 
 	self->think = DropToFloor;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 }
 // END JOSEPH
 
@@ -242,7 +242,7 @@ void Psmoke_think( GameEntity *ent ) {
 	tent->shared.s.angles2[1] = 32;
 	tent->shared.s.angles2[2] = 50;
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 }
 
 void prop_smoke( GameEntity *ent ) {
@@ -251,7 +251,7 @@ void prop_smoke( GameEntity *ent ) {
 	Psmoke = G_Spawn();
 	VectorCopy( ent->shared.r.currentOrigin, Psmoke->shared.s.origin );
 	Psmoke->think = Psmoke_think;
-	Psmoke->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( Psmoke, level.time + FRAMETIME );
 }
 
 /*QUAKED props_sparks (.8 .46 .16) (-8 -8 -8) (8 8 8) ELECTRIC
@@ -301,7 +301,7 @@ void Psparks_think( GameEntity *ent ) {
 	tent->shared.s.angles2[1] = ent->end_size;
 	tent->shared.s.angles2[2] = ent->speed;
 
-	ent->nextthink = level.time + FRAMETIME + ent->delay + ( rand() % 600 );
+	G_SetNextThink( ent, level.time + FRAMETIME + ent->delay + ( rand() % 600 ) );
 }
 
 void sparks_angles_think( GameEntity *ent ) {
@@ -324,7 +324,7 @@ void sparks_angles_think( GameEntity *ent ) {
 
 	SV_LinkEntity( &ent->shared );
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	if ( !Q_stricmp( ent->classname, "props_sparks" ) ) {
 		ent->think = Psparks_think;
 	} else {
@@ -339,7 +339,7 @@ void SP_props_sparks( GameEntity *ent ) {
 	ent->shared.s.eType = ET_GENERAL;
 
 	ent->think = sparks_angles_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	if ( !ent->health ) {
 		ent->health = 8;
@@ -381,7 +381,7 @@ void SP_props_gunsparks( GameEntity *ent ) {
 	ent->shared.s.eType = ET_GENERAL;
 
 	ent->think = sparks_angles_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	if ( !ent->speed ) {
 		ent->speed = 20;
@@ -484,7 +484,7 @@ void SP_Dust( GameEntity *ent ) {
 
 	if ( ent->target ) {
 		ent->think = dust_angles_think;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 	}
 
 	SV_LinkEntity( &ent->shared );
@@ -500,7 +500,8 @@ void propExplosionLarge( GameEntity *ent ) {
 
 	bolt = G_Spawn();
 	bolt->classname = "props_explosion_large";
-	bolt->nextthink = level.time + FRAMETIME;
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + FRAMETIME );
 	bolt->think = G_ExplodeMissile;
 	bolt->shared.s.eType = ET_MISSILE;
 
@@ -526,7 +527,8 @@ void propExplosion( GameEntity *ent ) {
 	extern void G_ExplodeMissile( GameEntity *ent );
 	bolt = G_Spawn();
 	bolt->classname = "props_explosion";
-	bolt->nextthink = level.time + FRAMETIME;
+	G_IndexEntity( bolt );
+	G_SetNextThink( bolt, level.time + FRAMETIME );
 	bolt->think = G_ExplodeMissile;
 	bolt->shared.s.eType = ET_MISSILE;
 
@@ -613,7 +615,7 @@ void props_bench_think( GameEntity *ent ) {
 	ent->shared.s.frame++;
 
 	if ( ent->shared.s.frame < 28 ) {
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 	} else
 	{
 		ent->clipmask = 0;
@@ -627,7 +629,7 @@ void props_bench_think( GameEntity *ent ) {
 
 void props_bench_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
 	ent->think = props_bench_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 }
 
 /*QUAKED props_bench (.8 .6 .2) ?
@@ -761,14 +763,14 @@ void locker_tall_think( GameEntity *ent ) {
 	} else
 	{
 		ent->shared.s.frame++;
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 	}
 
 }
 
 void props_locker_tall_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
 	ent->think = locker_tall_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->takedamage = false;
 
@@ -884,7 +886,7 @@ void Just_Got_Thrown( GameEntity *self ) {
 	len = 0;
 
 	if ( self->shared.s.groundEntityNum == -1 ) {
-		self->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( self, level.time + FRAMETIME );
 
 		if ( self->enemy ) {
 			GameEntity *player;
@@ -950,7 +952,7 @@ void Just_Got_Thrown( GameEntity *self ) {
 					self->shared.r.ownerNum = player->shared.s.number;
 					player->active = true;
 					player->melee = self;
-					self->nextthink = level.time + 50;
+					G_SetNextThink( self, level.time + 50 );
 
 					self->think = Props_Chair_Think;
 					self->touch = nullptr;
@@ -974,7 +976,7 @@ void Just_Got_Thrown( GameEntity *self ) {
 	self->die = Props_Chair_Die;
 	self->shared.s.eType = ET_MOVER;
 
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 
 	self->shared.r.ownerNum = self->shared.s.number;
 
@@ -1006,7 +1008,7 @@ void Props_Activated( GameEntity *self ) {
 
 	owner = &g_entities[self->shared.r.ownerNum];
 
-	self->nextthink = level.time + 50;
+	G_SetNextThink( self, level.time + 50 );
 
 	if ( !owner->client ) {
 		return;
@@ -1036,7 +1038,7 @@ void Props_Activated( GameEntity *self ) {
 		VectorCopy( velocity, self->shared.s.pos.trDelta );
 
 		self->think = nullptr;
-		self->nextthink = 0;
+		G_SetNextThink( self, 0 );
 
 		prop = G_Spawn();
 		prop->shared.s.modelindex = self->shared.s.modelindex;
@@ -1073,13 +1075,14 @@ void Props_Activated( GameEntity *self ) {
 		prop->count = self->count;
 
 		prop->think = Just_Got_Thrown;
-		prop->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( prop, level.time + FRAMETIME );
 
 		prop->takedamage = true;
 
 		prop->wait = self->wait;
 
 		prop->classname = self->classname;
+		G_IndexEntity( prop );
 
 		prop->shared.s.groundEntityNum = -1;
 
@@ -1197,7 +1200,7 @@ void Props_Chair_Think( GameEntity *self ) {
 	Prop_Check_Ground( self );
 
 
-	self->nextthink = level.time + 50;
+	G_SetNextThink( self, level.time + 50 );
 	SV_LinkEntity( &self->shared );
 }
 
@@ -1330,13 +1333,13 @@ void Props_Chair_Animate( GameEntity *ent ) {
 			ent->shared.s.frame = 27;
 			G_UseTargets( ent, nullptr );
 			ent->think = G_FreeEntity;
-			ent->nextthink = level.time + 2000;
+			G_SetNextThink( ent, level.time + 2000 );
 			ent->shared.s.time = level.time;
 			ent->shared.s.time2 = level.time + 2000;
 			return;
 		} else
 		{
-			ent->nextthink = level.time + ( FRAMETIME / 2 );
+			G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 		}
 	} else if (
 		( !Q_stricmp( ent->classname, "props_chair_side" ) ) ||
@@ -1348,13 +1351,13 @@ void Props_Chair_Animate( GameEntity *ent ) {
 			ent->shared.s.frame = 20;
 			G_UseTargets( ent, nullptr );
 			ent->think = G_FreeEntity;
-			ent->nextthink = level.time + 2000;
+			G_SetNextThink( ent, level.time + 2000 );
 			ent->shared.s.time = level.time;
 			ent->shared.s.time2 = level.time + 2000;
 			return;
 		} else
 		{
-			ent->nextthink = level.time + ( FRAMETIME / 2 );
+			G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 		}
 	} else if ( !Q_stricmp( ent->classname, "props_desklamp" ) )       {
 		if ( ent->shared.s.frame >= 11 ) {
@@ -1364,13 +1367,13 @@ void Props_Chair_Animate( GameEntity *ent ) {
 			}
 
 			ent->think = G_FreeEntity;
-			ent->nextthink = level.time + 2000;
+			G_SetNextThink( ent, level.time + 2000 );
 			ent->shared.s.time = level.time;
 			ent->shared.s.time2 = level.time + 2000;
 			return;
 		} else
 		{
-			ent->nextthink = level.time + ( FRAMETIME / 2 );
+			G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 		}
 	}
 
@@ -1422,7 +1425,7 @@ void Spawn_Shard( GameEntity *ent, GameEntity *inflictor, int quantity, int type
 
 	sfx->think = G_FreeEntity;
 
-	sfx->nextthink = level.time + 1000;
+	G_SetNextThink( sfx, level.time + 1000 );
 
 	sfx->shared.s.frame = quantity;
 
@@ -1472,7 +1475,7 @@ void Props_Chair_Die( GameEntity *ent, GameEntity *inflictor, GameEntity *attack
 	}
 
 	ent->think = Props_Chair_Animate;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->health = ent->duration;
 	ent->delay = damage;
@@ -1568,7 +1571,7 @@ void SP_Props_Chair( GameEntity *ent ) {
 
 	}
 	ent->think = Props_Chair_Think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->touch = Props_Chair_Touch;
 	ent->die = Props_Chair_Die;
@@ -1629,7 +1632,7 @@ void SP_Props_GenericChair( GameEntity *ent ) {
 	}
 
 	ent->think = Props_Chair_Think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->touch = Props_Chair_Touch;
 	ent->die = Props_Chair_Die;
@@ -1831,7 +1834,7 @@ void SP_Props_Desklamp( GameEntity *ent ) {
 	}
 
 	ent->think = Props_Chair_Think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->touch = Props_Chair_Touch;
 	ent->die = Props_Chair_Die;
@@ -1869,20 +1872,20 @@ void Props_Barrel_Animate( GameEntity *ent ) {
 		if ( ent->spawnflags & 1 ) {
 			//	G_UseTargets (ent, nullptr);
 			ent->think = G_FreeEntity;
-			ent->nextthink = level.time + 25000;
+			G_SetNextThink( ent, level.time + 25000 );
 			return;
 		} else
 		{
 			//	G_UseTargets (ent, nullptr);
 			ent->think = G_FreeEntity;
-			ent->nextthink = level.time + 25000;
+			G_SetNextThink( ent, level.time + 25000 );
 			//ent->shared.s.time = level.time;
 			//ent->shared.s.time2 = level.time + 2000;
 			return;
 		}
 	} else
 	{
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 	}
 
 	ent->shared.s.frame++;
@@ -1920,7 +1923,7 @@ void smoker_think( GameEntity *ent ) {
 	} else
 	{
 		barrel_smoke( ent );
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 	}
 
 }
@@ -1957,7 +1960,7 @@ void OilParticles_think( GameEntity *ent ) {
 	owner = &g_entities[ent->shared.s.density];
 
 	if ( owner && owner->takedamage && ent->count2 > level.time - 5000 ) {
-		ent->nextthink = ( level.time + FRAMETIME / 2 );
+		G_SetNextThink( ent, ( level.time + FRAMETIME / 2 ) );
 
 		tent = G_TempEntity( ent->shared.r.currentOrigin, EV_OILPARTICLES );
 		VectorCopy( ent->shared.r.currentOrigin, tent->shared.s.origin );
@@ -2036,7 +2039,7 @@ void SP_OilParticles( GameEntity *ent ) {
 	VectorCopy( forward, OilLeak->rotate );
 
 	OilLeak->think = OilParticles_think;
-	OilLeak->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( OilLeak, level.time + FRAMETIME );
 
 	OilLeak->shared.s.density = ent->shared.s.number;
 	OilLeak->count2 = level.time;
@@ -2078,7 +2081,7 @@ void OilSlick_remove( GameEntity *ent ) {
 	remove = G_Spawn();
 	remove->shared.s.density = ent->shared.s.number;
 	remove->think = OilSlick_remove_think;
-	remove->nextthink = level.time + 1000;
+	G_SetNextThink( remove, level.time + 1000 );
 	VectorCopy( ent->shared.r.currentOrigin, remove->shared.r.currentOrigin );
 	SV_LinkEntity( &remove->shared );
 }
@@ -2091,7 +2094,7 @@ void Props_Barrel_Die( GameEntity *ent, GameEntity *inflictor, GameEntity *attac
 
 	if ( ent->spawnflags & 1 ) {
 		smoker = G_Spawn();
-		smoker->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( smoker, level.time + FRAMETIME );
 		smoker->think = smoker_think;
 		smoker->count = 150 + rand() % 100;
 		G_SetOrigin( smoker, ent->shared.r.currentOrigin );
@@ -2120,7 +2123,7 @@ void Props_Barrel_Die( GameEntity *ent, GameEntity *inflictor, GameEntity *attac
 	ent->touch = nullptr;
 
 	ent->think = Props_Barrel_Animate;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->health = ent->duration;
 	ent->delay = damage;
@@ -2233,7 +2236,7 @@ void SP_Props_Flamebarrel( GameEntity *ent ) {
 	ent->count = 2; // metal shards
 
 	ent->think = Props_Barrel_Think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->touch = Props_Barrel_Touch;
 
@@ -2310,14 +2313,14 @@ void crate_animate( GameEntity *ent ) {
 	if ( ent->shared.s.frame == 17 ) {
 		G_UseTargets( ent, nullptr );
 		ent->think = G_FreeEntity;
-		ent->nextthink = level.time + 2000;
+		G_SetNextThink( ent, level.time + 2000 );
 		ent->shared.s.time = level.time;
 		ent->shared.s.time2 = level.time + 2000;
 		return;
 	}
 
 	ent->shared.s.frame++;
-	ent->nextthink = level.time + ( FRAMETIME / 2 );
+	G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 }
 
 void crate_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
@@ -2331,7 +2334,7 @@ void crate_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, in
 
 	ent->takedamage = false;
 	ent->think = crate_animate;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->touch = nullptr;
 
 	SV_UnlinkEntity( &ent->shared );
@@ -2383,7 +2386,7 @@ void SP_crate_64( GameEntity *self ) {
 	SV_LinkEntity( &self->shared );
 
 	self->think = DropToFloor;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 }
 
 void SP_crate_32( GameEntity *self ) {
@@ -2425,7 +2428,7 @@ void SP_crate_32( GameEntity *self ) {
 	SV_LinkEntity( &self->shared );
 
 	self->think = DropToFloor;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 }
 
 //////////////////////////////////////////////
@@ -2434,7 +2437,7 @@ void props_crate32x64_think( GameEntity *ent ) {
 	ent->shared.s.frame++;
 
 	if ( ent->shared.s.frame < 17 ) {
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 	} else
 	{
 		ent->clipmask = 0;
@@ -2448,7 +2451,7 @@ void props_crate32x64_think( GameEntity *ent ) {
 
 void props_crate32x64_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
 	ent->think = props_crate32x64_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 }
 
 void SP_Props_Crate32x64( GameEntity *ent ) {
@@ -2512,7 +2515,7 @@ void flippy_table_use( GameEntity *ent, GameEntity *other, GameEntity *activator
 			VectorCopy( ent->shared.s.apos.trDelta, slave->shared.s.apos.trDelta );
 
 			slave->think = ent->think;
-			slave->nextthink = ent->nextthink;
+			G_SetNextThink( slave, ent->nextthink );
 
 			VectorCopy( ent->pos1, slave->pos1 );
 			VectorCopy( ent->pos2, slave->pos2 );
@@ -2539,17 +2542,17 @@ void flippy_table_animate( GameEntity *ent ) {
 	if ( ent->shared.s.frame == 9 ) {
 		G_UseTargets( ent, nullptr );
 		ent->think = G_FreeEntity;
-		ent->nextthink = level.time + 2000;
+		G_SetNextThink( ent, level.time + 2000 );
 	} else
 	{
 		ent->shared.s.frame++;
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 	}
 }
 
 void props_flippy_table_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
 	ent->think = flippy_table_animate;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->takedamage = false;
 
@@ -2676,7 +2679,7 @@ void props_58x112tablew_think( GameEntity *ent ) {
 	ent->shared.s.frame++;
 
 	if ( ent->shared.s.frame < 16 ) {
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 	} else
 	{
 
@@ -2690,7 +2693,7 @@ void props_58x112tablew_think( GameEntity *ent ) {
 
 void props_58x112tablew_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
 	ent->think = props_58x112tablew_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->takedamage = false;
 }
 
@@ -2758,7 +2761,7 @@ void props_castlebed_animate( GameEntity *ent ) {
 	ent->shared.s.frame++;
 
 	if ( ent->shared.s.frame < 8 ) {
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 	} else
 	{
 		ent->clipmask = 0;
@@ -2769,7 +2772,7 @@ void props_castlebed_animate( GameEntity *ent ) {
 
 void props_castlebed_die( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
 	ent->think = props_castlebed_animate;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->touch = nullptr;
 	ent->takedamage = false;
 
@@ -2840,9 +2843,9 @@ void props_snowGenerator_think( GameEntity *ent ) {
 	}
 
 	if ( ent->spawnflags & 2 ) {
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 	} else if ( ent->wait < level.time ) {
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 	}
 }
 
@@ -2850,7 +2853,7 @@ void props_snowGenerator_use( GameEntity *ent, GameEntity *other, GameEntity *ac
 	if ( !( ent->spawnflags & 1 ) ) {
 		ent->spawnflags |= 1;
 		ent->think = props_snowGenerator_think;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 		ent->wait = level.time + ent->duration;
 	} else {
 		ent->spawnflags &= ~1;
@@ -2888,7 +2891,7 @@ void SP_props_snowGenerator( GameEntity *ent ) {
 
 	if ( ent->spawnflags & 1 || ent->spawnflags & 2 ) {
 		ent->think = props_snowGenerator_think;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 
 		if ( ent->spawnflags & 2 ) {
 			ent->spawnflags |= 1;
@@ -2978,7 +2981,7 @@ void propsFireColumnUse( GameEntity *ent, GameEntity *other, GameEntity *activat
 	// TBD
 	// lifetime
 	if ( ent->duration ) {
-		tent->nextthink = level.time + ent->duration;
+		G_SetNextThink( tent, level.time + ent->duration );
 	}
 
 	// speed
@@ -3032,7 +3035,7 @@ void propsFireColumnInit( GameEntity *ent ) {
 void SP_propsFireColumn( GameEntity *ent ) {
 	G_SetOrigin( ent, ent->shared.s.origin );
 	ent->think = propsFireColumnInit;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 	ent->use = propsFireColumnUse;
 	SV_LinkEntity( &ent->shared );
 }
@@ -3138,7 +3141,7 @@ void SP_props_ExploPart( GameEntity *ent ) {
 	}
 
 	ent->think = props_ExploPartInit;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	ent->use = props_ExploPartUse;
 }
@@ -3181,7 +3184,7 @@ void props_decoration_animate( GameEntity *ent ) {
 		}
 	}
 
-	ent->nextthink = level.time + 50;
+	G_SetNextThink( ent, level.time + 50 );
 }
 
 void props_decoration_death( GameEntity *ent, GameEntity *inflictor, GameEntity *attacker, int damage, int mod ) {
@@ -3201,7 +3204,7 @@ void props_decoration_death( GameEntity *ent, GameEntity *inflictor, GameEntity
 	}
 
 	if ( ent->spawnflags & 4 ) {
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 		ent->think = props_decoration_animate;
 		return;
 	}
@@ -3215,7 +3218,7 @@ void Use_props_decoration( GameEntity *ent, GameEntity *self, GameEntity *activa
 		SV_LinkEntity( &ent->shared );
 		ent->spawnflags &= ~1;
 	} else if ( ent->spawnflags & 4 )     {
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 		ent->think = props_decoration_animate;
 	} else
 	{
@@ -3352,7 +3355,7 @@ void SP_props_decoration( GameEntity *ent ) {
 	}
 
 	if ( ent->spawnflags & 64 ) {
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 		ent->think = props_decoration_animate;
 	}
 
@@ -3581,7 +3584,7 @@ void props_statue_animate( GameEntity *ent ) {
 	}
 
 	if ( ent->shared.s.frame < ent->count2 ) {
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 	}
 }
 
@@ -3608,7 +3611,7 @@ void props_statue_death( GameEntity *ent, GameEntity *inflictor, GameEntity *att
 	}
 
 	if ( ent->spawnflags & 4 ) {
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 		ent->think = props_statue_animate;
 		return;
 	}
@@ -3800,7 +3803,7 @@ void Spawn_Junk( GameEntity *ent ) {
 
 	sfx->think = G_FreeEntity;
 
-	sfx->nextthink = level.time + 1000;
+	G_SetNextThink( sfx, level.time + 1000 );
 
 	SV_LinkEntity( &sfx->shared );
 }
@@ -3813,7 +3816,7 @@ props_locker_endrattle
 void props_locker_endrattle( GameEntity *ent ) {
 	ent->shared.s.frame = 0;   // idle
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 	ent->delay = 0;
 }
 
@@ -3824,7 +3827,7 @@ void props_locker_use( GameEntity *ent, GameEntity *other, GameEntity *activator
 	}
 	ent->delay = 1;
 	ent->think = props_locker_endrattle;
-	ent->nextthink = level.time + 1000; // rattle a sec
+	G_SetNextThink( ent, level.time + 1000 ); // rattle a sec
 }
 
 void props_locker_pain( GameEntity *ent, GameEntity *attacker, int damage, vec3_t point ) {
@@ -3952,7 +3955,7 @@ void props_locker_death( GameEntity *ent, GameEntity *inflictor, GameEntity *att
 	ent->takedamage = false;
 	ent->shared.s.frame = 2;   // opening animation
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 
 	SV_UnlinkEntity( &ent->shared );
 	ent->shared.r.maxs[2] = 11;    // (SA) make the dead bb half height so the item can look like it's sitting inside
@@ -4064,7 +4067,7 @@ void props_flamethrower_think( GameEntity *ent ) {
 		//G_AddEvent (ent, EV_FLAMETHROWER_EFFECT, 0);
 		ent->shared.s.eFlags |= EF_FIRING;
 
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 
 		{
 			int rval;
@@ -4078,7 +4081,7 @@ void props_flamethrower_think( GameEntity *ent ) {
 			}
 
 			ent->timestamp = level.time + rnd;
-			ent->nextthink = ent->timestamp + 50;
+			G_SetNextThink( ent, ent->timestamp + 50 );
 		}
 	} else {
 		ent->shared.s.eFlags &= ~EF_FIRING;
@@ -4094,7 +4097,7 @@ void props_flamethrower_use( GameEntity *ent, GameEntity *other, GameEntity *act
 		ent->shared.s.eFlags &= ~EF_FIRING;
 		ent->spawnflags &= ~2;
 		ent->think = nullptr;      // (SA) wasn't working
-		ent->nextthink = 0;
+		G_SetNextThink( ent, 0 );
 		return;
 	} else
 	{
@@ -4111,7 +4114,7 @@ void props_flamethrower_use( GameEntity *ent, GameEntity *other, GameEntity *act
 	ent->timestamp = level.time + rnd;
 
 	ent->think = props_flamethrower_think;
-	ent->nextthink = level.time + 50;
+	G_SetNextThink( ent, level.time + 50 );
 
 }
 
@@ -4146,7 +4149,7 @@ void SP_props_flamethrower( GameEntity *ent ) {
 	float dsize;
 
 	ent->think = props_flamethrower_init;
-	ent->nextthink = level.time + 50;
+	G_SetNextThink( ent, level.time + 50 );
 	ent->use = props_flamethrower_use;
 
 	G_SetOrigin( ent, ent->shared.s.origin );
@@ -31,6 +31,8 @@ If you have questions concerning this license or the applicable additional terms
  *
  */
 
+#include <vector>
+
 #include "../game/g_local.h"
 #include "../game/q_shared.h"
 #include "../game/botlib.h"      //bot lib interface
@@ -43,6 +45,9 @@ If you have questions concerning this license or the applicable additional terms
 #include "g_save.h"
 #include "ai_cast.h"
 #include "../qcommon/qcommon.h"
+#include "../qcommon/profiler.h"
+#include "../qcommon/job_system.h"
+#include "../qcommon/save_codec.h"
 #include "../server/server.h"
 
 /*
@@ -266,6 +271,99 @@ int G_SaveWrite( const void *buffer, int len, fileHandle_t f )
 
 //=========================================================
 
+/*
+Asynchronous saving
+
+G_SaveGame builds the savegame in memory on the game thread. Each entity,
+client and cast state is copied with its pointers already converted by
+WriteField1, followed by its WriteField2 data, so nothing needs to look at
+game state afterwards. Encoding the structures, compressing and the file
+write happen in a background job, so only an idle worker picks it up and a
+frame waiting on its own jobs never does. It writes the whole file to a
+temp name in one go and only renames it over the real one once every byte
+made it out. Without workers the save is written straight away instead.
+
+Only one save is in flight at a time. Anything that needs the file on disk
+(another save, a load, shutdown) calls G_SaveGameFlush first.
+*/
+typedef struct {
+	int ofs;
+	int len;
+	bool encode;            // a structure, written as an encoded record
+} saveChunk_t;
+
+struct saveSnapshot_s {
+	std::vector<uint8_t> data;
+	std::vector<saveChunk_t> chunks;
+	int bodyChunk;          // first chunk after the header
+	bool compress;
+	char name[MAX_QPATH];
+	char tempPath[MAX_OSPATH];
+	char finalPath[MAX_OSPATH];
+
+	// set by the writer job
+	int fileBytes;
+	int writeMsec;
+	bool failed;
+};
+
+// reused between saves so the buffers keep their capacity
+static saveSnapshot_t saveSnapshot;
+static JobSystem::Fence saveFence;
+static bool saveWriting;
+
+static void G_SnapshotAppend( saveSnapshot_t *snap, const void *buffer, int len, bool encode ) {
+	if ( !encode && !snap->chunks.empty() && !snap->chunks.back().encode ) {
+		snap->chunks.back().len += len;
+	} else {
+		saveChunk_t chunk;
+		chunk.ofs = (int)snap->data.size();
+		chunk.len = len;
+		chunk.encode = encode;
+		snap->chunks.push_back( chunk );
+	}
+	snap->data.insert( snap->data.end(), (const uint8_t *)buffer, (const uint8_t *)buffer + len );
+}
+
+/*
+===============
+G_SnapshotWrite
+===============
+*/
+void G_SnapshotWrite( saveSnapshot_t *snap, const void *buffer, int len ) {
+	G_SnapshotAppend( snap, buffer, len, false );
+}
+
+/*
+===============
+G_SnapshotWriteEncoded
+
+  queues a structure to be encoded by the writer
+===============
+*/
+void G_SnapshotWriteEncoded( saveSnapshot_t *snap, const void *buffer, int len ) {
+	G_SnapshotAppend( snap, buffer, len, true );
+}
+
+/*
+===============
+G_SnapshotBeginBody
+
+  everything after this may be compressed, the header before it is read
+  directly by the server and the UI
+===============
+*/
+void G_SnapshotBeginBody( saveSnapshot_t *snap ) {
+	saveChunk_t chunk;
+	chunk.ofs = (int)snap->data.size();
+	chunk.len = 0;
+	chunk.encode = false;
+	snap->bodyChunk = (int)snap->chunks.size();
+	snap->chunks.push_back( chunk );
+}
+
+//=========================================================
+
 funcList_t *G_FindFuncAtAddress( uint8_t *adr )
 {
 	for (int i = 0; funcList[i].funcStr; i++ ) {
@@ -360,7 +458,7 @@ void WriteField1( saveField_t *field, uint8_t *base )
 }
 
 
-void WriteField2( fileHandle_t f, saveField_t *field, uint8_t *base )
+void WriteField2( saveSnapshot_t *snap, saveField_t *field, uint8_t *base )
 {
 	size_t len;
 	funcList_t  *func;
@@ -371,9 +469,7 @@ void WriteField2( fileHandle_t f, saveField_t *field, uint8_t *base )
 	case F_STRING:
 		if ( *(char **)p ) {
 			len = strlen( *(char **)p ) + 1;
-			if ( !G_SaveWrite( *(char **)p, len, f ) ) {
-				G_SaveWriteError();
-			}
+			G_SnapshotWrite( snap, *(char **)p, len );
 		}
 		break;
 	case F_FUNCTION:
@@ -384,9 +480,7 @@ void WriteField2( fileHandle_t f, saveField_t *field, uint8_t *base )
                 return; // keep the linter happy, ERR_DROP does not return
 			}
 			len = strlen( func->funcStr ) + 1;
-			if ( !G_SaveWrite( func->funcStr, len, f ) ) {
-				G_SaveWriteError();
-			}
+			G_SnapshotWrite( snap, func->funcStr, len );
 		}
 		break;
 	default:
@@ -394,7 +488,81 @@ void WriteField2( fileHandle_t f, saveField_t *field, uint8_t *base )
 	}
 }
 
-void ReadField( fileHandle_t f, saveField_t *field, uint8_t *base )
+/*
+Version 19 layout. The header, up to and including the skill level, is
+unchanged from version 18 since the server and the UI read it in place. The
+rest, the body, is stored as
+
+	int flags               // SAVE_BODY_LZ
+	int rawSize
+	int storedSize
+	uint8_t stored[storedSize]  // rawSize bytes once decompressed
+
+In the body each structure is a record,
+
+	uint8_t mode            // SAVE_RECORD_PLAIN or SAVE_RECORD_DELTA
+	int length
+	uint8_t data[length]    // SaveCodec_EncodeZeroRuns output
+
+A delta record is the structure XORed with the previous record of the same
+size, so entities of one class, which mostly only differ in a few fields,
+come out as a handful of bytes. Whichever of the two is smaller is kept.
+Version 18 records are a length followed by G_Save_Encode output.
+*/
+
+#define SAVE_RECORD_PLAIN       0
+#define SAVE_RECORD_DELTA       1
+
+#define SAVE_BODY_LZ            1
+
+// the last record decoded for each structure size
+typedef struct {
+	int size;
+	std::vector<uint8_t> data;
+} saveBaseline_t;
+
+static std::vector<uint8_t> &G_SaveBaseline( std::vector<saveBaseline_t> &baselines, int size ) {
+	for ( saveBaseline_t& baseline : baselines ) {
+		if ( baseline.size == size ) {
+			return baseline.data;
+		}
+	}
+	baselines.push_back( saveBaseline_t() );
+	baselines.back().size = size;
+	return baselines.back().data;
+}
+
+static void G_SaveAppend( std::vector<uint8_t> &out, const void *buffer, int len ) {
+	out.insert( out.end(), (const uint8_t *)buffer, (const uint8_t *)buffer + len );
+}
+
+struct saveReader_s {
+	const uint8_t *data;
+	int size;
+	int pos;
+	int version;
+	std::vector<saveBaseline_t> baselines;
+};
+
+/*
+===============
+G_SaveRead
+
+  like FS_Read, anything asked for past the end is left untouched
+===============
+*/
+static void G_SaveRead( saveReader_t *r, void *buffer, int len ) {
+	int avail = r->size - r->pos;
+	if ( len > avail ) {
+		len = avail;
+	}
+	if ( len > 0 ) {
+		memcpy( buffer, r->data + r->pos, len );
+		r->pos += len;
+	}
+}
+
+void ReadField( saveReader_t *r, saveField_t *field, uint8_t *base )
 {
 	int len;
 	int index;
@@ -410,7 +578,7 @@ void ReadField( fileHandle_t f, saveField_t *field, uint8_t *base )
 		} else
 		{
 			*(char **)p = (char *)G_Alloc( len );
-			FS_Read( *(char **)p, len, f );
+			G_SaveRead( r, *(char **)p, len );
 		}
 		break;
 	case F_ENTITY:
@@ -456,7 +624,7 @@ void ReadField( fileHandle_t f, saveField_t *field, uint8_t *base )
 				Com_Error( ERR_DROP, "ReadField: function name is greater than buffer (%i chars)", sizeof( funcStr ) );
                 return; // keep the linter happy, ERR_DROP does not return
 			}
-			FS_Read( funcStr, len, f );
+			G_SaveRead( r, funcStr, len );
 			if ( !( *(uint8_t **)p = G_FindFuncByName( funcStr ) ) ) {
 				Com_Error( ERR_DROP, "ReadField: unknown function '%s'\ncannot load game", funcStr );
                 return; // keep the linter happy, ERR_DROP does not return
@@ -546,14 +714,264 @@ void G_Save_Decode( uint8_t *in, int insize, uint8_t *out, int outsize )
 
 //=========================================================
 
-uint8_t clientBuf[ 2 * sizeof( GameEntity ) ];
+/*
+===============
+G_SaveGameEncode
+
+  turns a snapshot into the file image. Safe to run in the writer job.
+===============
+*/
+static void G_SaveGameEncode( const saveSnapshot_t *snap, int version, bool compress, std::vector<uint8_t> &out ) {
+	std::vector<uint8_t> body;
+	std::vector<uint8_t> encodeBuf;
+	std::vector<uint8_t> deltaBuf;
+	std::vector<uint8_t> deltaEncodeBuf;
+	std::vector<saveBaseline_t> baselines;
+
+	out.clear();
+	out.reserve( snap->data.size() );
+	G_SaveAppend( out, &version, sizeof( version ) );
+
+	std::vector<uint8_t> *dest = &out;
+	for ( int c = 0; c < (int)snap->chunks.size(); c++ ) {
+		const saveChunk_t& chunk = snap->chunks[c];
+		const uint8_t *raw = snap->data.data() + chunk.ofs;
+
+		if ( c == snap->bodyChunk && version != SAVE_VERSION_RLE ) {
+			body.reserve( snap->data.size() - chunk.ofs );
+			dest = &body;
+		}
+
+		if ( !chunk.encode ) {
+			G_SaveAppend( *dest, raw, chunk.len );
+			continue;
+		}
+
+		if ( version == SAVE_VERSION_RLE ) {
+			// worst case is a count byte for every data byte
+			encodeBuf.resize( 2 * chunk.len );
+			int length = G_Save_Encode( (uint8_t *)raw, encodeBuf.data(), chunk.len, (int)encodeBuf.size() );
+			G_SaveAppend( *dest, &length, sizeof( length ) );
+			G_SaveAppend( *dest, encodeBuf.data(), length );
+			continue;
+		}
+
+		encodeBuf.resize( SaveCodec_ZeroRunBound( chunk.len ) );
+		int length = SaveCodec_EncodeZeroRuns( raw, chunk.len, encodeBuf.data(), (int)encodeBuf.size() );
+		const uint8_t *encoded = encodeBuf.data();
+		uint8_t mode = SAVE_RECORD_PLAIN;
+
+		std::vector<uint8_t> &baseline = G_SaveBaseline( baselines, chunk.len );
+		if ( !baseline.empty() ) {
+			deltaBuf.resize( chunk.len );
+			for ( int i = 0; i < chunk.len; i++ ) {
+				deltaBuf[i] = raw[i] ^ baseline[i];
+			}
+			deltaEncodeBuf.resize( encodeBuf.size() );
+			int deltaLength = SaveCodec_EncodeZeroRuns( deltaBuf.data(), chunk.len, deltaEncodeBuf.data(), (int)deltaEncodeBuf.size() );
+			if ( deltaLength < length ) {
+				length = deltaLength;
+				encoded = deltaEncodeBuf.data();
+				mode = SAVE_RECORD_DELTA;
+			}
+		}
+		baseline.assign( raw, raw + chunk.len );
+
+		G_SaveAppend( *dest, &mode, sizeof( mode ) );
+		G_SaveAppend( *dest, &length, sizeof( length ) );
+		G_SaveAppend( *dest, encoded, length );
+	}
+
+	if ( version == SAVE_VERSION_RLE ) {
+		return;
+	}
+
+	int flags = 0;
+	int rawSize = (int)body.size();
+	const uint8_t *stored = body.data();
+	int storedSize = rawSize;
+
+	if ( compress ) {
+		encodeBuf.resize( SaveCodec_LZBound( rawSize ) );
+		int length = SaveCodec_CompressLZ( body.data(), rawSize, encodeBuf.data(), (int)encodeBuf.size() );
+		if ( length >= 0 && length < rawSize ) {
+			flags |= SAVE_BODY_LZ;
+			stored = encodeBuf.data();
+			storedSize = length;
+		}
+	}
+
+	G_SaveAppend( out, &flags, sizeof( flags ) );
+	G_SaveAppend( out, &rawSize, sizeof( rawSize ) );
+	G_SaveAppend( out, &storedSize, sizeof( storedSize ) );
+	G_SaveAppend( out, stored, storedSize );
+}
+
+/*
+===============
+G_SaveGameWrite
+
+  runs as a job, so it must not touch game state or the filesystem
+  handle table
+===============
+*/
+static void G_SaveGameWrite( saveSnapshot_t *snap ) {
+	PROFILE_ZONE( "G_SaveGameWrite" );
+
+	int start = Sys_Milliseconds();
+
+	std::vector<uint8_t> out;
+	G_SaveGameEncode( snap, SAVE_VERSION, snap->compress, out );
+
+	bool ok = false;
+	FILE *f = fopen( snap->tempPath, "wb" );
+	if ( f ) {
+		ok = fwrite( out.data(), 1, out.size(), f ) == out.size();
+		ok = ( fflush( f ) == 0 ) && ok;
+		ok = ( fclose( f ) == 0 ) && ok;
+	}
+
+	if ( ok && rename( snap->tempPath, snap->finalPath ) ) {
+		// some platforms won't rename over an existing file
+		remove( snap->finalPath );
+		ok = rename( snap->tempPath, snap->finalPath ) == 0;
+	}
+	if ( !ok ) {
+		remove( snap->tempPath );
+	}
+
+	snap->fileBytes = (int)out.size();
+	snap->writeMsec = Sys_Milliseconds() - start;
+	snap->failed = !ok;
+}
+
+/*
+===============
+G_SaveGameFlush
+
+  waits for any savegame still being written
+===============
+*/
+void G_SaveGameFlush( void ) {
+	if ( !saveWriting ) {
+		return;
+	}
+	Com_Jobs().wait( saveFence );
+	saveWriting = false;
+
+	Com_DPrintf( "G_SaveGame '%s': wrote %i bytes in %i msec\n", saveSnapshot.name, saveSnapshot.fileBytes, saveSnapshot.writeMsec );
+	if ( saveSnapshot.failed ) {
+		G_SaveWriteError();
+	}
+}
+
+/*
+===============
+G_SaveGameCheck
+
+  collects a finished savegame without blocking, called every frame
+===============
+*/
+void G_SaveGameCheck( void ) {
+	if ( saveWriting && saveFence.done() ) {
+		G_SaveGameFlush();
+	}
+}
+
+//=========================================================
+
+/*
+===============
+G_SaveReadRecord
+
+  decodes the next structure record into out
+===============
+*/
+static void G_SaveReadRecord( saveReader_t *r, void *out, int outsize ) {
+	uint8_t mode = SAVE_RECORD_PLAIN;
+	int length = -1;
+
+	if ( r->version != SAVE_VERSION_RLE ) {
+		G_SaveRead( r, &mode, sizeof( mode ) );
+	}
+	G_SaveRead( r, &length, sizeof( length ) );
+
+	if ( r->version == SAVE_VERSION_RLE ) {
+		// worst case is a count byte for every data byte
+		if ( length < 0 || length > 2 * outsize || length > r->size - r->pos ) {
+			Com_Error( ERR_DROP, "G_LoadGame: encoded chunk is greater than buffer" );
+			return; // keep the linter happy, ERR_DROP does not return
+		}
+		G_Save_Decode( (uint8_t *)r->data + r->pos, length, (uint8_t *)out, outsize );
+		r->pos += length;
+		return;
+	}
+
+	if ( mode > SAVE_RECORD_DELTA || length < 0 || length > r->size - r->pos
+		 || SaveCodec_DecodeZeroRuns( r->data + r->pos, length, (uint8_t *)out, outsize ) != outsize ) {
+		Com_Error( ERR_DROP, "G_LoadGame: corrupt record" );
+		return; // keep the linter happy, ERR_DROP does not return
+	}
+	r->pos += length;
+
+	std::vector<uint8_t> &baseline = G_SaveBaseline( r->baselines, outsize );
+	if ( mode == SAVE_RECORD_DELTA ) {
+		if ( baseline.empty() ) {
+			Com_Error( ERR_DROP, "G_LoadGame: delta record without a baseline" );
+			return; // keep the linter happy, ERR_DROP does not return
+		}
+		for ( int i = 0; i < outsize; i++ ) {
+			( (uint8_t *)out )[i] ^= baseline[i];
+		}
+	}
+	baseline.assign( (uint8_t *)out, (uint8_t *)out + outsize );
+}
+
+/*
+===============
+G_SaveReadBody
+
+  moves the reader on to the body of a version 19 save, which is
+  decompressed into bodyBuf if need be. Returns false if it is corrupt.
+===============
+*/
+static bool G_SaveReadBody( saveReader_t *r, std::vector<uint8_t> &bodyBuf ) {
+	if ( r->version == SAVE_VERSION_RLE ) {
+		return true;
+	}
+
+	int flags = 0, rawSize = -1, storedSize = -1;
+	G_SaveRead( r, &flags, sizeof( flags ) );
+	G_SaveRead( r, &rawSize, sizeof( rawSize ) );
+	G_SaveRead( r, &storedSize, sizeof( storedSize ) );
+	if ( rawSize < 0 || storedSize < 0 || storedSize > r->size - r->pos ) {
+		return false;
+	}
+
+	if ( flags & SAVE_BODY_LZ ) {
+		bodyBuf.resize( rawSize );
+		if ( SaveCodec_DecompressLZ( r->data + r->pos, storedSize, bodyBuf.data(), rawSize ) != rawSize ) {
+			return false;
+		}
+		r->data = bodyBuf.data();
+	} else if ( storedSize == rawSize ) {
+		r->data += r->pos;
+	} else {
+		return false;
+	}
+	r->size = rawSize;
+	r->pos = 0;
+	return true;
+}
+
+//=========================================================
 
 /*
 ===============
 WriteClient
 ===============
 */
-void WriteClient( fileHandle_t f, GameClient *cl )
+void WriteClient( saveSnapshot_t *snap, GameClient *cl )
 {
 	// copy the structure across, then process the fields
     GameClient temp = *cl;
@@ -572,19 +990,12 @@ void WriteClient( fileHandle_t f, GameClient *cl )
 	}
 
 	// write the block
-	//if (!G_SaveWrite (&temp, sizeof(temp), f)) G_SaveWriteError();
-	int length = G_Save_Encode( (uint8_t *)&temp, clientBuf, sizeof( temp ), sizeof( clientBuf ) );
-	if ( !G_SaveWrite( &length, sizeof( length ), f ) ) {
-		G_SaveWriteError();
-	}
-	if ( !G_SaveWrite( &clientBuf, length, f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWriteEncoded( snap, &temp, sizeof( temp ) );
 
 	// now write any allocated data following the edict
 	for (saveField_t * field = gclientFields ; field->type ; field++ )
 	{
-		WriteField2( f, field, (uint8_t *)cl );
+		WriteField2( snap, field, (uint8_t *)cl );
 	}
 
 }
@@ -594,24 +1005,15 @@ void WriteClient( fileHandle_t f, GameClient *cl )
 ReadClient
 ===============
 */
-void ReadClient( fileHandle_t f, GameClient *client, int size )
+void ReadClient( saveReader_t *r, GameClient *client, int size )
 {
-	int decodedSize;
-
     // read the encoded chunk
-    FS_Read( &decodedSize, sizeof( int ), f );
-    if ( decodedSize > sizeof( clientBuf ) ) {
-        Com_Error( ERR_DROP, "G_LoadGame: encoded chunk is greater than buffer" );
-        return; // keep the linter happy, ERR_DROP does not return
-    }
-    
-    FS_Read( clientBuf, decodedSize, f );
     GameClient temp;
-    G_Save_Decode( clientBuf, decodedSize, (uint8_t *)&temp, sizeof( temp ) );
+    G_SaveReadRecord( r, &temp, sizeof( temp ) );
 	
 	// convert any feilds back to the correct data
 	for (saveField_t *field = gclientFields ; field->type ; field++ ) {
-		ReadField( f, field, (uint8_t *)&temp );
+		ReadField( r, field, (uint8_t *)&temp );
 	}
 
 	// backup any fields that we don't want to read in
@@ -654,14 +1056,12 @@ void ReadClient( fileHandle_t f, GameClient *client, int size )
 
 //=========================================================
 
-uint8_t entityBuf[ 2 * sizeof( GameEntity ) ];
-
 /*
 ===============
 WriteEntity
 ===============
 */
-void WriteEntity( fileHandle_t f, GameEntity *ent )
+void WriteEntity( saveSnapshot_t *snap, GameEntity *ent )
 {
 	// copy the structure across, then process the fields
     GameEntity temp = *ent;
@@ -681,21 +1081,14 @@ void WriteEntity( fileHandle_t f, GameEntity *ent )
 	WriteField1( gentityFields_18, (uint8_t *)&temp );
 
 	// write the block
-	//if (!G_SaveWrite (&temp, sizeof(temp), f)) G_SaveWriteError();
-	int length = G_Save_Encode( (uint8_t *)&temp, entityBuf, sizeof( temp ), sizeof( entityBuf ) );
-	if ( !G_SaveWrite( &length, sizeof( length ), f ) ) {
-		G_SaveWriteError();
-	}
-	if ( !G_SaveWrite( &entityBuf, length, f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWriteEncoded( snap, &temp, sizeof( temp ) );
 
 	// now write any allocated data following the edict
 	for (saveField_t *field = gentityFields_17 ; field->type ; field++ ) {
-		WriteField2( f, field, (uint8_t *)ent );
+		WriteField2( snap, field, (uint8_t *)ent );
 	}
 
-	WriteField2( f, gentityFields_18, (uint8_t *)ent );
+	WriteField2( snap, gentityFields_18, (uint8_t *)ent );
 }
 
 /*
@@ -703,28 +1096,21 @@ void WriteEntity( fileHandle_t f, GameEntity *ent )
 ReadEntity
 ===============
 */
-void ReadEntity( fileHandle_t f, GameEntity *ent, int size )
+void ReadEntity( saveReader_t *r, GameEntity *ent, int size )
 {
     GameEntity backup = *ent;
 
     // read the encoded chunk
-    int decodedSize;
-    FS_Read( &decodedSize, sizeof( int ), f );
-    if ( decodedSize > sizeof( entityBuf ) ) {
-        Com_Error( ERR_DROP, "G_LoadGame: encoded chunk is greater than buffer" );
-        return; // keep the linter happy, ERR_DROP does not return
-    }
-    FS_Read( entityBuf, decodedSize, f );
     GameEntity temp;
-    G_Save_Decode( entityBuf, decodedSize, (uint8_t *)&temp, sizeof( temp ) );
+    G_SaveReadRecord( r, &temp, sizeof( temp ) );
 	
 
 	// convert any fields back to the correct data
 	for (saveField_t *field = gentityFields_17 ; field->type ; field++ ) {
-		ReadField( f, field, (uint8_t *)&temp );
+		ReadField( r, field, (uint8_t *)&temp );
 	}
 
-    ReadField( f, gentityFields_18, (uint8_t *)&temp );
+    ReadField( r, gentityFields_18, (uint8_t *)&temp );
 	
 	// backup any fields that we don't want to read in
 	for (ignoreField_t *ifield = gentityIgnoreFields ; ifield->len ; ifield++ ) {
@@ -813,14 +1199,12 @@ void ReadEntity( fileHandle_t f, GameEntity *ent, int size )
 
 //=========================================================
 
-uint8_t castStateBuf[ 2 * sizeof( cast_state_t ) ];
-
 /*
 ===============
 WriteCastState
 ===============
 */
-void WriteCastState( fileHandle_t f, cast_state_t *cs )
+void WriteCastState( saveSnapshot_t *snap, cast_state_t *cs )
 {
 	// copy the structure across, then process the fields
     cast_state_t temp = *cs;
@@ -831,17 +1215,11 @@ void WriteCastState( fileHandle_t f, cast_state_t *cs )
 	}
 
 	// write the block
-	int length = G_Save_Encode( (uint8_t *)&temp, castStateBuf, sizeof( temp ), sizeof( castStateBuf ) );
-	if ( !G_SaveWrite( &length, sizeof( length ), f ) ) {
-		G_SaveWriteError();
-	}
-	if ( !G_SaveWrite( &castStateBuf, length, f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWriteEncoded( snap, &temp, sizeof( temp ) );
 
 	// now write any allocated data following the edict
 	for (saveField_t *field = castStateFields; field->type; field++ ) {
-		WriteField2( f, field, (uint8_t *)cs );
+		WriteField2( snap, field, (uint8_t *)cs );
 	}
 }
 
@@ -850,23 +1228,16 @@ void WriteCastState( fileHandle_t f, cast_state_t *cs )
 ReadCastState
 ===============
 */
-void ReadCastState( fileHandle_t f, cast_state_t *cs, int size )
+void ReadCastState( saveReader_t *r, cast_state_t *cs, int size )
 {
     // read the encoded chunk
-    int decodedSize;
-    FS_Read( &decodedSize, sizeof( int ), f );
-    if ( decodedSize > sizeof( castStateBuf ) ) {
-        Com_Error( ERR_DROP, "G_LoadGame: encoded chunk is greater than buffer" );
-        return; // keep the linter happy, ERR_DROP does not return
-    }
-    FS_Read( castStateBuf, decodedSize, f );
     cast_state_t temp;
-    G_Save_Decode( castStateBuf, decodedSize, (uint8_t *)&temp, sizeof( temp ) );
+    G_SaveReadRecord( r, &temp, sizeof( temp ) );
 	
 
 	// convert any feilds back to the correct data
 	for (saveField_t *field = castStateFields ; field->type ; field++ ) {
-		ReadField( f, field, (uint8_t *)&temp );
+		ReadField( r, field, (uint8_t *)&temp );
 	}
 
 	// backup any fields that we don't want to read in
@@ -898,21 +1269,21 @@ void ReadCastState( fileHandle_t f, cast_state_t *cs, int size )
 WriteTime
 ==============
 */
-void WriteTime( fileHandle_t f )
+void WriteTime( saveSnapshot_t *snap )
 {
 	qtime_t tm;
 
 	// just save it all so it can be interpreted as desired
 	trap_RealTime( &tm );
-	G_SaveWrite( &tm.tm_sec,       sizeof( tm.tm_sec ),  f );     /* seconds after the minute - [0,59] */
-	G_SaveWrite( &tm.tm_min,       sizeof( tm.tm_min ),  f );     /* minutes after the hour - [0,59] */
-	G_SaveWrite( &tm.tm_hour,  sizeof( tm.tm_hour ), f );     /* hours since midnight - [0,23] */
-	G_SaveWrite( &tm.tm_mday,  sizeof( tm.tm_mday ), f );     /* day of the month - [1,31] */
-	G_SaveWrite( &tm.tm_mon,       sizeof( tm.tm_mon ),  f );     /* months since January - [0,11] */
-	G_SaveWrite( &tm.tm_year,  sizeof( tm.tm_year ), f );     /* years since 1900 */
-	G_SaveWrite( &tm.tm_wday,  sizeof( tm.tm_wday ), f );     /* days since Sunday - [0,6] */
-	G_SaveWrite( &tm.tm_yday,  sizeof( tm.tm_yday ), f );     /* days since January 1 - [0,365] */
-	G_SaveWrite( &tm.tm_isdst, sizeof( tm.tm_isdst ),f );     /* daylight savings time flag */
+	G_SnapshotWrite( snap, &tm.tm_sec, sizeof( tm.tm_sec ) );     /* seconds after the minute - [0,59] */
+	G_SnapshotWrite( snap, &tm.tm_min, sizeof( tm.tm_min ) );     /* minutes after the hour - [0,59] */
+	G_SnapshotWrite( snap, &tm.tm_hour, sizeof( tm.tm_hour ) );     /* hours since midnight - [0,23] */
+	G_SnapshotWrite( snap, &tm.tm_mday, sizeof( tm.tm_mday ) );     /* day of the month - [1,31] */
+	G_SnapshotWrite( snap, &tm.tm_mon, sizeof( tm.tm_mon ) );     /* months since January - [0,11] */
+	G_SnapshotWrite( snap, &tm.tm_year, sizeof( tm.tm_year ) );     /* years since 1900 */
+	G_SnapshotWrite( snap, &tm.tm_wday, sizeof( tm.tm_wday ) );     /* days since Sunday - [0,6] */
+	G_SnapshotWrite( snap, &tm.tm_yday, sizeof( tm.tm_yday ) );     /* days since January 1 - [0,365] */
+	G_SnapshotWrite( snap, &tm.tm_isdst, sizeof( tm.tm_isdst ) );     /* daylight savings time flag */
 }
 
 /*
@@ -920,17 +1291,17 @@ void WriteTime( fileHandle_t f )
 ReadTime
 ==============
 */
-void ReadTime( fileHandle_t f, qtime_t *tm )
+void ReadTime( saveReader_t *r, qtime_t *tm )
 {
-	FS_Read( &tm->tm_sec, sizeof( tm->tm_sec ), f );
-	FS_Read( &tm->tm_min, sizeof( tm->tm_min ), f );
-	FS_Read( &tm->tm_hour, sizeof( tm->tm_hour ), f );
-	FS_Read( &tm->tm_mday, sizeof( tm->tm_mday ), f );
-	FS_Read( &tm->tm_mon, sizeof( tm->tm_mon ), f );
-	FS_Read( &tm->tm_year, sizeof( tm->tm_year ), f );
-	FS_Read( &tm->tm_wday, sizeof( tm->tm_wday ), f );
-	FS_Read( &tm->tm_yday, sizeof( tm->tm_yday ), f );
-	FS_Read( &tm->tm_isdst, sizeof( tm->tm_isdst ), f );
+	G_SaveRead( r, &tm->tm_sec, sizeof( tm->tm_sec ) );
+	G_SaveRead( r, &tm->tm_min, sizeof( tm->tm_min ) );
+	G_SaveRead( r, &tm->tm_hour, sizeof( tm->tm_hour ) );
+	G_SaveRead( r, &tm->tm_mday, sizeof( tm->tm_mday ) );
+	G_SaveRead( r, &tm->tm_mon, sizeof( tm->tm_mon ) );
+	G_SaveRead( r, &tm->tm_year, sizeof( tm->tm_year ) );
+	G_SaveRead( r, &tm->tm_wday, sizeof( tm->tm_wday ) );
+	G_SaveRead( r, &tm->tm_yday, sizeof( tm->tm_yday ) );
+	G_SaveRead( r, &tm->tm_isdst, sizeof( tm->tm_isdst ) );
 }
 
 /*
@@ -984,85 +1355,42 @@ static char infoString[SAVE_INFOSTRING_LENGTH];
 
 /*
 ===============
-G_SaveGame
+G_SaveGameSnapshot
 
-  returns true if successful
-
-  TODO: have G_SaveWrite return the number of uint8_t's written, so if it doesn't
-  succeed, we can abort the save, and not save the file. This means we should
-  save to a temporary name, then copy it across to the real name after success,
-  so full disks don't result in lost saved games.
+  copies the level into snap, ready to be encoded
 ===============
 */
-bool G_SaveGame( const char *username )
+static void G_SaveGameSnapshot( saveSnapshot_t *snap )
 {
-	char filename[MAX_QPATH];
 	char mapstr[MAX_QPATH];
 	char leveltime[MAX_QPATH];
 	char healthstr[MAX_QPATH];
+	int i;
 
-	if ( g_entities[0].health <= 0 ) { // no save when dead
-		return true;
-	}
-
-	Com_Printf( "G_SaveGame '%s'\n", username );
-
-	// update the playtime
-	AICast_AgePlayTime( 0 );
-
-	if ( !username ) {
-		username = "current";
-	}
-
-	// validate the filename
-	for (int i = 0; i < strlen( username ); i++ ) {
-		if ( !Q_isforfilename( username[i] ) && username[i] != '\\' ) { // (allow '\\' so games can be saved in subdirs)
-			Com_Printf( "G_SaveGame: '%s'.  Invalid character (%c) in filename. Must use alphanumeric characters only.\n", username, username[i] );
-			return true;
-		}
-	}
+	snap->data.clear();
+	snap->chunks.clear();
+	snap->bodyChunk = -1;
+	snap->compress = g_saveCompress.integer != 0;
 
-	saveByteCount = 0;
-
-	// open the file
-	snprintf( filename, MAX_QPATH, "save\\temp.svg" );
-    fileHandle_t f;
-	if ( FS_FOpenFileByMode( filename, &f, FS_WRITE ) < 0 ) {
-		Com_Error( ERR_DROP, "G_SaveGame: cannot open file for saving\n" );
-        return false; // keep the linter happy, ERR_DROP does not return
-	}
-
-	// write the version
-	int i = SAVE_VERSION;
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	// the version is written by G_SaveGameEncode
 
 	// write the mapname
     vmCvar_t mapname;
 	Cvar_Register( &mapname, "mapname", "", CVAR_SERVERINFO | CVAR_ROM );
 	strncpy( mapstr, mapname.string, MAX_QPATH );
-	if ( !G_SaveWrite( mapstr, MAX_QPATH, f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, mapstr, MAX_QPATH );
 
 	// write out the level time
-	if ( !G_SaveWrite( &level.time, sizeof( level.time ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &level.time, sizeof( level.time ) );
 
 	// write the totalPlayTime
 	i = caststates[0].totalPlayTime;
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
 
     vmCvar_t episode;
     Cvar_Register( &episode, "g_episode", "0", CVAR_ROM );
     i = episode.integer;
-    if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-        G_SaveWriteError();
-    }
+    G_SnapshotWrite( snap, &i, sizeof( i ) );
 
 	int playtime = caststates[0].totalPlayTime;
     int minutes;
@@ -1102,134 +1430,234 @@ bool G_SaveGame( const char *username )
 				 healthstr,
 				 g_entities[0].health );
 	i = strlen( infoString );
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
-	if ( !G_SaveWrite( infoString, strlen( infoString ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
+	G_SnapshotWrite( snap, infoString, strlen( infoString ) );
 	// write out current time/date info
-	WriteTime( f );
+	WriteTime( snap );
 
 	// write music
 	Cvar_Register( &musicCvar, "s_currentMusic", "", CVAR_ROM );
-	if ( !G_SaveWrite( musicCvar.string, MAX_QPATH, f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, musicCvar.string, MAX_QPATH );
 
 	SV_GetConfigstring( CS_FOGVARS, infoString, sizeof( infoString ) );
 
 	i = strlen( infoString );
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
 	// if there's fog info to save
 	if ( !i ) {
 		Q_strncpyz( &infoString[0], "none", sizeof( infoString ) );
 	}
 
-	if ( !G_SaveWrite( infoString, strlen( infoString ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, infoString, strlen( infoString ) );
 
 	// save the skill level
-	if ( !G_SaveWrite( &g_gameskill.integer, sizeof( g_gameskill.integer ), f ) ) {
-		G_SaveWriteError();
-	}
-    
+	G_SnapshotWrite( snap, &g_gameskill.integer, sizeof( g_gameskill.integer ) );
+
+	// the header ends here, everything below may be compressed
+	G_SnapshotBeginBody( snap );
+
 	// write out the entity structures
 	i = sizeof( GameEntity );
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
     
 	for ( i = 0 ; i < level.num_entities ; i++ ) {
         GameEntity *ent = &g_entities[i];
 		if ( !ent->inuse || ent->shared.s.number == ENTITYNUM_WORLD ) {
 			continue;
 		}
-		if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-			G_SaveWriteError();
-		}
-		WriteEntity( f, ent );
+		G_SnapshotWrite( snap, &i, sizeof( i ) );
+		WriteEntity( snap, ent );
 	}
 	i = -1;
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
 
 	// write out the client structures
 	i = sizeof( GameClient );
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
     
 	for ( i = 0 ; i < MAX_CLIENTS ; i++ ) {
         GameClient *cl = &level.clients[i];
 		if ( cl->pers.connected != CON_CONNECTED ) {
 			continue;
 		}
-		if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-			G_SaveWriteError();
-		}
-		WriteClient( f, cl );
+		G_SnapshotWrite( snap, &i, sizeof( i ) );
+		WriteClient( snap, cl );
 	}
     
 	i = -1;
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
 
 	// write out the cast_state structures
 	i = sizeof( cast_state_t );
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
-	}
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
 	for ( i = 0 ; i < level.numConnectedClients ; i++ ){
         cast_state_t *cs = &caststates[i];
 		if ( !g_entities[i].inuse ) {
 			continue;
 		}
-		if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-			G_SaveWriteError();
-		}
-		WriteCastState( f, cs );
+		G_SnapshotWrite( snap, &i, sizeof( i ) );
+		WriteCastState( snap, cs );
 	}
 
 	i = -1;
-	if ( !G_SaveWrite( &i, sizeof( i ), f ) ) {
-		G_SaveWriteError();
+	G_SnapshotWrite( snap, &i, sizeof( i ) );
+}
+
+/*
+===============
+G_SaveGame
+
+  returns true if the savegame was queued for writing. The file is written
+  to a temporary name and renamed over the real one by the writer job, a
+  failed write is reported when the game thread collects it.
+===============
+*/
+bool G_SaveGame( const char *username )
+{
+	char filename[MAX_QPATH];
+
+	if ( g_entities[0].health <= 0 ) { // no save when dead
+		return true;
 	}
 
+	Com_Printf( "G_SaveGame '%s'\n", username );
 
-	FS_FCloseFile( f );
+	// update the playtime
+	AICast_AgePlayTime( 0 );
 
-	// check the uint8_t count
-    int len;
-	if ( ( len = FS_FOpenFileByMode( filename, &f, FS_READ ) ) != saveByteCount ) {
-		FS_FCloseFile( f );
-		G_SaveWriteError();
-		return false;
+	if ( !username ) {
+		username = "current";
 	}
 
-	FS_FCloseFile( f );
+	// validate the filename
+	for (int i = 0; i < strlen( username ); i++ ) {
+		if ( !Q_isforfilename( username[i] ) && username[i] != '\\' ) { // (allow '\\' so games can be saved in subdirs)
+			Com_Printf( "G_SaveGame: '%s'.  Invalid character (%c) in filename. Must use alphanumeric characters only.\n", username, username[i] );
+			return true;
+		}
+	}
 
-	// now rename the file to the actual file
-	snprintf( mapstr, MAX_QPATH, "save\\%s.svg", username );
-	FS_Rename( filename, mapstr );
+	int64_t startUsec = Sys_Microseconds();
 
-	// double check that it saved ok
-	if ( ( len = FS_FOpenFileByMode( mapstr, &f, FS_READ ) ) != saveByteCount ) {
-		FS_FCloseFile( f );
-		G_SaveWriteError();
-		return false;
+	// only one savegame is written at a time
+	G_SaveGameFlush();
+
+	saveSnapshot_t *snap = &saveSnapshot;
+	Q_strncpyz( snap->name, username, sizeof( snap->name ) );
+	Q_strncpyz( snap->tempPath, FS_WritePath( "save\\temp.svg" ), sizeof( snap->tempPath ) );
+	snprintf( filename, MAX_QPATH, "save\\%s.svg", username );
+	Q_strncpyz( snap->finalPath, FS_WritePath( filename ), sizeof( snap->finalPath ) );
+
+	G_SaveGameSnapshot( snap );
+
+	// encode and write it out in the background, nothing would run the job without workers
+	saveWriting = true;
+	if ( Com_Jobs().workers() ) {
+		Com_Jobs().submitBackground( [snap] { G_SaveGameWrite( snap ); }, &saveFence );
+	} else {
+		G_SaveGameWrite( snap );
 	}
 
-	FS_FCloseFile( f );
+	Com_Printf( "G_SaveGame: %i bytes, %.2f msec on the game thread\n", (int)snap->data.size(), (float)( Sys_Microseconds() - startUsec ) / 1000.0f );
 
 	return true;
 }
 
+/*
+===============
+G_SaveBenchDecode
+
+  decodes a file image the way G_LoadGame does, without touching the game,
+  and checks every chunk comes back as it went in
+===============
+*/
+static bool G_SaveBenchDecode( const saveSnapshot_t *snap, const std::vector<uint8_t> &image, int version ) {
+	static saveReader_t reader;
+	static std::vector<uint8_t> bodyBuf;
+	static std::vector<uint8_t> record;
+
+	saveReader_t *r = &reader;
+	r->data = image.data();
+	r->size = (int)image.size();
+	r->pos = sizeof( int );
+	r->version = version;
+	r->baselines.clear();
+
+	for ( int c = 0; c < (int)snap->chunks.size(); c++ ) {
+		const saveChunk_t& chunk = snap->chunks[c];
+		if ( c == snap->bodyChunk && !G_SaveReadBody( r, bodyBuf ) ) {
+			return false;
+		}
+		record.resize( chunk.len );
+		if ( chunk.encode ) {
+			G_SaveReadRecord( r, record.data(), chunk.len );
+		} else {
+			G_SaveRead( r, record.data(), chunk.len );
+		}
+		if ( memcmp( record.data(), snap->data.data() + chunk.ofs, chunk.len ) ) {
+			return false;
+		}
+	}
+	return r->pos == r->size;
+}
+
+/*
+===============
+G_SaveBench_f
+
+  savebench [count]
+  snapshots the current level and times encoding and decoding it in each
+  of the savegame formats. Nothing is written to disk.
+===============
+*/
+void G_SaveBench_f( void ) {
+	static saveSnapshot_t benchSnapshot;
+	static std::vector<uint8_t> image;
+	char arg[MAX_TOKEN_CHARS];
+
+	int count = 10;
+	if ( Cmd_Argc() > 1 ) {
+		Cmd_ArgvBuffer( 1, arg, sizeof( arg ) );
+		count = atoi( arg ) > 0 ? atoi( arg ) : 1;
+	}
+
+	saveSnapshot_t *snap = &benchSnapshot;
+	int64_t start = Sys_Microseconds();
+	for ( int n = 0; n < count; n++ ) {
+		G_SaveGameSnapshot( snap );
+	}
+	Com_Printf( "savebench: %i entities, %i raw bytes, snapshot %.3f msec\n",
+				level.num_entities, (int)snap->data.size(), (float)( Sys_Microseconds() - start ) / 1000.0f / count );
+
+	static const struct {
+		const char *name;
+		int version;
+		bool compress;
+	} formats[] = {
+		{ "v18 rle", SAVE_VERSION_RLE, false },
+		{ "v19 delta", SAVE_VERSION, false },
+		{ "v19 delta+lz", SAVE_VERSION, true },
+	};
+
+	for ( const auto& format : formats ) {
+		start = Sys_Microseconds();
+		for ( int n = 0; n < count; n++ ) {
+			G_SaveGameEncode( snap, format.version, format.compress, image );
+		}
+		float saveMsec = (float)( Sys_Microseconds() - start ) / 1000.0f / count;
+
+		bool ok = true;
+		start = Sys_Microseconds();
+		for ( int n = 0; n < count; n++ ) {
+			ok = G_SaveBenchDecode( snap, image, format.version ) && ok;
+		}
+		float loadMsec = (float)( Sys_Microseconds() - start ) / 1000.0f / count;
+
+		Com_Printf( "%-14s %8i bytes  save %7.3f msec  load %7.3f msec%s\n",
+					format.name, (int)image.size(), saveMsec, loadMsec, ok ? "" : "  MISMATCH" );
+	}
+}
+
 /*
 ===============
 G_LoadGame
@@ -1241,7 +1669,7 @@ void G_LoadGame( const char *filename )
 {
 	char mapname[MAX_QPATH];
 	fileHandle_t f;
-	int i, leveltime, size, last;
+	int i, leveltime, size, last, len;
 	GameEntity   *ent;
 	GameClient   *cl;
 	cast_state_t    *cs;
@@ -1252,53 +1680,71 @@ void G_LoadGame( const char *filename )
 		return;
 	}
 
+	// make sure a savegame we just made is on disk
+	G_SaveGameFlush();
+
     Com_Printf( "G_LoadGame '%s'\n", filename );
 
 	// enforce the "current" savegame, since that is used for all loads
 	filename = "save\\current.svg";
 
 	// open the file
-	if ( FS_FOpenFileByMode( filename, &f, FS_READ ) < 0 ) {
+	len = FS_FOpenFileByMode( filename, &f, FS_READ );
+	if ( len < 0 ) {
 		Com_Error( ERR_DROP, "G_LoadGame: savegame '%s' not found\n", filename );
         return; // keep the linter happy, ERR_DROP does not return
 	}
 
+	// pull the whole file in, the records are decoded straight out of memory
+	static std::vector<uint8_t> fileBuf;
+	fileBuf.resize( len );
+	FS_Read( fileBuf.data(), len, f );
+	FS_FCloseFile( f );
+
+	static saveReader_t reader;
+	saveReader_t *r = &reader;
+	r->data = fileBuf.data();
+	r->size = len;
+	r->pos = 0;
+	r->baselines.clear();
+
 	// read the version
-	FS_Read( &i, sizeof( i ), f );
+	i = 0;
+	G_SaveRead( r, &i, sizeof( i ) );
 
-	if ( i != SAVE_VERSION ) {
-		FS_FCloseFile( f );
+	if ( i != SAVE_VERSION && i != SAVE_VERSION_RLE ) {
 		Com_Error( ERR_DROP, "G_LoadGame: savegame '%s' is wrong version (%i, should be %i)\n", filename, i, SAVE_VERSION );
         return; // keep the linter happy, ERR_DROP does not return
 	}
+	r->version = i;
 
 	// read the mapname (this is only used in the sever exe, so just discard it)
-	FS_Read( mapname, MAX_QPATH, f );
+	G_SaveRead( r, mapname, MAX_QPATH );
 
 	// read the level time
-	FS_Read( &i, sizeof( i ), f );
+	G_SaveRead( r, &i, sizeof( i ) );
 	leveltime = i;
 
 	// read the totalPlayTime
-	FS_Read( &i, sizeof( i ), f );
+	G_SaveRead( r, &i, sizeof( i ) );
 	if ( i > g_totalPlayTime.integer ) {
 		Cvar_Set( "g_totalPlayTime", va( "%i", i ) );
 	}
 
-    FS_Read( &i, sizeof( i ), f );
+    G_SaveRead( r, &i, sizeof( i ) );
     Cvar_Set( "g_episode", va( "%i", i ) );
 
 	// read the info string length
-	FS_Read( &i, sizeof( i ), f );
+	G_SaveRead( r, &i, sizeof( i ) );
 
 	// read the info string
-	FS_Read( infoString, i, f );
+	G_SaveRead( r, infoString, i );
 
     // read current time/date info
-    ReadTime( f, &tm );
+    ReadTime( r, &tm );
 
     // read music
-    FS_Read( musicString, MAX_QPATH, f );
+    G_SaveRead( r, musicString, MAX_QPATH );
 
     if ( strlen( musicString ) ) {
         Cvar_Register( &musicCvar, "s_currentMusic", "", CVAR_ROM ); // get current music
@@ -1308,9 +1754,9 @@ void G_LoadGame( const char *filename )
     }
     
     // get length
-    FS_Read( &i, sizeof( i ), f );
+    G_SaveRead( r, &i, sizeof( i ) );
     // get fog string
-    FS_Read( infoString, i, f );
+    G_SaveRead( r, infoString, i );
     infoString[i] = 0;
 
     // set the configstring so the 'savegame current' has good fog
@@ -1336,26 +1782,32 @@ void G_LoadGame( const char *filename )
     SV_SetConfigstring( CS_FOGVARS, infoString );
 
     // read the game skill
-    FS_Read( &i, sizeof( i ), f );
+    G_SaveRead( r, &i, sizeof( i ) );
     Cvar_Set( "g_gameskill", va( "%i",i ) );
 
     aicast_skillscale = (float)i / (float)GSKILL_MAX;
+
+	// carry on reading from the body, decompressing it if need be
+	static std::vector<uint8_t> bodyBuf;
+	if ( !G_SaveReadBody( r, bodyBuf ) ) {
+		Com_Error( ERR_DROP, "G_LoadGame: savegame '%s' is corrupt\n", filename );
+        return; // keep the linter happy, ERR_DROP does not return
+	}
     
 	// reset all AAS blocking entities
 	trap_AAS_SetAASBlockingEntity( vec3_origin, vec3_origin, -1 );
 
 	// read the entity structures
-	FS_Read( &i, sizeof( i ), f );
+	G_SaveRead( r, &i, sizeof( i ) );
 	size = i;
 	last = 0;
 	while ( 1 )
 	{
-		FS_Read( &i, sizeof( i ), f );
+		G_SaveRead( r, &i, sizeof( i ) );
 		if ( i < 0 ) {
 			break;
 		}
 		if ( i >= MAX_GENTITIES ) {
-			FS_FCloseFile( f );
 			Com_Error( ERR_DROP, "G_LoadGame: entitynum out of range (%i, MAX = %i)\n", i, MAX_GENTITIES );
             return; // keep the linter happy, ERR_DROP does not return
 		}
@@ -1364,7 +1816,7 @@ void G_LoadGame( const char *filename )
 			serverEntityUpdate = true;
 		}
 		ent = &g_entities[i];
-		ReadEntity( f, ent, size );
+		ReadEntity( r, ent, size );
 		// free all entities that we skipped
 		for ( ; last < i; last++ ) {
 			if ( g_entities[last].inuse && i != ENTITYNUM_WORLD ) {
@@ -1387,44 +1839,41 @@ void G_LoadGame( const char *filename )
 	}
 
 	// read the client structures
-	FS_Read( &i, sizeof( i ), f );
+	G_SaveRead( r, &i, sizeof( i ) );
 	size = i;
 	while ( 1 )
 	{
-		FS_Read( &i, sizeof( i ), f );
+		G_SaveRead( r, &i, sizeof( i ) );
 		if ( i < 0 ) {
 			break;
 		}
 		if ( i > MAX_CLIENTS ) {
-			FS_FCloseFile( f );
 			Com_Error( ERR_DROP, "G_LoadGame: clientnum out of range\n" );
             return; // keep the linter happy, ERR_DROP does not return
 		}
 		cl = &level.clients[i];
 		if ( cl->pers.connected == CON_DISCONNECTED ) {
-			FS_FCloseFile( f );
 			Com_Error( ERR_DROP, "G_LoadGame: client mis-match in savegame" );
             return; // keep the linter happy, ERR_DROP does not return
 		}
-		ReadClient( f, cl, size );
+		ReadClient( r, cl, size );
 	}
 
 	// read the cast_state structures
-	FS_Read( &i, sizeof( i ), f );
+	G_SaveRead( r, &i, sizeof( i ) );
 	size = i;
 	while ( 1 )
 	{
-		FS_Read( &i, sizeof( i ), f );
+		G_SaveRead( r, &i, sizeof( i ) );
 		if ( i < 0 ) {
 			break;
 		}
 		if ( i > MAX_CLIENTS ) {
-			FS_FCloseFile( f );
 			Com_Error( ERR_DROP, "G_LoadGame: clientnum out of range\n" );
             return; // keep the linter happy, ERR_DROP does not return
 		}
 		cs = &caststates[i];
-		ReadCastState( f, cs, size );
+		ReadCastState( r, cs, size );
 	}
 
 	// inform server of entity count if it has increased
@@ -1434,11 +1883,14 @@ void G_LoadGame( const char *filename )
 							 &level.clients[0].ps, sizeof( level.clients[0] ) );
 	}
 
+	// entity names were all restored from the save
+	G_IndexAllEntities();
+
     // read current time/date info
-    ReadTime( f, &tm );
+    ReadTime( r, &tm );
 
     // read music
-    FS_Read( musicString, MAX_QPATH, f );
+    G_SaveRead( r, musicString, MAX_QPATH );
 
     if ( strlen( musicString ) ) {
         Cvar_Register( &musicCvar, "s_currentMusic", "", CVAR_ROM ); // get current music
@@ -1449,14 +1901,12 @@ void G_LoadGame( const char *filename )
     }
 
     // read the game skill
-    FS_Read( &i, sizeof( i ), f );
+    G_SaveRead( r, &i, sizeof( i ) );
     // set the skill level
     Cvar_Set( "g_gameskill", va( "%i",i ) );
     // update this
     aicast_skillscale = (float)i / (float)GSKILL_MAX;
 
-	FS_FCloseFile( f );
-
 	// now increment the attempts field and update totalplaytime according to cvar
 	Cvar_Update( &g_attempts );
 	Cvar_Set( "g_attempts", va( "%i", g_attempts.integer + 1 ) );
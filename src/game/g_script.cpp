@@ -39,39 +39,51 @@ according to each different scenario.
 
 vmCvar_t g_scriptDebug;
 
+// compiled args for the playanim each entity is looping forever on
+typedef struct {
+	const char *params;
+	g_script_args_t *args;
+} g_script_animating_t;
+
+static g_script_animating_t animatingArgs[MAX_GENTITIES];
+
+// actions run outside the stack by G_Script_ScriptRun, for the profiler
+static g_script_stack_action_t *gotoMarkerAction;
+static g_script_stack_action_t *playAnimAction;
+
 //
 //====================================================================
 //
 // action functions need to be declared here so they can be accessed in the scriptAction table
-bool G_ScriptAction_GotoMarker( GameEntity *ent, char *params );
-bool G_ScriptAction_Wait( GameEntity *ent, char *params );
-bool G_ScriptAction_Trigger( GameEntity *ent, char *params );
-bool G_ScriptAction_PlaySound( GameEntity *ent, char *params );
-bool G_ScriptAction_PlayAnim( GameEntity *ent, char *params );
-bool G_ScriptAction_AlertEntity( GameEntity *ent, char *params );
-bool G_ScriptAction_Accum( GameEntity *ent, char *params );
-bool G_ScriptAction_MissionFailed( GameEntity *ent, char *params );
-bool G_ScriptAction_MissionSuccess( GameEntity *ent, char *params );
-bool G_ScriptAction_Print( GameEntity *ent, char *params );
-bool G_ScriptAction_FaceAngles( GameEntity *ent, char *params );
-bool G_ScriptAction_ResetScript( GameEntity *ent, char *params );
-bool G_ScriptAction_TagConnect( GameEntity *ent, char *params );
-bool G_ScriptAction_Halt( GameEntity *ent, char *params );
-bool G_ScriptAction_StopSound( GameEntity *ent, char *params );
-bool G_ScriptAction_StartCam( GameEntity *ent, char *params );
-bool G_ScriptAction_EntityScriptName( GameEntity *ent, char *params );
-bool G_ScriptAction_AIScriptName( GameEntity *ent, char *params );
-
-bool G_ScriptAction_BackupScript( GameEntity *ent, char *params );
-bool G_ScriptAction_RestoreScript( GameEntity *ent, char *params );
-bool G_ScriptAction_SetHealth( GameEntity *ent, char *params );
+bool G_ScriptAction_GotoMarker( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_Wait( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_Trigger( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_PlaySound( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_PlayAnim( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_AlertEntity( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_Accum( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_MissionFailed( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_MissionSuccess( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_Print( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_FaceAngles( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_ResetScript( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_TagConnect( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_Halt( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_StopSound( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_StartCam( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_EntityScriptName( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_AIScriptName( GameEntity *ent, char *params, g_script_args_t *args );
+
+bool G_ScriptAction_BackupScript( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_RestoreScript( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_SetHealth( GameEntity *ent, char *params, g_script_args_t *args );
 
 //----(SA)	added
-bool G_ScriptAction_MusicStart( GameEntity *ent, char *params );
-bool G_ScriptAction_MusicPlay( GameEntity *ent, char *params );
-bool G_ScriptAction_MusicStop( GameEntity *ent, char *params );
-bool G_ScriptAction_MusicFade( GameEntity *ent, char *params );
-bool G_ScriptAction_MusicQueue( GameEntity *ent, char *params );
+bool G_ScriptAction_MusicStart( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_MusicPlay( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_MusicStop( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_MusicFade( GameEntity *ent, char *params, g_script_args_t *args );
+bool G_ScriptAction_MusicQueue( GameEntity *ent, char *params, g_script_args_t *args );
 //----(SA)	end
 
 // these are the actions that each event can call
@@ -218,6 +230,10 @@ void G_Script_ScriptLoad( void ) {
 
 	level.scriptEntity = nullptr;
 
+	memset( animatingArgs, 0, sizeof( animatingArgs ) );
+	gotoMarkerAction = G_Script_ActionForString( "gotomarker" );
+	playAnimAction = G_Script_ActionForString( "playanim" );
+
 	Cvar_VariableStringBuffer( "g_scriptName", filename, sizeof( filename ) );
 	if ( strlen( filename ) > 0 ) {
 		Cvar_Register( &mapname, "g_scriptName", "", CVAR_ROM );
@@ -415,6 +431,7 @@ void G_Script_ScriptParse( GameEntity *ent ) {
 					curEvent->stack.items[curEvent->stack.numItems].params = (char *)G_Alloc( strlen( params ) + 1 );
 					Q_strncpyz( curEvent->stack.items[curEvent->stack.numItems].params, params, strlen( params ) + 1 );
 				}
+				curEvent->stack.items[curEvent->stack.numItems].args = G_Script_CompileArgs( curEvent->stack.items[curEvent->stack.numItems].params );
 
 				curEvent->stack.numItems++;
 
@@ -452,6 +469,196 @@ void G_Script_ScriptParse( GameEntity *ent ) {
 	}
 }
 
+/*
+==============
+G_Script_CompileArgs
+
+  splits an action's params into tokens once, at parse time
+==============
+*/
+g_script_args_t *G_Script_CompileArgs( const char *params ) {
+	g_script_args_t *args = (g_script_args_t *)G_Alloc( sizeof( g_script_args_t ) );
+	memset( args, 0, sizeof( *args ) );
+	for ( int i = 0; i < G_MAX_SCRIPT_ARGS; i++ ) {
+		args->ents[i].entityNum = -1;
+	}
+
+	if ( !params ) {
+		return args;
+	}
+
+	const char *pString = params;
+	while ( args->numArgs < G_MAX_SCRIPT_ARGS ) {
+		const char *token = COM_ParseExt( &pString, false );
+		if ( !token[0] ) {
+			break;
+		}
+		int len = strlen( token ) + 1;
+		args->argv[args->numArgs] = (char *)G_Alloc( len );
+		Q_strncpyz( args->argv[args->numArgs], token, len );
+		args->argi[args->numArgs] = atoi( token );
+		args->argf[args->numArgs] = atof( token );
+		args->numArgs++;
+	}
+
+	return args;
+}
+
+/*
+==============
+G_Script_ArgFind
+
+  true if any arg from first on matches the keyword
+==============
+*/
+bool G_Script_ArgFind( const g_script_args_t *args, int first, const char *keyword ) {
+	if ( !args ) {
+		return false;
+	}
+	for ( int i = first; i < args->numArgs; i++ ) {
+		if ( !Q_stricmp( args->argv[i], keyword ) ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+==============
+G_Script_ArgEntity
+
+  returns the entity whose targetname is the given arg, optionally of the
+  given classname. The result is cached, so an action that is active over
+  many frames only searches for its target once.
+==============
+*/
+GameEntity *G_Script_ArgEntity( g_script_args_t *args, int arg, const char *classname ) {
+	if ( !args || arg >= args->numArgs ) {
+		return nullptr;
+	}
+
+	g_script_entref_t *ref = &args->ents[arg];
+	if ( ref->entityNum >= 0 ) {
+		GameEntity *ent = &g_entities[ref->entityNum];
+		// a freed or reused slot won't have the same name string
+		if ( ent->inuse && ent->targetname == ref->name ) {
+			return ent;
+		}
+		ref->entityNum = -1;
+	}
+
+	GameEntity *ent = nullptr;
+	while ( ( ent = G_Find( ent, FOFS( targetname ), args->argv[arg] ) ) ) {
+		if ( !classname || ( ent->classname && !Q_strcasecmp( ent->classname, classname ) ) ) {
+			break;
+		}
+	}
+
+	if ( ent ) {
+		ref->entityNum = ent->shared.s.number;
+		ref->name = ent->targetname;
+	}
+	return ent;
+}
+
+/*
+==============
+G_Script_AnimatingArgs
+
+  finds the compiled args for the playanim the entity is looping forever on
+==============
+*/
+static g_script_args_t *G_Script_AnimatingArgs( GameEntity *ent ) {
+	g_script_animating_t *cached = &animatingArgs[ent->shared.s.number];
+	const char *params = ent->scriptStatus.animatingParams;
+
+	if ( cached->params == params && cached->args ) {
+		return cached->args;
+	}
+
+	cached->params = params;
+	cached->args = nullptr;
+
+	// usually the params belong to one of our own stack items
+	for ( int i = 0; i < ent->numScriptEvents && !cached->args; i++ ) {
+		g_script_stack_t *stack = &ent->scriptEvents[i].stack;
+		for ( int j = 0; j < stack->numItems; j++ ) {
+			if ( stack->items[j].params == params ) {
+				cached->args = stack->items[j].args;
+				break;
+			}
+		}
+	}
+
+	// but a loaded savegame has its own copy
+	if ( !cached->args ) {
+		cached->args = G_Script_CompileArgs( params );
+	}
+	return cached->args;
+}
+
+/*
+==============
+G_Script_ProfileStart
+==============
+*/
+int64_t G_Script_ProfileStart( void ) {
+	return g_scriptProfile.integer ? Sys_Microseconds() : 0;
+}
+
+/*
+==============
+G_Script_ProfileEnd
+==============
+*/
+void G_Script_ProfileEnd( g_script_profile_t *profile, int64_t start ) {
+	if ( !g_scriptProfile.integer || !start ) {
+		return;
+	}
+
+	int usec = (int)( Sys_Microseconds() - start );
+	profile->calls++;
+	profile->usec += usec;
+	if ( usec > profile->maxUsec ) {
+		profile->maxUsec = usec;
+	}
+}
+
+/*
+==============
+G_Script_ProfilePrint
+
+  prints and clears one action's counters
+==============
+*/
+void G_Script_ProfilePrint( const char *system, const char *actionString, g_script_profile_t *profile ) {
+	if ( profile->calls ) {
+		Com_Printf( "%-6s %-20s %8i %10.2f %9.1f %9i\n", system, actionString, profile->calls,
+					(float)profile->usec / 1000.0f, (float)profile->usec / profile->calls, profile->maxUsec );
+	}
+	memset( profile, 0, sizeof( *profile ) );
+}
+
+/*
+==============
+G_Script_ProfileReport_f
+
+  scriptprofile: time spent in each script action since the last report,
+  collected while g_scriptProfile is set
+==============
+*/
+void G_Script_ProfileReport_f( void ) {
+	if ( !g_scriptProfile.integer ) {
+		Com_Printf( "set g_scriptProfile 1 to collect script timings\n" );
+	}
+
+	Com_Printf( "script action                  calls   total ms  avg usec  max usec\n" );
+	for ( int i = 0; gScriptActions[i].actionString; i++ ) {
+		G_Script_ProfilePrint( "entity", gScriptActions[i].actionString, &gScriptActions[i].profile );
+	}
+	AICast_ScriptProfileReport();
+}
+
 /*
 ================
 G_Script_ScriptChange
@@ -548,12 +755,16 @@ bool G_Script_ScriptRun( GameEntity *ent ) {
 
 	// if we are still doing a gotomarker, process the movement
 	if ( ent->scriptStatus.scriptFlags & SCFL_GOING_TO_MARKER ) {
-		G_ScriptAction_GotoMarker( ent, nullptr );
+		int64_t start = G_Script_ProfileStart();
+		G_ScriptAction_GotoMarker( ent, nullptr, nullptr );
+		G_Script_ProfileEnd( &gotoMarkerAction->profile, start );
 	}
 
 	// if we are animating, do the animation
 	if ( ent->scriptStatus.scriptFlags & SCFL_ANIMATING ) {
-		G_ScriptAction_PlayAnim( ent, ent->scriptStatus.animatingParams );
+		int64_t start = G_Script_ProfileStart();
+		G_ScriptAction_PlayAnim( ent, ent->scriptStatus.animatingParams, G_Script_AnimatingArgs( ent ) );
+		G_Script_ProfileEnd( &playAnimAction->profile, start );
 	}
 
 	if ( ent->scriptStatus.scriptEventIndex < 0 ) {
@@ -576,7 +787,11 @@ bool G_Script_ScriptRun( GameEntity *ent ) {
 	//
 	while ( ent->scriptStatus.scriptStackHead < stack->numItems )
 	{
-		if ( !stack->items[ent->scriptStatus.scriptStackHead].action->actionFunc( ent, stack->items[ent->scriptStatus.scriptStackHead].params ) ) {
+		g_script_stack_item_t *item = &stack->items[ent->scriptStatus.scriptStackHead];
+		int64_t start = G_Script_ProfileStart();
+		bool done = item->action->actionFunc( ent, item->params, item->args );
+		G_Script_ProfileEnd( &item->action->profile, start );
+		if ( !done ) {
 			return false;
 		}
 		// move to the next action in the script
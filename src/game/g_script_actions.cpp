@@ -57,7 +57,7 @@ G_ScriptAction_GotoMarker
   transitions
 ===============
 */
-bool G_ScriptAction_GotoMarker( GameEntity *ent, char *params ) {
+bool G_ScriptAction_GotoMarker( GameEntity *ent, char *params, g_script_args_t *args ) {
 
 	GameEntity *target;
 	vec3_t vec;
@@ -101,44 +101,39 @@ bool G_ScriptAction_GotoMarker( GameEntity *ent, char *params ) {
 		}
 	} else {    // we have just started this command
 
-		const char* pString = params;
-		const char* token = COM_ParseExt( &pString, false );
-		if ( !token[0] ) {
+		if ( !args->numArgs ) {
 			Com_Error( ERR_DROP, "G_Scripting: gotomarker must have an targetname\n" );
             return false; // keep the linter happy, ERR_DROP does not return
 		}
 
 		// find the entity with the given "targetname"
-		target = G_Find( nullptr, FOFS( targetname ), token );
+		target = G_Script_ArgEntity( args, 0, nullptr );
 
 		if ( !target ) {
-			Com_Error( ERR_DROP, "G_Scripting: can't find entity with \"targetname\" = \"%s\"\n", token );
+			Com_Error( ERR_DROP, "G_Scripting: can't find entity with \"targetname\" = \"%s\"\n", args->argv[0] );
             return false; // keep the linter happy, ERR_DROP does not return
 		}
 
 		VectorSubtract( target->shared.r.currentOrigin, ent->shared.r.currentOrigin, vec );
 
-		token = COM_ParseExt( &pString, false );
-		if ( !token[0] ) {
+		if ( args->numArgs < 2 ) {
 			Com_Error( ERR_DROP, "G_Scripting: gotomarker must have a speed\n" );
             return false; // keep the linter happy, ERR_DROP does not return
 		}
 
-		speed = atof( token );
+		speed = args->argf[1];
 		trType = TR_LINEAR_STOP;
 
-		while ( token[0] ) {
-			token = COM_ParseExt( &pString, false );
-			if ( token[0] ) {
-				if ( !Q_stricmp( token, "accel" ) ) {
-					trType = TR_ACCELERATE;
-				} else if ( !Q_stricmp( token, "deccel" ) )      {
-					trType = TR_DECCELERATE;
-				} else if ( !Q_stricmp( token, "wait" ) )      {
-					wait = true;
-				} else if ( !Q_stricmp( token, "turntotarget" ) )      {
-					turntotarget = true;
-				}
+		for ( i = 2; i < args->numArgs; i++ ) {
+			const char *token = args->argv[i];
+			if ( !Q_stricmp( token, "accel" ) ) {
+				trType = TR_ACCELERATE;
+			} else if ( !Q_stricmp( token, "deccel" ) )      {
+				trType = TR_DECCELERATE;
+			} else if ( !Q_stricmp( token, "wait" ) )      {
+				wait = true;
+			} else if ( !Q_stricmp( token, "turntotarget" ) )      {
+				turntotarget = true;
 			}
 		}
 
@@ -254,18 +249,16 @@ G_ScriptAction_Wait
   syntax: wait <duration>
 =================
 */
-bool G_ScriptAction_Wait( GameEntity *ent, char *params ) {
+bool G_ScriptAction_Wait( GameEntity *ent, char *params, g_script_args_t *args ) {
 	
 	int duration;
 
 	// get the duration
-	const char* pString = params;
-	const char* token = COM_ParseExt( &pString, false );
-	if ( !token[0] ) {
+	if ( !args->numArgs ) {
 		Com_Error( ERR_DROP, "G_Scripting: wait must have a duration\n" );
         return false; // keep the linter happy, ERR_DROP does not return
 	}
-	duration = atoi( token );
+	duration = args->argi[0];
 
 	return ( ent->scriptStatus.scriptStackChangeTime + duration < level.time );
 }
@@ -279,7 +272,7 @@ G_ScriptAction_Trigger
   Calls the specified trigger for the given ai character or script entity
 =================
 */
-bool G_ScriptAction_Trigger( GameEntity *ent, char *params ) {
+bool G_ScriptAction_Trigger( GameEntity *ent, char *params, g_script_args_t *args ) {
 	GameEntity *trent;
 	char name[MAX_QPATH], trigger[MAX_QPATH];
 	int oldId;
@@ -331,7 +324,7 @@ G_ScriptAction_PlaySound
   Use the optional LOOPING paramater to attach the sound to the entities looping channel.
 ================
 */
-bool G_ScriptAction_PlaySound( GameEntity *ent, char *params ) {
+bool G_ScriptAction_PlaySound( GameEntity *ent, char *params, g_script_args_t *args ) {
 	char sound[MAX_QPATH];
 
 	if ( !params ) {
@@ -360,7 +353,7 @@ AICast_ScriptAction_MusicStart
 
 ==================
 */
-bool G_ScriptAction_MusicStart( GameEntity *ent, char *params ) {
+bool G_ScriptAction_MusicStart( GameEntity *ent, char *params, g_script_args_t *args ) {
 	
 	char cvarName[MAX_QPATH];
 	int fadeupTime = 0;
@@ -389,7 +382,7 @@ AICast_ScriptAction_MusicPlay
 
 ==================
 */
-bool G_ScriptAction_MusicPlay( GameEntity *ent, char *params ) {
+bool G_ScriptAction_MusicPlay( GameEntity *ent, char *params, g_script_args_t *args ) {
 	
 	char cvarName[MAX_QPATH];
 	int fadeupTime = 0;
@@ -413,7 +406,7 @@ bool G_ScriptAction_MusicPlay( GameEntity *ent, char *params ) {
 AICast_ScriptAction_MusicStop
 ==================
 */
-bool G_ScriptAction_MusicStop( GameEntity *ent, char *params ) {
+bool G_ScriptAction_MusicStop( GameEntity *ent, char *params, g_script_args_t *args ) {
 	int fadeoutTime = 0;
 
 	const char* pString = params;
@@ -433,7 +426,7 @@ bool G_ScriptAction_MusicStop( GameEntity *ent, char *params ) {
 AICast_ScriptAction_MusicFade
 ==================
 */
-bool G_ScriptAction_MusicFade( GameEntity *ent, char *params ) {
+bool G_ScriptAction_MusicFade( GameEntity *ent, char *params, g_script_args_t *args ) {
 	
 	float targetvol;
 	int fadetime;
@@ -464,7 +457,7 @@ bool G_ScriptAction_MusicFade( GameEntity *ent, char *params ) {
 AICast_ScriptAction_MusicQueue
 ==================
 */
-bool G_ScriptAction_MusicQueue( GameEntity *ent, char *params ) {
+bool G_ScriptAction_MusicQueue( GameEntity *ent, char *params, g_script_args_t *args ) {
 	
 	char cvarName[MAX_QPATH];
 
@@ -492,9 +485,8 @@ G_ScriptAction_PlayAnim
   NOTE: all source animations must be at 20fps
 =================
 */
-bool G_ScriptAction_PlayAnim( GameEntity *ent, char *params ) {
-	char tokens[2][MAX_QPATH];
-	int i, endtime = 0; // TTimo: init
+bool G_ScriptAction_PlayAnim( GameEntity *ent, char *params, g_script_args_t *args ) {
+	int endtime = 0; // TTimo: init
 	bool looping = false, forever = false;
 	int startframe, endframe, idealframe;
 	int rate = 20;
@@ -504,32 +496,26 @@ bool G_ScriptAction_PlayAnim( GameEntity *ent, char *params ) {
 		ent->scriptStatus.scriptFlags &= ~SCFL_ANIMATING;
 	}
 
-	const char* pString = params;
-
-	for ( i = 0; i < 2; i++ ) {
-		const char* token = COM_ParseExt( &pString, false );
-		if ( !token || !token[0] ) {
-			Com_Printf( "G_Scripting: syntax error\n\nplayanim <startframe> <endframe> [LOOPING <duration>]\n" );
-			return true;
-		} else {
-			Q_strncpyz( tokens[i], token, sizeof( tokens[i] ) );
-		}
+	if ( args->numArgs < 2 ) {
+		Com_Printf( "G_Scripting: syntax error\n\nplayanim <startframe> <endframe> [LOOPING <duration>]\n" );
+		return true;
 	}
 
-	startframe = atoi( tokens[0] );
-	endframe = atoi( tokens[1] );
+	startframe = args->argi[0];
+	endframe = args->argi[1];
 
 	// check for optional parameters
-	const char* token = COM_ParseExt( &pString, false );
-	if ( token[0] ) {
+	int arg = 2;
+	if ( arg < args->numArgs ) {
+		const char *token = args->argv[arg++];
 		if ( !Q_strcasecmp( token, "looping" ) ) {
 			looping = true;
 
-			token = COM_ParseExt( &pString, false );
-			if ( !token || !token[0] ) {
+			if ( arg >= args->numArgs ) {
 				Com_Printf( "G_Scripting: syntax error\n\nplayanim <startframe> <endframe> [LOOPING <duration>]\n" );
 				return true;
 			}
+			token = args->argv[arg++];
 			if ( !Q_strcasecmp( token, "untilreachmarker" ) ) {
 				if ( level.time < ent->shared.s.pos.trTime + ent->shared.s.pos.trDuration ) {
 					endtime = level.time + 100;
@@ -542,19 +528,18 @@ bool G_ScriptAction_PlayAnim( GameEntity *ent, char *params ) {
 				endtime = level.time + 100;     // we don't care when it ends, since we are going forever!
 				forever = true;
 			} else {
-				endtime = ent->scriptStatus.scriptStackChangeTime + atoi( token );
+				endtime = ent->scriptStatus.scriptStackChangeTime + args->argi[arg - 1];
 			}
 
-			token = COM_ParseExt( &pString, false );
+			token = arg < args->numArgs ? args->argv[arg++] : "";
 		}
 
 		if ( token[0] && !Q_strcasecmp( token, "rate" ) ) {
-			token = COM_ParseExt( &pString, false );
-			if ( !token[0] ) {
+			if ( arg >= args->numArgs ) {
 				Com_Error( ERR_DROP, "G_Scripting: playanim has RATE parameter without an actual rate specified" );
                 return false; // keep the linter happy, ERR_DROP does not return
 			}
-			rate = atoi( token );
+			rate = args->argi[arg];
 		}
 
 		if ( !looping ) {
@@ -596,7 +581,7 @@ G_ScriptAction_AlertEntity
   syntax: alertentity <targetname>
 =================
 */
-bool G_ScriptAction_AlertEntity( GameEntity *ent, char *params ) {
+bool G_ScriptAction_AlertEntity( GameEntity *ent, char *params, g_script_args_t *args ) {
 	GameEntity   *alertent;
 
 	if ( !params || !params[0] ) {
@@ -651,7 +636,7 @@ G_ScriptAction_Accum
 	accum <n> abort_if_not_bitset <m>
 =================
 */
-bool G_ScriptAction_Accum( GameEntity *ent, char *params ) {
+bool G_ScriptAction_Accum( GameEntity *ent, char *params, g_script_args_t *args ) {
 	char *token, lastToken[MAX_QPATH];
 	int bufferIndex;
 
@@ -777,7 +762,7 @@ G_ScriptAction_MissionFailed
   syntax: missionfailed
 =================
 */
-bool G_ScriptAction_MissionFailed( GameEntity *ent, char *params ) {
+bool G_ScriptAction_MissionFailed( GameEntity *ent, char *params, g_script_args_t *args ) {
 	char   *token;
 	int time = 6, mof = 0;
 
@@ -821,7 +806,7 @@ G_ScriptAction_MissionSuccess
   syntax: missionsuccess <mission_level>
 =================
 */
-bool G_ScriptAction_MissionSuccess( GameEntity *ent, char *params ) {
+bool G_ScriptAction_MissionSuccess( GameEntity *ent, char *params, g_script_args_t *args ) {
 	GameEntity   *player;
 	vmCvar_t cvar;
 	int lvl;
@@ -878,7 +863,7 @@ G_ScriptAction_Print
   Mostly for debugging purposes
 =================
 */
-bool G_ScriptAction_Print( GameEntity *ent, char *params ) {
+bool G_ScriptAction_Print( GameEntity *ent, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "G_Scripting: print requires some text\n" );
         return false; // keep the linter happy, ERR_DROP does not return
@@ -899,7 +884,7 @@ G_ScriptAction_FaceAngles
   last gotomarker command will be used instead.
 =================
 */
-bool G_ScriptAction_FaceAngles( GameEntity *ent, char *params ) {
+bool G_ScriptAction_FaceAngles( GameEntity *ent, char *params, g_script_args_t *args ) {
 	char  *token;
 	int duration, i;
 	vec3_t diff;
@@ -997,7 +982,7 @@ G_ScriptAction_ResetScript
 	causes any currently running scripts to abort, in favour of the current script
 ===================
 */
-bool G_ScriptAction_ResetScript( GameEntity *ent, char *params )
+bool G_ScriptAction_ResetScript( GameEntity *ent, char *params, g_script_args_t *args )
 {
 	if ( level.time == ent->scriptStatus.scriptStackChangeTime ) {
 		return false;
@@ -1015,7 +1000,7 @@ G_ScriptAction_TagConnect
 	connect this entity onto the tag of another entity
 ===================
 */
-bool G_ScriptAction_TagConnect( GameEntity *ent, char *params ) {
+bool G_ScriptAction_TagConnect( GameEntity *ent, char *params, g_script_args_t *args ) {
 	char *token;
 	GameEntity *parent;
 
@@ -1059,7 +1044,7 @@ G_ScriptAction_Halt
   Stop moving.
 ====================
 */
-bool G_ScriptAction_Halt( GameEntity *ent, char *params ) {
+bool G_ScriptAction_Halt( GameEntity *ent, char *params, g_script_args_t *args ) {
 	if ( level.time == ent->scriptStatus.scriptStackChangeTime ) {
 		ent->scriptStatus.scriptFlags &= ~SCFL_GOING_TO_MARKER;
 
@@ -1098,7 +1083,7 @@ G_ScriptAction_StopSound
   Stops any looping sounds for this entity.
 ===================
 */
-bool G_ScriptAction_StopSound( GameEntity *ent, char *params ) {
+bool G_ScriptAction_StopSound( GameEntity *ent, char *params, g_script_args_t *args ) {
 	ent->shared.s.loopSound = 0;
 	return true;
 }
@@ -1110,7 +1095,7 @@ G_ScriptAction_StartCam
   syntax: startcam <camera filename>
 ===================
 */
-bool G_ScriptAction_StartCam( GameEntity *ent, char *params ) {
+bool G_ScriptAction_StartCam( GameEntity *ent, char *params, g_script_args_t *args ) {
 	char *token;
 	GameEntity *player;
 
@@ -1140,7 +1125,7 @@ bool G_ScriptAction_StartCam( GameEntity *ent, char *params ) {
 G_ScriptAction_EntityScriptName
 =================
 */
-bool G_ScriptAction_EntityScriptName( GameEntity *ent, char *params ) {
+bool G_ScriptAction_EntityScriptName( GameEntity *ent, char *params, g_script_args_t *args ) {
 	Cvar_Set( "g_scriptName", params );
 	return true;
 }
@@ -1151,7 +1136,7 @@ bool G_ScriptAction_EntityScriptName( GameEntity *ent, char *params ) {
 G_ScriptAction_AIScriptName
 =================
 */
-bool G_ScriptAction_AIScriptName( GameEntity *ent, char *params ) {
+bool G_ScriptAction_AIScriptName( GameEntity *ent, char *params, g_script_args_t *args ) {
 	Cvar_Set( "ai_scriptName", params );
 	return true;
 }
@@ -1164,7 +1149,7 @@ G_ScriptAction_BackupScript
   were we left off (useful if player gets in our way)
 =================
 */
-bool G_ScriptAction_BackupScript( GameEntity *ent, char *params ) {
+bool G_ScriptAction_BackupScript( GameEntity *ent, char *params, g_script_args_t *args ) {
 
 	// if we're not at the top of an event, then something is _probably_ wrong with the script
 //	if (ent->scriptStatus.scriptStackHead > 0) {
@@ -1212,7 +1197,7 @@ G_ScriptAction_RestoreScript
   restores the state of the scripting to the previous backup
 =================
 */
-bool G_ScriptAction_RestoreScript( GameEntity *ent, char *params ) {
+bool G_ScriptAction_RestoreScript( GameEntity *ent, char *params, g_script_args_t *args ) {
 
 	ent->scriptStatus = ent->scriptStatusBackup;
 	ent->scriptStatus.scriptStackChangeTime = level.time;       // start moves again
@@ -1225,7 +1210,7 @@ bool G_ScriptAction_RestoreScript( GameEntity *ent, char *params ) {
 G_ScriptAction_SetHealth
 ==================
 */
-bool G_ScriptAction_SetHealth( GameEntity *ent, char *params ) {
+bool G_ScriptAction_SetHealth( GameEntity *ent, char *params, g_script_args_t *args ) {
 	if ( !params || !params[0] ) {
 		Com_Error( ERR_DROP, "G_ScriptAction_SetHealth: sethealth requires a health value\n" );
         return false; // keep the linter happy, ERR_DROP does not return
@@ -746,6 +746,7 @@ void G_SpawnGEntityFromSpawnVars()
 	for (int i = 0 ; i < level.numSpawnVars ; i++ ) {
 		G_ParseField( level.spawnVars[i][0], level.spawnVars[i][1], ent );
 	}
+	G_IndexEntity( ent );
 
 	// move editor origin to pos
 	VectorCopy( ent->shared.s.origin, ent->shared.s.pos.trBase );
@@ -894,6 +895,7 @@ void SP_worldspawn()
 
 	g_entities[ENTITYNUM_WORLD].shared.s.number = ENTITYNUM_WORLD;
 	g_entities[ENTITYNUM_WORLD].classname = "worldspawn";
+	G_IndexEntity( &g_entities[ENTITYNUM_WORLD] );
 
 	// see if we want a warmup time
 	SV_SetConfigstring( CS_WARMUP, "" );
@@ -291,6 +291,16 @@ bool    ConsoleCommand( void ) {
 	}
 	// done.
 
+	if ( Q_stricmp( cmd, "scriptprofile" ) == 0 ) {
+		G_Script_ProfileReport_f();
+		return true;
+	}
+
+	if ( Q_stricmp( cmd, "savebench" ) == 0 ) {
+		G_SaveBench_f();
+		return true;
+	}
+
 	if ( Q_stricmp( cmd, "entitylist" ) == 0 ) {
 		Svcmd_EntityList_f();
 		return true;
@@ -141,6 +141,14 @@ int trap_AAS_TraceAreas( vec3_t start, vec3_t end, int *areas, vec3_t *points, i
 	return AAS_TraceAreas( start, end, areas, points, maxareas );
 }
 
+int trap_AAS_PointAreaNumInWorld( int world, vec3_t point ) {
+	return AAS_PointAreaNumInWorld( world, point );
+}
+
+int trap_AAS_TraceAreasInWorld( int world, vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas ) {
+	return AAS_TraceAreasInWorld( world, start, end, areas, points, maxareas );
+}
+
 int trap_AAS_PointContents( vec3_t point ) {
 	return AAS_PointContents(point );
 }
@@ -62,7 +62,7 @@ void Use_Target_Give( GameEntity *ent, GameEntity *other, GameEntity *activator
 		Touch_Item( t, activator, &trace );
 
 		// make sure it isn't going to respawn or show any events
-		t->nextthink = 0;
+		G_SetNextThink( t, 0 );
 		SV_UnlinkEntity( &t->shared );
 	}
 }
@@ -102,7 +102,7 @@ void Think_Target_Delay( GameEntity *ent ) {
 }
 
 void Use_Target_Delay( GameEntity *ent, GameEntity *other, GameEntity *activator ) {
-	ent->nextthink = level.time + ( ent->wait + ent->random * crandom() ) * 1000;
+	G_SetNextThink( ent, level.time + ( ent->wait + ent->random * crandom() ) * 1000 );
 	ent->think = Think_Target_Delay;
 	ent->activator = activator;
 }
@@ -269,7 +269,7 @@ void SP_target_speaker( GameEntity *ent ) {
 
 	if ( ent->spawnflags & 16 ) {
 		ent->think = target_speaker_multiple;
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 	}
 
 	// NO_PVS
@@ -325,7 +325,7 @@ void target_laser_think( GameEntity *self ) {
 	VectorCopy( tr.endpos, self->shared.s.origin2 );
 
 	SV_LinkEntity( &self->shared );
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 }
 
 void target_laser_on( GameEntity *self ) {
@@ -337,7 +337,7 @@ void target_laser_on( GameEntity *self ) {
 
 void target_laser_off( GameEntity *self ) {
 	SV_UnlinkEntity( &self->shared );
-	self->nextthink = 0;
+	G_SetNextThink( self, 0 );
 }
 
 void target_laser_use( GameEntity *self, GameEntity *other, GameEntity *activator ) {
@@ -381,7 +381,7 @@ void target_laser_start( GameEntity *self ) {
 void SP_target_laser( GameEntity *self ) {
 	// let everything else get spawned before we start firing
 	self->think = target_laser_start;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 }
 
 
@@ -553,7 +553,7 @@ void target_kill_use( GameEntity *self, GameEntity *other, GameEntity *activator
 		} else
 		{
 			// make sure it isn't going to respawn or show any events
-			targ->nextthink = 0;
+			G_SetNextThink( targ, 0 );
 			if ( targ == activator ) {
 				continue;
 			}
@@ -567,7 +567,7 @@ void target_kill_use( GameEntity *self, GameEntity *other, GameEntity *activator
 			SV_UnlinkEntity( &targ->shared );
 			targ->use = 0;
 			targ->touch = 0;
-			targ->nextthink = level.time + FRAMETIME;
+			G_SetNextThink( targ, level.time + FRAMETIME );
 			targ->think = G_FreeEntity;
 		}
 	}
@@ -628,7 +628,7 @@ in site, closest in distance
 */
 void SP_target_location( GameEntity *self ) {
 	self->think = target_location_linkup;
-	self->nextthink = level.time + 200;  // Let them all spawn first
+	G_SetNextThink( self, level.time + 200 );  // Let them all spawn first
 
 	G_SetOrigin( self, self->shared.s.origin );
 }
@@ -798,7 +798,7 @@ wait	= default is 50 the rate at which it will travel up
 void smoke_think( GameEntity *ent ) {
 	GameEntity   *tent;
 
-	ent->nextthink = level.time + ent->delay;
+	G_SetNextThink( ent, level.time + ent->delay );
 
 	if ( !( ent->spawnflags & 4 ) ) {
 		return;
@@ -808,7 +808,7 @@ void smoke_think( GameEntity *ent ) {
 		ent->health--;
 		if ( !ent->health ) {
 			ent->think = G_FreeEntity;
-			ent->nextthink = level.time + FRAMETIME;
+			G_SetNextThink( ent, level.time + FRAMETIME );
 		}
 	}
 
@@ -845,7 +845,7 @@ void smoke_init( GameEntity *ent ) {
 	vec3_t vec;
 
 	ent->think = smoke_think;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	if ( ent->target ) {
 		target = G_Find( nullptr, FOFS( targetname ), ent->target );
@@ -873,7 +873,7 @@ void SP_target_smoke( GameEntity *ent ) {
 	ent->use = smoke_toggle;
 
 	ent->think = smoke_init;
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	G_SetOrigin( ent, ent->shared.s.origin );
 	ent->shared.r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -1019,9 +1019,9 @@ void target_rumble_think( GameEntity * ent ) {
 			ent->shared.s.loopSound = 0;
 		}
 
-		ent->nextthink = 0;
+		G_SetNextThink( ent, 0 );
 	} else {
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 	}
 
 }
@@ -1033,7 +1033,7 @@ void target_rumble_use( GameEntity *ent, GameEntity *other, GameEntity *activato
 		ent->spawnflags &= ~1;
 		ent->think = target_rumble_think;
 		ent->count = 0;
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 	} else
 	{
 		// RF, don't broadcast this entity
@@ -254,7 +254,7 @@ void Calc_Roll( GameEntity *ent ) {
 
 	SV_LinkEntity( &ent->shared );
 
-	ent->nextthink = level.time + 50;
+	G_SetNextThink( ent, level.time + 50 );
 }
 
 
@@ -403,7 +403,7 @@ void Reached_Tramcar( GameEntity *ent ) {
 		SV_LinkEntity( &ent->shared );
 
 		ent->think = props_me109_think;
-		ent->nextthink = level.time + 50;
+		G_SetNextThink( ent, level.time + 50 );
 	} else if ( !Q_stricmp( ent->classname, "truck_cam" ) )       {
 		Com_Printf( "target: %s\n", next->targetname );
 
@@ -478,7 +478,7 @@ void Reached_Tramcar( GameEntity *ent ) {
 //testing
 		ent->shared.s.loopSound = truck_sound;
 		ent->think = truck_cam_think;
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 
 	} else if ( !Q_stricmp( ent->classname, "camera_cam" ) )       {
 
@@ -530,7 +530,7 @@ void Reached_Tramcar( GameEntity *ent ) {
 	// if there is a "wait" value on the target, don't start moving yet
 	// if ( next->wait )
 	if ( next->wait && next->wait != -1 ) {
-		ent->nextthink = level.time + next->wait * 1000;
+		G_SetNextThink( ent, level.time + next->wait * 1000 );
 		ent->think = Think_BeginMoving;
 		ent->shared.s.pos.trType = TR_STATIONARY;
 	}
@@ -567,7 +567,7 @@ void Tramcar_die( GameEntity *self, GameEntity *inflictor, GameEntity *attacker,
 		VectorCopy( self->shared.s.apos.trDelta, slave->shared.s.apos.trDelta );
 
 		slave->think = self->think;
-		slave->nextthink = self->nextthink;
+		G_SetNextThink( slave, self->nextthink );
 
 		VectorCopy( self->pos1, slave->pos1 );
 		VectorCopy( self->pos2, slave->pos2 );
@@ -753,7 +753,7 @@ void SP_func_tramcar( GameEntity *self ) {
 
 	self->reached = Reached_Tramcar;
 
-	self->nextthink = level.time + ( FRAMETIME / 2 );
+	G_SetNextThink( self, level.time + ( FRAMETIME / 2 ) );
 
 	self->think = Think_SetupTrainTargets;
 
@@ -829,7 +829,7 @@ void ExplodePlaneSndFx( GameEntity *self ) {
 	G_SetOrigin( temp, self->melee->shared.s.pos.trBase );
 	G_AddEvent( temp, EV_GLOBAL_SOUND, fpexpdebris_snd );
 	temp->think = G_FreeEntity;
-	temp->nextthink = level.time + 10000;
+	G_SetNextThink( temp, level.time + 10000 );
 	SV_LinkEntity( &temp->shared );
 
 	// added this because plane may be parked on runway
@@ -1028,7 +1028,7 @@ void props_me109_think( GameEntity *self ) {
 	}
 
 	if ( self->health > 0 ) {
-		self->nextthink = level.time + 50;
+		G_SetNextThink( self, level.time + 50 );
 
 		if ( self->props_frame_state == plane_choke ) {
 			self->melee->shared.s.loopSound = self->melee->noise_index = fpchoke_snd;
@@ -1173,7 +1173,7 @@ void SP_props_me109( GameEntity *ent ) {
 
 	ent->reached = Reached_Tramcar;
 
-	ent->nextthink = level.time + ( FRAMETIME / 2 );
+	G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 
 	ent->think = Think_SetupAirplaneWaypoints;
 
@@ -1261,7 +1261,7 @@ void truck_cam_touch( GameEntity *self, GameEntity *other, trace_t *trace ) {
 }
 
 void truck_cam_think( GameEntity *ent ) {
-	ent->nextthink = level.time + ( FRAMETIME / 2 );
+	G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 }
 
 void SP_truck_cam( GameEntity *self ) {
@@ -1289,7 +1289,7 @@ void SP_truck_cam( GameEntity *self ) {
 
 	InitTramcar( self );
 
-	self->nextthink = level.time + ( FRAMETIME / 2 );
+	G_SetNextThink( self, level.time + ( FRAMETIME / 2 ) );
 
 	self->think = Think_SetupTrainTargets;
 
@@ -1415,7 +1415,7 @@ void camera_cam_think( GameEntity *ent ) {
 		SV_LinkEntity( &player->shared );
 	}
 
-	ent->nextthink = level.time + ( FRAMETIME / 2 );
+	G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 }
 
 void camera_cam_use( GameEntity *ent, GameEntity *other, GameEntity *activator ) {
@@ -1429,7 +1429,7 @@ void camera_cam_use( GameEntity *ent, GameEntity *other, GameEntity *activator )
 
 	if ( !( ent->spawnflags & 1 ) ) {
 		ent->think = camera_cam_think;
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 		ent->spawnflags |= 1;
 		{
 			player->client->ps.persistant[PERS_HWEAPON_USE] = 1;
@@ -1465,7 +1465,7 @@ void camera_cam_firstthink( GameEntity *ent ) {
 	}
 
 	if ( ent->target ) {
-		ent->nextthink = level.time + ( FRAMETIME / 2 );
+		G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 		ent->think = Think_SetupTrainTargets;
 	}
 }
@@ -1481,7 +1481,7 @@ void SP_camera_cam( GameEntity *ent ) {
 
 	ent->reached = Reached_Tramcar;
 
-	ent->nextthink = level.time + ( FRAMETIME / 2 );
+	G_SetNextThink( ent, level.time + ( FRAMETIME / 2 ) );
 
 	ent->think = camera_cam_firstthink;
 
@@ -1492,7 +1492,7 @@ void SP_camera_cam( GameEntity *ent ) {
 
 		delayOn = G_Spawn();
 		delayOn->think = delayOnthink;
-		delayOn->nextthink = level.time + 1000;
+		G_SetNextThink( delayOn, level.time + 1000 );
 		delayOn->melee = ent;
 		SV_LinkEntity( &delayOn->shared );
 	}
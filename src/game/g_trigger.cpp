@@ -43,7 +43,7 @@ void InitTrigger( GameEntity *self ) {
 
 // the wait time has passed, so set back up for another activation
 void multi_wait( GameEntity *ent ) {
-	ent->nextthink = 0;
+	G_SetNextThink( ent, 0 );
 }
 
 
@@ -60,12 +60,12 @@ void multi_trigger( GameEntity *ent, GameEntity *activator ) {
 
 	if ( ent->wait > 0 ) {
 		ent->think = multi_wait;
-		ent->nextthink = level.time + ( ent->wait + ent->random * crandom() ) * 1000;
+		G_SetNextThink( ent, level.time + ( ent->wait + ent->random * crandom() ) * 1000 );
 	} else {
 		// we can't just remove (self) here, because this is a touch function
 		// called while looping through area links...
 		ent->touch = 0;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( ent, level.time + FRAMETIME );
 		ent->think = G_FreeEntity;
 	}
 }
@@ -215,7 +215,7 @@ This trigger will always fire.  It is activated by the world.
 */
 void SP_trigger_always( GameEntity *ent ) {
 	// we must have some delay to make sure our use targets are present
-	ent->nextthink = level.time + 300;
+	G_SetNextThink( ent, level.time + 300 );
 	ent->think = trigger_always_think;
 }
 
@@ -346,7 +346,7 @@ void SP_trigger_push( GameEntity *self ) {
 		SV_LinkEntity( &self->shared );
 	}
 
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 //	SV_LinkEntity (self);
 }
 
@@ -393,7 +393,7 @@ void SP_target_push( GameEntity *self ) {
 		VectorCopy( self->shared.s.origin, self->shared.r.absmin );
 		VectorCopy( self->shared.s.origin, self->shared.r.absmax );
 		self->think = AimAtTarget;
-		self->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( self, level.time + FRAMETIME );
 	}
 	self->use = Use_target_push;
 }
@@ -515,7 +515,7 @@ void hurt_touch( GameEntity *self, GameEntity *other, trace_t *trace ) {
 }
 
 void hurt_think( GameEntity *ent ) {
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	if ( ent->wait < level.time ) {
 		G_FreeEntity( ent );
@@ -531,7 +531,7 @@ void hurt_use( GameEntity *self, GameEntity *other, GameEntity *activator ) {
 	}
 
 	if ( self->delay ) {
-		self->nextthink = level.time + 50;
+		G_SetNextThink( self, level.time + 50 );
 		self->think = hurt_think;
 		self->wait = level.time + ( self->delay * 1000 );
 	}
@@ -596,7 +596,7 @@ so, the basic time between firing is a random time between
 void func_timer_think( GameEntity *self ) {
 	G_UseTargets( self, self->activator );
 	// set time before next firing
-	self->nextthink = level.time + 1000 * ( self->wait + crandom() * self->random );
+	G_SetNextThink( self, level.time + 1000 * ( self->wait + crandom() * self->random ) );
 }
 
 void func_timer_use( GameEntity *self, GameEntity *other, GameEntity *activator ) {
@@ -604,7 +604,7 @@ void func_timer_use( GameEntity *self, GameEntity *other, GameEntity *activator
 
 	// if on, turn it off
 	if ( self->nextthink ) {
-		self->nextthink = 0;
+		G_SetNextThink( self, 0 );
 		return;
 	}
 
@@ -625,7 +625,7 @@ void SP_func_timer( GameEntity *self ) {
 	}
 
 	if ( self->spawnflags & 1 ) {
-		self->nextthink = level.time + FRAMETIME;
+		G_SetNextThink( self, level.time + FRAMETIME );
 		self->activator = self;
 	}
 
@@ -705,12 +705,12 @@ void trigger_aidoor_stayopen( GameEntity * ent, GameEntity * other, trace_t * tr
 		}
 
 		if ( door->moverState == MOVER_POS2ROTATE ) {     // door is in open state waiting to close keep it open
-			door->nextthink = level.time + door->wait + 3000;
+			G_SetNextThink( door, level.time + door->wait + 3000 );
 		}
 
 //----(SA)	added
 		if ( door->moverState == MOVER_POS2 ) {   // door is in open state waiting to close keep it open
-			door->nextthink = level.time + door->wait + 3000;
+			G_SetNextThink( door, level.time + door->wait + 3000 );
 		}
 //----(SA)	end
 
@@ -803,9 +803,9 @@ void gas_think( GameEntity *ent ) {
 	if ( ent->health < ent->count ) {
 		ent->think = G_FreeEntity;
 		if ( ent->shared.s.density == 5 ) {
-			ent->nextthink = level.time + FRAMETIME;
+			G_SetNextThink( ent, level.time + FRAMETIME );
 		} else {
-			ent->nextthink = level.time + 3000;
+			G_SetNextThink( ent, level.time + 3000 );
 		}
 		return;
 	}
@@ -813,7 +813,7 @@ void gas_think( GameEntity *ent ) {
 	ent->shared.r.maxs[0] = ent->shared.r.maxs[1] = ent->shared.r.maxs[2]++;
 	ent->shared.r.mins[0] = ent->shared.r.mins[1] = ent->shared.r.mins[2]--;
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( ent, level.time + FRAMETIME );
 
 	tent = G_TempEntity( ent->shared.r.currentOrigin, EV_SMOKE );
 	VectorCopy( ent->shared.r.currentOrigin, tent->shared.s.origin );
@@ -842,7 +842,7 @@ void gas_think( GameEntity *ent ) {
 */
 void SP_gas( GameEntity *self ) {
 	self->think = gas_think;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink( self, level.time + FRAMETIME );
 	self->shared.r.contents = CONTENTS_TRIGGER;
 	self->touch = gas_touch;
 	SV_LinkEntity( &self->shared );
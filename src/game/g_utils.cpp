@@ -35,6 +35,8 @@ If you have questions concerning this license or the applicable additional terms
 #include "../idlib/math/Math.h"
 #include "g_local.h"
 #include "../server/server.h"
+#include "../qcommon/name_index.h"
+#include "../qcommon/timer_wheel.h"
 
 typedef struct {
 	char oldShader[MAX_QPATH];
@@ -137,6 +139,136 @@ int G_SoundIndex( const char *name ) {
 //=====================================================================
 
 
+/*
+=============
+Entity name index
+
+classname, targetname and scriptName are indexed so G_Find on those fields
+doesn't have to scan every entity. Entities are reindexed on spawn and free,
+wherever those fields are assigned, after loading a game, and once a frame
+from the G_RunFrame entity loop, which catches any assignment that slipped
+through in the meantime. The index only ever narrows the search: G_Find
+still checks inuse and compares the actual field of each candidate.
+=============
+*/
+enum {
+	ENTINDEX_CLASSNAME,
+	ENTINDEX_TARGETNAME,
+	ENTINDEX_SCRIPTNAME,
+
+	NUM_ENTINDEX_KEYS
+};
+
+static NameIndex<NUM_ENTINDEX_KEYS> entityIndex( MAX_GENTITIES );
+
+// when each entity's nextthink comes, see G_SetNextThink
+static TimerWheel<MAX_GENTITIES> thinkWheel;
+
+static int G_EntityIndexKey( int fieldofs ) {
+	if ( fieldofs == FOFS( classname ) ) {
+		return ENTINDEX_CLASSNAME;
+	}
+	if ( fieldofs == FOFS( targetname ) ) {
+		return ENTINDEX_TARGETNAME;
+	}
+	if ( fieldofs == FOFS( scriptName ) ) {
+		return ENTINDEX_SCRIPTNAME;
+	}
+	return -1;
+}
+
+/*
+=============
+G_IndexEntity
+
+Call after changing an entity's inuse, classname, targetname or scriptName
+=============
+*/
+void G_IndexEntity( GameEntity *ent ) {
+	int num = ent - g_entities;
+
+	g_entitiesInUse.set( num, ent->inuse );
+	entityIndex.set( ENTINDEX_CLASSNAME, num, ent->classname );
+	entityIndex.set( ENTINDEX_TARGETNAME, num, ent->targetname );
+	entityIndex.set( ENTINDEX_SCRIPTNAME, num, ent->scriptName );
+}
+
+/*
+=============
+G_IndexAllEntities
+
+Rebuilds the index and the think wheel after entities were changed in bulk
+(map spawn, loadgame)
+=============
+*/
+void G_IndexAllEntities( void ) {
+	g_entitiesInUse.clear();
+	entityIndex.clear();
+	thinkWheel.reset( level.time );
+	g_thinksDue.clear();
+	for ( int i = 0; i < level.num_entities; i++ ) {
+		G_IndexEntity( &g_entities[i] );
+		G_SetNextThink( &g_entities[i], g_entities[i].nextthink );
+	}
+}
+
+/*
+=============
+G_SetNextThink
+
+Sets the level time ent next thinks at, 0 or less for not at all
+=============
+*/
+void G_SetNextThink( GameEntity *ent, int time ) {
+	int num = ent - g_entities;
+
+	ent->nextthink.time = time;
+	if ( time > level.time ) {
+		thinkWheel.schedule( num, time );
+	} else {
+		thinkWheel.cancel( num );
+	}
+	g_thinksDue.set( num, time > 0 && time <= level.time );
+}
+
+/*
+=============
+G_AdvanceThinks
+
+Marks the entities whose nextthink has come as due, once level.time has moved on
+=============
+*/
+void G_AdvanceThinks( void ) {
+	thinkWheel.advance( level.time, []( int num ) {
+		g_thinksDue.set( num, true );
+	} );
+}
+
+/*
+=============
+G_CheckThinks
+
+Compares the think wheel against every entity's nextthink (g_debugThinks),
+and puts right any entity it has wrong
+=============
+*/
+void G_CheckThinks( void ) {
+	for ( int i = 0; i < MAX_GENTITIES; i++ ) {
+		GameEntity *ent = &g_entities[i];
+		int time = ent->nextthink;
+		bool due = time > 0 && time <= level.time;
+		bool waiting = time > level.time;
+
+		if ( g_thinksDue.test( i ) == due && thinkWheel.scheduled( i ) == waiting
+			 && ( !waiting || thinkWheel.when( i ) == time ) ) {
+			continue;
+		}
+		Com_Printf( "G_CheckThinks: %i (%s) nextthink %i at %i is not as the think wheel has it\n",
+					i, ent->classname ? ent->classname : "", time, level.time );
+		G_SetNextThink( ent, time );
+	}
+}
+
 /*
 =============
 G_Find
@@ -158,6 +290,24 @@ GameEntity *G_Find( GameEntity *from, int fieldofs, const char *match ) {
 		from++;
 	}
 
+	int key = G_EntityIndexKey( fieldofs );
+	if ( key >= 0 ) {
+		const std::vector<int>& candidates = entityIndex.candidates( key, match );
+		auto it = std::lower_bound( candidates.begin(), candidates.end(), (int)( from - g_entities ) );
+
+		for ( ; it != candidates.end() && *it < level.num_entities; ++it ) {
+			GameEntity *ent = &g_entities[*it];
+			if ( !ent->inuse ) {
+				continue;
+			}
+			s = *( char ** )( (uint8_t *)ent + fieldofs );
+			if ( s && !Q_stricmp( s, match ) ) {
+				return ent;
+			}
+		}
+		return nullptr;
+	}
+
 	for ( ; from < &g_entities[level.num_entities] ; from++ )
 	{
 		if ( !from->inuse ) {
@@ -375,6 +525,7 @@ void G_InitGentity( GameEntity *e )
 	e->inuse = true;
 	e->classname = "noclass";
 	e->shared.s.number = e - g_entities;
+	G_IndexEntity( e );
 	e->shared.r.ownerNum = ENTITYNUM_NONE;
 	e->headshotDamageScale = 1.0;   // RF, default value
 	e->eventTime = 0;
@@ -485,6 +636,8 @@ void G_FreeEntity( GameEntity *ed ) {
 	ed->classname = "freed";
 	ed->freetime = level.time;
 	ed->inuse = false;
+	G_SetNextThink( ed, 0 );
+	G_IndexEntity( ed );
 }
 
 /*
@@ -504,6 +657,7 @@ GameEntity *G_TempEntity( vec3_t origin, int event ) {
 	e->shared.s.eType = ET_EVENTS + event;
 
 	e->classname = "tempEntity";
+	G_IndexEntity( e );
 	e->eventTime = level.time;
 	e->shared.r.eventTime = level.time;
 	e->freeAfterEvent = true;
@@ -554,7 +554,8 @@ void Info_NextPair( const char **s, char *key, char *value );
 void  Com_Printf( const char *msg, ... );
 
 
-#define SAVE_VERSION    18
+#define SAVE_VERSION    19
+#define SAVE_VERSION_RLE    18  // byte RLE records, still loaded
 #define SAVE_INFOSTRING_LENGTH  256
 
 /*
@@ -28,18 +28,219 @@ If you have questions concerning this license or the applicable additional terms
 */
 
 
-#ifdef __APPLE__
-	#include <mach/mach_time.h>
-#endif
+#include <cstdio>
+#include <cstring>
 
 #include "Simd.h"
 #include "Simd_Generic.h"
 #include "Simd_SSE.h"
 
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+	#define SIMD_X86
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+	#include <xmmintrin.h>
+#endif
+
 idSIMDProcessor*	processor = nullptr;			// pointer to SIMD processor
 idSIMDProcessor* 	generic = nullptr;				// pointer to generic SIMD implementation
 idSIMDProcessor* 	SIMDProcessor = nullptr;
 
+#ifdef SIMD_X86
+
+/*
+================
+CPUID
+
+eax, ebx, ecx and edx of a cpuid leaf
+================
+*/
+static void CPUID( unsigned int leaf, unsigned int subLeaf, unsigned int regs[4] )
+{
+#ifdef _MSC_VER
+	__cpuidex( ( int* )regs, leaf, subLeaf );
+#else
+	__cpuid_count( leaf, subLeaf, regs[0], regs[1], regs[2], regs[3] );
+#endif
+}
+
+/*
+================
+XGETBV
+
+which register states the OS saves on a context switch
+================
+*/
+static unsigned long long XGETBV()
+{
+#ifdef _MSC_VER
+	return _xgetbv( 0 );
+#else
+	unsigned int eax, edx;
+	__asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+	return ( ( unsigned long long )edx << 32 ) | eax;
+#endif
+}
+
+/*
+================
+HasDAZ
+
+the first processors with SSE2 can't set Denormals-Are-Zero, the
+mask of the writable MXCSR bits that fxsave stores says if it can
+================
+*/
+static bool HasDAZ()
+{
+	alignas( 16 ) unsigned char area[512];
+	memset( area, 0, sizeof( area ) );
+#ifdef _MSC_VER
+	_fxsave( area );
+#else
+	__asm__ volatile( "fxsave %0" : "=m"( area ) );
+#endif
+	unsigned int mask;
+	memcpy( &mask, area + 28, sizeof( mask ) );
+	return ( mask & ( 1 << 6 ) ) != 0;
+}
+
+/*
+================
+FPU_SetFTZ / FPU_SetDAZ
+
+MXCSR is per thread, these only change the calling thread
+================
+*/
+static void FPU_SetFTZ( bool enable )
+{
+	_mm_setcsr( ( _mm_getcsr() & ~_MM_FLUSH_ZERO_MASK ) | ( enable ? _MM_FLUSH_ZERO_ON : _MM_FLUSH_ZERO_OFF ) );
+}
+
+static void FPU_SetDAZ( bool enable )
+{
+	const unsigned int daz = 1 << 6;
+	_mm_setcsr( ( _mm_getcsr() & ~daz ) | ( enable ? daz : 0 ) );
+}
+
+#endif
+
+/*
+================
+idSIMD::GetProcessorId
+================
+*/
+cpuid_t idSIMD::GetProcessorId()
+{
+	int flags = 0;
+#ifdef SIMD_X86
+	unsigned int regs[4];
+
+	CPUID( 0, 0, regs );
+	const unsigned int maxLeaf = regs[0];
+	char vendor[13];
+	memcpy( vendor + 0, &regs[1], 4 );
+	memcpy( vendor + 4, &regs[3], 4 );
+	memcpy( vendor + 8, &regs[2], 4 );
+	vendor[12] = 0;
+	if( !strcmp( vendor, "GenuineIntel" ) ) {
+		flags |= CPUID_INTEL;
+	} else if( !strcmp( vendor, "AuthenticAMD" ) ) {
+		flags |= CPUID_AMD;
+	} else {
+		flags |= CPUID_GENERIC;
+	}
+
+	if( maxLeaf < 1 ) {
+		return ( cpuid_t )flags;
+	}
+	CPUID( 1, 0, regs );
+	const unsigned int ecx = regs[2];
+	const unsigned int edx = regs[3];
+	if( edx & ( 1 << 15 ) ) {
+		flags |= CPUID_CMOV;
+	}
+	if( edx & ( 1 << 23 ) ) {
+		flags |= CPUID_MMX;
+	}
+	if( edx & ( 1 << 25 ) ) {
+		flags |= CPUID_SSE | CPUID_FTZ;
+	}
+	if( edx & ( 1 << 26 ) ) {
+		flags |= CPUID_SSE2;
+	}
+	if( edx & ( 1 << 28 ) ) {
+		flags |= CPUID_HTT;
+	}
+	if( ecx & ( 1 << 0 ) ) {
+		flags |= CPUID_SSE3;
+	}
+	if( ecx & ( 1 << 19 ) ) {
+		flags |= CPUID_SSE41;
+	}
+	if( ( edx & ( 1 << 24 ) ) && ( flags & CPUID_SSE ) && HasDAZ() ) {
+		flags |= CPUID_DAZ;
+	}
+
+	// AVX and FMA also need the OS to save the ymm registers
+	const bool osxsave = ( ecx & ( 1 << 27 ) ) != 0;
+	if( osxsave && ( ecx & ( 1 << 28 ) ) && ( XGETBV() & 6 ) == 6 ) {
+		flags |= CPUID_AVX;
+		if( ecx & ( 1 << 12 ) ) {
+			flags |= CPUID_FMA3;
+		}
+		if( maxLeaf >= 7 ) {
+			CPUID( 7, 0, regs );
+			if( regs[1] & ( 1 << 5 ) ) {
+				flags |= CPUID_AVX2;
+			}
+		}
+	}
+#else
+	flags = CPUID_GENERIC;
+#endif
+	return ( cpuid_t )flags;
+}
+
+/*
+================
+idSIMD::GetProcessorString
+================
+*/
+void idSIMD::GetProcessorString( cpuid_t cpuid, char* string, int size )
+{
+	static const struct {
+		int flag;
+		const char* name;
+	} names[] = {
+		{ CPUID_INTEL, "Intel" },
+		{ CPUID_AMD, "AMD" },
+		{ CPUID_GENERIC, "generic" },
+		{ CPUID_MMX, "MMX" },
+		{ CPUID_CMOV, "CMOV" },
+		{ CPUID_SSE, "SSE" },
+		{ CPUID_SSE2, "SSE2" },
+		{ CPUID_SSE3, "SSE3" },
+		{ CPUID_SSE41, "SSE4.1" },
+		{ CPUID_AVX, "AVX" },
+		{ CPUID_AVX2, "AVX2" },
+		{ CPUID_FMA3, "FMA3" },
+		{ CPUID_HTT, "HTT" },
+		{ CPUID_FTZ, "FTZ" },
+		{ CPUID_DAZ, "DAZ" },
+	};
+
+	int length = 0;
+	string[0] = 0;
+	for( const auto& name : names ) {
+		if( ( cpuid & name.flag ) && length < size ) {
+			length += snprintf( string + length, size - length, "%s%s", length ? " " : "", name.name );
+		}
+	}
+}
+
 /*
 ================
 idSIMD::Init
@@ -56,22 +257,24 @@ void idSIMD::Init()
 /*
 ============
 idSIMD::InitProcessor
+
+Can be called again to switch between the generic and the detected processor
 ============
 */
 void idSIMD::InitProcessor( const char* module, bool forceGeneric )
 {
 	idSIMDProcessor* newProcessor;
 
-	cpuid_t cpuid = CPUID_GENERIC; //idLib::sys->GetProcessorId();
+	cpuid_t cpuid = GetProcessorId();
 
 	if( forceGeneric ){
 		newProcessor = generic;
 	} else {
 		if( processor == nullptr ){
-#if defined(USE_INTRINSICS_SSE)
-			if( ( cpuid & CPUID_MMX ) && ( cpuid & CPUID_SSE ) )
+#if defined(ID_SIMD_SSE)
+			if( ( cpuid & CPUID_SSE ) && ( cpuid & CPUID_SSE2 ) )
 			{
-				processor = new( TAG_MATH ) idSIMD_SSE;
+				processor = new idSIMD_SSE;
 			}
 			else
 #endif
@@ -84,23 +287,36 @@ void idSIMD::InitProcessor( const char* module, bool forceGeneric )
 		newProcessor = processor;
 	}
 
-	if( newProcessor != SIMDProcessor )
-	{
-		SIMDProcessor = newProcessor;
-//		idLib::common->Printf( "%s using %s for SIMD processing\n", module, SIMDProcessor->GetName() );
-	}
+	SIMDProcessor = newProcessor;
+
+	InitThread();
+}
+
+/*
+============
+idSIMD::InitThread
 
+Sets up the floating point state of the calling thread, which InitProcessor
+does for the thread it runs on; other threads that do game math call it first
+============
+*/
+void idSIMD::InitThread()
+{
+#ifdef SIMD_X86
+	cpuid_t cpuid = GetProcessorId();
+
+	// denormal floats are very slow on x86 and far too small to matter
+	// to the game, so flush them to zero on this thread
 	if( cpuid & CPUID_FTZ )
 	{
-//		idLib::sys->FPU_SetFTZ( true );
-//		idLib::common->Printf( "enabled Flush-To-Zero mode\n" );
+		FPU_SetFTZ( true );
 	}
 
 	if( cpuid & CPUID_DAZ )
 	{
-//		idLib::sys->FPU_SetDAZ( true );
-//		idLib::common->Printf( "enabled Denormals-Are-Zero mode\n" );
+		FPU_SetDAZ( true );
 	}
+#endif
 }
 
 void idSIMD::Shutdown()
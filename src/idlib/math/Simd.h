@@ -39,13 +39,27 @@ If you have questions concerning this license or the applicable additional terms
 ===============================================================================
 */
 
+// the SSE processor is built wherever SSE2 can be assumed, which is every x86-64 target;
+// USE_INTRINSICS_SSE, for the SSE paths in idMath, is a separate switch
+#if !defined( ID_SIMD_SSE ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+	#define ID_SIMD_SSE
+#endif
+
+enum cpuid_t : int;
+
 class idSIMD
 {
 public:
 	static void			Init();
 	static void			InitProcessor( const char* module, bool forceGeneric );
+	static void			InitThread();
 	static void			Shutdown();
 	static void			Test_f( const class idCmdArgs& args );
+
+	// what the CPU running us supports, from the cpuid instruction
+	static cpuid_t		GetProcessorId();
+	// the CPUID_ flags set in cpuid as a space separated list
+	static void			GetProcessorString( cpuid_t cpuid, char* string, int size );
 };
 
 
@@ -83,7 +97,7 @@ class idPlane;
 //class idJointMat;
 //struct dominantTri_t;
 
-enum cpuid_t
+enum cpuid_t : int
 {
 	CPUID_NONE							= 0x00000,
 	CPUID_UNSUPPORTED					= 0x00001,	// unsupported (386/486)
@@ -101,7 +115,11 @@ enum cpuid_t
 	CPUID_FTZ							= 0x04000,	// Flush-To-Zero mode (denormal results are flushed to zero)
 	CPUID_DAZ							= 0x08000,	// Denormals-Are-Zero mode (denormal source operands are set to zero)
 	CPUID_XENON							= 0x10000,	// Xbox 360
-	CPUID_CELL							= 0x20000	// PS3
+	CPUID_CELL							= 0x20000,	// PS3
+	CPUID_SSE41							= 0x40000,	// Streaming SIMD Extensions 4.1
+	CPUID_AVX							= 0x80000,	// Advanced Vector Extensions, and the OS saves the ymm registers
+	CPUID_AVX2							= 0x100000,	// Advanced Vector Extensions 2
+	CPUID_FMA3							= 0x200000	// Fused Multiply Add with three operands
 };
 
 class idSIMDProcessor
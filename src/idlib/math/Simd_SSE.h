@@ -38,19 +38,16 @@ If you have questions concerning this license or the applicable additional terms
 ===============================================================================
 */
 
-#if defined(USE_INTRINSICS_SSE)
+#if defined(ID_SIMD_SSE)
 
 class idSIMD_SSE : public idSIMD_Generic
 {
 public:
 	virtual const char* VPCALL GetName() const;
 
-	virtual void VPCALL BlendJoints( idJointQuat* joints, const idJointQuat* blendJoints, const float lerp, const int* index, const int numJoints );
-	virtual void VPCALL BlendJointsFast( idJointQuat* joints, const idJointQuat* blendJoints, const float lerp, const int* index, const int numJoints );
-	virtual void VPCALL ConvertJointQuatsToJointMats( idJointMat* jointMats, const idJointQuat* jointQuats, const int numJoints );
-	virtual void VPCALL ConvertJointMatsToJointQuats( idJointQuat* jointQuats, const idJointMat* jointMats, const int numJoints );
-	virtual void VPCALL TransformJoints( idJointMat* jointMats, const int* parents, const int firstJoint, const int lastJoint );
-	virtual void VPCALL UntransformJoints( idJointMat* jointMats, const int* parents, const int firstJoint, const int lastJoint );
+	virtual void VPCALL MinMax( float& min,			float& max,				const float* src,		const int count );
+	virtual	void VPCALL MinMax( idVec2& min,		idVec2& max,			const idVec2* src,		const int count );
+	virtual void VPCALL MinMax( idVec3& min,		idVec3& max,			const idVec3* src,		const int count );
 };
 
 #endif
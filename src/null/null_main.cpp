@@ -0,0 +1,249 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// null_main.cpp -- main and the Sys_* layer for the dedicated server, with a
+// tty console on stdin/stdout and no SDL
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../game/q_shared.h"
+#include "../qcommon/qcommon.h"
+
+static char consoleLine[MAX_STRING_CHARS];
+static int consoleLineLength;
+static bool stdinActive;
+
+/*
+=================
+Sys_DefaultInstallPath
+=================
+*/
+char *Sys_DefaultInstallPath( void )
+{
+	return Sys_Cwd();
+}
+
+/*
+=================
+Sys_ConsoleInput
+
+Returns a complete line typed at the tty, or nullptr if there isn't one yet
+=================
+*/
+char *Sys_ConsoleInput( void )
+{
+	static char text[MAX_STRING_CHARS];
+
+	while ( stdinActive ) {
+		char c;
+		ssize_t len = read( STDIN_FILENO, &c, 1 );
+		if ( len == 0 ) {
+			// stdin was closed, don't spin on it
+			stdinActive = false;
+			break;
+		}
+		if ( len < 0 ) {
+			if ( errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR ) {
+				stdinActive = false;
+			}
+			break;
+		}
+
+		if ( c == '\n' ) {
+			consoleLine[consoleLineLength] = 0;
+			Q_strncpyz( text, consoleLine, sizeof( text ) );
+			consoleLineLength = 0;
+			return text;
+		}
+		if ( c != '\r' && consoleLineLength < (int)sizeof( consoleLine ) - 1 ) {
+			consoleLine[consoleLineLength++] = c;
+		}
+	}
+
+	return nullptr;
+}
+
+/*
+==================
+Sys_GetClipboardData
+==================
+*/
+char *Sys_GetClipboardData( void )
+{
+	return nullptr;
+}
+
+/*
+=================
+Sys_Exit
+
+Single exit point (regular exit or in case of error)
+=================
+*/
+[[noreturn]] static void Sys_Exit( int exitCode )
+{
+	if ( stdinActive ) {
+		fcntl( STDIN_FILENO, F_SETFL, fcntl( STDIN_FILENO, F_GETFL, 0 ) & ~O_NONBLOCK );
+	}
+	exit( exitCode );
+}
+
+/*
+=================
+Sys_Quit
+=================
+*/
+void Sys_Quit( void )
+{
+	Sys_Exit( 0 );
+}
+
+/*
+=================
+Sys_Init
+=================
+*/
+void Sys_Init( void )
+{
+	Cvar_Set( "username", Sys_GetCurrentUser() );
+}
+
+/*
+=================
+Sys_Print
+=================
+*/
+void Sys_Print( const char *msg )
+{
+	fputs( msg, stdout );
+	fflush( stdout );
+}
+
+/*
+=================
+Sys_Error
+=================
+*/
+[[noreturn]]
+void Sys_Error( const char *error, ... )
+{
+	va_list argptr;
+	char    string[1024];
+
+	va_start( argptr, error );
+	vsnprintf( string, sizeof( string ), error, argptr );
+	va_end( argptr );
+
+	fprintf( stderr, "Sys_Error: %s\n", string );
+	Sys_Exit( 3 );
+}
+
+/*
+=================
+Sys_SigHandler
+=================
+*/
+static void Sys_SigHandler( int signal )
+{
+	static bool signalcaught = false;
+
+	if ( signalcaught ) {
+		fprintf( stderr, "DOUBLE SIGNAL FAULT: Received signal %d, exiting...\n", signal );
+	} else {
+		signalcaught = true;
+		SV_Shutdown( va( "Received signal %d", signal ) );
+	}
+
+	if ( signal == SIGTERM || signal == SIGINT ) {
+		Sys_Exit( 1 );
+	} else {
+		Sys_Exit( 2 );
+	}
+}
+
+/*
+=================
+main
+
+With fixedtime set every Com_Frame advances the server by exactly that many
+msec and frames run back to back, otherwise frames follow the wall clock and
+the loop sleeps between them.
+=================
+*/
+int main( int argc, char **argv )
+{
+	char commandLine[MAX_STRING_CHARS] = { 0 };
+
+	if ( argc == 2 && ( !strcmp( argv[1], "--version" ) || !strcmp( argv[1], "-v" ) ) ) {
+		fprintf( stdout, Q3_VERSION " dedicated server\n" );
+		return 0;
+	}
+
+	// Set the initial time base
+	Sys_Milliseconds();
+
+	// Concatenate the command line for passing to Com_Init
+	for ( int i = 1; i < argc; i++ ) {
+		const bool containsSpaces = strchr( argv[i], ' ' ) != nullptr;
+		if ( containsSpaces ) {
+			Q_strcat( commandLine, sizeof( commandLine ), "\"" );
+		}
+		Q_strcat( commandLine, sizeof( commandLine ), argv[i] );
+		if ( containsSpaces ) {
+			Q_strcat( commandLine, sizeof( commandLine ), "\"" );
+		}
+		Q_strcat( commandLine, sizeof( commandLine ), " " );
+	}
+
+	// commands typed at the tty are polled between frames, a closed
+	// stdin (soak runs started with </dev/null) turns this off
+	stdinActive = true;
+	fcntl( STDIN_FILENO, F_SETFL, fcntl( STDIN_FILENO, F_GETFL, 0 ) | O_NONBLOCK );
+
+	Com_Init( commandLine );
+
+	signal( SIGTERM, Sys_SigHandler );
+	signal( SIGINT, Sys_SigHandler );
+
+	while ( 1 ) {
+		const char *line = Sys_ConsoleInput();
+		if ( line ) {
+			Cbuf_AddText( line );
+			Cbuf_AddText( "\n" );
+		}
+
+		Com_Frame();
+
+		if ( !com_fixedtime->integer ) {
+			usleep( 1000 );
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 )
+#define BOXFILTER_SSE
+#include <xmmintrin.h>
+#endif
+
+/**
+ * @brief Packed bounds of lists of boxes, for skipping the ones a swept box can't touch.
+ *
+ * Boxes are added list after list, each list starting on a group of four.
+ * The bounds are kept as one array per coordinate and the last group of a
+ * list is padded with empty boxes, so a query tests four boxes at a time.
+ * forEach() visits the boxes of one list that a sweep may touch in the order
+ * they were added, which lets a caller that stops at the first hit, or
+ * breaks ties by order, get the same result as when it visited them all.
+ *
+ * A sweep is a segment grown by extents on every side. A box is skipped when
+ * the grown segment misses it: either their bounds don't overlap or, along
+ * the segment, the slabs of the box on the three axes are never crossed at
+ * the same time. An axis the segment hardly moves along is left to the bounds
+ * test, so the test never skips a box the grown segment touches.
+ */
+class BoxFilter
+{
+public:
+    struct Sweep {
+        float start[3];
+        float invDir[3];
+        bool moving[3];                         // false when the slab test leaves the axis to the bounds
+        float mins[3];                          // bounds of the segment, grown by the extents
+        float maxs[3];
+        float extents[3];
+    };
+
+    static Sweep sweep(const float start[3], const float end[3], const float extents[3]) {
+        Sweep s;
+        for (int i = 0; i < 3; i++) {
+            const float dir = end[i] - start[i];
+            s.start[i] = start[i];
+            s.moving[i] = std::fabs(dir) > 1e-6f;
+            s.invDir[i] = s.moving[i] ? 1.0f / dir : 0.0f;
+            s.mins[i] = (start[i] < end[i] ? start[i] : end[i]) - extents[i];
+            s.maxs[i] = (start[i] < end[i] ? end[i] : start[i]) + extents[i];
+            s.extents[i] = extents[i];
+        }
+        return s;
+    }
+
+    void clear() {
+        for (int i = 0; i < 3; i++) {
+            mins[i].clear();
+            maxs[i].clear();
+        }
+        used = 0;
+    }
+
+    // starts a new list, returns the index of its first box
+    int beginList() {
+        used = (int)mins[0].size();
+        return used;
+    }
+
+    void add(const float boxMins[3], const float boxMaxs[3]) {
+        if (used == (int)mins[0].size()) {
+            for (int i = 0; i < 3; i++) {
+                mins[i].resize(used + 4, EMPTY);
+                maxs[i].resize(used + 4, -EMPTY);
+            }
+        }
+        for (int i = 0; i < 3; i++) {
+            mins[i][used] = boxMins[i];
+            maxs[i][used] = boxMaxs[i];
+        }
+        used++;
+    }
+
+    // a box no sweep touches, to keep a list lined up with what it stands for
+    void addEmpty() {
+        const float emptyMins[3] = { EMPTY, EMPTY, EMPTY };
+        const float emptyMaxs[3] = { -EMPTY, -EMPTY, -EMPTY };
+        add(emptyMins, emptyMaxs);
+    }
+
+    int size() const {
+        return used;
+    }
+
+    bool touches(const Sweep& s, int box) const {
+        float enter = 0.0f;
+        float leave = 1.0f;
+        for (int i = 0; i < 3; i++) {
+            const float lo = mins[i][box] - s.extents[i];
+            const float hi = maxs[i][box] + s.extents[i];
+            if (lo > s.maxs[i] || hi < s.mins[i]) {
+                return false;
+            }
+            if (s.moving[i]) {
+                const float t0 = (lo - s.start[i]) * s.invDir[i];
+                const float t1 = (hi - s.start[i]) * s.invDir[i];
+                enter = std::fmax(enter, std::fmin(t0, t1));
+                leave = std::fmin(leave, std::fmax(t0, t1));
+            }
+        }
+        return enter <= leave;
+    }
+
+    // calls visit(k) in order for every box k of the list starting at first the
+    // sweep may touch, k counting from 0, until visit returns false
+    template <typename Visit>
+    void forEach(const Sweep& s, int first, int count, Visit visit) const {
+        for (int group = 0; group < count; group += 4) {
+            unsigned mask = touches4(s, first + group);
+            if (count - group < 4) {
+                mask &= (1u << (count - group)) - 1;
+            }
+            for (int k = group; mask; k++, mask >>= 1) {
+                if ((mask & 1) && !visit(k)) {
+                    return;
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr float EMPTY = 1e30f;
+
+    // a bit for each of the four boxes from box on, which must start a group
+    unsigned touches4(const Sweep& s, int box) const {
+#ifdef BOXFILTER_SSE
+        __m128 enter = _mm_setzero_ps();
+        __m128 leave = _mm_set1_ps(1.0f);
+        __m128 overlap = _mm_cmpeq_ps(enter, enter);
+        for (int i = 0; i < 3; i++) {
+            const __m128 extents = _mm_set1_ps(s.extents[i]);
+            const __m128 lo = _mm_sub_ps(_mm_loadu_ps(&mins[i][box]), extents);
+            const __m128 hi = _mm_add_ps(_mm_loadu_ps(&maxs[i][box]), extents);
+            overlap = _mm_and_ps(overlap, _mm_cmple_ps(lo, _mm_set1_ps(s.maxs[i])));
+            overlap = _mm_and_ps(overlap, _mm_cmpge_ps(hi, _mm_set1_ps(s.mins[i])));
+            if (s.moving[i]) {
+                const __m128 start = _mm_set1_ps(s.start[i]);
+                const __m128 invDir = _mm_set1_ps(s.invDir[i]);
+                const __m128 t0 = _mm_mul_ps(_mm_sub_ps(lo, start), invDir);
+                const __m128 t1 = _mm_mul_ps(_mm_sub_ps(hi, start), invDir);
+                enter = _mm_max_ps(enter, _mm_min_ps(t0, t1));
+                leave = _mm_min_ps(leave, _mm_max_ps(t0, t1));
+            }
+        }
+        return (unsigned)_mm_movemask_ps(_mm_and_ps(overlap, _mm_cmple_ps(enter, leave)));
+#else
+        unsigned mask = 0;
+        for (int k = 0; k < 4; k++) {
+            if (touches(s, box + k)) {
+                mask |= 1u << k;
+            }
+        }
+        return mask;
+#endif
+    }
+
+    std::vector<float> mins[3];
+    std::vector<float> maxs[3];
+    int used = 0;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Which brushes and patches the current trace has already tested.
+ *
+ * A brush or patch that's in several leaves is only tested the first time a
+ * trace reaches it. Each trace or box query starts with begin(), which makes
+ * every earlier mark stale, so the marks only need clearing when the map
+ * changes or the counter wraps.
+ *
+ * The clip model keeps one of these per thread rather than a stamp on each
+ * brush and patch, so jobs can trace at the same time as the main thread.
+ */
+class ClipChecks
+{
+public:
+    // sizes the marks for a map and forgets them
+    void reset(int numBrushes, int numPatches) {
+        brushes.assign(numBrushes, 0);
+        patches.assign(numPatches, 0);
+        count = 0;
+    }
+
+    void begin() {
+        if (++count == 0) {
+            std::fill(brushes.begin(), brushes.end(), 0);
+            std::fill(patches.begin(), patches.end(), 0);
+            count = 1;
+        }
+    }
+
+    // true the first time a brush is marked since begin()
+    bool markBrush(int brushnum) {
+        if (brushes[brushnum] == count) {
+            return false;
+        }
+        brushes[brushnum] = count;
+        return true;
+    }
+
+    // patches are marked by surface number
+    bool markPatch(int surfaceNum) {
+        if (patches[surfaceNum] == count) {
+            return false;
+        }
+        patches[surfaceNum] = count;
+        return true;
+    }
+
+private:
+    std::vector<unsigned> brushes;
+    std::vector<unsigned> patches;
+    unsigned count = 0;
+};
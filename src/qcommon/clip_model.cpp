@@ -4,6 +4,60 @@
 
 ClipModel TheClipModel::clipModel;
 
+// to allow boxes to be treated as brush models, each thread builds a box hull
+// of its own, which tempBoxModel moves to the box it is given
+#define BOX_SIDES       6
+#define BOX_PLANES      12
+
+struct ClipBoxHull
+{
+	ClipBoxHull();
+
+	cModel_t model;
+	cplane_t planes[BOX_PLANES];
+	cBrushSide_t sides[BOX_SIDES];
+	cBrush_t brush;
+};
+
+ClipBoxHull::ClipBoxHull()
+{
+	model.leaf = {};
+	model.leaf.firstBrushBox = -1;
+	model.leaf.firstPatchBox = -1;
+
+	// create the planes for the axial box
+	for ( int i = 0 ; i < 6 ; i++ ) {
+		cplane_t* p = &planes[i * 2];
+		p->type = i >> 1;
+		p->signbits = 0;
+		VectorClear( p->normal );
+		p->normal[i >> 1] = 1;
+
+		p = &planes[i * 2 + 1];
+		p->type = 3 + ( i >> 1 );
+		p->signbits = 0;
+		VectorClear( p->normal );
+		p->normal[i >> 1] = -1;
+
+		SetPlaneSignbits( p );
+	}
+
+	// create the single brush that is the box
+	brush.sides = sides;
+	brush.numsides = BOX_SIDES;
+	brush.shaderNum = 0; // default shader
+	brush.contents = CONTENTS_BODY;
+
+	for ( int i = 0 ; i < BOX_SIDES ; i++ ) {
+		int side = i & 1;
+		sides[i].plane = &planes[i*2 + side];
+		sides[i].shaderNum = 0; // default shader
+		sides[i].surfaceFlags = 0;
+	}
+}
+
+static thread_local ClipBoxHull boxHull;
+
 int ClipModel::leafArea(int leafnum)
 {
 	if ( leafnum < 0 || leafnum >= numLeaves ) {
@@ -44,7 +98,7 @@ cModel_t *ClipModel::clipHandleToModel(clipHandle_t handle)
 		return &cmodels[handle];
 	}
 	if ( handle == BOX_MODEL_HANDLE || handle == CAPSULE_MODEL_HANDLE ) {
-		return &box_model;
+		return &boxHull.model;
 	}
 	if ( handle < MAX_SUBMODELS ) {
 		Com_Error( ERR_DROP, "CM_ClipHandleToModel: bad handle %i < %i < %i",
@@ -96,14 +150,34 @@ void ClipModel::loadMap(const char *name)
 	// we are NOT freeing the file, because it is cached for the ref
 	FS_FreeFile( buf );
 
-	initBoxHull();
+	for ( int i = 0 ; i < numLeaves ; i++ ) {
+		buildLeafBoxes( &leaves[i] );
+	}
+	for ( int i = 0 ; i < numSubModels ; i++ ) {
+		buildLeafBoxes( &cmodels[i].leaf );
+	}
 
 	floodAreaConnections();
+
+	generation++;
+}
+
+ClipChecks& ClipModel::beginChecks()
+{
+	thread_local ClipChecks checks;
+	thread_local int checksGeneration = -1;
+
+	if ( checksGeneration != generation ) {
+		checks.reset( numBrushes, numSurfaces );
+		checksGeneration = generation;
+	}
+	checks.begin();
+	return checks;
 }
 
 ClipModel::ClipModel()
 {
-	checkcount = 0;
+	generation = 0;
 	floodvalid = 0;
 
 	shaders = nullptr;
@@ -156,7 +230,7 @@ ClipModel::~ClipModel()
 
 void ClipModel::clearMap()
 {
-	checkcount = 0;
+	generation++;
 	floodvalid = 0;
 
 	delete[] shaders;
@@ -217,6 +291,9 @@ void ClipModel::clearMap()
 	numSurfaces = 0;
 	delete[] surfaces;
 	surfaces = nullptr;
+
+	brushBoxes.clear();
+	patchBoxes.clear();
 }
 
 void ClipModel::loadShaders(const lump_t* l, const uint8_t* offsetBase)
@@ -235,14 +312,6 @@ void ClipModel::loadShaders(const lump_t* l, const uint8_t* offsetBase)
 	memcpy( shaders, in, count * sizeof( *shaders ) );
 }
 
-// to allow boxes to be treated as brush models, we allocate
-// some extra indexes along with those needed by the map
-#define BOX_BRUSHES     1
-#define BOX_LEAF_BRUSHES 1
-#define BOX_SIDES       6
-#define BOX_LEAFS       2
-#define BOX_PLANES      12
-
 void ClipModel::loadLeaves(const lump_t* l, const uint8_t* offsetBase)
 {
 	const dleaf_t* in = ( const dleaf_t * )( offsetBase + l->fileofs );
@@ -255,7 +324,7 @@ void ClipModel::loadLeaves(const lump_t* l, const uint8_t* offsetBase)
 		Com_Error( ERR_DROP, "Map with no leaves" );
 	}
 
-	leaves = new cLeaf_t[BOX_LEAFS + count];
+	leaves = new cLeaf_t[count];
 	numLeaves = count;
 
 	for (int i = 0 ; i < count ; i++, in++) {
@@ -290,7 +359,7 @@ void ClipModel::loadLeafBrushes(const lump_t* l, const uint8_t* offsetBase)
 	}
 	int count = l->filelen / sizeof( int );
 
-	leafBrushes = new int[BOX_LEAF_BRUSHES + count];
+	leafBrushes = new int[count];
 	numLeafBrushes = count;
 
 	memcpy( leafBrushes, in, count * sizeof( int ) );
@@ -323,7 +392,7 @@ void ClipModel::loadPlanes(const lump_t* l, const uint8_t* offsetBase)
 		Com_Error( ERR_DROP, "Map with no planes" );
 	}
 
-	planes = new cplane_t[BOX_PLANES + count];
+	planes = new cplane_t[count];
 	numPlanes = count;
 
 	cplane_t* out = planes;
@@ -351,7 +420,7 @@ void ClipModel::loadBrushSides(const lump_t* l, const uint8_t* offsetBase)
 	}
 	int count = l->filelen / sizeof( *in );
 
-	brushsides = new cBrushSide_t[BOX_SIDES + count];
+	brushsides = new cBrushSide_t[count];
 	numBrushSides = count;
 
 	cBrushSide_t* out = brushsides;
@@ -375,7 +444,7 @@ void ClipModel::loadBrushes(const lump_t* l, const uint8_t* offsetBase)
 	}
 	int count = l->filelen / sizeof( *in );
 
-	brushes = new cBrush_t[BOX_BRUSHES + count];
+	brushes = new cBrush_t[count];
 	numBrushes = count;
 
 	cBrush_t* out = brushes;
@@ -406,6 +475,35 @@ void ClipModel::boundBrush( cBrush_t *b )
 	b->bounds[1][2] = b->sides[5].plane->dist;
 }
 
+// packed bounds of a leaf's brushes and patches, in the order the leaf lists
+// them, so traces can skip the ones they miss
+void ClipModel::buildLeafBoxes( cLeaf_t *leaf )
+{
+	leaf->firstBrushBox = brushBoxes.beginList();
+	for ( int k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
+		int brushnum = leaf->firstLeafBrush + k;
+		if ( leaf->fromSubmodel == 0 ) {
+			brushnum = leafBrushes[brushnum];
+		}
+		const cBrush_t *b = &brushes[brushnum];
+		brushBoxes.add( b->bounds[0].ToFloatPtr(), b->bounds[1].ToFloatPtr() );
+	}
+
+	leaf->firstPatchBox = patchBoxes.beginList();
+	for ( int k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
+		int surfaceNum = leaf->firstLeafSurface + k;
+		if ( leaf->fromSubmodel == 0 ) {
+			surfaceNum = leafsurfaces[surfaceNum];
+		}
+		const cPatch_t *patch = surfaces[surfaceNum];
+		if ( !patch ) {
+			patchBoxes.addEmpty();
+			continue;
+		}
+		patchBoxes.add( patch->pc->bounds[0].ToFloatPtr(), patch->pc->bounds[1].ToFloatPtr() );
+	}
+}
+
 void ClipModel::loadSubmodels(const lump_t* l, const uint8_t* offsetBase)
 {
 	dmodel_t    *in = ( dmodel_t * )( offsetBase + l->fileofs );
@@ -542,53 +640,12 @@ void ClipModel::loadPatches(const lump_t* surfaceLump, const lump_t* drawVertLum
 
 }
 
-void ClipModel::initBoxHull()
-{
-	box_model.leaf.numLeafBrushes = 1;
-	box_model.leaf.firstLeafBrush = numLeafBrushes;
-	leafBrushes[numLeafBrushes] = numBrushes;
-	numLeafBrushes += BOX_LEAF_BRUSHES;
-
-	// create the planes for the axial box
-	box_planes = &planes[numPlanes];
-	for ( int i = 0 ; i < 6 ; i++ ) {
-		cplane_t* p = &box_planes[i * 2];
-		p->type = i >> 1;
-		p->signbits = 0;
-		VectorClear( p->normal );
-		p->normal[i >> 1] = 1;
-
-		p = &box_planes[i * 2 + 1];
-		p->type = 3 + ( i >> 1 );
-		p->signbits = 0;
-		VectorClear( p->normal );
-		p->normal[i >> 1] = -1;
-
-		SetPlaneSignbits( p );
-	}
-
-	numPlanes += BOX_PLANES;
-
-	// create the single brush that is the box
-	box_brush = &brushes[numBrushes];
-	box_brush->sides = &brushsides[numBrushSides];
-	box_brush->numsides = BOX_SIDES;
-	box_brush->shaderNum = 0; // default shader
-	box_brush->contents = CONTENTS_BODY;
-
-	for ( int i = 0 ; i < BOX_SIDES ; i++ ) {
-		int side = i & 1;
-		brushsides[numBrushSides + i].plane = &box_planes[i*2 + side];
-		brushsides[numBrushSides + i].shaderNum = 0; // default shader
-		brushsides[numBrushSides + i].surfaceFlags = 0;
-	}
-
-	numBrushSides += BOX_SIDES;
-	numBrushes += BOX_BRUSHES;
-}
-
 clipHandle_t ClipModel::tempBoxModel( const vec3_t mins, const vec3_t maxs, int capsule )
 {
+	cModel_t& box_model = boxHull.model;
+	cplane_t* box_planes = boxHull.planes;
+	cBrush_t* box_brush = &boxHull.brush;
+
 	VectorCopy( mins, box_model.mins );
 	VectorCopy( maxs, box_model.maxs );
 
@@ -614,6 +671,11 @@ clipHandle_t ClipModel::tempBoxModel( const vec3_t mins, const vec3_t maxs, int
 
 	return BOX_MODEL_HANDLE;
 }
+
+cBrush_t* ClipModel::tempBoxBrush()
+{
+	return &boxHull.brush;
+}
 void ClipModel::floodArea_r( int areaNum, int floodnum )
 {
 	cArea_t * area = &areas[ areaNum ];
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include "../idlib/math/Vector.h"
+#include "box_filter.h"
+#include "clip_checks.h"
 #include "cm_patch.h"
 
 struct lump_t;
@@ -13,7 +15,7 @@ typedef int clipHandle_t;
 #define BOX_MODEL_HANDLE        511
 #define CAPSULE_MODEL_HANDLE    510
 
-// Note this is the file format, so don't change it.
+// Loaded field by field from dleaf_t, which is the file format.
 struct cLeaf_t
 {
 	int cluster;
@@ -27,6 +29,11 @@ struct cLeaf_t
 	
 	// If this leaf is part of a sub-model then don't index via leaf brushed
 	int fromSubmodel;
+
+	// lists of the bounds of the leaf's brushes and patches in ClipModel::brushBoxes
+	// and patchBoxes, or -1 when the brushes aren't fixed (the temp box model)
+	int firstBrushBox;
+	int firstPatchBox;
 };
 
 struct cModel_t
@@ -53,7 +60,6 @@ struct cBrushSide_t
 struct cBrush_t
 {
 	cBrush_t() {
-        checkcount = 0;
         shaderNum = 0;
         contents = 0;
         numsides = 0;
@@ -65,7 +71,6 @@ struct cBrush_t
 	idVec3 bounds[2];
 	int numsides;
 	cBrushSide_t    *sides;
-	int checkcount;  // to avoid repeated testings
 };
 
 struct cNode_t
@@ -77,13 +82,11 @@ struct cNode_t
 struct cPatch_t
 {
     cPatch_t() {
-        checkcount = 0;
         surfaceFlags = 0;
         contents = 0;
         pc = nullptr;
     }
 
-	int checkcount;                     // to avoid repeated testings
 	int surfaceFlags;
 	int contents;
 	patchCollide_t   *pc;
@@ -105,20 +108,23 @@ public:
 
     cModel_t* clipHandleToModel(clipHandle_t handle);
 
-    int checkcount;
+    // the calling thread's marks, sized for this map and started on a new trace
+    ClipChecks& beginChecks();
 
     /*
         To keep everything totally uniform, bounding boxes are turned into small
         BSP trees instead of being compared directly.
         Capsules are handled differently though.
+        Each thread has its own box, so the handle only means something to the
+        thread that made it.
     */
     clipHandle_t tempBoxModel( const float mins[3], const float maxs[3], int capsule );
 
-    // used by the temp box model
+    // the single brush of the calling thread's temp box model
+    cBrush_t* tempBoxBrush();
+
 private:
-    cModel_t    box_model;
-    cplane_t    *box_planes;
-    cBrush_t    *box_brush;
+    int generation;     // changes with the map, so each thread resizes its marks
 
 private:
     void loadShaders(const lump_t* l, const uint8_t* offsetBase);
@@ -135,7 +141,7 @@ private:
     void loadPatches(const lump_t* surfaceLump, const lump_t* drawVertLump, const uint8_t* offsetBase);
 
     void boundBrush( cBrush_t *b );
-    void initBoxHull();
+    void buildLeafBoxes( cLeaf_t *leaf );
     void floodAreaConnections();
     void floodArea_r( int areaNum, int floodnum );
 
@@ -186,6 +192,9 @@ public:
 
     int numSurfaces;
     cPatch_t** surfaces;
+
+    BoxFilter brushBoxes;
+    BoxFilter patchBoxes;
 };
 
 class TheClipModel
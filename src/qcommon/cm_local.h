@@ -31,6 +31,8 @@ If you have questions concerning this license or the applicable additional terms
 #include "qcommon.h"
 #include "cm_polylib.h"
 #include "cm_patch.h"
+#include "box_filter.h"
+#include "clip_checks.h"
 
 
 
@@ -136,6 +138,8 @@ typedef struct {
 	bool isPoint;       // optimized case
 	trace_t trace;          // returned from trace call
 	sphere_t sphere;        // sphere for oriendted capsule collision
+	BoxFilter::Sweep sweep; // the trace grown by the clip epsilon, to skip brushes and patches it misses
+	ClipChecks *checks;     // the brushes and patches already tested, by this thread
 } traceWork_t;
 
 typedef struct leafList_s {
@@ -145,6 +149,7 @@ typedef struct leafList_s {
 	int     *list;
 	vec3_t bounds[2];
 	int lastLeaf;           // for overflows where each leaf can't be stored individually
+	ClipChecks *checks;     // for CM_StoreBrushes
 	void ( *storeLeafs )( struct leafList_s *ll, int nodenum );
 } leafList_t;
 
@@ -48,8 +48,6 @@ int c_totalPatchBlocks;
 int c_totalPatchSurfaces;
 int c_totalPatchEdges;
 
-static const patchCollide_t *debugPatchCollide;
-static const facet_t        *debugFacet;
 static bool debugBlock;
 static idVec3 debugBlockPoints[4];
 
@@ -60,8 +58,6 @@ CM_ClearLevelPatches
 */
 void CM_ClearLevelPatches(  )
 {
-	debugPatchCollide = nullptr;
-	debugFacet = nullptr;
 }
 
 /*
@@ -1164,9 +1160,6 @@ void CM_TracePointThroughPatchCollide( traceWork_t *tw, const patchCollide_t *pc
 	int i, j, k;
 	float offset;
 	float d1, d2;
-#ifndef BSPC
-	static cvar_t *cv;
-#endif //BSPC
 
 #ifndef BSPC
 	if ( !tw->isPoint ) {
@@ -1223,15 +1216,6 @@ void CM_TracePointThroughPatchCollide( traceWork_t *tw, const patchCollide_t *pc
 		}
 		if ( j == facet->numBorders ) {
 			// we hit this facet
-#ifndef BSPC
-			if ( !cv ) {
-				cv = Cvar_Get( "r_debugSurfaceUpdate", "1", 0 );
-			}
-			if ( cv->integer ) {
-				debugPatchCollide = pc;
-				debugFacet = facet;
-			}
-#endif //BSPC
 			planes = &pc->planes[facet->surfacePlane];
 
 			// calculate intersection with a slight pushoff
@@ -1308,9 +1292,6 @@ void CM_TraceThroughPatchCollide( traceWork_t *tw, const patchCollide_t *pc ) {
 	facet_t *facet;
 	float plane[4], bestplane[4];
 	vec3_t startp, endp;
-#ifndef BSPC
-	static cvar_t *cv;
-#endif //BSPC
 
 	if ( tw->isPoint ) {
 		CM_TracePointThroughPatchCollide( tw, pc );
@@ -1404,15 +1385,6 @@ void CM_TraceThroughPatchCollide( traceWork_t *tw, const patchCollide_t *pc ) {
 				if ( enterFrac < 0 ) {
 					enterFrac = 0;
 				}
-#ifndef BSPC
-				if ( !cv ) {
-					cv = Cvar_Get( "r_debugSurfaceUpdate", "1", 0 );
-				}
-				if ( cv && cv->integer ) {
-					debugPatchCollide = pc;
-					debugFacet = facet;
-				}
-#endif //BSPC
 
 				tw->trace.fraction = enterFrac;
 				VectorCopy( bestplane, tw->trace.plane.normal );
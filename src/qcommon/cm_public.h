@@ -57,6 +57,7 @@ int         CM_BoxLeafnums( const vec3_t mins, const vec3_t maxs, int *list,
 
 void        CM_AdjustAreaPortalState( int area1, int area2, bool open );
 bool    CM_AreasConnected( int area1, int area2 );
+int         CM_AreaPortalGeneration( void );   // changes when any portal opens or closes
 
 int         CM_WriteAreaBits( uint8_t *buffer, int area );
 
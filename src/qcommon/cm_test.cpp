@@ -103,11 +103,10 @@ void CM_StoreBrushes( leafList_t *ll, int nodenum )
 		if (leaf->fromSubmodel == 0){
 			brushnum = cm.leafBrushes[brushnum];
 		}
-		cBrush_t *b = &cm.brushes[brushnum];
-		if ( b->checkcount == cm.checkcount ) {
+		if ( !ll->checks->markBrush( brushnum ) ) {
 			continue;   // already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		cBrush_t *b = &cm.brushes[brushnum];
 		int i;
 		for ( i = 0 ; i < 3 ; i++ ) {
 			if ( b->bounds[0][i] >= ll->bounds[1][i] || b->bounds[1][i] <= ll->bounds[0][i] ) {
@@ -165,14 +164,13 @@ CM_BoxLeafnums
 */
 int CM_BoxLeafnums( const vec3_t mins, const vec3_t maxs, int *list, int listsize, int *lastLeaf ) {
 	leafList_t ll;
-	ClipModel& cm = TheClipModel::get();
-	cm.checkcount++;
 
 	VectorCopy( mins, ll.bounds[0] );
 	VectorCopy( maxs, ll.bounds[1] );
 	ll.count = 0;
 	ll.maxcount = listsize;
 	ll.list = list;
+	ll.checks = nullptr;
 	ll.storeLeafs = CM_StoreLeafs;
 	ll.lastLeaf = 0;
 	ll.overflowed = false;
@@ -191,14 +189,12 @@ CM_BoxBrushes
 int CM_BoxBrushes( const vec3_t mins, const vec3_t maxs, cBrush_t **list, int listsize ) {
 	leafList_t ll;
 
-	ClipModel& cm = TheClipModel::get();
-	cm.checkcount++;
-
 	VectorCopy( mins, ll.bounds[0] );
 	VectorCopy( maxs, ll.bounds[1] );
 	ll.count = 0;
 	ll.maxcount = listsize;
 	ll.list = (int *)list;
+	ll.checks = &TheClipModel::get().beginChecks();
 	ll.storeLeafs = CM_StoreBrushes;
 	ll.lastLeaf = 0;
 	ll.overflowed = false;
@@ -233,6 +229,18 @@ int CM_PointContents( const vec3_t p, clipHandle_t model ) {
 		return 0;
 	}
 
+	if ( model == BOX_MODEL_HANDLE || model == CAPSULE_MODEL_HANDLE ) {
+		// the temp box isn't in the map's brush lists
+		b = cm.tempBoxBrush();
+		for ( i = 0 ; i < b->numsides ; i++ ) {
+			d = DotProduct( p, b->sides[i].plane->normal );
+			if ( d > b->sides[i].plane->dist ) {
+				return 0;
+			}
+		}
+		return b->contents;
+	}
+
 	if ( model ) {
 		clipm = cm.clipHandleToModel( model );
 		leaf = &clipm->leaf;
@@ -410,6 +418,16 @@ void    CM_AdjustAreaPortalState( int area1, int area2, bool open ) {
 	CM_FloodAreaConnections();
 }
 
+/*
+====================
+CM_AreaPortalGeneration
+
+====================
+*/
+int     CM_AreaPortalGeneration( void ) {
+	return TheClipModel::get().floodvalid;
+}
+
 /*
 ====================
 CM_AreasConnected
@@ -29,6 +29,7 @@ If you have questions concerning this license or the applicable additional terms
 #include "../idlib/math/Math.h"
 #include "cm_local.h"
 #include "clip_model.h"
+#include "profiler.h"
 
 /*
 ===============================================================================
@@ -249,11 +250,10 @@ void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf )
 		if (leaf->fromSubmodel == 0){
 			brushnum = cm.leafBrushes[brushnum];
 		}
-		cBrush_t* b = &cm.brushes[brushnum];
-		if ( b->checkcount == cm.checkcount ) {
+		if ( !tw->checks->markBrush( brushnum ) ) {
 			continue;   // already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		cBrush_t* b = &cm.brushes[brushnum];
 
 		if ( !( b->contents & tw->contents ) ) {
 			continue;
@@ -275,10 +275,9 @@ void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf )
 		if ( !patch ) {
 			continue;
 		}
-		if ( patch->checkcount == cm.checkcount ) {
+		if ( !tw->checks->markPatch( surfaceNum ) ) {
 			continue;   // already checked this brush in another leaf
 		}
-		patch->checkcount = cm.checkcount;
 
 		if ( !( patch->contents & tw->contents ) ) {
 			continue;
@@ -391,13 +390,10 @@ void CM_PositionTest( traceWork_t *tw )
 	ll.storeLeafs = CM_StoreLeafs;
 	ll.lastLeaf = 0;
 	ll.overflowed = false;
-
-	cm.checkcount++;
+	ll.checks = nullptr;
 
 	CM_BoxLeafnums_r( &ll, 0 );
 
-	cm.checkcount++;
-
 	// test the contents of the leafs
 	for (int i = 0 ; i < ll.count ; i++ ) {
 		CM_TestInLeaf( tw, &cm.leaves[leafs[i]] );
@@ -623,49 +619,68 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf )
 	ClipModel& cm = TheClipModel::get();
 
 	// trace line against all brushes in the leaf
-	for (int k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
+	auto traceBrush = [&]( int k ) {
 		int brushnum = leaf->firstLeafBrush + k;
 		if (leaf->fromSubmodel == 0){
 			brushnum = cm.leafBrushes[brushnum];
 		}
-		cBrush_t*b = &cm.brushes[brushnum];
-		if ( b->checkcount == cm.checkcount ) {
-			continue;   // already checked this brush in another leaf
+		if ( !tw->checks->markBrush( brushnum ) ) {
+			return true;   // already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		cBrush_t*b = &cm.brushes[brushnum];
 
 		if ( !( b->contents & tw->contents ) ) {
-			continue;
+			return true;
 		}
 
 		CM_TraceThroughBrush( tw, b );
-		if ( !tw->trace.fraction ) {
-			return;
+		return tw->trace.fraction != 0;
+	};
+
+	// the brushes whose bounds the trace misses by more than the clip epsilon
+	// would be left as they are, skipping them keeps the order of the others
+	if ( leaf->firstBrushBox >= 0 ) {
+		cm.brushBoxes.forEach( tw->sweep, leaf->firstBrushBox, leaf->numLeafBrushes, traceBrush );
+	} else {
+		for ( int k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
+			if ( !traceBrush( k ) ) {
+				break;
+			}
 		}
 	}
+	if ( !tw->trace.fraction ) {
+		return;
+	}
 
 	// trace line against all patches in the leaf
-	for (int k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
+	auto tracePatch = [&]( int k ) {
 		int surfaceNum =leaf->firstLeafSurface + k;
 		if (leaf->fromSubmodel == 0){
 			surfaceNum = cm.leafsurfaces[surfaceNum];
 		}
 		cPatch_t* patch = cm.surfaces[ surfaceNum ];
 		if ( !patch ) {
-			continue;
+			return true;
 		}
-		if ( patch->checkcount == cm.checkcount ) {
-			continue;   // already checked this patch in another leaf
+		if ( !tw->checks->markPatch( surfaceNum ) ) {
+			return true;   // already checked this patch in another leaf
 		}
-		patch->checkcount = cm.checkcount;
 
 		if ( !( patch->contents & tw->contents ) ) {
-			continue;
+			return true;
 		}
 
 		CM_TraceThroughPatch( tw, patch );
-		if ( !tw->trace.fraction ) {
-			return;
+		return tw->trace.fraction != 0;
+	};
+
+	if ( leaf->firstPatchBox >= 0 ) {
+		cm.patchBoxes.forEach( tw->sweep, leaf->firstPatchBox, leaf->numLeafSurfaces, tracePatch );
+	} else {
+		for ( int k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
+			if ( !tracePatch( k ) ) {
+				break;
+			}
 		}
 	}
 }
@@ -1070,18 +1085,17 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end,
 	vec3_t offset;
 	cModel_t    *cmod;
 
-	
+	PROFILE_ZONE( "CM_Trace" );
 
 	ClipModel& cm = TheClipModel::get();
 
 	// Will longjump on error.
 	cmod = cm.clipHandleToModel( model );
 
-	cm.checkcount++;        // for multi-check avoidance
-
 	// fill in a default trace
 	Com_Memset( &tw, 0, sizeof( tw ) );
 	tw.trace.fraction = 1;  // assume it goes the entire distance until shown otherwise
+	tw.checks = &cm.beginChecks();  // for multi-check avoidance
 	VectorCopy( origin, tw.modelOrigin );
 
 	if ( !cm.numNodes ) {
@@ -1189,7 +1203,11 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end,
 		if ( model ) {
 			if ( model == BOX_MODEL_HANDLE || model == CAPSULE_MODEL_HANDLE ) {
 				tw.sphere.use = false;
-				CM_TestInLeaf( &tw, &cmod->leaf );
+				// the temp box isn't in the map's brush lists, it's this thread's
+				cBrush_t *box = cm.tempBoxBrush();
+				if ( box->contents & tw.contents ) {
+					CM_TestBoxInBrush( &tw, box );
+				}
 			} else
 			{
 				CM_TestInLeaf( &tw, &cmod->leaf );
@@ -1211,13 +1229,28 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end,
 			tw.extents[2] = tw.size[1][2];
 		}
 
+		// grown past what CM_TraceThroughBrush and the patch facets could still clip
+		vec3_t sweepExtents;
+		for ( i = 0 ; i < 3 ; i++ ) {
+			if ( tw.sphere.use ) {
+				sweepExtents[i] = fabs( tw.sphere.offset[i] ) + tw.sphere.radius;
+			} else {
+				sweepExtents[i] = tw.size[1][i];
+			}
+			sweepExtents[i] += SURFACE_CLIP_EPSILON + 1.0f;
+		}
+		tw.sweep = BoxFilter::sweep( tw.start, tw.end, sweepExtents );
+
 		//
 		// general sweeping through world
 		//
 		if ( model ) {
 			if ( model == BOX_MODEL_HANDLE || model == CAPSULE_MODEL_HANDLE ) {
 				tw.sphere.use = false;
-				CM_TraceThroughLeaf( &tw, &cmod->leaf );
+				cBrush_t *box = cm.tempBoxBrush();
+				if ( box->contents & tw.contents ) {
+					CM_TraceThroughBrush( &tw, box );
+				}
 			} else
 			{
 				CM_TraceThroughLeaf( &tw, &cmod->leaf );
@@ -30,19 +30,14 @@ If you have questions concerning this license or the applicable additional terms
 
 #include "../game/q_shared.h"
 #include "qcommon.h"
+#include "command_args.h"
+#include "command_buffer.h"
 
 #define MAX_CMD_BUFFER  16384
 #define MAX_CMD_LINE    1024
 
-typedef struct {
-	uint8_t    *data;
-	int maxsize;
-	int cmdsize;
-} cmd_t;
-
 int cmd_wait;
-cmd_t cmd_text;
-uint8_t cmd_text_buf[MAX_CMD_BUFFER];
+static CommandBuffer<MAX_CMD_BUFFER> cmd_text;
 
 
 //=============================================================================
@@ -79,9 +74,7 @@ Cbuf_Init
 ============
 */
 void Cbuf_Init( void ) {
-	cmd_text.data = cmd_text_buf;
-	cmd_text.maxsize = MAX_CMD_BUFFER;
-	cmd_text.cmdsize = 0;
+	cmd_text.clear();
 }
 
 /*
@@ -94,12 +87,11 @@ Adds command text at the end of the buffer, does NOT add a final \n
 void Cbuf_AddText( const char *text ) {
 	size_t l = strlen( text );
 
-	if ( cmd_text.cmdsize + l >= cmd_text.maxsize ) {
+	if ( cmd_text.size() + l >= MAX_CMD_BUFFER ) {
 		Com_Printf( "Cbuf_AddText: overflow\n" );
 		return;
 	}
-	memcpy( &cmd_text.data[cmd_text.cmdsize], text, l );
-	cmd_text.cmdsize += l;
+	cmd_text.append( text, l );
 }
 
 
@@ -114,23 +106,14 @@ Adds a \n to the text
 void Cbuf_InsertText( const char *text )
 {
 	size_t len = strlen( text ) + 1;
-	if ( len + cmd_text.cmdsize > cmd_text.maxsize ) {
+	if ( len + cmd_text.size() > MAX_CMD_BUFFER ) {
 		Com_Printf( "Cbuf_InsertText overflowed\n" );
 		return;
 	}
 
-	// move the existing command text
-	for (int i = cmd_text.cmdsize - 1 ; i >= 0 ; i-- ) {
-		cmd_text.data[ i + len ] = cmd_text.data[ i ];
-	}
-
-	// copy the new text in
-	memcpy( cmd_text.data, text, len - 1 );
-
-	// add a \n
-	cmd_text.data[ len - 1 ] = '\n';
-
-	cmd_text.cmdsize += len;
+	// the text, then a \n, in front of the existing command text
+	cmd_text.prepend( "\n", 1 );
+	cmd_text.prepend( text, len - 1 );
 }
 
 
@@ -169,7 +152,7 @@ void Cbuf_Execute()
 {
 	char line[MAX_CMD_LINE];
 
-	while ( cmd_text.cmdsize )
+	while ( cmd_text.size() )
 	{
 		if ( cmd_wait ) {
 			// skip out while text still remains in buffer, leaving it
@@ -178,42 +161,9 @@ void Cbuf_Execute()
 			break;
 		}
 
-		// find a \n or ; line break
-		char* text = (char *)cmd_text.data;
-
-		int quotes = 0;
-		int i;
-		for (i = 0 ; i < cmd_text.cmdsize ; i++ )
-		{
-			if ( text[i] == '"' ) {
-				quotes++;
-			}
-			if ( !( quotes & 1 ) &&  text[i] == ';' ) {
-				break;  // don't break if inside a quoted string
-			}
-			if ( text[i] == '\n' || text[i] == '\r' ) {
-				break;
-			}
-		}
-
-		if ( i >= ( MAX_CMD_LINE - 1 ) ) {
-			i = MAX_CMD_LINE - 1;
-		}
-
-		memcpy( line, text, i );
-		line[i] = 0;
-
-// delete the text from the command buffer and move remaining commands down
-// this is necessary because commands (exec) can insert data at the
-// beginning of the text buffer
-
-		if ( i == cmd_text.cmdsize ) {
-			cmd_text.cmdsize = 0;
-		} else {
-			i++;
-			cmd_text.cmdsize -= i;
-			memmove( text, text + i, cmd_text.cmdsize );
-		}
+		// take the command off the front of the buffer before running it,
+		// as commands (exec) can insert text there
+		cmd_text.takeCommand( line, sizeof( line ) );
 
 		Cmd_ExecuteString( line );
 	}
@@ -304,16 +254,55 @@ void Cmd_Echo_f()
 typedef struct cmd_function_s
 {
 	struct cmd_function_s   *next;
+	struct cmd_function_s   *hashNext;
 	char                    *name;
 	xcommand_t function;
 } cmd_function_t;
 
+#define MAX_CMD_DEPTH   4
+#define CMD_HASH_SIZE   512
+
+typedef CommandArgs<MAX_STRING_TOKENS, BIG_INFO_STRING + MAX_STRING_TOKENS> cmdArgs_t;
 
-static int cmd_argc;
-static char        *cmd_argv[MAX_STRING_TOKENS];        // points into cmd_tokenized
-static char cmd_tokenized[BIG_INFO_STRING + MAX_STRING_TOKENS];         // will have 0 bytes inserted
+// the arguments of each command being executed, so that one executed from inside
+// another doesn't overwrite the outer one's; [0] is also what Cmd_TokenizeString
+// fills outside of any command
+static cmdArgs_t cmd_argsStack[MAX_CMD_DEPTH];
+static cmdArgs_t *cmd_currentArgs = &cmd_argsStack[0];
+static int cmd_depth;
 
 static cmd_function_t  *cmd_functions;      // possible commands to execute
+static cmd_function_t  *cmd_hashTable[CMD_HASH_SIZE];
+
+/*
+============
+Cmd_HashName
+
+Case insensitive, as commands are matched
+============
+*/
+static int Cmd_HashName( const char *name ) {
+	int hash = 0;
+
+	for ( int i = 0; name[i]; i++ ) {
+		hash += tolower( (unsigned char)name[i] ) * ( i + 119 );
+	}
+	return hash & ( CMD_HASH_SIZE - 1 );
+}
+
+/*
+============
+Cmd_FindCommand
+============
+*/
+static cmd_function_t *Cmd_FindCommand( const char *cmd_name ) {
+	for ( cmd_function_t *cmd = cmd_hashTable[Cmd_HashName( cmd_name )] ; cmd ; cmd = cmd->hashNext ) {
+		if ( !Q_stricmp( cmd_name, cmd->name ) ) {
+			return cmd;
+		}
+	}
+	return nullptr;
+}
 
 /*
 ============
@@ -321,7 +310,7 @@ Cmd_Argc
 ============
 */
 int     Cmd_Argc( void ) {
-	return cmd_argc;
+	return cmd_currentArgs->argc();
 }
 
 /*
@@ -330,10 +319,7 @@ Cmd_Argv
 ============
 */
 const char    *Cmd_Argv( int arg ) {
-	if ( (unsigned)arg >= cmd_argc ) {
-		return "";
-	}
-	return cmd_argv[arg];
+	return cmd_currentArgs->argv( arg );
 }
 
 /*
@@ -361,9 +347,9 @@ char    *Cmd_Args()
 	static char cmd_args[MAX_STRING_CHARS];
 
 	cmd_args[0] = 0;
-	for (int i = 1 ; i < cmd_argc ; i++ ) {
-		strcat( cmd_args, cmd_argv[i] );
-		if ( i != cmd_argc - 1 ) {
+	for (int i = 1 ; i < Cmd_Argc() ; i++ ) {
+		strcat( cmd_args, Cmd_Argv( i ) );
+		if ( i != Cmd_Argc() - 1 ) {
 			strcat( cmd_args, " " );
 		}
 	}
@@ -386,9 +372,9 @@ char *Cmd_ArgsFrom( int arg )
 	if ( arg < 0 ) {
 		arg = 0;
 	}
-	for (int i = arg ; i < cmd_argc ; i++ ) {
-		strcat( cmd_args, cmd_argv[i] );
-		if ( i != cmd_argc - 1 ) {
+	for (int i = arg ; i < Cmd_Argc() ; i++ ) {
+		strcat( cmd_args, Cmd_Argv( i ) );
+		if ( i != Cmd_Argc() - 1 ) {
 			strcat( cmd_args, " " );
 		}
 	}
@@ -413,102 +399,14 @@ void    Cmd_ArgsBuffer( char *buffer, int bufferLength ) {
 ============
 Cmd_TokenizeString
 
-Parses the given string into command line tokens.
-The text is copied to a seperate buffer and 0 characters
-are inserted in the apropriate place, The argv array
-will point into this temporary buffer.
+Parses the given string into command line tokens, which
+Cmd_Argc and Cmd_Argv return until the next call. The text
+is copied, so it need not be kept.
 ============
 */
 void Cmd_TokenizeString( const char *text_in )
 {
-	// clear previous args
-	cmd_argc = 0;
-
-	if ( !text_in ) {
-		return;
-	}
-
-	const char* text = text_in;
-	char* textOut = cmd_tokenized;
-
-	while ( 1 ) {
-		if ( cmd_argc == MAX_STRING_TOKENS ) {
-			return;         // this is usually something malicious
-		}
-
-		while ( 1 ) {
-			// skip whitespace
-			while ( *text && *text <= ' ' ) {
-				text++;
-			}
-			if ( !*text ) {
-				return;         // all tokens parsed
-			}
-
-			// skip // comments
-			if ( text[0] == '/' && text[1] == '/' ) {
-				return;         // all tokens parsed
-			}
-
-			// skip /* */ comments
-			if ( text[0] == '/' && text[1] == '*' ) {
-				while ( *text && ( text[0] != '*' || text[1] != '/' ) ) {
-					text++;
-				}
-				if ( !*text ) {
-					return;     // all tokens parsed
-				}
-				text += 2;
-			} else {
-				break;          // we are ready to parse a token
-			}
-		}
-
-		// handle quoted strings
-		if ( *text == '"' ) {
-			cmd_argv[cmd_argc] = textOut;
-			cmd_argc++;
-			text++;
-			while ( *text && *text != '"' ) {
-				*textOut++ = *text++;
-			}
-			*textOut++ = 0;
-			if ( !*text ) {
-				return;     // all tokens parsed
-			}
-			text++;
-			continue;
-		}
-
-		// regular token
-		cmd_argv[cmd_argc] = textOut;
-		cmd_argc++;
-
-		// skip until whitespace, quote, or command
-		while ( *text > ' ' ) {
-			if ( text[0] == '"' ) {
-				break;
-			}
-
-			if ( text[0] == '/' && text[1] == '/' ) {
-				break;
-			}
-
-			// skip /* */ comments
-			if ( text[0] == '/' && text[1] == '*' ) {
-				break;
-			}
-
-			*textOut++ = *text++;
-		}
-
-		*textOut++ = 0;
-
-		if ( !*text ) {
-			return;     // all tokens parsed
-		}
-	}
-
+	cmd_currentArgs->tokenize( text_in );
 }
 
 
@@ -519,9 +417,10 @@ Cmd_AddCommand
 */
 void    Cmd_AddCommand( const char *cmd_name, xcommand_t function ) {
 	cmd_function_t  *cmd;
+	int hash = Cmd_HashName( cmd_name );
 
 	// fail if the command already exists
-	for ( cmd = cmd_functions ; cmd ; cmd = cmd->next ) {
+	for ( cmd = cmd_hashTable[hash] ; cmd ; cmd = cmd->hashNext ) {
 		if ( !strcmp( cmd_name, cmd->name ) ) {
 			// allow completion-only commands to be silently doubled
 			if ( function != nullptr ) {
@@ -537,6 +436,8 @@ void    Cmd_AddCommand( const char *cmd_name, xcommand_t function ) {
 	cmd->function = function;
 	cmd->next = cmd_functions;
 	cmd_functions = cmd;
+	cmd->hashNext = cmd_hashTable[hash];
+	cmd_hashTable[hash] = cmd;
 }
 
 /*
@@ -547,7 +448,7 @@ Cmd_RemoveCommand
 void    Cmd_RemoveCommand( const char *cmd_name ) {
 	cmd_function_t  *cmd, **back;
 
-	back = &cmd_functions;
+	back = &cmd_hashTable[Cmd_HashName( cmd_name )];
 	while ( 1 ) {
 		cmd = *back;
 		if ( !cmd ) {
@@ -555,6 +456,9 @@ void    Cmd_RemoveCommand( const char *cmd_name ) {
 			return;
 		}
 		if ( !strcmp( cmd_name, cmd->name ) ) {
+			*back = cmd->hashNext;
+			for ( back = &cmd_functions ; *back != cmd ; back = &( *back )->next ) {
+			}
 			*back = cmd->next;
 			if ( cmd->name ) {
 				free( cmd->name );
@@ -562,7 +466,7 @@ void    Cmd_RemoveCommand( const char *cmd_name ) {
 			free( cmd );
 			return;
 		}
-		back = &cmd->next;
+		back = &cmd->hashNext;
 	}
 }
 
@@ -583,40 +487,22 @@ void    Cmd_CommandCompletion( void ( *callback )(const char *s) ) {
 
 /*
 ============
-Cmd_ExecuteString
-
-A complete command line has been parsed, so try to execute it
+Cmd_Dispatch
 ============
 */
-void    Cmd_ExecuteString( const char *text ) {
-	cmd_function_t  *cmd, **prev;
-
-	// execute the command line
+static void Cmd_Dispatch( const char *text ) {
 	Cmd_TokenizeString( text );
 	if ( !Cmd_Argc() ) {
 		return;     // no tokens
 	}
 
 	// check registered command functions
-	for ( prev = &cmd_functions ; *prev ; prev = &cmd->next ) {
-		cmd = *prev;
-		if ( !Q_stricmp( cmd_argv[0],cmd->name ) ) {
-			// rearrange the links so that the command will be
-			// near the head of the list next time it is used
-			*prev = cmd->next;
-			cmd->next = cmd_functions;
-			cmd_functions = cmd;
-
-			// perform the action
-			if ( !cmd->function ) {
-				// let the cgame or game handle it
-				break;
-			} else {
-				cmd->function();
-			}
-			return;
-		}
+	cmd_function_t *cmd = Cmd_FindCommand( Cmd_Argv( 0 ) );
+	if ( cmd && cmd->function ) {
+		cmd->function();
+		return;
 	}
+	// a command without a function is left to the cgame or game
 
 	// check cvars
 	if ( Cvar_Command() ) {
@@ -643,6 +529,39 @@ void    Cmd_ExecuteString( const char *text ) {
 	CL_ForwardCommandToServer( text );
 }
 
+/*
+============
+Cmd_ExecuteString
+
+A complete command line has been parsed, so try to execute it
+============
+*/
+void    Cmd_ExecuteString( const char *text ) {
+	cmdArgs_t *outer = cmd_currentArgs;
+
+	// one executed from inside another gets arguments of its own, and the outer
+	// one gets its own back afterwards; deeper than that they share as they used to
+	if ( cmd_depth > 0 && cmd_depth < MAX_CMD_DEPTH ) {
+		cmd_currentArgs = &cmd_argsStack[cmd_depth];
+	}
+	cmd_depth++;
+	Cmd_Dispatch( text );
+	cmd_depth--;
+	cmd_currentArgs = outer;
+}
+
+/*
+============
+Cmd_AbortExecution
+
+The commands being executed when an error was thrown are not going to return
+============
+*/
+void Cmd_AbortExecution( void ) {
+	cmd_depth = 0;
+	cmd_currentArgs = &cmd_argsStack[0];
+}
+
 /*
 ============
 Cmd_List_f
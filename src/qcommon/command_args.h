@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * @brief A command line split into its arguments.
+ *
+ * tokenize() copies the text into the object with a 0 after each argument,
+ * so each object holds a whole command line of its own: one can be filled
+ * while another is still being read, as when a command runs another command
+ * before it has finished with its own arguments. Arguments are separated by
+ * whitespace and may be quoted; a line comment ends them and a block comment
+ * is skipped. Text past MaxTokens arguments or MaxChars characters is ignored.
+ */
+template <int MaxTokens, int MaxChars>
+class CommandArgs
+{
+public:
+    int argc() const {
+        return count;
+    }
+
+    // "" past the last
+    const char* argv(int arg) const {
+        if ((unsigned)arg >= (unsigned)count) {
+            return "";
+        }
+        return args[arg];
+    }
+
+    void tokenize(const char* in) {
+        count = 0;
+        if (!in) {
+            return;
+        }
+
+        char* out = text;
+        char* const end = text + MaxChars - 1;      // leaves room for the last 0
+        while (count < MaxTokens && out < end) {
+            while (true) {
+                // skip whitespace
+                while (*in && *in <= ' ') {
+                    in++;
+                }
+                if (!*in) {
+                    return;
+                }
+
+                // skip // comments
+                if (in[0] == '/' && in[1] == '/') {
+                    return;
+                }
+
+                // skip /* */ comments
+                if (in[0] == '/' && in[1] == '*') {
+                    while (*in && (in[0] != '*' || in[1] != '/')) {
+                        in++;
+                    }
+                    if (!*in) {
+                        return;
+                    }
+                    in += 2;
+                } else {
+                    break;
+                }
+            }
+
+            args[count++] = out;
+
+            // quoted strings
+            if (*in == '"') {
+                in++;
+                while (*in && *in != '"' && out < end) {
+                    *out++ = *in++;
+                }
+                *out++ = 0;
+                if (*in != '"') {
+                    return;
+                }
+                in++;
+                continue;
+            }
+
+            // up to whitespace, a quote or a comment
+            while (*in > ' ' && out < end) {
+                if (in[0] == '"') {
+                    break;
+                }
+                if (in[0] == '/' && (in[1] == '/' || in[1] == '*')) {
+                    break;
+                }
+                *out++ = *in++;
+            }
+            *out++ = 0;
+            if (!*in) {
+                return;
+            }
+        }
+    }
+
+private:
+    int count = 0;
+    char* args[MaxTokens];
+    char text[MaxChars];
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief Command text waiting to be executed, taken off the front a command
+ * at a time.
+ *
+ * A ring of N bytes: text is added at the end, or inserted in front of what
+ * is left (exec, vstr), and taking a command moves the front on rather than
+ * moving the rest of the text down, so running through a large config costs
+ * its length rather than its length times its number of lines. The caller
+ * checks that text fits before adding it.
+ */
+template <int N>
+class CommandBuffer
+{
+    static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+public:
+    int size() const {
+        return count;
+    }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    void append(const char* text, int length) {
+        write((head + count) & (N - 1), text, length);
+        count += length;
+    }
+
+    void prepend(const char* text, int length) {
+        head = (head - length) & (N - 1);
+        write(head, text, length);
+        count += length;
+    }
+
+    // takes the text up to the first ';' outside quotes or line end, and that too, into line
+    // with a 0 after it; a command that doesn't fit in lineSize - 1 is cut there and the
+    // character it was cut at dropped
+    int takeCommand(char* line, int lineSize) {
+        const int limit = std::min(count, lineSize - 1);
+        int quotes = 0;
+        int length = 0;
+        for (; length < limit; length++) {
+            const char c = data[(head + length) & (N - 1)];
+            if (c == '"') {
+                quotes++;
+            }
+            if (!(quotes & 1) && c == ';') {
+                break;
+            }
+            if (c == '\n' || c == '\r') {
+                break;
+            }
+        }
+
+        const int first = std::min(length, N - head);
+        memcpy(line, data + head, first);
+        memcpy(line + first, data, length - first);
+        line[length] = 0;
+
+        const int taken = length == count ? length : length + 1;
+        head = (head + taken) & (N - 1);
+        count -= taken;
+        return length;
+    }
+
+private:
+    void write(int at, const char* text, int length) {
+        const int first = std::min(length, N - at);
+        memcpy(data + at, text, first);
+        memcpy(data, text + first, length - first);
+    }
+
+    char data[N];
+    int head = 0;
+    int count = 0;
+};
@@ -30,7 +30,14 @@ If you have questions concerning this license or the applicable additional terms
 
 #include "../game/q_shared.h"
 #include "qcommon.h"
+#include "profiler.h"
+#include "job_system.h"
+#include "log_pipeline.h"
+#include "../idlib/math/Simd.h"
 #include <setjmp.h>
+#include <chrono>
+#include <condition_variable>
+#include <string>
 
 #define MAXPRINTMSG 4096
 
@@ -56,10 +63,14 @@ fileHandle_t com_journalDataFile;           // config files are written here
 
 cvar_t  *com_viewlog;
 cvar_t  *com_speeds;
+#ifdef WOLF_PROFILE
+cvar_t  *com_profile;
+#endif
 cvar_t  *com_developer;
 
 cvar_t  *com_timescale;
 cvar_t  *com_fixedtime;
+cvar_t  *com_savegameLoading;
 cvar_t  *com_dropsim;       // 0.0 to 1.0, simulated packet drops
 cvar_t  *com_journal;
 cvar_t  *com_maxfps;
@@ -67,6 +78,8 @@ cvar_t  *com_maxfps;
 cvar_t  *com_sv_running;
 cvar_t  *com_cl_running;
 cvar_t  *com_logfile;       // 1 = buffer log, 2 = flush after each print
+cvar_t  *com_logLevel;
+cvar_t  *com_logMask;
 cvar_t  *com_showtrace;
 cvar_t  *com_version;
 cvar_t  *com_blood;
@@ -79,6 +92,8 @@ cvar_t  *com_cameraMode;
 cvar_t  *com_noErrorInterrupt;
 #endif
 cvar_t  *com_recommendedSet;
+cvar_t  *com_forceGenericSIMD;
+cvar_t  *com_workers;
 
 // Rafael Notebook
 cvar_t  *cl_notebook;
@@ -89,6 +104,7 @@ cvar_t  *com_hunkused;      // Ridah
 int time_game;
 int time_frontend;          // renderer frontend time
 int time_backend;           // renderer backend time
+bool com_timeFrames;
 
 int com_frameTime;
 int com_frameMsec;
@@ -129,24 +145,239 @@ void Com_EndRedirect( void ) {
 	rd_flush = nullptr;
 }
 
+/*
+============================================================================
+
+LOG WRITER
+
+Printing from any thread puts the message on com_log and returns. The log
+writer thread takes the messages off it and does the slow part: it prints
+them to the terminal, and queues them for the log file and, when another
+thread printed them, for the console. Neither the console nor the
+filesystem may be used off the main thread, so the main thread writes what
+is queued for them in Com_FlushLog, every frame and whenever it prints.
+
+The main thread still prints to the console and to a redirect right away,
+and with logfile 2 writes everything itself as before, so that nothing is
+lost if it crashes.
+============================================================================
+*/
+
+#define LOG_SHOWN       1       // already printed to the console
+
+static LogPipeline com_log;
+static std::thread com_logWriter;
+static std::atomic<bool> com_logWriting;
+static std::atomic<bool> com_logToFile;
+static std::atomic<bool> com_logPending;
+static std::mutex com_logLock;              // guards the pending text and com_logStopping
+static std::condition_variable com_logWake;
+static bool com_logStopping;
+static std::string com_logPendingFile;
+static std::string com_logPendingConsole;
+static thread_local bool com_mainThread;
+
 /*
 =============
-Com_Printf
+Com_WriteLogFile
 
-Both client and server can use this, and it will output
-to the apropriate place.
+Opens rtcwconsole.log the first time, main thread only
+=============
+*/
+static void Com_WriteLogFile( const char *text, size_t length ) {
+	static bool opening_qconsole = false;
 
-A raw string should NEVER be passed as fmt, because of "%f" type crashers.
+	if ( !com_logfile || !com_logfile->integer ) {
+		return;
+	}
+
+	// TTimo: only open the qconsole.log if the filesystem is in an initialized state
+	//   also, avoid recursing in the qconsole.log opening (i.e. if fs_debug is on)
+	if ( !logfile && FS_Initialized() && !opening_qconsole ) {
+		struct tm *newtime;
+		time_t aclock;
+
+		opening_qconsole = true;
+
+		time( &aclock );
+		newtime = localtime( &aclock );
+
+		logfile = FS_FOpenFileWrite( "rtcwconsole.log" );    //----(SA)	changed name for Wolf
+		Com_Printf( "logfile opened on %s\n", asctime( newtime ) );
+		if ( com_logfile->integer > 1 ) {
+			// force it to not buffer so we get valid
+			// data even if we are crashing
+			FS_ForceFlush( logfile );
+		}
+
+		opening_qconsole = false;
+	}
+	if ( logfile && FS_Initialized() ) {
+		FS_Write( text, length, logfile );
+	}
+}
+
+/*
+=============
+Com_DrainLog
+
+Prints everything on com_log and queues it for the main thread, only called
+by the log writer, or once it has stopped
 =============
 */
-void  Com_Printf( const char *fmt, ... ) {
-	va_list argptr;
+static void Com_DrainLog( void ) {
+	std::string terminal, file, console;
+	const bool toFile = com_logToFile.load( std::memory_order_relaxed );
+
+	com_log.drain( [&]( const LogPipeline::Record &record ) {
+		terminal.append( record.text, record.length );
+		if ( toFile ) {
+			file.append( record.text, record.length );
+		}
+		if ( !( record.flags & LOG_SHOWN ) ) {
+			console.append( record.text, record.length );
+		}
+	} );
+
+	const uint32_t dropped = com_log.takeDropped();
+	if ( dropped ) {
+		const std::string warning = S_COLOR_YELLOW "WARNING: " + std::to_string( dropped ) + " log messages dropped\n";
+		terminal += warning;
+		file += warning;
+		console += warning;
+	}
+
+	if ( !terminal.empty() ) {
+		Sys_Print( terminal.c_str() );
+	}
+	if ( file.empty() && console.empty() ) {
+		return;
+	}
+	std::lock_guard<std::mutex> guard( com_logLock );
+	com_logPendingFile += file;
+	com_logPendingConsole += console;
+	com_logPending.store( true, std::memory_order_release );
+}
+
+static void Com_LogWriter( void ) {
+#ifdef WOLF_PROFILE
+	Profiler::get().setThreadName( "log" );
+#endif
+	std::unique_lock<std::mutex> guard( com_logLock );
+	while ( true ) {
+		const bool stopping = com_logStopping;
+		guard.unlock();
+		Com_DrainLog();
+		guard.lock();
+		if ( stopping ) {
+			break;
+		}
+		com_logWake.wait_for( guard, std::chrono::milliseconds( 10 ) );
+	}
+}
+
+/*
+=============
+Com_StartLogWriter
+=============
+*/
+static void Com_StopLogWriter( void );
+
+static void Com_StartLogWriter( void ) {
+	com_mainThread = true;
+	if ( com_logWriter.joinable() ) {
+		return;
+	}
+	com_logStopping = false;
+	com_logWriter = std::thread( Com_LogWriter );
+	com_logWriting = true;
+	// in case something exits without shutting down
+	atexit( Com_StopLogWriter );
+}
+
+/*
+=============
+Com_StopLogWriter
+
+Prints whatever is left to the terminal, from here on everything is printed synchronously
+=============
+*/
+static void Com_StopLogWriter( void ) {
+	if ( !com_logWriter.joinable() ) {
+		return;
+	}
+	com_logWriting = false;
+	{
+		std::lock_guard<std::mutex> guard( com_logLock );
+		com_logStopping = true;
+	}
+	com_logWake.notify_one();
+	com_logWriter.join();
+	// anything pushed while it stopped
+	Com_DrainLog();
+}
+
+/*
+=============
+Com_FlushLog
+
+Writes what the log writer queued for the console and the log file, main thread only
+=============
+*/
+void Com_FlushLog( void ) {
+	std::string file, console;
+
+	com_logToFile.store( com_logfile && com_logfile->integer, std::memory_order_relaxed );
+	if ( !com_logPending.exchange( false, std::memory_order_acquire ) ) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> guard( com_logLock );
+		file.swap( com_logPendingFile );
+		console.swap( com_logPendingConsole );
+	}
+	if ( !console.empty() ) {
+		CL_ConsolePrint( &console[0] );
+	}
+	if ( !file.empty() ) {
+		Com_WriteLogFile( file.data(), file.size() );
+	}
+}
+
+/*
+=============
+Com_LogEnabled
+
+False if com_logLevel or com_logMask filters the subsystem's messages out
+=============
+*/
+bool Com_LogEnabled( logSubsystem_t subsystem, logSeverity_t severity ) {
+	return com_log.enabled( severity, subsystem );
+}
+
+/*
+=============
+Com_LogVPrintf
+
+Anything that isn't filtered out is formatted on the calling thread, the
+rest happens on the log writer
+=============
+*/
+void Com_LogVPrintf( logSubsystem_t subsystem, logSeverity_t severity, const char *fmt, va_list argptr ) {
 	char msg[MAXPRINTMSG];
-	static bool opening_qconsole = false;
+	int length;
 
-	va_start( argptr,fmt );
-	vsnprintf( msg, MAXPRINTMSG, fmt,argptr );
-	va_end( argptr );
+	if ( !com_log.enabled( severity, subsystem ) ) {
+		return;
+	}
+
+	length = vsnprintf( msg, MAXPRINTMSG, fmt, argptr );
+	length = std::clamp( length, 0, MAXPRINTMSG - 1 );
+
+	if ( !com_mainThread && com_logWriting ) {
+		com_log.push( severity, subsystem, 0, msg, length );
+		return;
+	}
 
 	if ( rd_buffer ) {
 		if ( ( strlen( msg ) + strlen( rd_buffer ) ) > ( rd_buffersize - 1 ) ) {
@@ -163,36 +394,36 @@ void  Com_Printf( const char *fmt, ... ) {
 
 	CL_ConsolePrint( msg );
 
+	if ( com_logWriting && !( com_logfile && com_logfile->integer > 1 ) ) {
+		com_log.push( severity, subsystem, LOG_SHOWN, msg, length );
+		if ( com_logPending.load( std::memory_order_relaxed ) ) {
+			Com_FlushLog();
+		}
+		return;
+	}
+
 	// echo to dedicated console and early console
 	Sys_Print( msg );
 
-	// logfile
-	if ( com_logfile && com_logfile->integer ) {
-		// TTimo: only open the qconsole.log if the filesystem is in an initialized state
-		//   also, avoid recursing in the qconsole.log opening (i.e. if fs_debug is on)
-		if ( !logfile && FS_Initialized() && !opening_qconsole ) {
-			struct tm *newtime;
-			time_t aclock;
-
-			opening_qconsole = true;
-
-			time( &aclock );
-			newtime = localtime( &aclock );
-
-			logfile = FS_FOpenFileWrite( "rtcwconsole.log" );    //----(SA)	changed name for Wolf
-			Com_Printf( "logfile opened on %s\n", asctime( newtime ) );
-			if ( com_logfile->integer > 1 ) {
-				// force it to not buffer so we get valid
-				// data even if we are crashing
-				FS_ForceFlush( logfile );
-			}
+	Com_WriteLogFile( msg, length );
+}
 
-			opening_qconsole = false;
-		}
-		if ( logfile && FS_Initialized() ) {
-			FS_Write( msg, strlen( msg ), logfile );
-		}
-	}
+/*
+=============
+Com_Printf
+
+Both client and server can use this, and it will output
+to the apropriate place.
+
+A raw string should NEVER be passed as fmt, because of "%f" type crashers.
+=============
+*/
+void  Com_Printf( const char *fmt, ... ) {
+	va_list argptr;
+
+	va_start( argptr,fmt );
+	Com_LogVPrintf( LOG_COMMON, LOG_INFO, fmt, argptr );
+	va_end( argptr );
 }
 
 
@@ -205,17 +436,29 @@ A Com_Printf that only shows up if the "developer" cvar is set
 */
 void  Com_DPrintf( const char *fmt, ... ) {
 	va_list argptr;
-	char msg[MAXPRINTMSG];
 
 	if ( !com_developer || !com_developer->integer ) {
 		return;         // don't confuse non-developers with techie stuff...
 	}
 
 	va_start( argptr,fmt );
-	vsnprintf( msg, MAXPRINTMSG, fmt,argptr );
+	Com_LogVPrintf( LOG_COMMON, LOG_DEBUG, fmt, argptr );
 	va_end( argptr );
+}
 
-	Com_Printf( "%s", msg );
+/*
+================
+Com_LogPrintf
+
+A Com_Printf for a subsystem, which com_logLevel and com_logMask can filter out
+================
+*/
+void  Com_LogPrintf( logSubsystem_t subsystem, logSeverity_t severity, const char *fmt, ... ) {
+	va_list argptr;
+
+	va_start( argptr,fmt );
+	Com_LogVPrintf( subsystem, severity, fmt, argptr );
+	va_end( argptr );
 }
 
 /*
@@ -259,6 +502,8 @@ void  Com_Error( int code, const char *fmt, ... ) {
 	}
 	com_errorEntered = true;
 
+	Cmd_AbortExecution();
+
 	va_start( argptr,fmt );
 	vsnprintf( com_errorMessage, MAXPRINTMSG, fmt,argptr );
 	va_end( argptr );
@@ -1267,6 +1512,40 @@ static void Com_Crash_f( void ) {
 	__builtin_trap();
 }
 
+#ifdef WOLF_PROFILE
+/*
+=================
+Com_ProfileDump_f
+
+profile_dump [filename]
+
+Writes the zones recorded while com_profile was on as a Chrome trace
+=================
+*/
+static void Com_ProfileDump_f( void ) {
+	char filename[MAX_QPATH];
+
+	if ( Cmd_Argc() > 2 ) {
+		Com_Printf( "Usage: profile_dump [filename]\n" );
+		return;
+	}
+
+	Q_strncpyz( filename, Cmd_Argc() == 2 ? Cmd_Argv( 1 ) : "profile", sizeof( filename ) );
+	COM_DefaultExtension( filename, sizeof( filename ), ".json" );
+
+	fileHandle_t f = FS_FOpenFileWrite( filename );
+	if ( !f ) {
+		Com_Printf( "Couldn't write %s.\n", filename );
+		return;
+	}
+
+	std::string trace = Profiler::get().chromeTrace();
+	FS_Write( trace.data(), trace.size(), f );
+	FS_FCloseFile( f );
+	Com_Printf( "Wrote %s, %i bytes.\n", filename, (int)trace.size() );
+}
+#endif
+
 void Com_SetRecommended( bool vidrestart ) {
 	cvar_t *cv;
 	bool goodVideo;
@@ -1308,6 +1587,60 @@ void Com_SetRecommended( bool vidrestart ) {
 		Cbuf_AddText( "vid_restart\n" );
 	}
 }
+/*
+=================
+Com_InitSIMD
+
+Picks the SIMD processor for the CPU, again whenever com_forceGenericSIMD changes
+=================
+*/
+static void Com_InitSIMD( void ) {
+	char cpu[256];
+
+	idSIMD::InitProcessor( "wolf", com_forceGenericSIMD->integer != 0 );
+	idSIMD::GetProcessorString( SIMDProcessor->cpuid, cpu, sizeof( cpu ) );
+	Com_Printf( "CPU: %s\n", cpu );
+	Com_Printf( "using %s for SIMD processing\n", SIMDProcessor->GetName() );
+	com_forceGenericSIMD->modified = false;
+}
+
+/*
+=================
+Com_Jobs
+=================
+*/
+JobSystem &Com_Jobs( void ) {
+	static JobSystem jobs;
+	return jobs;
+}
+
+/*
+=================
+Com_InitJobs
+
+Starts com_workers worker threads, or one less than the number of cores if it is -1
+=================
+*/
+static void Com_InitJobs( void ) {
+	int workers;
+
+	com_workers = Cvar_Get( "com_workers", "-1", CVAR_ARCHIVE | CVAR_LATCH );
+	workers = com_workers->integer;
+	if ( workers < 0 ) {
+		workers = (int)std::thread::hardware_concurrency() - 1;
+	}
+	workers = std::clamp( workers, 0, MAX_JOB_WORKERS );
+
+	Com_Jobs().start( workers, []( int index ) {
+		// MXCSR is per thread, and jobs do the same math as the main thread
+		idSIMD::InitThread();
+#ifdef WOLF_PROFILE
+		Profiler::get().setThreadName( ( "worker " + std::to_string( index ) ).c_str() );
+#endif
+	} );
+	Com_Printf( "%i job worker threads\n", workers );
+}
+
 /*
 =================
 Com_Init
@@ -1316,6 +1649,8 @@ Com_Init
 void Com_Init( char *commandLine ) {
 	char    *s;
 
+	Com_StartLogWriter();
+
 	Com_Printf( "%s %s\n", Q3_VERSION, __DATE__ );
 
 	if ( setjmp( abortframe ) ) {
@@ -1325,6 +1660,9 @@ void Com_Init( char *commandLine ) {
 	// bk001129 - do this before anything else decides to push events
 	Com_InitPushEvent();
 
+	// generic until com_forceGenericSIMD can be read
+	idSIMD::Init();
+
 	Cvar_Init();
 
 	// prepare enough of the subsystems to handle
@@ -1382,6 +1720,8 @@ void Com_Init( char *commandLine ) {
 
 	
 	com_logfile = Cvar_Get( "logfile", "0", CVAR_TEMP );
+	com_logLevel = Cvar_Get( "com_logLevel", "0", 0 );
+	com_logMask = Cvar_Get( "com_logMask", "-1", 0 );
 
 	com_timescale = Cvar_Get( "timescale", "1", CVAR_CHEAT | CVAR_SYSTEMINFO );
 	com_fixedtime = Cvar_Get( "fixedtime", "0", CVAR_CHEAT );
@@ -1389,6 +1729,10 @@ void Com_Init( char *commandLine ) {
 	com_dropsim = Cvar_Get( "com_dropsim", "0", CVAR_CHEAT );
 	com_viewlog = Cvar_Get( "viewlog", "0", CVAR_CHEAT );
 	com_speeds = Cvar_Get( "com_speeds", "0", 0 );
+#ifdef WOLF_PROFILE
+	com_profile = Cvar_Get( "com_profile", "0", 0 );
+	Profiler::get().setThreadName( "main" );
+#endif
 
 	com_cameraMode = Cvar_Get( "com_cameraMode", "0", CVAR_CHEAT );
 
@@ -1401,10 +1745,15 @@ void Com_Init( char *commandLine ) {
 	com_introPlayed = Cvar_Get( "com_introplayed", "0", CVAR_ARCHIVE );
 	com_recommendedSet = Cvar_Get( "com_recommendedSet", "0", CVAR_ARCHIVE );
 
-	Cvar_Get( "savegame_loading", "0", CVAR_ROM );
+	com_savegameLoading = Cvar_Get( "savegame_loading", "0", CVAR_ROM );
 
 	com_hunkused = Cvar_Get( "com_hunkused", "0", 0 );
 
+	com_forceGenericSIMD = Cvar_Get( "com_forceGenericSIMD", "0", 0 );
+	Com_InitSIMD();
+
+	Com_InitJobs();
+
 	if ( com_developer && com_developer->integer ) {
 		Cmd_AddCommand( "error", Com_Error_f );
 		Cmd_AddCommand( "crash", Com_Crash_f );
@@ -1413,6 +1762,9 @@ void Com_Init( char *commandLine ) {
 	Cmd_AddCommand( "quit", Com_Quit_f );
 	Cmd_AddCommand( "changeVectors", MSG_ReportChangeVectors_f );
 	Cmd_AddCommand( "writeconfig", Com_WriteConfig_f );
+#ifdef WOLF_PROFILE
+	Cmd_AddCommand( "profile_dump", Com_ProfileDump_f );
+#endif
 
 	s = va( "%s %s", Q3_VERSION, __DATE__ );
 	com_version = Cvar_Get( "version", s, CVAR_ROM | CVAR_SERVERINFO );
@@ -1573,11 +1925,28 @@ void Com_Frame( void ) {
 	int timeBeforeEvents;
 	int timeBeforeClient;
 	int timeAfter;
+	int64_t usecBeforeServer;
 
 	if ( setjmp( abortframe ) ) {
 		return;         // an ERR_DROP was thrown
 	}
 
+#ifdef WOLF_PROFILE
+	Profiler::get().setEnabled( com_profile->integer != 0 );
+#endif
+	PROFILE_ZONE( "Com_Frame" );
+
+	if ( com_forceGenericSIMD->modified ) {
+		Com_InitSIMD();
+	}
+
+	if ( com_logLevel->modified || com_logMask->modified ) {
+		com_log.setFilter( com_logLevel->integer, (uint32_t)com_logMask->integer );
+		com_logLevel->modified = false;
+		com_logMask->modified = false;
+	}
+	Com_FlushLog();
+
 	// bk001204 - init to zero.
 	//  also:  might be clobbered by `longjmp' or `vfork'
 	timeBeforeFirstEvents = 0;
@@ -1585,6 +1954,7 @@ void Com_Frame( void ) {
 	timeBeforeEvents = 0;
 	timeBeforeClient = 0;
 	timeAfter = 0;
+	usecBeforeServer = 0;
 
 	// write config file if anything changed
 	Com_WriteConfiguration();
@@ -1620,8 +1990,9 @@ void Com_Frame( void ) {
 	//
 	// server side
 	//
-	if ( com_speeds->integer ) {
+	if ( com_speeds->integer || com_timeFrames ) {
 		timeBeforeServer = Sys_Milliseconds();
+		usecBeforeServer = Sys_Microseconds();
 	}
 
 	SV_Frame( msec );
@@ -1650,10 +2021,13 @@ void Com_Frame( void ) {
 
 	CL_Frame( msec );
 
-	if ( com_speeds->integer ) {
+	if ( com_speeds->integer || com_timeFrames ) {
 		timeAfter = Sys_Milliseconds();
 	}
-	
+
+	if ( com_timeFrames ) {
+		CL_TimeDemoSample( (int)( Sys_Microseconds() - usecBeforeServer ) );
+	}
 
 	//
 	// report timing information
@@ -1672,6 +2046,11 @@ void Com_Frame( void ) {
 					com_frameNumber, all, sv, ev, cl, time_game, time_frontend, time_backend );
 	}
 
+	Cvar_LintFrame();
+
+	// everything queued against the frame is done and its scratch memory reclaimed
+	Com_Jobs().endFrame();
+
 	com_frameNumber++;
 }
 
@@ -1681,6 +2060,10 @@ Com_Shutdown
 =================
 */
 void Com_Shutdown( void ) {
+	Com_Jobs().stop();
+	Com_StopLogWriter();
+	Com_FlushLog();
+
 	if ( logfile ) {
 		FS_FCloseFile( logfile );
 		logfile = 0;
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Ordered rule sets compiled into decision tables.
+ *
+ * A rule is a list of tests on condition values and passes when all of them
+ * do. Evaluating a rule set finds the first rule that passes, which is how
+ * the animation scripts pick the item to play. Rather than testing rule by
+ * rule, a rule set is compiled condition by condition: every condition the
+ * rules test gets an entry with the bits of the rules that don't test it and
+ * one test per distinct value the rules compare it with, carrying the bits of
+ * the rules that use that value. Evaluating is an AND over the conditions of
+ * the rules passing each one, and the lowest bit left is the rule.
+ *
+ * A condition value is two ints. A BITFLAGS test passes when it shares a bit
+ * with the value, a VALUE test when the first ints are equal. The compiled
+ * tests of all the rule sets live in the table's fixed storage; compile
+ * returns false for a rule set that doesn't fit, and the caller falls back to
+ * testing its rules one by one. There is no constructor so the table can be
+ * part of a struct that is allocated raw; call clear() before compiling.
+ */
+template <int MAX_CONDITIONS, int MAX_TESTS>
+class ConditionTable
+{
+public:
+    static const int MAX_RULES = 32;            // rules per rule set, one bit each
+    static const int MAX_RULE_TESTS = 1024;     // tests of all the rules of a set
+
+    enum {
+        BITFLAGS,
+        VALUE
+    };
+
+    // one test of one rule, the input to compile
+    struct Test {
+        int rule;                               // index of the rule in its rule set
+        int condition;                          // which condition value is tested
+        int type;                               // BITFLAGS or VALUE
+        int value[2];
+    };
+
+    struct RuleSet {
+        int firstCondition;
+        int numConditions;
+        uint32_t rules;                         // a bit for each rule
+        bool compiled;
+    };
+
+    void clear() {
+        numConditions = 0;
+        numTests = 0;
+    }
+
+    int conditionsUsed() const {
+        return numConditions;
+    }
+
+    int testsUsed() const {
+        return numTests;
+    }
+
+    // compiles the rules of a set from all of their tests, the tests of a rule may be in any order
+    bool compile(RuleSet& set, int numRules, const Test* ruleTests, int numRuleTests) {
+        set.firstCondition = numConditions;
+        set.numConditions = 0;
+        set.rules = numRules >= MAX_RULES ? ~0u : (1u << numRules) - 1;
+        set.compiled = false;
+        if (numRules > MAX_RULES || numRuleTests > MAX_RULE_TESTS) {
+            return false;
+        }
+
+        // group the tests by condition, a rule that tests a condition twice must pass both
+        // so its second test goes to a second entry for the same condition
+        int entryOf[MAX_RULE_TESTS];
+        uint32_t tested[MAX_RULE_TESTS];
+        int numEntries = 0;
+        for (int i = 0; i < numRuleTests; i++) {
+            const Test& test = ruleTests[i];
+            const uint32_t bit = 1u << test.rule;
+            int entry = 0;
+            while (entry < numEntries && (conditions[set.firstCondition + entry].condition != test.condition ||
+                                          conditions[set.firstCondition + entry].type != test.type ||
+                                          (tested[entry] & bit))) {
+                entry++;
+            }
+            if (entry == numEntries) {
+                if (set.firstCondition + entry >= MAX_CONDITIONS) {
+                    return false;
+                }
+                Condition& condition = conditions[set.firstCondition + entry];
+                condition.condition = test.condition;
+                condition.type = test.type;
+                tested[entry] = 0;
+                numEntries++;
+            }
+            tested[entry] |= bit;
+            entryOf[i] = entry;
+        }
+
+        // then give every entry its distinct values, each with the rules that test it
+        int firstTest = numTests;
+        for (int entry = 0; entry < numEntries; entry++) {
+            Condition& condition = conditions[set.firstCondition + entry];
+            condition.untested = set.rules & ~tested[entry];
+            condition.firstTest = firstTest;
+            condition.numTests = 0;
+            for (int i = 0; i < numRuleTests; i++) {
+                if (entryOf[i] != entry) {
+                    continue;
+                }
+                const Test& test = ruleTests[i];
+                const int value1 = condition.type == BITFLAGS ? test.value[1] : 0;
+                int t = 0;
+                while (t < condition.numTests && (tests[firstTest + t].value[0] != test.value[0] ||
+                                                  tests[firstTest + t].value[1] != value1)) {
+                    t++;
+                }
+                if (t == condition.numTests) {
+                    if (firstTest + t >= MAX_TESTS) {
+                        return false;
+                    }
+                    tests[firstTest + t].value[0] = test.value[0];
+                    tests[firstTest + t].value[1] = value1;
+                    tests[firstTest + t].rules = 0;
+                    condition.numTests++;
+                }
+                tests[firstTest + t].rules |= 1u << test.rule;
+            }
+            firstTest += condition.numTests;
+        }
+
+        set.numConditions = numEntries;
+        set.compiled = true;
+        numConditions += numEntries;
+        numTests = firstTest;
+        return true;
+    }
+
+    // the first rule passing with values[condition], or -1 if none does
+    int evaluate(const RuleSet& set, const int (*values)[2]) const {
+        uint32_t passing = set.rules;
+        const Condition* condition = &conditions[set.firstCondition];
+        for (int c = 0; c < set.numConditions && passing; c++, condition++) {
+            const int* value = values[condition->condition];
+            const CompiledTest* test = &tests[condition->firstTest];
+            uint32_t pass = condition->untested;
+            if (condition->type == BITFLAGS) {
+                for (int t = 0; t < condition->numTests; t++, test++) {
+                    if ((value[0] & test->value[0]) || (value[1] & test->value[1])) {
+                        pass |= test->rules;
+                    }
+                }
+            } else {
+                for (int t = 0; t < condition->numTests; t++, test++) {
+                    if (value[0] == test->value[0]) {
+                        pass |= test->rules;
+                        break;                  // the values are distinct
+                    }
+                }
+            }
+            passing &= pass;
+        }
+
+        if (!passing) {
+            return -1;
+        }
+        int rule = 0;
+        while (!(passing & 1)) {
+            passing >>= 1;
+            rule++;
+        }
+        return rule;
+    }
+
+private:
+    struct Condition {
+        int condition;
+        int type;
+        uint32_t untested;                      // rules that don't test this condition pass it
+        int firstTest;
+        int numTests;
+    };
+
+    struct CompiledTest {
+        int value[2];
+        uint32_t rules;                         // rules that pass when this value matches
+    };
+
+    Condition conditions[MAX_CONDITIONS];
+    int numConditions;
+    CompiledTest tests[MAX_TESTS];
+    int numTests;
+};
@@ -34,6 +34,7 @@ If you have questions concerning this license or the applicable additional terms
 cvar_t      *cvar_vars;
 cvar_t      *cvar_cheats;
 int cvar_modifiedFlags;
+int cvar_modificationCount;
 
 #define MAX_CVARS   1024
 cvar_t cvar_indexes[MAX_CVARS];
@@ -42,6 +43,21 @@ int cvar_numIndexes;
 #define FILE_HASH_SIZE      256
 static cvar_t*     hashTable[FILE_HASH_SIZE];
 
+// cvar_lint counts the lookups by name made during a frame, to find code that
+// should keep the cvar_t * around instead of asking for the cvar every frame
+#define MAX_LINT_NAMES      32
+
+typedef struct {
+	char name[MAX_QPATH];
+	int count;
+} cvarLintName_t;
+
+static cvar_t         *cvar_lint;
+static cvarLintName_t lintNames[MAX_LINT_NAMES];
+static int lintNumNames;
+static int lintLookups;
+static bool lintReporting;
+
 cvar_t *Cvar_Set2( const char *var_name, const char *value, bool force );
 
 /*
@@ -90,6 +106,57 @@ static bool Cvar_ValidateString( const char *s ) {
 	return true;
 }
 
+/*
+============
+Cvar_LintLookup
+============
+*/
+static void Cvar_LintLookup( const char *var_name ) {
+	int i;
+
+	lintLookups++;
+	for ( i = 0 ; i < lintNumNames ; i++ ) {
+		if ( !Q_stricmp( lintNames[i].name, var_name ) ) {
+			lintNames[i].count++;
+			return;
+		}
+	}
+	if ( lintNumNames < MAX_LINT_NAMES ) {
+		Q_strncpyz( lintNames[lintNumNames].name, var_name, sizeof( lintNames[lintNumNames].name ) );
+		lintNames[lintNumNames].count = 1;
+		lintNumNames++;
+	}
+}
+
+/*
+============
+Cvar_LintFrame
+
+Prints the lookups by name made since the last call, once a frame
+============
+*/
+void Cvar_LintFrame( void ) {
+	char report[MAX_STRING_CHARS];
+	int i, lookups;
+
+	if ( !lintLookups ) {
+		return;
+	}
+
+	report[0] = 0;
+	for ( i = 0 ; i < lintNumNames ; i++ ) {
+		Q_strcat( report, sizeof( report ), va( "%s%s x%i", i ? ", " : "", lintNames[i].name, lintNames[i].count ) );
+	}
+	lookups = lintLookups;
+	lintLookups = 0;
+	lintNumNames = 0;
+
+	// printing can look up cvars too, don't count those towards the next frame
+	lintReporting = true;
+	Com_Printf( "cvar_lint: %i lookups by name: %s\n", lookups, report );
+	lintReporting = false;
+}
+
 /*
 ============
 Cvar_FindVar
@@ -99,6 +166,10 @@ static cvar_t *Cvar_FindVar( const char *var_name ) {
 	cvar_t  *var;
 	long hash;
 
+	if ( cvar_lint && cvar_lint->integer && !lintReporting ) {
+		Cvar_LintLookup( var_name );
+	}
+
 	hash = generateHashValue( var_name );
 
 	for ( var = hashTable[hash] ; var ; var = var->hashNext ) {
@@ -260,6 +331,7 @@ cvar_t *Cvar_Get( const char *var_name, const char *var_value, int flags ) {
 	var->string = CopyString( var_value );
 	var->modified = true;
 	var->modificationCount = 1;
+	cvar_modificationCount++;
 	var->value = atof( var->string );
 	var->integer = atoi( var->string );
 	var->resetString = CopyString( var_value );
@@ -344,6 +416,7 @@ cvar_t *Cvar_Set2( const char *var_name, const char *value, bool force ) {
 			var->latchedString = CopyString( value );
 			var->modified = true;
 			var->modificationCount++;
+			cvar_modificationCount++;
 			return var;
 		}
 
@@ -366,6 +439,7 @@ cvar_t *Cvar_Set2( const char *var_name, const char *value, bool force ) {
 	}
 	var->modified = true;
 	var->modificationCount++;
+	cvar_modificationCount++;
 
 	free( var->string );   // free the old value string
 
@@ -894,6 +968,7 @@ Reads in all archived cvars
 */
 void Cvar_Init( void ) {
 	cvar_cheats = Cvar_Get( "sv_cheats", "0", CVAR_ROM | CVAR_SYSTEMINFO );
+	cvar_lint = Cvar_Get( "cvar_lint", "0", CVAR_TEMP );
 
 	Cmd_AddCommand( "toggle", Cvar_Toggle_f );
 	Cmd_AddCommand( "set", Cvar_Set_f );
@@ -721,6 +721,23 @@ fileHandle_t FS_FOpenFileWrite( const char *filename ) {
 	return f;
 }
 
+/*
+===========
+FS_WritePath
+
+===========
+*/
+const char *FS_WritePath( const char *qpath ) {
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
+
+	char* ospath = FS_BuildOSPath( fs_homepath->string, fs_gamedir, qpath );
+	FS_CreatePath( ospath );
+	return ospath;
+}
+
 /*
 ===========
 FS_FOpenFileAppend
@@ -0,0 +1,201 @@
+#pragma once
+
+struct FixedPoolStats
+{
+    int capacity;
+    int count;          // currently allocated
+    int highWater;      // most allocated at once since the last clear
+    int allocs;
+    int steals;         // live items freed to make room for a new one
+    int failures;       // allocations refused because the pool was full
+};
+
+/**
+ * @brief Fixed capacity pool of N items with allocation-order iteration.
+ *
+ * The items live in one array. Allocated slots are also recorded, in the order
+ * they were allocated, in a dense index array, so the per-frame update loops
+ * walk memory linearly rather than chasing list pointers, and the oldest item
+ * (the usual victim when the pool is full) is found in O(1).
+ *
+ * Freeing leaves a hole in the order array, which is squeezed out lazily.
+ * Iteration tolerates items being allocated or freed during the walk: new
+ * items are visited before the walk ends and freed items are skipped.
+ *
+ * Handles are positive ints that carry a generation count, so a handle kept
+ * across frames resolves to nullptr once its item has been freed, even if the
+ * slot has since been reused. 0 is never a valid handle.
+ *
+ * The pool does not construct or clear items; callers initialise what they use.
+ */
+template <typename T, int N>
+class FixedPool
+{
+public:
+    typedef int Handle;
+
+    FixedPool() {
+        clear();
+    }
+
+    void clear() {
+        for (int i = 0; i < N; i++) {
+            orderPos[i] = -1;
+            generation[i] = 0;
+            freeSlots[i] = N - 1 - i;     // hand out low slots first
+        }
+        numFree = N;
+        orderHead = orderTail = 0;
+        iterCursor = 0;
+
+        stats.capacity = N;
+        stats.count = 0;
+        stats.highWater = 0;
+        stats.allocs = 0;
+        stats.steals = 0;
+        stats.failures = 0;
+    }
+
+    // returns nullptr if the pool is full
+    T* alloc() {
+        if (!numFree) {
+            stats.failures++;
+            return nullptr;
+        }
+
+        if (orderTail == ORDER_SIZE) {
+            compact();
+        }
+
+        int slot = freeSlots[--numFree];
+        orderPos[slot] = orderTail;
+        order[orderTail++] = slot;
+
+        stats.allocs++;
+        stats.count++;
+        if (stats.count > stats.highWater) {
+            stats.highWater = stats.count;
+        }
+        return &items[slot];
+    }
+
+    void free(T* item) {
+        int slot = (int)(item - items);
+        if (orderPos[slot] < 0) {
+            return;
+        }
+
+        order[orderPos[slot]] = -1;
+        orderPos[slot] = -1;
+        generation[slot] = (generation[slot] + 1) & GENERATION_MASK;
+        freeSlots[numFree++] = slot;
+        stats.count--;
+
+        while (orderHead < orderTail && order[orderHead] < 0) {
+            orderHead++;
+        }
+    }
+
+    // free a live item to make room, counted separately from normal frees
+    void steal(T* item) {
+        stats.steals++;
+        free(item);
+    }
+
+    bool isActive(const T* item) const {
+        return orderPos[item - items] >= 0;
+    }
+
+    T* oldest() {
+        return orderHead < orderTail ? &items[order[orderHead]] : nullptr;
+    }
+
+    int count() const {
+        return stats.count;
+    }
+
+    bool full() const {
+        return numFree == 0;
+    }
+
+    Handle handleFor(const T* item) const {
+        int slot = (int)(item - items);
+        return (generation[slot] << SLOT_BITS) | (slot + 1);
+    }
+
+    T* get(Handle handle) {
+        if (handle <= 0) {
+            return nullptr;
+        }
+        int slot = (handle & SLOT_MASK) - 1;
+        if (slot >= N || orderPos[slot] < 0 || generation[slot] != (handle >> SLOT_BITS)) {
+            return nullptr;
+        }
+        return &items[slot];
+    }
+
+    // walk live items from oldest to newest
+    T* first() {
+        // squeeze out the holes once they outnumber the live items
+        if (orderTail - orderHead > 2 * stats.count + 16) {
+            compact();
+        }
+        iterCursor = orderHead;
+        return next();
+    }
+
+    T* next() {
+        while (iterCursor < orderTail) {
+            int slot = order[iterCursor++];
+            if (slot >= 0) {
+                return &items[slot];
+            }
+        }
+        return nullptr;
+    }
+
+    const FixedPoolStats& getStats() const {
+        return stats;
+    }
+
+private:
+    static const int SLOT_BITS = 16;
+    static const int SLOT_MASK = (1 << SLOT_BITS) - 1;
+    static const int GENERATION_MASK = 0x7fff;
+    static const int ORDER_SIZE = N * 2;
+
+    static_assert(N < SLOT_MASK, "FixedPool slot index must fit in a handle");
+
+    void compact() {
+        int out = 0;
+        int cursor = 0;
+        for (int i = orderHead; i < orderTail; i++) {
+            if (i == iterCursor) {
+                cursor = out;
+            }
+            int slot = order[i];
+            if (slot >= 0) {
+                orderPos[slot] = out;
+                order[out++] = slot;
+            }
+        }
+        if (iterCursor >= orderTail) {
+            cursor = out;
+        }
+        iterCursor = cursor;
+        orderHead = 0;
+        orderTail = out;
+    }
+
+    T items[N];
+    int generation[N];
+    int orderPos[N];            // index into order, -1 if the slot is free
+    int freeSlots[N];
+    int numFree;
+
+    int order[ORDER_SIZE];      // slots in allocation order, -1 for freed
+    int orderHead, orderTail;
+    int iterCursor;
+
+    FixedPoolStats stats;
+};
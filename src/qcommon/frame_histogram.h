@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Histogram of per-frame times, for timedemo reports.
+ *
+ * Samples are microseconds. Bucket 0 holds samples under FIRST_BUCKET_USEC
+ * and each bucket after that covers twice the range of the one before, so a
+ * handful of buckets spans everything from a null renderer frame to a hitch
+ * of several seconds. The last bucket takes everything larger. Exact min,
+ * max and total are kept alongside; percentiles are resolved to a bucket
+ * bound, which is as much precision as a frame time report needs.
+ */
+class FrameHistogram
+{
+public:
+    static const int NUM_BUCKETS = 16;
+    static const int FIRST_BUCKET_USEC = 64;
+
+    FrameHistogram() {
+        clear();
+    }
+
+    void clear() {
+        for (int i = 0; i < NUM_BUCKETS; i++) {
+            buckets[i] = 0;
+        }
+        count = 0;
+        total = 0;
+        minUsec = 0;
+        maxUsec = 0;
+    }
+
+    void add(int usec) {
+        if (usec < 0) {
+            usec = 0;
+        }
+        if (!count || usec < minUsec) {
+            minUsec = usec;
+        }
+        if (usec > maxUsec) {
+            maxUsec = usec;
+        }
+        buckets[bucketFor(usec)]++;
+        count++;
+        total += usec;
+    }
+
+    static int bucketFor(int usec) {
+        int bucket = 0;
+        for (int limit = FIRST_BUCKET_USEC; usec >= limit && bucket < NUM_BUCKETS - 1; limit <<= 1) {
+            bucket++;
+        }
+        return bucket;
+    }
+
+    // samples in bucket are >= lowerBound and < upperBound (the last bucket has no upper bound)
+    static int lowerBound(int bucket) {
+        return bucket ? FIRST_BUCKET_USEC << (bucket - 1) : 0;
+    }
+
+    static int upperBound(int bucket) {
+        return FIRST_BUCKET_USEC << bucket;
+    }
+
+    // upper bound of the bucket holding the given percentile, or maxUsec if that is lower
+    int percentile(float pct) const {
+        if (!count) {
+            return 0;
+        }
+        int64_t rank = (int64_t)(count * pct / 100.0f + 0.5f);
+        if (rank < 1) {
+            rank = 1;
+        }
+        int64_t seen = 0;
+        for (int i = 0; i < NUM_BUCKETS - 1; i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return upperBound(i) < maxUsec ? upperBound(i) : maxUsec;
+            }
+        }
+        return maxUsec;
+    }
+
+    float mean() const {
+        return count ? (float)total / count : 0.0f;
+    }
+
+    int buckets[NUM_BUCKETS];
+    int count;
+    int64_t total;
+    int minUsec;
+    int maxUsec;
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Where the glyph pages of a font go in the one texture that holds them all.
+ *
+ * The prerendered fonts come as several 256x256 pages per point size, and a
+ * string that crosses pages changes shader, which ends the renderer's batch.
+ * The pages are copied into a grid of cols x rows cells, both powers of two
+ * so the texture is one too, and a glyph's texture coordinates are moved from
+ * its page into its cell with remap(). A layout that would be larger than
+ * maxSize on either side is not valid and the font keeps its pages.
+ */
+struct GlyphAtlas
+{
+    int cols = 0;
+    int rows = 0;
+    int width = 0;
+    int height = 0;
+
+    static GlyphAtlas layout(int pages, int pageWidth, int pageHeight, int maxSize) {
+        GlyphAtlas atlas;
+        if (pages < 1 || pageWidth < 1 || pageHeight < 1) {
+            return atlas;
+        }
+        // square-ish, wider than tall
+        int cols = 1, rows = 1;
+        while (cols * rows < pages) {
+            if (cols <= rows) {
+                cols *= 2;
+            } else {
+                rows *= 2;
+            }
+        }
+        if (cols * pageWidth > maxSize || rows * pageHeight > maxSize) {
+            return atlas;
+        }
+        atlas.cols = cols;
+        atlas.rows = rows;
+        atlas.width = cols * pageWidth;
+        atlas.height = rows * pageHeight;
+        return atlas;
+    }
+
+    bool valid() const {
+        return cols > 0;
+    }
+
+    int col(int page) const {
+        return page % cols;
+    }
+
+    int row(int page) const {
+        return page / cols;
+    }
+
+    void remap(int page, float& s, float& t) const {
+        s = (col(page) + s) / cols;
+        t = (row(page) + t) / rows;
+    }
+};
+
+/**
+ * @brief Collects the quads of the text being drawn and hands them to the
+ * renderer as one command per run of the same shader.
+ *
+ * Quad is stretchQuad_t, or anything with its members. The batch is submitted
+ * when the shader changes, when it is full, on flush() and when it goes out of
+ * scope, so the quads reach the renderer in the order they were added.
+ */
+template <typename Quad, int Size>
+class QuadBatch
+{
+public:
+    using Submit = void (*)(int shader, const Quad* quads, int count);
+
+    explicit QuadBatch(Submit submit) : submit(submit) {
+    }
+
+    QuadBatch(const QuadBatch&) = delete;
+    QuadBatch& operator=(const QuadBatch&) = delete;
+
+    ~QuadBatch() {
+        flush();
+    }
+
+    void add(int shader, float x, float y, float w, float h, float s1, float t1, float s2, float t2,
+             const float color[4]) {
+        if (count && (shader != current || count == Size)) {
+            flush();
+        }
+        current = shader;
+        Quad& quad = quads[count++];
+        quad.x = x;
+        quad.y = y;
+        quad.w = w;
+        quad.h = h;
+        quad.s1 = s1;
+        quad.t1 = t1;
+        quad.s2 = s2;
+        quad.t2 = t2;
+        for (int i = 0; i < 4; i++) {
+            const float c = color[i] * 255.0f;
+            quad.modulate[i] = c <= 0.0f ? 0 : c >= 255.0f ? 255 : (uint8_t)c;
+        }
+    }
+
+    void flush() {
+        if (count) {
+            submit(current, quads, count);
+            count = 0;
+        }
+    }
+
+    int size() const {
+        return count;
+    }
+
+private:
+    Submit submit;
+    int current = 0;
+    int count = 0;
+    Quad quads[Size];
+};
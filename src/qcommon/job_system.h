@@ -0,0 +1,411 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Per-thread bump allocator for memory that only lives until the end of the frame.
+ *
+ * alloc() hands out memory from the current block and starts a new, larger
+ * one when it runs out; nothing is freed until reset(), which keeps the
+ * largest block for the next frame. One allocator belongs to one thread, see
+ * JobSystem::scratch().
+ */
+class ScratchAllocator
+{
+public:
+    static constexpr size_t BLOCK_SIZE = 256 * 1024;
+
+    void* alloc(size_t size, size_t align = 16) {
+        if (!blocks.empty()) {
+            Block& block = blocks.back();
+            const uintptr_t base = (uintptr_t)block.data.get();
+            const size_t offset = ((base + block.used + align - 1) & ~(uintptr_t)(align - 1)) - base;
+            if (offset + size <= block.size) {
+                block.used = offset + size;
+                total += size;
+                return block.data.get() + offset;
+            }
+        }
+        size_t size2 = std::max(size + align, blocks.empty() ? BLOCK_SIZE : blocks.back().size * 2);
+        blocks.push_back({ std::unique_ptr<uint8_t[]>(new uint8_t[size2]), size2, 0 });
+        return alloc(size, align);
+    }
+
+    template <typename T>
+    T* alloc(size_t count) {
+        return (T*)alloc(count * sizeof(T), alignof(T) > 16 ? alignof(T) : 16);
+    }
+
+    void reset() {
+        if (blocks.size() > 1) {
+            std::swap(blocks.front(), blocks.back());
+            blocks.resize(1);
+        }
+        if (!blocks.empty()) {
+            blocks.front().used = 0;
+        }
+        total = 0;
+    }
+
+    // bytes handed out since the last reset
+    size_t used() const {
+        return total;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    std::vector<Block> blocks;
+    size_t total = 0;
+};
+
+/**
+ * @brief Worker threads that run jobs, with fences to wait for them.
+ *
+ * Each worker has its own queue. A job submitted from a worker goes on that
+ * worker's queue, and from any other thread on a shared one. Workers take
+ * their newest job first and, when their queue is empty, steal the oldest
+ * from the others, so work spreads out without a central queue everyone
+ * contends on. A thread waiting on a Fence runs jobs too instead of
+ * blocking, which is also how jobs get run when there are no workers at all
+ * (com_workers 0): on the thread that waits for them.
+ *
+ * Long jobs that mustn't hold up a frame (file I/O) go in with
+ * submitBackground(). Only idle workers run those, never a thread waiting
+ * on a fence, unless there are no workers at all.
+ *
+ * On top of that are parallelFor(), which splits a range into jobs and waits
+ * for them, TaskGraph for jobs that depend on each other, and frame(), the
+ * fence the engine waits on at the end of every frame, after which the
+ * scratch allocators of all threads are reset.
+ *
+ * Jobs must not throw or call Com_Error: the longjmp would leave the
+ * worker's stack. The thread that called start() counts as thread 0, the
+ * workers as 1 to workers(); scratch() is for those threads only.
+ */
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+
+    // counts the jobs submitted against it that haven't finished
+    class Fence
+    {
+    public:
+        bool done() const {
+            return pending.load(std::memory_order_acquire) == 0;
+        }
+
+    private:
+        friend class JobSystem;
+        std::atomic<int> pending{0};
+    };
+
+    // jobs run once all the jobs that precede them have; run() it again once done
+    class TaskGraph
+    {
+    public:
+        int add(Job job) {
+            nodes.push_back(std::make_unique<Node>());
+            nodes.back()->job = std::move(job);
+            return (int)nodes.size() - 1;
+        }
+
+        void precede(int before, int after) {
+            nodes[before]->successors.push_back(after);
+            nodes[after]->predecessors++;
+        }
+
+        int size() const {
+            return (int)nodes.size();
+        }
+
+        void run(JobSystem& jobs, Fence& fence) {
+            fence.pending.fetch_add((int)nodes.size(), std::memory_order_relaxed);
+            for (const std::unique_ptr<Node>& node : nodes) {
+                node->remaining.store(node->predecessors, std::memory_order_relaxed);
+            }
+            for (int i = 0; i < (int)nodes.size(); i++) {
+                if (nodes[i]->predecessors == 0) {
+                    submitNode(jobs, fence, i);
+                }
+            }
+        }
+
+    private:
+        struct Node {
+            Job job;
+            std::vector<int> successors;
+            int predecessors = 0;
+            std::atomic<int> remaining{0};
+        };
+
+        void submitNode(JobSystem& jobs, Fence& fence, int i) {
+            jobs.submit([this, &jobs, &fence, i] {
+                Node& node = *nodes[i];
+                node.job();
+                for (int next : node.successors) {
+                    if (nodes[next]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        submitNode(jobs, fence, next);
+                    }
+                }
+                fence.pending.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        std::vector<std::unique_ptr<Node>> nodes;
+    };
+
+    JobSystem() = default;
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    ~JobSystem() {
+        stop();
+    }
+
+    // the calling thread becomes thread 0; each worker calls begin(index) before taking jobs
+    void start(int workers, const std::function<void(int)>& begin = nullptr) {
+        stop();
+        workers = std::max(workers, 0);
+        current() = { this, 0 };
+        queues.clear();
+        scratches.clear();
+        for (int i = 0; i <= workers; i++) {
+            queues.push_back(std::make_unique<Queue>());
+            scratches.push_back(std::make_unique<ScratchAllocator>());
+        }
+        stopping = false;
+        for (int i = 1; i <= workers; i++) {
+            threads.emplace_back([this, i, begin] {
+                current() = { this, i };
+                if (begin) {
+                    begin(i);
+                }
+                workerLoop(i);
+            });
+        }
+    }
+
+    // finishes the jobs already queued, then joins the workers
+    void stop() {
+        if (queues.empty()) {
+            return;
+        }
+        wait(frameFence);
+        while (queued.load(std::memory_order_acquire) > 0) {
+            if (!runOne(0, threads.empty())) {
+                std::this_thread::yield();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+        // whatever the last jobs queued
+        while (runOne(0, true)) {
+        }
+        queues.clear();
+        scratches.clear();
+    }
+
+    int workers() const {
+        return (int)threads.size();
+    }
+
+    bool running() const {
+        return !queues.empty();
+    }
+
+    // 0 for the thread that started the jobs, 1 to workers() for the workers, -1 for any other
+    int threadIndex() const {
+        return current().jobs == this ? current().index : -1;
+    }
+
+    void submit(Job job, Fence* fence = nullptr) {
+        if (fence) {
+            fence->pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        int index = std::max(threadIndex(), 0);
+        {
+            std::lock_guard<std::mutex> guard(queues[index]->lock);
+            queues[index]->jobs.push_back({ std::move(job), fence });
+        }
+        queued.fetch_add(1, std::memory_order_release);
+        {
+            // a worker between finding nothing and sleeping would miss the notify otherwise
+            std::lock_guard<std::mutex> guard(sleepLock);
+        }
+        wake.notify_one();
+    }
+
+    // a job only an idle worker runs, so waiting for other jobs never picks it up
+    void submitBackground(Job job, Fence* fence = nullptr) {
+        if (fence) {
+            fence->pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        {
+            std::lock_guard<std::mutex> guard(background.lock);
+            background.jobs.push_back({ std::move(job), fence });
+        }
+        queued.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+        }
+        wake.notify_one();
+    }
+
+    // runs jobs until everything submitted against the fence has finished
+    void wait(Fence& fence) {
+        const int index = std::max(threadIndex(), 0);
+        while (!fence.done()) {
+            if (!runOne(index, threads.empty())) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // body(first, last) over [begin, end) in chunks of up to grain, returns when all are done
+    void parallelFor(int begin, int end, int grain, const std::function<void(int, int)>& body) {
+        grain = std::max(grain, 1);
+        if (end - begin <= grain || threads.empty()) {
+            for (int first = begin; first < end; first += grain) {
+                body(first, std::min(first + grain, end));
+            }
+            return;
+        }
+        Fence fence;
+        for (int first = begin + grain; first < end; first += grain) {
+            const int last = std::min(first + grain, end);
+            submit([&body, first, last] { body(first, last); }, &fence);
+        }
+        body(begin, begin + grain);
+        wait(fence);
+    }
+
+    // the jobs that have to be finished by the end of the frame
+    Fence& frame() {
+        return frameFence;
+    }
+
+    // waits for the frame's jobs, then reclaims every thread's scratch memory
+    void endFrame() {
+        wait(frameFence);
+        for (const std::unique_ptr<ScratchAllocator>& scratch : scratches) {
+            scratch->reset();
+        }
+    }
+
+    ScratchAllocator& scratch() {
+        return *scratches[threadIndex()];
+    }
+
+private:
+    struct Entry {
+        Job job;
+        Fence* fence;
+    };
+
+    struct Queue {
+        std::mutex lock;
+        std::deque<Entry> jobs;
+    };
+
+    struct ThreadSlot {
+        const JobSystem* jobs;
+        int index;
+    };
+
+    static ThreadSlot& current() {
+        thread_local ThreadSlot slot = { nullptr, -1 };
+        return slot;
+    }
+
+    // the newest job of the thread's own queue, or the oldest of someone else's,
+    // or the oldest background job
+    bool take(int index, bool takeBackground, Entry& entry) {
+        {
+            Queue& own = *queues[index];
+            std::lock_guard<std::mutex> guard(own.lock);
+            if (!own.jobs.empty()) {
+                entry = std::move(own.jobs.back());
+                own.jobs.pop_back();
+                return true;
+            }
+        }
+        const int count = (int)queues.size();
+        for (int i = 1; i < count; i++) {
+            Queue& other = *queues[(index + i) % count];
+            std::lock_guard<std::mutex> guard(other.lock);
+            if (!other.jobs.empty()) {
+                entry = std::move(other.jobs.front());
+                other.jobs.pop_front();
+                return true;
+            }
+        }
+        if (takeBackground) {
+            std::lock_guard<std::mutex> guard(background.lock);
+            if (!background.jobs.empty()) {
+                entry = std::move(background.jobs.front());
+                background.jobs.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool runOne(int index, bool takeBackground = false) {
+        Entry entry;
+        if (!take(index, takeBackground, entry)) {
+            return false;
+        }
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        entry.job();
+        if (entry.fence) {
+            entry.fence->pending.fetch_sub(1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    void workerLoop(int index) {
+        while (true) {
+            if (runOne(index, true)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> guard(sleepLock);
+            wake.wait(guard, [this] { return stopping || queued.load(std::memory_order_acquire) > 0; });
+            if (stopping) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues;         // 0 is shared by every thread but the workers
+    Queue background;                                   // submitBackground(), for idle workers
+    std::vector<std::unique_ptr<ScratchAllocator>> scratches;
+    std::vector<std::thread> threads;
+    std::atomic<int> queued{0};                         // jobs in the queues
+    std::mutex sleepLock;                               // guards stopping
+    std::condition_variable wake;
+    bool stopping = false;
+    Fence frameFence;
+};
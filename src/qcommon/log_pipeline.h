@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Printed messages on their way from the threads that print them to
+ * the one thread that writes them out.
+ *
+ * Every thread that pushes a message gets a ring of its own, which only it
+ * writes and only the reader reads, so pushing takes no lock: the message is
+ * copied in and the ring's head moved on. drain() takes the messages out of
+ * all the rings in the order they were pushed in. A message that doesn't fit
+ * in its ring is dropped and counted rather than waited for. A thread's ring
+ * is kept when it exits and handed to the next new thread once it has been
+ * drained.
+ *
+ * enabled() is the filter on severity and subsystem, checked before a message
+ * is formatted so that filtered messages cost next to nothing.
+ */
+class LogPipeline
+{
+public:
+    static constexpr uint32_t RING_SIZE = 256 * 1024;
+
+    struct Record {
+        uint64_t sequence;
+        int severity;
+        int subsystem;
+        int flags;
+        const char* text;       // not terminated
+        int length;
+    };
+
+    // ringSize is a power of two
+    explicit LogPipeline(uint32_t ringSize = RING_SIZE)
+        : ringSize(ringSize), id(nextId()) {
+    }
+
+    LogPipeline(const LogPipeline&) = delete;
+    LogPipeline& operator=(const LogPipeline&) = delete;
+
+    // messages at least minSeverity from the subsystems whose bits are set
+    void setFilter(int minSeverity, uint32_t subsystems) {
+        filterSeverity.store(minSeverity, std::memory_order_relaxed);
+        filterSubsystems.store(subsystems, std::memory_order_relaxed);
+    }
+
+    bool enabled(int severity, int subsystem) const {
+        return severity >= filterSeverity.load(std::memory_order_relaxed)
+            && (filterSubsystems.load(std::memory_order_relaxed) >> (subsystem & 31) & 1) != 0;
+    }
+
+    // false if it was dropped
+    bool push(int severity, int subsystem, int flags, const char* text, int length) {
+        Ring& ring = threadRing();
+        const uint32_t needed = align((uint32_t)(sizeof(Header) + length));
+        const uint32_t head = ring.head.load(std::memory_order_relaxed);
+        const uint32_t tail = ring.tail.load(std::memory_order_acquire);
+        const uint32_t pos = head & (ringSize - 1);
+        // a message is never split by the end of the ring
+        const uint32_t skip = ringSize - pos < needed ? ringSize - pos : 0;
+        if (needed + skip > ringSize - (head - tail)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (skip >= sizeof(Header)) {
+            Header pad = { 0, skip, -1, 0, 0, 0 };
+            memcpy(ring.data.get() + pos, &pad, sizeof(pad));
+        }
+        uint8_t* out = ring.data.get() + ((head + skip) & (ringSize - 1));
+        Header header = { sequence.fetch_add(1, std::memory_order_relaxed), needed, length,
+            (uint8_t)severity, (uint8_t)subsystem, (uint16_t)flags };
+        memcpy(out, &header, sizeof(header));
+        memcpy(out + sizeof(header), text, length);
+        ring.head.store(head + skip + needed, std::memory_order_release);
+        return true;
+    }
+
+    // hands every message pushed so far to write(const Record&), oldest first; one thread at a time
+    template <typename Write>
+    int drain(Write&& write) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            reading = rings;
+        }
+        int count = 0;
+        while (true) {
+            Ring* oldest = nullptr;
+            Header oldestHeader;
+            for (const std::shared_ptr<Ring>& ring : reading) {
+                Header header;
+                if (peek(*ring, header) && (!oldest || header.sequence < oldestHeader.sequence)) {
+                    oldest = ring.get();
+                    oldestHeader = header;
+                }
+            }
+            if (!oldest) {
+                break;
+            }
+            const uint32_t tail = oldest->tail.load(std::memory_order_relaxed);
+            const uint8_t* in = oldest->data.get() + (tail & (ringSize - 1));
+            write(Record{ oldestHeader.sequence, oldestHeader.severity, oldestHeader.subsystem,
+                oldestHeader.flags, (const char*)in + sizeof(Header), oldestHeader.length });
+            oldest->tail.store(tail + oldestHeader.bytes, std::memory_order_release);
+            count++;
+        }
+        return count;
+    }
+
+    // messages dropped since the last call
+    uint32_t takeDropped() {
+        return dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+    // one for every thread that has pushed a message, less those handed on
+    int ringCount() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return (int)rings.size();
+    }
+
+private:
+    struct Header {
+        uint64_t sequence;
+        uint32_t bytes;         // to the next message
+        int32_t length;         // of the text, -1 for padding at the end of the ring
+        uint8_t severity;
+        uint8_t subsystem;
+        uint16_t flags;
+    };
+
+    struct Ring {
+        explicit Ring(uint32_t size) : data(new uint8_t[size]) {
+        }
+
+        std::unique_ptr<uint8_t[]> data;
+        std::atomic<uint32_t> head{0};      // moved on by the thread that owns it
+        std::atomic<uint32_t> tail{0};      // moved on by drain()
+        std::atomic<bool> owned{true};
+    };
+
+    struct ThreadSlot {
+        uint64_t pipeline = 0;
+        std::shared_ptr<Ring> ring;
+
+        ~ThreadSlot() {
+            if (ring) {
+                ring->owned.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    static uint64_t nextId() {
+        static std::atomic<uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static uint32_t align(uint32_t bytes) {
+        return (bytes + alignof(Header) - 1) & ~(uint32_t)(alignof(Header) - 1);
+    }
+
+    Ring& threadRing() {
+        thread_local ThreadSlot slot;
+        if (slot.pipeline == id) {
+            return *slot.ring;
+        }
+        if (slot.ring) {
+            slot.ring->owned.store(false, std::memory_order_release);
+            slot.ring.reset();
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        for (const std::shared_ptr<Ring>& ring : rings) {
+            if (!ring->owned.load(std::memory_order_acquire)
+                && ring->head.load(std::memory_order_relaxed) == ring->tail.load(std::memory_order_acquire)) {
+                slot.ring = ring;
+                break;
+            }
+        }
+        if (!slot.ring) {
+            slot.ring = std::make_shared<Ring>(ringSize);
+            rings.push_back(slot.ring);
+        }
+        slot.ring->owned.store(true, std::memory_order_relaxed);
+        slot.pipeline = id;
+        return *slot.ring;
+    }
+
+    // the next message of the ring, skipping the padding at the end
+    bool peek(Ring& ring, Header& header) {
+        while (true) {
+            const uint32_t tail = ring.tail.load(std::memory_order_relaxed);
+            if (tail == ring.head.load(std::memory_order_acquire)) {
+                return false;
+            }
+            const uint32_t pos = tail & (ringSize - 1);
+            if (ringSize - pos < sizeof(Header)) {
+                ring.tail.store(tail + ringSize - pos, std::memory_order_release);
+                continue;
+            }
+            memcpy(&header, ring.data.get() + pos, sizeof(header));
+            if (header.length < 0) {
+                ring.tail.store(tail + header.bytes, std::memory_order_release);
+                continue;
+            }
+            return true;
+        }
+    }
+
+    const uint32_t ringSize;
+    const uint64_t id;
+    mutable std::mutex lock;                            // guards rings
+    std::vector<std::shared_ptr<Ring>> rings;
+    std::vector<std::shared_ptr<Ring>> reading;         // drain()'s copy of rings
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<int> filterSeverity{0};
+    std::atomic<uint32_t> filterSubsystems{~0u};
+};
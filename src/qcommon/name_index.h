@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Case insensitive string index from (key, name) to items.
+ *
+ * Each item (a small integer owned by the caller, such as an entity number)
+ * holds up to NumKeys names, for instance its classname and targetname. The
+ * index remembers the string pointer it last saw for each item and key, so
+ * set() is cheap to call again with an unchanged name and callers can resync
+ * an item whenever its names might have been changed.
+ *
+ * candidates() returns the items whose name hashes like the given one, in
+ * ascending order. Names that merely collide are included, so callers must
+ * still compare the strings; in exchange a lookup costs a hash and a walk
+ * over a short list rather than a scan of every item.
+ */
+template <int NumKeys>
+class NameIndex
+{
+public:
+    static const int HASH_SIZE = 1024;          // must be a power of two
+
+    explicit NameIndex(int maxItems)
+        : maxItems(maxItems), names(NumKeys * maxItems, nullptr), hashes(NumKeys * maxItems, 0),
+          buckets(NumKeys * HASH_SIZE) {
+    }
+
+    void clear() {
+        std::fill(names.begin(), names.end(), nullptr);
+        for (std::vector<int>& bucket : buckets) {
+            bucket.clear();
+        }
+    }
+
+    // returns true if the name pointer changed and the item was reindexed
+    bool set(int key, int item, const char* name) {
+        int slot = key * maxItems + item;
+        if (names[slot] == name) {
+            return false;
+        }
+
+        if (names[slot]) {
+            std::vector<int>& bucket = buckets[key * HASH_SIZE + hashes[slot]];
+            auto it = std::lower_bound(bucket.begin(), bucket.end(), item);
+            if (it != bucket.end() && *it == item) {
+                bucket.erase(it);
+            }
+        }
+
+        names[slot] = name;
+        if (name) {
+            hashes[slot] = hash(name);
+            std::vector<int>& bucket = buckets[key * HASH_SIZE + hashes[slot]];
+            bucket.insert(std::lower_bound(bucket.begin(), bucket.end(), item), item);
+        }
+        return true;
+    }
+
+    const char* get(int key, int item) const {
+        return names[key * maxItems + item];
+    }
+
+    const std::vector<int>& candidates(int key, const char* name) const {
+        return buckets[key * HASH_SIZE + hash(name)];
+    }
+
+    // FNV-1a over the lower cased name, folded into the table size
+    static int hash(const char* name) {
+        uint32_t h = 2166136261u;
+        for (const char* p = name; *p; p++) {
+            char c = *p;
+            if (c >= 'A' && c <= 'Z') {
+                c += 'a' - 'A';
+            }
+            h = (h ^ (uint8_t)c) * 16777619u;
+        }
+        return (int)((h ^ (h >> 16)) & (HASH_SIZE - 1));
+    }
+
+private:
+    int maxItems;
+    std::vector<const char*> names;             // [key * maxItems + item]
+    std::vector<int> hashes;
+    std::vector<std::vector<int>> buckets;      // [key * HASH_SIZE + hash], sorted items
+};
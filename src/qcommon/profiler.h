@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Scoped zone profiler with a timeline per thread.
+ *
+ * A ProfileZone records when its scope was entered and left. Each thread
+ * writes its zones into its own ring buffer, so recording takes no locks and
+ * only the newest RING_SIZE zones of every thread are kept. Nested zones are
+ * not linked up explicitly: a zone that starts and ends inside another one is
+ * its child, which is how trace viewers draw the hierarchy too.
+ *
+ * Zone names are not copied and must outlive the profiler; PROFILE_ZONE is
+ * meant for string literals. A zone left by Com_Error's longjmp is simply
+ * not recorded. Code is instrumented with PROFILE_ZONE, which
+ * is empty unless WOLF_PROFILE is defined (cmake -DENABLE_PROFILER=ON), so
+ * builds without it don't pay for the zones at all. With it the cost of a
+ * zone while profiling is off is one relaxed load and a branch.
+ */
+class Profiler
+{
+public:
+    static const int RING_SIZE = 1 << 17;      // zones kept per thread, must be a power of two
+
+    struct Zone {
+        const char* name;
+        int64_t start;                          // nsec since the profiler started
+        int64_t end;
+    };
+
+    struct Timeline {
+        int id = 0;
+        std::string name;
+        bool owned = false;                     // false once the thread has exited
+        std::atomic<uint32_t> written{0};       // zones ever recorded, the ring holds the newest
+        Zone zones[RING_SIZE];
+    };
+
+    static Profiler& get() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    bool enabled() const {
+        return active.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool on) {
+        active.store(on, std::memory_order_relaxed);
+    }
+
+    int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    // the calling thread's timeline, picked the first time the thread records a zone;
+    // a new thread reuses the timeline of one that has exited
+    Timeline& thread() {
+        thread_local ThreadOwner owner;
+        if (!owner.timeline) {
+            std::lock_guard<std::mutex> guard(lock);
+            for (const std::unique_ptr<Timeline>& timeline : timelines) {
+                if (!timeline->owned) {
+                    owner.timeline = timeline.get();
+                    break;
+                }
+            }
+            if (!owner.timeline) {
+                timelines.push_back(std::make_unique<Timeline>());
+                owner.timeline = timelines.back().get();
+                owner.timeline->id = (int)timelines.size();
+                owner.timeline->name = "thread " + std::to_string(owner.timeline->id);
+            }
+            owner.timeline->owned = true;
+        }
+        return *owner.timeline;
+    }
+
+    void setThreadName(const char* name) {
+        Timeline& timeline = thread();
+        std::lock_guard<std::mutex> guard(lock);
+        timeline.name = name;
+    }
+
+    void record(Timeline& timeline, const char* name, int64_t start, int64_t end) {
+        uint32_t n = timeline.written.load(std::memory_order_relaxed);
+        timeline.zones[n & (RING_SIZE - 1)] = { name, start, end };
+        timeline.written.store(n + 1, std::memory_order_release);
+    }
+
+    // forget everything recorded so far, only safe while no thread is recording
+    void clear() {
+        std::lock_guard<std::mutex> guard(lock);
+        for (const std::unique_ptr<Timeline>& timeline : timelines) {
+            timeline->written.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // the zones still in a timeline's ring, oldest first
+    std::vector<Zone> zones(const Timeline& timeline) const {
+        uint32_t end = timeline.written.load(std::memory_order_acquire);
+        uint32_t begin = end > (uint32_t)RING_SIZE ? end - RING_SIZE : 0;
+
+        std::vector<Zone> copy;
+        copy.reserve(end - begin);
+        for (uint32_t i = begin; i < end; i++) {
+            copy.push_back(timeline.zones[i & (RING_SIZE - 1)]);
+        }
+
+        // the owner may have lapped the start of the ring while it was copied,
+        // the slot it is writing now is the one after the last completed zone
+        uint32_t after = timeline.written.load(std::memory_order_acquire);
+        if (after + 1 > begin + RING_SIZE) {
+            uint32_t lapped = std::min(after + 1 - RING_SIZE - begin, (uint32_t)copy.size());
+            copy.erase(copy.begin(), copy.begin() + lapped);
+        }
+        return copy;
+    }
+
+    // every timeline in the Chrome trace event format, for chrome://tracing or Perfetto
+    std::string chromeTrace() const {
+        std::lock_guard<std::mutex> guard(lock);
+        std::string json = "{\"traceEvents\":[\n";
+        char buffer[256];
+        bool first = true;
+
+        for (const std::unique_ptr<Timeline>& timeline : timelines) {
+            snprintf(buffer, sizeof(buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"",
+                     first ? "" : ",\n", timeline->id);
+            json += buffer;
+            appendEscaped(json, timeline->name.c_str());
+            json += "\"}}";
+            first = false;
+
+            for (const Zone& zone : zones(*timeline)) {
+                json += ",\n{\"name\":\"";
+                appendEscaped(json, zone.name);
+                snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                         timeline->id, zone.start / 1000.0, (zone.end - zone.start) / 1000.0);
+                json += buffer;
+            }
+        }
+
+        json += "\n]}\n";
+        return json;
+    }
+
+private:
+    struct ThreadOwner {
+        Timeline* timeline = nullptr;
+        ~ThreadOwner() {
+            if (timeline) {
+                std::lock_guard<std::mutex> guard(get().lock);
+                timeline->owned = false;
+            }
+        }
+    };
+
+    Profiler() : epoch(std::chrono::steady_clock::now()) {
+    }
+
+    static void appendEscaped(std::string& json, const char* s) {
+        for (; *s; s++) {
+            if (*s == '"' || *s == '\\') {
+                json += '\\';
+            }
+            if ((unsigned char)*s >= ' ') {
+                json += *s;
+            }
+        }
+    }
+
+    std::atomic<bool> active{false};
+    std::chrono::steady_clock::time_point epoch;
+    mutable std::mutex lock;                    // guards the timeline list and names
+    std::vector<std::unique_ptr<Timeline>> timelines;
+};
+
+/**
+ * @brief Records the scope it lives in as a zone, if profiling was on when it was entered.
+ */
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char* name) : name(name) {
+        Profiler& profiler = Profiler::get();
+        if (profiler.enabled()) {
+            timeline = &profiler.thread();
+            start = profiler.now();
+        }
+    }
+
+    ~ProfileZone() {
+        if (timeline) {
+            Profiler& profiler = Profiler::get();
+            profiler.record(*timeline, name, start, profiler.now());
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    Profiler::Timeline* timeline = nullptr;
+    int64_t start = 0;
+};
+
+#define PROFILE_ZONE_CONCAT2( a, b ) a##b
+#define PROFILE_ZONE_CONCAT( a, b ) PROFILE_ZONE_CONCAT2( a, b )
+
+#ifdef WOLF_PROFILE
+#define PROFILE_ZONE( name ) ProfileZone PROFILE_ZONE_CONCAT( profileZone, __LINE__ )( name )
+#else
+#define PROFILE_ZONE( name )
+#endif
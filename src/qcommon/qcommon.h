@@ -28,6 +28,7 @@ If you have questions concerning this license or the applicable additional terms
 
 #pragma once
 
+#include <cstdint>
 
 #include "../qcommon/cm_public.h"
 
@@ -380,6 +381,9 @@ void    Cmd_ExecuteString( const char *text );
 // Parses a single line of text into arguments and tries to execute it
 // as if it was typed at the console
 
+void    Cmd_AbortExecution( void );
+// Com_Error calls this, as the commands it interrupted won't return
+
 
 /*
 ==============================================================
@@ -471,6 +475,16 @@ extern int cvar_modifiedFlags;
 // etc, variables have been modified since the last check.  The bit
 // can then be cleared to allow another change detection.
 
+extern int cvar_modificationCount;
+// incremented along with the modificationCount of any cvar, so a module
+// that remembers it can skip updating its vmCvar_t table when nothing
+// has changed since the last update
+
+void    Cvar_LintFrame( void );
+// with cvar_lint set, prints how many lookups by name were made since the
+// last call, called once a frame.  Code that reads a cvar every frame
+// should hold on to the cvar_t * from Cvar_Get instead.
+
 /*
 ==============================================================
 
@@ -514,6 +528,11 @@ void    FS_FreeFileList( char **list );
 
 bool FS_FileExists( const char *file );
 
+const char *FS_WritePath( const char *qpath );
+// full OS path FS_FOpenFileWrite would use for qpath, creating any directories
+// it needs. For writers on other threads, which can't use the handle table.
+// The returned buffer is overwritten by the next call.
+
 int     FS_LoadStack();
 
 int     FS_GetFileList(  const char *path, const char *extension, char *listbuf, int bufsize );
@@ -611,18 +630,6 @@ MISC
 ==============================================================
 */
 
-// returnbed by Sys_GetProcessorId
-#define CPUID_GENERIC           0           // any unrecognized processor
-
-#define CPUID_AXP               0x10
-
-#define CPUID_INTEL_UNSUPPORTED 0x20            // Intel 386/486
-#define CPUID_INTEL_PENTIUM     0x21            // Intel Pentium or PPro
-#define CPUID_INTEL_MMX         0x22            // Intel Pentium/MMX or P2/MMX
-#define CPUID_INTEL_KATMAI      0x23            // Intel Katmai
-
-#define CPUID_AMD_3DNOW         0x30            // AMD K6 3DNOW!
-
 typedef enum {
 	// EVT_NONE must be zero
 	EVT_NONE = 0,		// evTime is still valid
@@ -652,6 +659,29 @@ void Com_BeginRedirect( char *buffer, int buffersize, void ( *flush )( char * )
 void        Com_EndRedirect( void );
 void  Com_Printf( const char *fmt, ... );
 void  Com_DPrintf( const char *fmt, ... );
+
+// com_logLevel is the lowest severity printed, com_logMask has a bit for each subsystem printed
+typedef enum {
+	LOG_DEBUG,
+	LOG_INFO,
+	LOG_WARNING,
+	LOG_ERROR
+} logSeverity_t;
+
+typedef enum {
+	LOG_COMMON,
+	LOG_SERVER,
+	LOG_CLIENT,
+	LOG_RENDERER,
+	LOG_GAME,
+	LOG_AI,
+	LOG_BOTLIB
+} logSubsystem_t;
+
+void  Com_LogPrintf( logSubsystem_t subsystem, logSeverity_t severity, const char *fmt, ... );
+void  Com_LogVPrintf( logSubsystem_t subsystem, logSeverity_t severity, const char *fmt, va_list argptr );
+bool        Com_LogEnabled( logSubsystem_t subsystem, logSeverity_t severity );
+void        Com_FlushLog( void );       // main thread only, prints what other threads printed
 [[noreturn]] void  Com_Error( int code, const char *fmt, ... );
 void        Com_Quit_f( void );
 
@@ -675,6 +705,8 @@ extern cvar_t  *com_developer;
 
 extern cvar_t  *com_speeds;
 extern cvar_t  *com_timescale;
+extern cvar_t  *com_fixedtime;
+extern cvar_t  *com_savegameLoading;    // 1 while a savegame is loading, 2 while a map restarts from one
 extern cvar_t  *com_sv_running;
 extern cvar_t  *com_cl_running;
 extern cvar_t  *com_viewlog;            // 0 = hidden, 1 = visible, 2 = minimized
@@ -692,6 +724,7 @@ extern cvar_t  *sv_paused;
 extern int time_game;
 extern int time_frontend;
 extern int time_backend;            // renderer backend time
+extern bool com_timeFrames;         // measure the com_speeds times even if they aren't printed
 
 extern int com_frameTime;
 extern int com_frameMsec;
@@ -706,6 +739,11 @@ void *Hunk_AllocateTempMemory( size_t size );
 void Hunk_FreeTempMemory( void *buf );
 
 
+// worker threads shared by the server, game, botlib and renderer, see job_system.h
+#define MAX_JOB_WORKERS     31
+class JobSystem;
+JobSystem   &Com_Jobs( void );
+
 // commandLine should not include the executable name (argv[0])
 void Com_Init( char *commandLine );
 void Com_Frame( void );
@@ -731,6 +769,8 @@ void CL_Init( void );
 void CL_Disconnect( bool showMainMenu );
 void CL_Shutdown( void );
 void CL_Frame( int msec );
+void CL_TimeDemoSample( int frameUsec );
+// timedemo collects the com_speeds times of each frame while com_timeFrames is set
 bool CL_GameCommand( void );
 void CL_KeyEvent( int key, bool down, unsigned time );
 
@@ -850,14 +890,14 @@ void    Sys_Print( const char *msg );
 // Sys_Milliseconds should only be used for profiling purposes,
 // any game related timing information should come from event timestamps
 int     Sys_Milliseconds( void );
+// finer grained timer for profiling short sections, same base as Sys_Milliseconds
+int64_t Sys_Microseconds( void );
 
 void    Sys_SnapVector( float *v );
 
 // the system console is shown when a dedicated server is running
 void    Sys_DisplaySystemConsole( bool show );
 
-int     Sys_GetProcessorId( void );
-
 void    Sys_BeginStreamedFile( fileHandle_t f, int readahead );
 void    Sys_EndStreamedFile( fileHandle_t f );
 size_t     Sys_StreamedRead( void *buffer, size_t size, int count, fileHandle_t f );
@@ -0,0 +1,372 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define SAVECODEC_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+Byte codecs for savegames.
+
+Zero runs: the structures saved are mostly zero, in long stretches. The data is
+split into alternating literal and zero runs, each preceded by a varint of
+( length << 1 ) | zero. A literal run only ends at SAVECODEC_MIN_ZERO_RUN or
+more zeros, so scattered zero bytes don't cost a token each, and there is no
+cap on run length. Zeros are found 16 (SSE2) or 8 bytes at a time.
+
+LZ: a small LZ77 in the style of LZ4 blocks, for squeezing the repetition that
+is left between records (strings, similar entities). A sequence is a token
+uint8_t (literal length high nibble, match length - 4 low nibble, 15 meaning
+more length bytes follow), the literals, a little endian 16 bit offset and any
+extra match length bytes. The last sequence has literals only.
+
+Every function returns the number of bytes written, or -1 if the output buffer
+is too small or the input is malformed.
+*/
+
+#define SAVECODEC_MIN_ZERO_RUN  4
+#define SAVECODEC_MIN_MATCH     4
+#define SAVECODEC_HASH_BITS     12
+
+// largest output SaveCodec_EncodeZeroRuns can produce for size bytes
+inline int SaveCodec_ZeroRunBound( int size ) {
+	return size + size / 2 + 16;
+}
+
+// largest output SaveCodec_CompressLZ can produce for size bytes
+inline int SaveCodec_LZBound( int size ) {
+	return size + size / 255 + 16;
+}
+
+inline int SaveCodec_CountTrailingZeros( uint32_t v ) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward( &index, v );
+	return (int)index;
+#else
+	return __builtin_ctz( v );
+#endif
+}
+
+inline int SaveCodec_CountTrailingZeros64( uint64_t v ) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward64( &index, v );
+	return (int)index;
+#else
+	return __builtin_ctzll( v );
+#endif
+}
+
+// number of zero bytes at the start of p
+inline int SaveCodec_ZeroRunLength( const uint8_t *p, int size ) {
+	int i = 0;
+#ifdef SAVECODEC_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	for ( ; i + 16 <= size; i += 16 ) {
+		int mask = _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i *)( p + i ) ), zero ) );
+		if ( mask != 0xffff ) {
+			return i + SaveCodec_CountTrailingZeros( ~mask & 0xffff );
+		}
+	}
+#endif
+	for ( ; i + 8 <= size; i += 8 ) {
+		uint64_t w;
+		memcpy( &w, p + i, sizeof( w ) );
+		if ( w ) {
+			// assumes little endian, like the savegame format itself
+			return i + SaveCodec_CountTrailingZeros64( w ) / 8;
+		}
+	}
+	while ( i < size && !p[i] ) {
+		i++;
+	}
+	return i;
+}
+
+// offset of the first zero uint8_t in p, or size if there is none
+inline int SaveCodec_FindZero( const uint8_t *p, int size ) {
+	int i = 0;
+#ifdef SAVECODEC_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	for ( ; i + 16 <= size; i += 16 ) {
+		int mask = _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i *)( p + i ) ), zero ) );
+		if ( mask ) {
+			return i + SaveCodec_CountTrailingZeros( mask );
+		}
+	}
+#endif
+	for ( ; i + 8 <= size; i += 8 ) {
+		uint64_t w;
+		memcpy( &w, p + i, sizeof( w ) );
+		// has a zero uint8_t
+		if ( ( w - 0x0101010101010101ull ) & ~w & 0x8080808080808080ull ) {
+			break;
+		}
+	}
+	while ( i < size && p[i] ) {
+		i++;
+	}
+	return i;
+}
+
+inline int SaveCodec_WriteVarint( uint8_t *out, int outsize, int pos, uint32_t v ) {
+	do {
+		if ( pos >= outsize ) {
+			return -1;
+		}
+		uint8_t b = v & 0x7f;
+		v >>= 7;
+		out[pos++] = b | ( v ? 0x80 : 0 );
+	} while ( v );
+	return pos;
+}
+
+inline int SaveCodec_ReadVarint( const uint8_t *in, int insize, int pos, uint32_t *v ) {
+	*v = 0;
+	for ( int shift = 0; shift < 35; shift += 7 ) {
+		if ( pos >= insize ) {
+			return -1;
+		}
+		uint8_t b = in[pos++];
+		*v |= (uint32_t)( b & 0x7f ) << shift;
+		if ( !( b & 0x80 ) ) {
+			return pos;
+		}
+	}
+	return -1;
+}
+
+inline int SaveCodec_EncodeZeroRuns( const uint8_t *raw, int rawsize, uint8_t *out, int outsize ) {
+	int rawpos = 0;
+	int outpos = 0;
+
+	while ( rawpos < rawsize ) {
+		int zeros = SaveCodec_ZeroRunLength( raw + rawpos, rawsize - rawpos );
+		if ( zeros ) {
+			outpos = SaveCodec_WriteVarint( out, outsize, outpos, ( (uint32_t)zeros << 1 ) | 1 );
+			if ( outpos < 0 ) {
+				return -1;
+			}
+			rawpos += zeros;
+			continue;
+		}
+
+		// literal run, up to a zero run long enough to be worth a token
+		int end = rawpos;
+		while ( end < rawsize ) {
+			end += SaveCodec_FindZero( raw + end, rawsize - end );
+			if ( end == rawsize ) {
+				break;
+			}
+			int run = SaveCodec_ZeroRunLength( raw + end, rawsize - end );
+			if ( run >= SAVECODEC_MIN_ZERO_RUN || end + run == rawsize ) {
+				break;
+			}
+			end += run;
+		}
+
+		int count = end - rawpos;
+		outpos = SaveCodec_WriteVarint( out, outsize, outpos, (uint32_t)count << 1 );
+		if ( outpos < 0 || outpos + count > outsize ) {
+			return -1;
+		}
+		memcpy( out + outpos, raw + rawpos, count );
+		outpos += count;
+		rawpos = end;
+	}
+
+	return outpos;
+}
+
+inline int SaveCodec_DecodeZeroRuns( const uint8_t *in, int insize, uint8_t *out, int outsize ) {
+	int inpos = 0;
+	int outpos = 0;
+
+	while ( inpos < insize ) {
+		uint32_t header;
+		inpos = SaveCodec_ReadVarint( in, insize, inpos, &header );
+		if ( inpos < 0 ) {
+			return -1;
+		}
+		uint32_t count = header >> 1;
+		if ( count > (uint32_t)( outsize - outpos ) ) {
+			return -1;
+		}
+		if ( header & 1 ) {
+			memset( out + outpos, 0, count );
+		} else {
+			if ( count > (uint32_t)( insize - inpos ) ) {
+				return -1;
+			}
+			memcpy( out + outpos, in + inpos, count );
+			inpos += count;
+		}
+		outpos += count;
+	}
+
+	return outpos;
+}
+
+inline int SaveCodec_WriteLength( uint8_t *out, int outsize, int pos, int length ) {
+	for ( ; length >= 255; length -= 255 ) {
+		if ( pos >= outsize ) {
+			return -1;
+		}
+		out[pos++] = 255;
+	}
+	if ( pos >= outsize ) {
+		return -1;
+	}
+	out[pos++] = (uint8_t)length;
+	return pos;
+}
+
+inline int SaveCodec_ReadLength( const uint8_t *in, int insize, int pos, int *length ) {
+	uint8_t b;
+	do {
+		if ( pos >= insize ) {
+			return -1;
+		}
+		b = in[pos++];
+		*length += b;
+	} while ( b == 255 );
+	return pos;
+}
+
+inline int SaveCodec_WriteSequence( uint8_t *out, int outsize, int pos, const uint8_t *literals, int numLiterals, int offset, int matchLength ) {
+	if ( pos >= outsize ) {
+		return -1;
+	}
+	int tokenPos = pos++;
+	int litNibble = numLiterals < 15 ? numLiterals : 15;
+	int matchNibble = 0;
+	if ( matchLength ) {
+		matchNibble = matchLength - SAVECODEC_MIN_MATCH < 15 ? matchLength - SAVECODEC_MIN_MATCH : 15;
+	}
+	out[tokenPos] = (uint8_t)( ( litNibble << 4 ) | matchNibble );
+
+	if ( litNibble == 15 ) {
+		pos = SaveCodec_WriteLength( out, outsize, pos, numLiterals - 15 );
+		if ( pos < 0 ) {
+			return -1;
+		}
+	}
+	if ( pos + numLiterals > outsize ) {
+		return -1;
+	}
+	memcpy( out + pos, literals, numLiterals );
+	pos += numLiterals;
+
+	if ( !matchLength ) {
+		return pos;
+	}
+	if ( pos + 2 > outsize ) {
+		return -1;
+	}
+	out[pos++] = (uint8_t)( offset & 0xff );
+	out[pos++] = (uint8_t)( offset >> 8 );
+	if ( matchNibble == 15 ) {
+		pos = SaveCodec_WriteLength( out, outsize, pos, matchLength - SAVECODEC_MIN_MATCH - 15 );
+	}
+	return pos;
+}
+
+inline int SaveCodec_CompressLZ( const uint8_t *in, int insize, uint8_t *out, int outsize ) {
+	int table[1 << SAVECODEC_HASH_BITS];
+	for ( int i = 0; i < ( 1 << SAVECODEC_HASH_BITS ); i++ ) {
+		table[i] = -1;
+	}
+
+	int anchor = 0;
+	int ip = 0;
+	int outpos = 0;
+
+	while ( ip + SAVECODEC_MIN_MATCH <= insize ) {
+		uint32_t seq;
+		memcpy( &seq, in + ip, sizeof( seq ) );
+		uint32_t h = ( seq * 2654435761u ) >> ( 32 - SAVECODEC_HASH_BITS );
+		int ref = table[h];
+		table[h] = ip;
+
+		if ( ref < 0 || ip - ref > 0xffff || memcmp( in + ref, in + ip, SAVECODEC_MIN_MATCH ) ) {
+			ip++;
+			continue;
+		}
+
+		int length = SAVECODEC_MIN_MATCH;
+		while ( ip + length < insize && in[ref + length] == in[ip + length] ) {
+			length++;
+		}
+
+		outpos = SaveCodec_WriteSequence( out, outsize, outpos, in + anchor, ip - anchor, ip - ref, length );
+		if ( outpos < 0 ) {
+			return -1;
+		}
+		ip += length;
+		anchor = ip;
+	}
+
+	return SaveCodec_WriteSequence( out, outsize, outpos, in + anchor, insize - anchor, 0, 0 );
+}
+
+inline int SaveCodec_DecompressLZ( const uint8_t *in, int insize, uint8_t *out, int outsize ) {
+	int inpos = 0;
+	int outpos = 0;
+
+	while ( inpos < insize ) {
+		int token = in[inpos++];
+
+		int numLiterals = token >> 4;
+		if ( numLiterals == 15 ) {
+			inpos = SaveCodec_ReadLength( in, insize, inpos, &numLiterals );
+			if ( inpos < 0 ) {
+				return -1;
+			}
+		}
+		if ( numLiterals > insize - inpos || numLiterals > outsize - outpos ) {
+			return -1;
+		}
+		memcpy( out + outpos, in + inpos, numLiterals );
+		inpos += numLiterals;
+		outpos += numLiterals;
+
+		if ( inpos == insize ) {
+			break;      // the last sequence has no match
+		}
+
+		if ( inpos + 2 > insize ) {
+			return -1;
+		}
+		int offset = in[inpos] | ( in[inpos + 1] << 8 );
+		inpos += 2;
+
+		int length = token & 15;
+		if ( length == 15 ) {
+			inpos = SaveCodec_ReadLength( in, insize, inpos, &length );
+			if ( inpos < 0 ) {
+				return -1;
+			}
+		}
+		length += SAVECODEC_MIN_MATCH;
+
+		if ( !offset || offset > outpos || length > outsize - outpos ) {
+			return -1;
+		}
+		// byte at a time, matches may overlap their own output
+		const uint8_t *src = out + outpos - offset;
+		for ( int i = 0; i < length; i++ ) {
+			out[outpos + i] = src[i];
+		}
+		outpos += length;
+	}
+
+	return outpos;
+}
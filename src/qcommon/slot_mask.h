@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Which of N slots are in use, one bit each, for walking the used slots
+ * in order without touching the others.
+ *
+ * The game keeps one for its entities: a loop over every entity slot reads a
+ * flag out of a separate, large struct for each one, a cache miss per slot
+ * whether it is in use or not, where the mask covers 64 slots per word.
+ *
+ * forEach() reads the mask again after every call, so it sees changes made
+ * during the walk the way a loop testing each slot as it reaches it would:
+ * slots further on that get freed are skipped and ones that get used are
+ * visited.
+ */
+template <int N>
+class SlotMask
+{
+public:
+    SlotMask() {
+        clear();
+    }
+
+    void clear() {
+        memset(words, 0, sizeof(words));
+    }
+
+    void set(int i, bool used) {
+        const uint64_t bit = (uint64_t)1 << (i & 63);
+        if (used) {
+            words[i >> 6] |= bit;
+        } else {
+            words[i >> 6] &= ~bit;
+        }
+    }
+
+    bool test(int i) const {
+        return (words[i >> 6] >> (i & 63) & 1) != 0;
+    }
+
+    int count() const {
+        int n = 0;
+        for (uint64_t word : words) {
+            for (; word; word &= word - 1) {
+                n++;
+            }
+        }
+        return n;
+    }
+
+    // visit(i) for the used slots below end, which is read again after every call
+    template <typename Visit>
+    void forEach(const int& end, Visit&& visit) const {
+        for (int w = 0; w < WORDS && w * 64 < end; w++) {
+            uint64_t bits = words[w];
+            while (bits) {
+                const int i = w * 64 + countTrailingZeros(bits);
+                if (i >= end) {
+                    return;
+                }
+                visit(i);
+                // the slots after i, as they are now
+                bits = (i & 63) == 63 ? 0 : words[w] & (~(uint64_t)0 << ((i & 63) + 1));
+            }
+        }
+    }
+
+private:
+    static constexpr int WORDS = (N + 63) / 64;
+
+    static int countTrailingZeros(uint64_t v) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, v);
+        return (int)index;
+#else
+        return __builtin_ctzll(v);
+#endif
+    }
+
+    uint64_t words[WORDS];
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Hashed uniform grid over the XY plane for broadphase box queries.
+ *
+ * Items are small integer indices owned by the caller (for instance an index
+ * into a solid entity list). The grid is rebuilt from scratch whenever the
+ * item set changes, so there is no removal. Items that would touch too many
+ * cells, or whose bounds are not known, are kept on an "always" list that
+ * every query walks; unbounded items are returned by every query.
+ *
+ * query() returns every item whose bounds overlap the query box, sorted by
+ * ascending index and without duplicates, so a caller iterating the result
+ * visits candidates in exactly the same order as a linear scan would.
+ */
+class SpatialGrid
+{
+public:
+    static const int CELL_SHIFT = 8;            // 256 unit cells
+    static const int HASH_SIZE = 1024;          // must be a power of two
+    static const int MAX_ITEM_CELLS = 16;       // larger items go on the always list
+    static const int MAX_QUERY_CELLS = 64;      // larger queries test every item
+
+    explicit SpatialGrid(int maxItems)
+        : heads(HASH_SIZE, -1), bounds(maxItems), stamps(maxItems, 0) {
+        links.reserve(maxItems * 4);
+        always.reserve(maxItems);
+        inserted.reserve(maxItems);
+        queryStamp = 0;
+    }
+
+    void clear() {
+        std::fill(heads.begin(), heads.end(), -1);
+        links.clear();
+        always.clear();
+        inserted.clear();
+    }
+
+    // item must be in [0, maxItems) and inserted at most once per rebuild
+    void insert(int item, const float mins[3], const float maxs[3]) {
+        Box& b = bounds[item];
+        for (int i = 0; i < 3; i++) {
+            b.mins[i] = mins[i];
+            b.maxs[i] = maxs[i];
+        }
+        b.unbounded = false;
+        inserted.push_back(item);
+
+        int x0 = cellCoord(mins[0]), x1 = cellCoord(maxs[0]);
+        int y0 = cellCoord(mins[1]), y1 = cellCoord(maxs[1]);
+        if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_ITEM_CELLS) {
+            always.push_back(item);
+            return;
+        }
+
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                int bucket = hashCell(x, y);
+                Link link;
+                link.item = item;
+                link.next = heads[bucket];
+                heads[bucket] = (int)links.size();
+                links.push_back(link);
+            }
+        }
+    }
+
+    // for items whose position can change before the next rebuild
+    void insertAlways(int item) {
+        bounds[item].unbounded = true;
+        inserted.push_back(item);
+        always.push_back(item);
+    }
+
+    int query(const float mins[3], const float maxs[3], int* out, int maxOut) {
+        int count = 0;
+
+        queryStamp++;
+        if (queryStamp == 0) {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            queryStamp = 1;
+        }
+
+        int x0 = cellCoord(mins[0]), x1 = cellCoord(maxs[0]);
+        int y0 = cellCoord(mins[1]), y1 = cellCoord(maxs[1]);
+        if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_QUERY_CELLS) {
+            for (int item : inserted) {
+                if (count < maxOut && overlaps(item, mins, maxs)) {
+                    out[count++] = item;
+                }
+            }
+        } else {
+            for (int item : always) {
+                stamps[item] = queryStamp;
+                if (count < maxOut && overlaps(item, mins, maxs)) {
+                    out[count++] = item;
+                }
+            }
+            for (int y = y0; y <= y1; y++) {
+                for (int x = x0; x <= x1; x++) {
+                    for (int l = heads[hashCell(x, y)]; l != -1; l = links[l].next) {
+                        int item = links[l].item;
+                        if (stamps[item] == queryStamp) {
+                            continue;
+                        }
+                        stamps[item] = queryStamp;
+                        if (count < maxOut && overlaps(item, mins, maxs)) {
+                            out[count++] = item;
+                        }
+                    }
+                }
+            }
+        }
+
+        std::sort(out, out + count);
+        return count;
+    }
+
+    int debug_getItemCount() const {
+        return (int)inserted.size();
+    }
+
+    int debug_getAlwaysCount() const {
+        return (int)always.size();
+    }
+
+private:
+    struct Box
+    {
+        float mins[3];
+        float maxs[3];
+        bool unbounded;
+    };
+
+    struct Link
+    {
+        int item;
+        int next;
+    };
+
+    static int cellCoord(float v) {
+        // keep unbounded extents from overflowing the int conversion
+        v = std::min(std::max(v, -262144.0f), 262144.0f);
+        return (int)v >> CELL_SHIFT;
+    }
+
+    static int hashCell(int x, int y) {
+        return (int)(((unsigned)x * 73856093u) ^ ((unsigned)y * 19349663u)) & (HASH_SIZE - 1);
+    }
+
+    bool overlaps(int item, const float mins[3], const float maxs[3]) const {
+        const Box& b = bounds[item];
+        if (b.unbounded) {
+            return true;
+        }
+        return b.mins[0] <= maxs[0] && b.maxs[0] >= mins[0]
+            && b.mins[1] <= maxs[1] && b.maxs[1] >= mins[1]
+            && b.mins[2] <= maxs[2] && b.maxs[2] >= mins[2];
+    }
+
+    std::vector<int> heads;
+    std::vector<Link> links;
+    std::vector<Box> bounds;
+    std::vector<int> stamps;
+    std::vector<int> always;
+    std::vector<int> inserted;
+    int queryStamp;
+};
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Times at which each of N ids is next due, handed back as time passes
+ * without looking at the ids that aren't due yet.
+ *
+ * A hierarchical timer wheel: four levels of 64 slots, each slot of a level
+ * covering 64 times as long as one of the level below. An id is filed at the
+ * level where its time first differs from now and moves down a level whenever
+ * now reaches its slot, so advance() touches the slots it passes and the ids
+ * in them, however many ids are waiting further on. Times past the top level
+ * wait in a list of their own. Times are in whatever unit the caller counts
+ * in and are never negative.
+ */
+template <int N>
+class TimerWheel
+{
+public:
+    TimerWheel() {
+        reset(0);
+    }
+
+    // forgets every id
+    void reset(int time) {
+        now = time;
+        for (int& head : heads) {
+            head = NONE;
+        }
+        for (uint64_t& bits : occupied) {
+            bits = 0;
+        }
+        for (int id = 0; id < N; id++) {
+            lists[id] = NONE;
+        }
+    }
+
+    int time() const {
+        return now;
+    }
+
+    // a time not after time() is due on the next advance()
+    void schedule(int id, int time) {
+        cancel(id);
+        times[id] = time;
+        file(id);
+    }
+
+    void cancel(int id) {
+        if (lists[id] != NONE) {
+            unlink(id);
+        }
+    }
+
+    bool scheduled(int id) const {
+        return lists[id] != NONE;
+    }
+
+    // of an id that is scheduled
+    int when(int id) const {
+        return times[id];
+    }
+
+    // moves on to time, not before time(), and hands due(id) every id whose time has come,
+    // in no particular order; due() may schedule and cancel
+    template <typename Due>
+    void advance(int time, Due&& due) {
+        take(LATE);
+        const uint32_t changed = (uint32_t)time ^ (uint32_t)now;
+        for (int level = 0; level < LEVELS; level++) {
+            const int shift = level * SLOT_BITS;
+            uint64_t slots = occupied[level];
+            if ((changed >> shift) >> SLOT_BITS == 0) {
+                // still in the same turn of this level, so only the slots after now's up to time's
+                const int from = (now >> shift) & (SLOTS - 1);
+                const int to = (time >> shift) & (SLOTS - 1);
+                slots &= ((uint64_t)2 << to) - 1;
+                slots &= ~(((uint64_t)2 << from) - 1);
+            }
+            for (; slots; slots &= slots - 1) {
+                take(level * SLOTS + countTrailingZeros(slots));
+            }
+        }
+        if (changed >> (LEVELS * SLOT_BITS)) {
+            take(PAST_TOP);
+        }
+
+        now = time;
+        while (heads[TAKEN] != NONE) {
+            const int id = heads[TAKEN];
+            unlink(id);
+            if (times[id] <= now) {
+                due(id);
+            } else {
+                file(id);
+            }
+        }
+    }
+
+private:
+    static constexpr int SLOT_BITS = 6;
+    static constexpr int SLOTS = 1 << SLOT_BITS;
+    static constexpr int LEVELS = 4;
+    static constexpr int PAST_TOP = LEVELS * SLOTS;     // times past the top level
+    static constexpr int LATE = PAST_TOP + 1;           // scheduled for a time already reached
+    static constexpr int TAKEN = LATE + 1;              // on their way out of advance()
+    static constexpr int LISTS = TAKEN + 1;
+    static constexpr int NONE = -1;
+
+    static int countTrailingZeros(uint64_t v) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, v);
+        return (int)index;
+#else
+        return __builtin_ctzll(v);
+#endif
+    }
+
+    void file(int id) {
+        const uint32_t changed = (uint32_t)times[id] ^ (uint32_t)now;
+        if (times[id] <= now) {
+            link(id, LATE);
+        } else if (changed >> (LEVELS * SLOT_BITS)) {
+            link(id, PAST_TOP);
+        } else {
+            int level = 0;
+            while (changed >> ((level + 1) * SLOT_BITS)) {
+                level++;
+            }
+            link(id, level * SLOTS + ((times[id] >> (level * SLOT_BITS)) & (SLOTS - 1)));
+        }
+    }
+
+    void take(int list) {
+        while (heads[list] != NONE) {
+            const int id = heads[list];
+            unlink(id);
+            link(id, TAKEN);
+        }
+    }
+
+    void link(int id, int list) {
+        lists[id] = list;
+        prev[id] = NONE;
+        next[id] = heads[list];
+        if (next[id] != NONE) {
+            prev[next[id]] = id;
+        }
+        heads[list] = id;
+        if (list < PAST_TOP) {
+            occupied[list / SLOTS] |= (uint64_t)1 << (list % SLOTS);
+        }
+    }
+
+    void unlink(int id) {
+        const int list = lists[id];
+        if (prev[id] != NONE) {
+            next[prev[id]] = next[id];
+        } else {
+            heads[list] = next[id];
+        }
+        if (next[id] != NONE) {
+            prev[next[id]] = prev[id];
+        }
+        lists[id] = NONE;
+        if (list < PAST_TOP && heads[list] == NONE) {
+            occupied[list / SLOTS] &= ~((uint64_t)1 << (list % SLOTS));
+        }
+    }
+
+    int now;
+    int heads[LISTS];
+    uint64_t occupied[LEVELS];      // the slots of each level with ids in them
+    int times[N];
+    int lists[N];
+    int next[N];
+    int prev[N];
+};
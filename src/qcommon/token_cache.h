@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The tokens a preprocessed script file produced, for reading it again
+ * without the preprocessor.
+ *
+ * Loading the menus runs every menu file through the script preprocessor:
+ * the file and its includes are tokenized, the macros of menudef.h expanded
+ * and the conditionals evaluated, token by token, every time the UI or a HUD
+ * is loaded. Everything that comes out of it depends only on the files that
+ * went in and on the global defines, so the stream is recorded once, with a
+ * checksum of each of those files, and replayed for as long as they are
+ * unchanged. upToDate() is given the checksum of the defines and a way to
+ * checksum each source file as it is now.
+ *
+ * write() and read() put a stream in a flat buffer for keeping it on disk.
+ * The buffer ends with a hash of the rest; read() rejects a buffer that is
+ * truncated or damaged, from another version, or with tokens that don't fit
+ * the parser's token buffer, and leaves the stream empty.
+ */
+class TokenStream
+{
+public:
+    static constexpr uint32_t MAGIC = 0x314b4f54;   // "TOK1"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr int MAX_STRING = 1024;         // including the terminator, MAX_TOKENLENGTH
+
+    struct Token {
+        int type;
+        int subtype;
+        int intvalue;
+        float floatvalue;
+        int line;                               // of the file being read when the token was
+        uint32_t offset;                        // of the string in the string buffer
+    };
+
+    struct Source {
+        std::string name;
+        uint32_t checksum;
+    };
+
+    // FNV-1a, which can be continued over several buffers
+    static uint32_t hash(const void* data, size_t size, uint32_t h = 2166136261u) {
+        const uint8_t* p = (const uint8_t*)data;
+        for (size_t i = 0; i < size; i++) {
+            h = (h ^ p[i]) * 16777619u;
+        }
+        return h;
+    }
+
+    void clear() {
+        defines = 0;
+        sourceList.clear();
+        tokens.clear();
+        strings.clear();
+    }
+
+    void setDefines(uint32_t checksum) {
+        defines = checksum;
+    }
+
+    void addSource(const char* name, uint32_t checksum) {
+        sourceList.push_back({ name, checksum });
+    }
+
+    void add(int type, int subtype, int intvalue, float floatvalue, int line, const char* string) {
+        size_t length = std::strlen(string);
+        if (length >= MAX_STRING) {
+            length = MAX_STRING - 1;
+        }
+        tokens.push_back({ type, subtype, intvalue, floatvalue, line, (uint32_t)strings.size() });
+        strings.insert(strings.end(), string, string + length);
+        strings.push_back(0);
+    }
+
+    int size() const {
+        return (int)tokens.size();
+    }
+
+    const Token& token(int i) const {
+        return tokens[i];
+    }
+
+    const char* string(const Token& t) const {
+        return &strings[t.offset];
+    }
+
+    const std::vector<Source>& sources() const {
+        return sourceList;
+    }
+
+    // checksumOf(name, checksum) returns false if the file is gone
+    template <typename ChecksumOf>
+    bool upToDate(uint32_t currentDefines, ChecksumOf checksumOf) const {
+        if (currentDefines != defines || sourceList.empty()) {
+            return false;
+        }
+        for (const Source& s : sourceList) {
+            uint32_t checksum;
+            if (!checksumOf(s.name.c_str(), checksum) || checksum != s.checksum) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void write(std::vector<uint8_t>& out) const {
+        out.clear();
+        put(out, MAGIC);
+        put(out, VERSION);
+        put(out, defines);
+        put(out, (uint32_t)sourceList.size());
+        put(out, (uint32_t)tokens.size());
+        put(out, (uint32_t)strings.size());
+        for (const Source& s : sourceList) {
+            put(out, s.checksum);
+            put(out, (uint32_t)s.name.size());
+            out.insert(out.end(), s.name.begin(), s.name.end());
+        }
+        for (const Token& t : tokens) {
+            put(out, t);
+        }
+        out.insert(out.end(), strings.begin(), strings.end());
+        put(out, hash(out.data(), out.size()));
+    }
+
+    bool read(const uint8_t* data, size_t size) {
+        clear();
+        if (!readChecked(data, size)) {
+            clear();
+            return false;
+        }
+        return true;
+    }
+
+private:
+    template <typename T>
+    static void put(std::vector<uint8_t>& out, const T& value) {
+        const uint8_t* p = (const uint8_t*)&value;
+        out.insert(out.end(), p, p + sizeof(T));
+    }
+
+    template <typename T>
+    static bool get(const uint8_t*& p, const uint8_t* end, T& value) {
+        if ((size_t)(end - p) < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return true;
+    }
+
+    bool readChecked(const uint8_t* data, size_t size) {
+        uint32_t stored;
+        if (size < sizeof(stored)) {
+            return false;
+        }
+        const uint8_t* end = data + size - sizeof(stored);
+        std::memcpy(&stored, end, sizeof(stored));
+        if (stored != hash(data, end - data)) {
+            return false;
+        }
+
+        const uint8_t* p = data;
+        uint32_t magic, version, numSources, numTokens, numStrings;
+        if (!get(p, end, magic) || !get(p, end, version) || magic != MAGIC || version != VERSION) {
+            return false;
+        }
+        if (!get(p, end, defines) || !get(p, end, numSources) || !get(p, end, numTokens) || !get(p, end, numStrings)) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < numSources; i++) {
+            Source s;
+            uint32_t length;
+            if (!get(p, end, s.checksum) || !get(p, end, length) || (size_t)(end - p) < length) {
+                return false;
+            }
+            s.name.assign((const char*)p, length);
+            p += length;
+            sourceList.push_back(s);
+        }
+
+        if ((size_t)(end - p) / sizeof(Token) < numTokens) {
+            return false;
+        }
+        tokens.resize(numTokens);
+        for (Token& t : tokens) {
+            get(p, end, t);
+        }
+
+        if ((size_t)(end - p) != numStrings || (numStrings && p[numStrings - 1] != 0)) {
+            return false;
+        }
+        strings.assign(p, end);
+
+        // every string starts inside the buffer and is terminated in time
+        for (const Token& t : tokens) {
+            if (t.offset >= numStrings) {
+                return false;
+            }
+            const void* terminator = std::memchr(&strings[t.offset], 0, numStrings - t.offset);
+            if ((const char*)terminator - &strings[t.offset] >= MAX_STRING) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t defines = 0;
+    std::vector<Source> sourceList;
+    std::vector<Token> tokens;
+    std::vector<char> strings;
+};
@@ -27,6 +27,7 @@ If you have questions concerning this license or the applicable additional terms
 */
 
 #include "tr_local.h"
+#include "../qcommon/profiler.h"
 
 backEndData_t   *backEndData[SMP_FRAMES];
 backEndState_t backEnd;
@@ -1325,6 +1326,89 @@ const void *RB_StretchPic( const void *data ) {
 }
 
 
+/*
+=============
+RB_StretchQuads
+
+Like RB_StretchPic for a whole run of quads, with the color of each quad
+in the command rather than in backEnd.color2D.
+=============
+*/
+const void *RB_StretchQuads( const void *data ) {
+	const stretchQuadsCommand_t *cmd;
+	const stretchQuad_t *quad;
+	shader_t *shader;
+	int i, numVerts, numIndexes;
+
+	cmd = (const stretchQuadsCommand_t *)data;
+	quad = (const stretchQuad_t *)( cmd + 1 );
+
+	if ( !backEnd.projection2D ) {
+		RB_SetGL2D();
+	}
+
+	shader = cmd->shader;
+	if ( shader != tess.shader ) {
+		if ( tess.numIndexes ) {
+			RB_EndSurface();
+		}
+		backEnd.currentEntity = &backEnd.entity2D;
+		RB_BeginSurface( shader, 0 );
+	}
+
+	for ( i = 0; i < cmd->numQuads; i++, quad++ ) {
+		RB_CHECKOVERFLOW( 4, 6 );
+		numVerts = tess.numVertexes;
+		numIndexes = tess.numIndexes;
+
+		tess.numVertexes += 4;
+		tess.numIndexes += 6;
+
+		tess.indexes[ numIndexes ] = numVerts + 3;
+		tess.indexes[ numIndexes + 1 ] = numVerts + 0;
+		tess.indexes[ numIndexes + 2 ] = numVerts + 2;
+		tess.indexes[ numIndexes + 3 ] = numVerts + 2;
+		tess.indexes[ numIndexes + 4 ] = numVerts + 0;
+		tess.indexes[ numIndexes + 5 ] = numVerts + 1;
+
+		memcpy( tess.vertexColors[ numVerts ], quad->modulate, 4 );
+		memcpy( tess.vertexColors[ numVerts + 1 ], quad->modulate, 4 );
+		memcpy( tess.vertexColors[ numVerts + 2 ], quad->modulate, 4 );
+		memcpy( tess.vertexColors[ numVerts + 3 ], quad->modulate, 4 );
+
+		tess.xyz[ numVerts ][0] = quad->x;
+		tess.xyz[ numVerts ][1] = quad->y;
+		tess.xyz[ numVerts ][2] = 0;
+
+		tess.texCoords[ numVerts ][0][0] = quad->s1;
+		tess.texCoords[ numVerts ][0][1] = quad->t1;
+
+		tess.xyz[ numVerts + 1 ][0] = quad->x + quad->w;
+		tess.xyz[ numVerts + 1 ][1] = quad->y;
+		tess.xyz[ numVerts + 1 ][2] = 0;
+
+		tess.texCoords[ numVerts + 1 ][0][0] = quad->s2;
+		tess.texCoords[ numVerts + 1 ][0][1] = quad->t1;
+
+		tess.xyz[ numVerts + 2 ][0] = quad->x + quad->w;
+		tess.xyz[ numVerts + 2 ][1] = quad->y + quad->h;
+		tess.xyz[ numVerts + 2 ][2] = 0;
+
+		tess.texCoords[ numVerts + 2 ][0][0] = quad->s2;
+		tess.texCoords[ numVerts + 2 ][0][1] = quad->t2;
+
+		tess.xyz[ numVerts + 3 ][0] = quad->x;
+		tess.xyz[ numVerts + 3 ][1] = quad->y + quad->h;
+		tess.xyz[ numVerts + 3 ][2] = 0;
+
+		tess.texCoords[ numVerts + 3 ][0][0] = quad->s1;
+		tess.texCoords[ numVerts + 3 ][0][1] = quad->t2;
+	}
+
+	return (const void *)quad;
+}
+
+
 /*
 ==============
 RB_StretchPicGradient
@@ -1581,6 +1665,8 @@ smp extensions, or asyncronously by another thread.
 void RB_ExecuteRenderCommands( const void *data ) {
 	int t1, t2;
 
+	PROFILE_ZONE( "RB_ExecuteRenderCommands" );
+
 	t1 = ri.Milliseconds();
 
 	if ( !r_smp->integer || data == backEndData[0]->commands.cmds ) {
@@ -1601,6 +1687,9 @@ void RB_ExecuteRenderCommands( const void *data ) {
 		case RC_STRETCH_PIC_GRADIENT:
 			data = RB_StretchPicGradient( data );
 			break;
+		case RC_STRETCH_QUADS:
+			data = RB_StretchQuads( data );
+			break;
 		case RC_DRAW_SURFS:
 			data = RB_DrawSurfs( data );
 			break;
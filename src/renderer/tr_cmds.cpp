@@ -332,6 +332,39 @@ void RE_StretchPicGradient( float x, float y, float w, float h,
 //----(SA)	end
 
 
+/*
+==============
+RE_StretchQuads
+
+Queues a run of quads with one shader, such as a string of text, as a single
+command instead of a color and a picture per character.
+==============
+*/
+#define MAX_QUADS_PER_COMMAND   1024
+
+void RE_StretchQuads( qhandle_t hShader, const stretchQuad_t *quads, int numQuads ) {
+	stretchQuadsCommand_t *cmd;
+	shader_t *shader;
+	int count;
+
+	shader = R_GetShaderByHandle( hShader );
+	while ( numQuads > 0 ) {
+		count = numQuads < MAX_QUADS_PER_COMMAND ? numQuads : MAX_QUADS_PER_COMMAND;
+		cmd = (stretchQuadsCommand_t*)R_GetCommandBuffer( sizeof( *cmd ) + count * sizeof( stretchQuad_t ) );
+		if ( !cmd ) {
+			return;
+		}
+		cmd->commandId = RC_STRETCH_QUADS;
+		cmd->shader = shader;
+		cmd->numQuads = count;
+		memcpy( cmd + 1, quads, count * sizeof( stretchQuad_t ) );
+
+		quads += count;
+		numQuads -= count;
+	}
+}
+
+
 /*
 ====================
 RE_BeginFrame
@@ -80,12 +80,17 @@ If you have questions concerning this license or the applicable additional terms
 
 #include "tr_local.h"
 #include "../qcommon/qcommon.h"
+#include "../qcommon/glyph_batch.h"
+
+#include <vector>
 
 
 #define MAX_FONTS 6
 static int registeredFontCount = 0;
 static fontInfo_t registeredFont[MAX_FONTS];
 
+#define MAX_FONT_PAGES 16
+
 static int fdOffset;
 static uint8_t *fdFile;
 
@@ -117,6 +122,104 @@ float readFloat() {
 	return me.ffred;
 }
 
+/*
+==============
+R_BuildFontAtlas
+
+Copies the glyph pages of a font into one texture, see GlyphAtlas, so that
+any string in the font is drawn with a single shader. Fonts whose pages have
+a shader script, differ in size or don't fit are left on their pages.
+==============
+*/
+static void R_BuildFontAtlas( fontInfo_t *font, int pointSize ) {
+	const char *pageNames[MAX_FONT_PAGES];
+	image_t *pageImages[MAX_FONT_PAGES];
+	int pageOf[GLYPHS_PER_FONT];
+	int numPages;
+	int i, page, y;
+	char name[MAX_QPATH];
+	shader_t *sh;
+	qhandle_t hShader;
+
+	numPages = 0;
+	for ( i = GLYPH_START; i < GLYPH_END; i++ ) {
+		pageOf[i] = -1;
+		if ( !font->glyphs[i].shaderName[0] ) {
+			continue;
+		}
+		for ( page = 0; page < numPages; page++ ) {
+			if ( !Q_stricmp( pageNames[page], font->glyphs[i].shaderName ) ) {
+				break;
+			}
+		}
+		if ( page == numPages ) {
+			if ( numPages == MAX_FONT_PAGES ) {
+				return;
+			}
+			pageNames[numPages++] = font->glyphs[i].shaderName;
+		}
+		pageOf[i] = page;
+	}
+	if ( numPages < 2 ) {
+		return;
+	}
+
+	for ( page = 0; page < numPages; page++ ) {
+		sh = R_FindShaderByName( pageNames[page] );
+		if ( sh->defaultShader || sh->explicitlyDefined || !sh->stages[0] || !sh->stages[0]->bundle[0].image[0] ) {
+			return;
+		}
+		pageImages[page] = sh->stages[0]->bundle[0].image[0];
+		if ( pageImages[page]->width != pageImages[0]->width || pageImages[page]->height != pageImages[0]->height ) {
+			return;
+		}
+	}
+
+	const GlyphAtlas atlas = GlyphAtlas::layout( numPages, pageImages[0]->width, pageImages[0]->height, glConfig.maxTextureSize );
+	if ( !atlas.valid() ) {
+		return;
+	}
+
+	snprintf( name, sizeof( name ), "fonts/fontAtlas_%i", pointSize );
+	sh = R_FindShaderByName( name );
+	if ( sh != tr.defaultShader ) {
+		hShader = sh->index;
+	} else {
+		const int pageWidth = pageImages[0]->width;
+		const int pageHeight = pageImages[0]->height;
+		std::vector<uint8_t> pixels( atlas.width * atlas.height * 4 );
+
+		for ( page = 0; page < numPages; page++ ) {
+			uint8_t *pic;
+			int width, height;
+
+			// the load buffer is reused by every image, so copy each page out of it
+			R_LoadImage( pageImages[page]->imgName, &pic, &width, &height );
+			if ( !pic || width != pageWidth || height != pageHeight ) {
+				return;
+			}
+			for ( y = 0; y < pageHeight; y++ ) {
+				memcpy( &pixels[( ( atlas.row( page ) * pageHeight + y ) * atlas.width + atlas.col( page ) * pageWidth ) * 4],
+						pic + y * pageWidth * 4, pageWidth * 4 );
+			}
+		}
+
+		image_t *image = R_CreateImage( name, pixels.data(), atlas.width, atlas.height, false, false, GL_CLAMP );
+		hShader = RE_RegisterShaderFromImage( name, LIGHTMAP_2D, image, false );
+	}
+
+	for ( i = GLYPH_START; i < GLYPH_END; i++ ) {
+		if ( pageOf[i] < 0 ) {
+			continue;
+		}
+		atlas.remap( pageOf[i], font->glyphs[i].s, font->glyphs[i].t );
+		atlas.remap( pageOf[i], font->glyphs[i].s2, font->glyphs[i].t2 );
+		font->glyphs[i].glyph = hShader;
+		Q_strncpyz( font->glyphs[i].shaderName, name, sizeof( font->glyphs[i].shaderName ) );
+	}
+	ri.Printf( PRINT_DEVELOPER, "RE_RegisterFont: %i pages of %s in %s\n", numPages, font->name, name );
+}
+
 void RE_RegisterFont( const char *fontName, int pointSize, fontInfo_t *font ) {
 
 	void *faceData;
@@ -176,6 +279,7 @@ void RE_RegisterFont( const char *fontName, int pointSize, fontInfo_t *font ) {
 		for ( i = GLYPH_START; i < GLYPH_END; i++ ) {
 			font->glyphs[i].glyph = RE_RegisterShaderNoMip( font->glyphs[i].shaderName );
 		}
+		R_BuildFontAtlas( font, pointSize );
 		memcpy( &registeredFont[registeredFontCount++], font, sizeof( fontInfo_t ) );
 		return;
 	}
@@ -1381,6 +1381,7 @@ refexport_t *GetRefAPI( int apiVersion, refimport_t *rimp ) {
 	re.SetColor         = RE_SetColor;
 	re.DrawStretchPic   = RE_StretchPic;
 	re.DrawStretchPicGradient   = RE_StretchPicGradient;
+	re.DrawStretchQuads = RE_StretchQuads;
 	re.DrawStretchRaw   = RE_StretchRaw;
 	re.UploadCinematic  = RE_UploadCinematic;
 	re.RegisterFont     = RE_RegisterFont;
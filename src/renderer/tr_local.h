@@ -1308,6 +1308,7 @@ bool    R_GetEntityToken( char *buffer, int size );
 model_t     *R_AllocModel( void );
 
 void        R_Init( void );
+void        R_LoadImage( const char *name, uint8_t **pic, int *width, int *height );
 image_t     *R_FindImageFile( const char *name, bool mipmap, bool allowPicmip, int glWrapClampMode );
 image_t     *R_FindImageFileExt( const char *name, bool mipmap, bool allowPicmip, bool characterMip, int glWrapClampMode ); //----(SA)	added
 
@@ -1654,6 +1655,13 @@ typedef struct {
 	int gradientType; 
 } stretchPicCommand_t;
 
+// followed by numQuads stretchQuad_t
+typedef struct {
+	int commandId;
+	shader_t    *shader;
+	int numQuads;
+} stretchQuadsCommand_t;
+
 typedef struct {
 	int commandId;
 	trRefdef_t refdef;
@@ -1667,6 +1675,7 @@ typedef enum {
 	RC_SET_COLOR,
 	RC_STRETCH_PIC,
 	RC_STRETCH_PIC_GRADIENT,    // (SA) added
+	RC_STRETCH_QUADS,
 	RC_DRAW_SURFS,
 	RC_DRAW_BUFFER,
 	RC_SWAP_BUFFERS
@@ -34,6 +34,7 @@ If you have questions concerning this license or the applicable additional terms
 */
 
 #include "tr_local.h"
+#include "../qcommon/profiler.h"
 
 trGlobals_t tr;
 
@@ -1668,6 +1669,8 @@ or a mirror / remote location
 void R_RenderView( viewParms_t *parms ) {
 	int firstDrawSurf;
 
+	PROFILE_ZONE( "R_RenderView" );
+
 	if ( parms->viewportWidth <= 0 || parms->viewportHeight <= 0 ) {
 		return;
 	}
@@ -66,6 +66,7 @@ void RE_StretchPic( float x, float y, float w, float h,
 					float s1, float t1, float s2, float t2, qhandle_t hShader );
 void RE_StretchPicGradient( float x, float y, float w, float h,
 							float s1, float t1, float s2, float t2, qhandle_t hShader, const float *gradientColor, int gradientType );
+void RE_StretchQuads( qhandle_t hShader, const stretchQuad_t *quads, int numQuads );
 
 int         R_LerpTag( orientation_t *tag, const refEntity_t *refent, const char *tagName, int startIndex );
 void        R_ModelBounds( qhandle_t handle, vec3_t mins, vec3_t maxs );
@@ -128,6 +129,8 @@ typedef struct {
 							  float s1, float t1, float s2, float t2, qhandle_t hShader ); // 0 = white
 	void ( *DrawStretchPicGradient )( float x, float y, float w, float h,
 									  float s1, float t1, float s2, float t2, qhandle_t hShader, const float *gradientColor, int gradientType );
+	// any number of quads with one shader, each with its own color, ignoring SetColor
+	void ( *DrawStretchQuads )( qhandle_t hShader, const stretchQuad_t *quads, int numQuads );
 
 	// Draw images for cinematic rendering, pass as 32 bit rgba
 	void ( *DrawStretchRaw )( int x, int y, int w, int h, int cols, int rows, const uint8_t *data, int client, bool dirty );
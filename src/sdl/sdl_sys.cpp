@@ -8,12 +8,17 @@
 #include <sys/time.h>
 #include <pwd.h>
 
-#include <SDL3/SDL.h>
 #include "../qcommon/qcommon.h"
 
 char *Sys_Cwd( void )
 {
-	return SDL_GetCurrentDirectory();
+	static char cwd[MAX_OSPATH];
+
+	if ( !getcwd( cwd, sizeof( cwd ) - 1 ) ) {
+		cwd[0] = 0;
+	}
+	cwd[MAX_OSPATH - 1] = 0;
+	return cwd;
 }
 
 const char    *Sys_DefaultHomePath( void ) {
@@ -204,12 +209,6 @@ const char *Sys_GetCurrentUser( void ) {
 	return "";
 }
 
-int Sys_GetProcessorId( void ) {
-	// TODO TTimo add better CPU identification?
-	// see Sys_GetHighQualityCPU
-	return CPUID_GENERIC;
-}
-
 int Sys_GetHighQualityCPU() {
 	// TODO TTimo see win_shared.c IsP3 || IsAthlon
 	return 0;
@@ -237,6 +236,19 @@ int Sys_Milliseconds( void ) {
 	return (int)( tp.tv_sec - sys_timeBase ) * 1000 + tp.tv_usec / 1000;
 }
 
+int64_t Sys_Microseconds( void ) {
+	struct timeval tp;
+	struct timezone tzp;
+
+	gettimeofday( &tp, &tzp );
+
+	if ( !sys_timeBase ) {
+		sys_timeBase = tp.tv_sec;
+	}
+
+	return (int64_t)( tp.tv_sec - sys_timeBase ) * 1000000 + tp.tv_usec;
+}
+
 void    Sys_Mkdir( const char *path ) {
 	mkdir( path, 0777 );
 }
@@ -291,6 +291,8 @@ void        SV_InitGameProgs( void );
 void        SV_ShutdownGameProgs( void );
 void        SV_RestartGameProgs( void );
 bool    SV_inPVS( const vec3_t p1, const vec3_t p2 );
+int     SV_PointCluster( const vec3_t p );
+int     SV_AreaPortalGeneration( void );
 
 void SV_SetBrushModel( sharedEntity_t *ent, const char *name );
 
@@ -114,37 +114,54 @@ BotImport_Print
 void  BotImport_Print( int type, const char *fmt, ... ) {
 	char str[2048];
 	va_list ap;
-
-	va_start( ap, fmt );
-	vsnprintf( str, 2048, fmt, ap );
-	va_end( ap );
+	logSeverity_t severity;
+	const char *prefix;
 
 	switch ( type ) {
 	case PRT_MESSAGE: {
-		Com_Printf( "%s", str );
+		severity = LOG_INFO;
+		prefix = "";
 		break;
 	}
 	case PRT_WARNING: {
-		Com_Printf( S_COLOR_YELLOW "Warning: %s", str );
+		severity = LOG_WARNING;
+		prefix = S_COLOR_YELLOW "Warning: ";
 		break;
 	}
 	case PRT_ERROR: {
-		Com_Printf( S_COLOR_RED "Error: %s", str );
+		severity = LOG_ERROR;
+		prefix = S_COLOR_RED "Error: ";
 		break;
 	}
 	case PRT_FATAL: {
-		Com_Printf( S_COLOR_RED "Fatal: %s", str );
+		severity = LOG_ERROR;
+		prefix = S_COLOR_RED "Fatal: ";
 		break;
 	}
 	case PRT_EXIT: {
-		Com_Error( ERR_DROP, S_COLOR_RED "Exit: %s", str );
+		severity = LOG_ERROR;
+		prefix = S_COLOR_RED "Exit: ";
 		break;
 	}
 	default: {
 		Com_Printf( "unknown print type\n" );
-		break;
+		return;
 	}
 	}
+
+	// don't format what won't be printed
+	if ( type != PRT_EXIT && !Com_LogEnabled( LOG_BOTLIB, severity ) ) {
+		return;
+	}
+
+	va_start( ap, fmt );
+	vsnprintf( str, 2048, fmt, ap );
+	va_end( ap );
+
+	if ( type == PRT_EXIT ) {
+		Com_Error( ERR_DROP, "%s%s", prefix, str );
+	}
+	Com_LogPrintf( LOG_BOTLIB, severity, "%s%s", prefix, str );
 }
 
 /*
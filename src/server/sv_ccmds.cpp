@@ -64,6 +64,9 @@ static void SV_Map_f( void ) {
 		char savemap[MAX_QPATH];
 		uint8_t *buffer;
 
+		// the game may still be writing it
+		G_SaveGameFlush();
+
 		if ( !( strstr( map, "save/" ) == map ) ) {
 			snprintf( savemap, sizeof( savemap ), "save/%s", map );
 		} else {
@@ -220,7 +223,7 @@ static void SV_MapRestart_f( void ) {
 	}
 
 	// Ridah, check for loading a saved game
-	if ( Cvar_VariableIntegerValue( "savegame_loading" ) ) {
+	if ( com_savegameLoading->integer ) {
 		// open the current savegame, and find out what the time is, everything else we can ignore
 		const char *savemap = "save/current.svg";
 		uint8_t *buffer;
@@ -321,7 +324,7 @@ void    SV_LoadGame_f( void ) {
 	int size;
 
 	// dont allow command if another loadgame is pending
-	if ( Cvar_VariableIntegerValue( "savegame_loading" ) ) {
+	if ( com_savegameLoading->integer ) {
 		return;
 	}
 	if ( sv_reloading->integer ) {
@@ -345,6 +348,9 @@ void    SV_LoadGame_f( void ) {
 		*(char *)strstr( filename, "\\" ) = '/';
 	}
 
+	// the game may still be writing it
+	G_SaveGameFlush();
+
 	size = FS_ReadFile( filename, nullptr );
 	if ( size < 0 ) {
 		Com_Printf( "Can't find savegame %s\n", filename );
@@ -183,6 +183,28 @@ bool SV_inPVSIgnorePortals( const vec3_t p1, const vec3_t p2 )
 	return true;
 }
 
+/*
+=================
+SV_PointCluster
+=================
+*/
+int SV_PointCluster( const vec3_t p )
+{
+	return TheClipModel::get().leafCluster( CM_PointLeafnum( p ) );
+}
+
+/*
+=================
+SV_AreaPortalGeneration
+
+Changes whenever an area portal opens or closes
+=================
+*/
+int SV_AreaPortalGeneration( void )
+{
+	return CM_AreaPortalGeneration();
+}
+
 
 /*
 ========================
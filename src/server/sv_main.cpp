@@ -30,6 +30,7 @@ If you have questions concerning this license or the applicable additional terms
 #include "server.h"
 #include "../game/g_local.h"
 #include "../game/g_func_decs.h"
+#include "../qcommon/profiler.h"
 
 serverStatic_t svs;                 // persistant server info
 server_t sv;                        // local server
@@ -420,6 +421,8 @@ happen before SV_Frame is called
 */
 void SV_Frame( int msec )
 {
+	PROFILE_ZONE( "SV_Frame" );
+
 	// the menu kills the server with this cvar
 	if ( sv_killserver->integer ) {
 		SV_Shutdown( "Server was killed.\n" );
@@ -481,7 +484,7 @@ void SV_Frame( int msec )
 	}
 	
 	int startTime = 0;
-	if ( com_speeds->integer ) {
+	if ( com_speeds->integer || com_timeFrames ) {
 		startTime = Sys_Milliseconds();
 	}
 
@@ -494,7 +497,7 @@ void SV_Frame( int msec )
 		G_RunFrame( svs.time );
 	}
 
-	if ( com_speeds->integer ) {
+	if ( com_speeds->integer || com_timeFrames ) {
 		time_game = Sys_Milliseconds() - startTime;
 	}
 
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Distance along the sampled points of a spline, for finding the point
+ * a given distance along it.
+ *
+ * A camera on a spline moves by distance: every frame it works out how far it
+ * has travelled and needs the point that far along the path. The path is the
+ * polyline through the spline's samples, so the table keeps the distance from
+ * the first sample to each one, built once with the samples, and locate()
+ * finds the segment holding a distance with a binary search rather than by
+ * measuring every segment up to it. Distances outside the path are clamped to
+ * its ends.
+ */
+class ArcLengthTable
+{
+public:
+    void clear() {
+        distances.clear();
+    }
+
+    void add(float x, float y, float z) {
+        if (distances.empty()) {
+            distances.push_back(0.0f);
+        } else {
+            const float dx = x - last[0];
+            const float dy = y - last[1];
+            const float dz = z - last[2];
+            distances.push_back(distances.back() + std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+        last[0] = x;
+        last[1] = y;
+        last[2] = z;
+    }
+
+    int size() const {
+        return (int)distances.size();
+    }
+
+    float total() const {
+        return distances.empty() ? 0.0f : distances.back();
+    }
+
+    // from the first sample to sample i
+    float distance(int i) const {
+        return distances[i];
+    }
+
+    // the point is frac of the way from sample segment to sample segment + 1,
+    // or sample segment itself when frac is 0
+    void locate(float d, int& segment, float& frac) const {
+        segment = 0;
+        frac = 0.0f;
+        if (distances.size() < 2 || d <= 0.0f) {
+            return;
+        }
+        if (d >= distances.back()) {
+            segment = (int)distances.size() - 1;
+            return;
+        }
+        // the first sample at least d along, which isn't the first one
+        const int hi = (int)(std::lower_bound(distances.begin() + 1, distances.end(), d) - distances.begin());
+        segment = hi - 1;
+        const float length = distances[hi] - distances[segment];
+        if (length > 0.0f) {
+            frac = (d - distances[segment]) / length;
+        }
+    }
+
+private:
+    std::vector<float> distances;
+    float last[3] = { 0.0f, 0.0f, 0.0f };
+};
+
+/**
+ * @brief Weights of the four control points of a uniform cubic B-spline segment at t.
+ *
+ * Every segment of a spline is sampled at the same values of t, so the
+ * weights are worked out once per sample rather than once per coordinate of
+ * every control point of every segment.
+ */
+inline void SplineWeights(float t, float w[4]) {
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    const float s = 1.0f - t;
+    w[0] = s * s * s / 6.0f;
+    w[1] = (3.0f * t3 - 6.0f * t2 + 4.0f) / 6.0f;
+    w[2] = (-3.0f * t3 + 3.0f * t2 + 3.0f * t + 1.0f) / 6.0f;
+    w[3] = t3 / 6.0f;
+}
@@ -185,13 +185,15 @@ void idSplineList::addToRenderer() {
 	idVec3 step1;
 	for ( i = 3; i < controlPoints.Num(); i++ ) {
 		for ( float tension = 0.0f; tension < 1.001f; tension += 0.1f ) {
+			float w[4];
 			float x = 0;
 			float y = 0;
 			float z = 0;
+			SplineWeights( tension, w );
 			for ( int j = 0; j < 4; j++ ) {
-				x += controlPoints[i - ( 3 - j )]->x * calcSpline( j, tension );
-				y += controlPoints[i - ( 3 - j )]->y * calcSpline( j, tension );
-				z += controlPoints[i - ( 3 - j )]->z * calcSpline( j, tension );
+				x += controlPoints[i - ( 3 - j )]->x * w[j];
+				y += controlPoints[i - ( 3 - j )]->y * w[j];
+				z += controlPoints[i - ( 3 - j )]->z * w[j];
 			}
 			if ( step == 0 ) {
 				step1[0] = x;
@@ -210,17 +212,25 @@ void idSplineList::addToRenderer() {
 void idSplineList::buildSpline() {
 	//int start = Sys_Milliseconds();
 	clearSpline();
+
+	// every segment is sampled at the same tensions
+	idList<idVec4> weights;
+	for ( float tension = 0.0f; tension < 1.001f; tension += granularity ) {
+		idVec4 w;
+		SplineWeights( tension, w.ToFloatPtr() );
+		weights.Append( w );
+	}
+
 	for ( int i = 3; i < controlPoints.Num(); i++ ) {
-		for ( float tension = 0.0f; tension < 1.001f; tension += granularity ) {
-			float x = 0;
-			float y = 0;
-			float z = 0;
-			for ( int j = 0; j < 4; j++ ) {
-				x += controlPoints[i - ( 3 - j )]->x * calcSpline( j, tension );
-				y += controlPoints[i - ( 3 - j )]->y * calcSpline( j, tension );
-				z += controlPoints[i - ( 3 - j )]->z * calcSpline( j, tension );
-			}
-			splinePoints.Append( new idVec3( x, y, z ) );
+		const idVec3 &p0 = *controlPoints[i - 3];
+		const idVec3 &p1 = *controlPoints[i - 2];
+		const idVec3 &p2 = *controlPoints[i - 1];
+		const idVec3 &p3 = *controlPoints[i];
+		for ( int j = 0; j < weights.Num(); j++ ) {
+			const idVec4 &w = weights[j];
+			idVec3 *point = new idVec3( p0 * w[0] + p1 * w[1] + p2 * w[2] + p3 * w[3] );
+			splinePoints.Append( point );
+			arcLength.add( point->x, point->y, point->z );
 		}
 	}
 	dirty = false;
@@ -286,8 +296,6 @@ void idSplineList::draw( bool editMode ) {
 
 float idSplineList::totalDistance() {
 
-	// FIXME: save dist and return
-	//
 	if ( controlPoints.Num() == 0 ) {
 		return 0.0;
 	}
@@ -296,15 +304,27 @@ float idSplineList::totalDistance() {
 		buildSpline();
 	}
 
-	float dist = 0.0;
-	idVec3 temp;
-	int count = splinePoints.Num();
-	for ( int i = 1; i < count; i++ ) {
-		temp = *splinePoints[i - 1];
-		temp -= *splinePoints[i];
-		dist += temp.Length();
+	return arcLength.total();
+}
+
+void idSplineList::positionAtDistance( float distance, idVec3 &pos ) {
+	int segment;
+	float frac;
+
+	if ( dirty ) {
+		buildSpline();
+	}
+
+	if ( splinePoints.Num() == 0 ) {
+		pos = zero;
+		return;
+	}
+
+	arcLength.locate( distance, segment, frac );
+	pos = *splinePoints[segment];
+	if ( frac > 0.0f ) {
+		pos += ( *splinePoints[segment + 1] - pos ) * frac;
 	}
-	return dist;
 }
 
 void idSplineList::initPosition( long bt, long totalTime ) {
@@ -324,15 +344,10 @@ void idSplineList::initPosition( long bt, long totalTime ) {
 	splineTime.Clear();
 	splineTime.Append( bt );
 	double dist = totalDistance();
-	double distSoFar = 0.0;
-	idVec3 temp;
 	int count = splinePoints.Num();
 	//for(int i = 2; i < count - 1; i++) {
 	for ( int i = 1; i < count; i++ ) {
-		temp = *splinePoints[i - 1];
-		temp -= *splinePoints[i];
-		distSoFar += temp.Length();
-		double percent = distSoFar / dist;
+		double percent = arcLength.distance( i ) / dist;
 		percent *= totalTime;
 		splineTime.Append( percent + bt );
 	}
@@ -342,18 +357,6 @@ void idSplineList::initPosition( long bt, long totalTime ) {
 
 
 
-float idSplineList::calcSpline( int step, float tension ) {
-	switch ( step ) {
-	case 0: return ( pow( 1 - tension, 3 ) ) / 6;
-	case 1: return ( 3 * pow( tension, 3 ) - 6 * pow( tension, 2 ) + 4 ) / 6;
-	case 2: return ( -3 * pow( tension, 3 ) + 3 * pow( tension, 2 ) + 3 * tension + 1 ) / 6;
-	case 3: return pow( tension, 3 ) / 6;
-	}
-	return 0.0;
-}
-
-
-
 void idSplineList::updateSelection( const idVec3 &move ) {
 	if ( selected ) {
 		dirty = true;
@@ -1328,63 +1331,8 @@ const idVec3 *idSplinePosition::getPosition( long t ) {
 	float distToTravel = timePassed * velocity;
 
 	distSoFar += distToTravel;
-	double tempDistance = target.totalDistance();
-
-	double percent = (double)( distSoFar ) / tempDistance;
-
-	double targetDistance = percent * tempDistance;
-	tempDistance = 0;
-
-	double lastDistance1,lastDistance2;
-	lastDistance1 = lastDistance2 = 0;
-	//FIXME: calc distances on spline build
-	idVec3 temp;
-	int count = target.numSegments();
-	// TTimo fixed MSVCism
-	int i;
-	for ( i = 1; i < count; i++ ) {
-		temp = *target.getSegmentPoint( i - 1 );
-		temp -= *target.getSegmentPoint( i );
-		tempDistance += temp.Length();
-		if ( i & 1 ) {
-			lastDistance1 = tempDistance;
-		} else {
-			lastDistance2 = tempDistance;
-		}
-		if ( tempDistance >= targetDistance ) {
-			break;
-		}
-	}
 
-	if ( i >= count - 1 ) {
-		interpolatedPos = *target.getSegmentPoint( i - 1 );
-	} else {
-#if 0
-		double timeHi = target.getSegmentTime( i + 1 );
-		double timeLo = target.getSegmentTime( i - 1 );
-		double percent = ( timeHi - t ) / ( timeHi - timeLo );
-		idVec3 v1 = *target.getSegmentPoint( i - 1 );
-		idVec3 v2 = *target.getSegmentPoint( i + 1 );
-		v2 *= ( 1.0 - percent );
-		v1 *= percent;
-		v2 += v1;
-		interpolatedPos = v2;
-#else
-		if ( lastDistance1 > lastDistance2 ) {
-			double d = lastDistance2;
-			lastDistance2 = lastDistance1;
-			lastDistance1 = d;
-		}
-
-		idVec3 v1 = *target.getSegmentPoint( i - 1 );
-		idVec3 v2 = *target.getSegmentPoint( i );
-		double percent = ( lastDistance2 - targetDistance ) / ( lastDistance2 - lastDistance1 );
-		v2 *= ( 1.0 - percent );
-		v1 *= percent;
-		v2 += v1;
-		interpolatedPos = v2;
-#endif
-	}
+	target.positionAtDistance( distSoFar, interpolatedPos );
 	return &interpolatedPos;
 
 }
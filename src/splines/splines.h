@@ -31,6 +31,7 @@ If you have questions concerning this license or the applicable additional terms
 #include "../renderer/qgl.h"
 #include "util_list.h"
 #include "util_str.h"
+#include "spline_table.h"
 #include "../idlib/math/Vector.h"
 
 typedef int fileHandle_t;
@@ -113,6 +114,7 @@ void clearSpline() {
 		delete splinePoints[i];
 	}
 	splinePoints.Clear();
+	arcLength.clear();
 }
 
 void parse( const char *( *text ) );
@@ -205,6 +207,9 @@ void addSegmentTime( int index, int time ) {
 
 float totalDistance();
 
+// the point distance along the path, clamped to its ends
+void positionAtDistance( float distance, idVec3 &pos );
+
 static idVec3 zero;
 
 int getActiveSegment() {
@@ -254,9 +259,9 @@ void setBaseTime( long t ) {
 
 protected:
 idStr name;
-float calcSpline( int step, float tension );
 idList<idVec3*> controlPoints;
 idList<idVec3*> splinePoints;
+ArcLengthTable arcLength;                   // built with splinePoints
 idList<double> splineTime;
 idVec3 *selected;
 idVec3 pathColor, segmentColor, controlColor, activeColor;
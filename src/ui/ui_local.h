@@ -802,6 +802,7 @@ void            trap_R_AddCoronaToScene( const vec3_t org, float r, float g, flo
 void            trap_R_RenderScene( const refdef_t *fd );
 void            RE_SetColor( const float *rgba );
 void            trap_R_DrawStretchPic( float x, float y, float w, float h, float s1, float t1, float s2, float t2, qhandle_t hShader );
+void            trap_R_DrawStretchQuads( qhandle_t hShader, const stretchQuad_t *quads, int numQuads );
 void            trap_R_ModelBounds( clipHandle_t model, vec3_t mins, vec3_t maxs );
 void            SCR_UpdateScreen( void );
 
@@ -207,6 +207,15 @@ void Text_PaintChar( float x, float y, float scale, glyphInfo_t *glyph )
     trap_R_DrawStretchPic( x, y, w, h, glyph->s, glyph->t, glyph->s2, glyph->t2, glyph->glyph);
 }
 
+// Text_PaintChar into a batch, so that a string goes to the renderer in one piece
+void Text_AddChar( textBatch_t &batch, float x, float y, float scale, const glyphInfo_t *glyph, const float *color )
+{
+    float w = glyph->imageWidth * scale;
+    float h = glyph->imageHeight * scale;
+    UI_AdjustFrom640( &x, &y, &w, &h );
+    batch.add( glyph->glyph, x, y, w, h, glyph->s, glyph->t, glyph->s2, glyph->t2, color );
+}
+
 void Text_Paint( float x, float y, int font, float scale, vec4_t color, const char *text, float adjust, int limit, int style )
 {
     if (!text){
@@ -217,9 +226,10 @@ void Text_Paint( float x, float y, int font, float scale, vec4_t color, const ch
 
 	float useScale = scale * fnt->glyphScale;
 
+    textBatch_t batch( trap_R_DrawStretchQuads );
     const char *s = text;
-    RE_SetColor( color );
     vec4_t newColor;
+    vec4_t shadowColor = { 0, 0, 0, 1 };
     memcpy( &newColor[0], &color[0], sizeof( vec4_t ) );
     size_t len = strnlen( text, 1024);
     if ( limit > 0 && len > limit ) {
@@ -231,26 +241,24 @@ void Text_Paint( float x, float y, int font, float scale, vec4_t color, const ch
         if ( Q_IsColorString( s ) ) {
             memcpy( newColor, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( newColor ) );
             newColor[3] = color[3];
-            RE_SetColor( newColor );
             s += 2;
         } else {
-            glyphInfo_t *glyph = &fnt->glyphs[*s];
+            const glyphInfo_t *glyph = &fnt->glyphs[(unsigned char)*s];
             float yadj = useScale * glyph->top;
             if ( style == ITEM_TEXTSTYLE_SHADOWED || style == ITEM_TEXTSTYLE_SHADOWEDMORE ) {
                 int ofs = style == ITEM_TEXTSTYLE_SHADOWED ? 1 : 2;
-                colorBlack[3] = newColor[3];
-                RE_SetColor( colorBlack );
-                Text_PaintChar( x + ofs, y - yadj + ofs, useScale, glyph );
-                RE_SetColor( newColor );
-                colorBlack[3] = 1.0;
+                shadowColor[3] = newColor[3];
+                Text_AddChar( batch, x + ofs, y - yadj + ofs, useScale, glyph, shadowColor );
             }
-            Text_PaintChar( x, y - yadj, useScale, glyph );
+            Text_AddChar( batch, x, y - yadj, useScale, glyph, newColor );
 
             x += ( glyph->xSkip * useScale ) + adjust;
             s++;
             count++;
         }
     }
+    batch.flush();
+    RE_SetColor( newColor );
 }
 
 void Text_PaintWithCursor( float x, float y, int font, float scale, vec4_t color, const char *text, int cursorPos, char cursor, int limit, int style )
@@ -261,38 +269,36 @@ void Text_PaintWithCursor( float x, float y, int font, float scale, vec4_t color
     fontInfo_t *fnt = getTextFont(font, scale);
 	float useScale = scale * fnt->glyphScale;
 
+    textBatch_t batch( trap_R_DrawStretchQuads );
     const char *s = text;
-    RE_SetColor( color );
     vec4_t newColor;
+    vec4_t shadowColor = { 0, 0, 0, 1 };
     memcpy( &newColor[0], &color[0], sizeof( vec4_t ) );
     size_t len = strnlen( text, 1024);
     if ( limit > 0 && len > limit ) {
         len = limit;
     }
     int count = 0;
-    glyphInfo_t *cursorGlyph = &fnt->glyphs[(unsigned char)cursor];
+    const glyphInfo_t *cursorGlyph = &fnt->glyphs[(unsigned char)cursor];
+    const bool cursorOn = !( ( uiInfo.uiDC.realTime / BLINK_DIVISOR ) & 1 );
     while ( s && *s && count < len ) {
-        glyphInfo_t *glyph = &fnt->glyphs[*s];
+        const glyphInfo_t *glyph = &fnt->glyphs[(unsigned char)*s];
         if ( Q_IsColorString( s ) ) {
             memcpy( newColor, g_color_table[ColorIndex( *( s + 1 ) )], sizeof( newColor ) );
             newColor[3] = color[3];
-            RE_SetColor( newColor );
             s += 2;
         } else {
             float yadj = useScale * glyph->top;
             if ( style == ITEM_TEXTSTYLE_SHADOWED || style == ITEM_TEXTSTYLE_SHADOWEDMORE ) {
                 int ofs = style == ITEM_TEXTSTYLE_SHADOWED ? 1 : 2;
-                colorBlack[3] = newColor[3];
-                RE_SetColor( colorBlack );
-                Text_PaintChar( x + ofs, y - yadj + ofs, useScale, glyph );
-                colorBlack[3] = 1.0;
-                RE_SetColor( newColor );
+                shadowColor[3] = newColor[3];
+                Text_AddChar( batch, x + ofs, y - yadj + ofs, useScale, glyph, shadowColor );
             }
-            Text_PaintChar( x, y - yadj, useScale, glyph );
+            Text_AddChar( batch, x, y - yadj, useScale, glyph, newColor );
             
-            if ( count == cursorPos && !( ( uiInfo.uiDC.realTime / BLINK_DIVISOR ) & 1 ) ) {
+            if ( count == cursorPos && cursorOn ) {
                 yadj = useScale * cursorGlyph->top;
-                Text_PaintChar( x, y - yadj, useScale, cursorGlyph );
+                Text_AddChar( batch, x, y - yadj, useScale, cursorGlyph, newColor );
             }
 
             x += ( glyph->xSkip * useScale );
@@ -302,10 +308,12 @@ void Text_PaintWithCursor( float x, float y, int font, float scale, vec4_t color
     }
     
     // need to paint cursor at end of text
-    if ( cursorPos == len && !( ( uiInfo.uiDC.realTime / BLINK_DIVISOR ) & 1 ) ) {
+    if ( cursorPos == len && cursorOn ) {
         float yadj = useScale * cursorGlyph->top;
-        Text_PaintChar( x, y - yadj, useScale, cursorGlyph );
+        Text_AddChar( batch, x, y - yadj, useScale, cursorGlyph, newColor );
     }
+    batch.flush();
+    RE_SetColor( newColor );
 	
 }
 
@@ -1294,7 +1302,7 @@ void UI_ParseSavegame( int index )
 	FS_Read( &ver, sizeof( ver ), f );
 
 	// if the version is wrong, just set some defaults and get out
-	if ( ver != 18 ) {
+	if ( ver != SAVE_VERSION && ver != SAVE_VERSION_RLE ) {
 		FS_FCloseFile( f );
 		uiInfo.savegameList[index].mapName          = "unknownmap";
 		uiInfo.savegameList[index].episode          = -1;
@@ -2205,6 +2213,9 @@ static cvarTable_t cvarTable[] = {
 
 static int cvarTableSize = sizeof( cvarTable ) / sizeof( cvarTable[0] );
 
+// cvar_modificationCount as of the last full update of the cvar table
+static int cvarModificationCount = -1;
+
 
 /*
 =================
@@ -2216,6 +2227,8 @@ void UI_RegisterCvars( void ) {
 	int i;
 	cvarTable_t *cv;
 
+	cvarModificationCount = -1;
+
 	for ( i = 0, cv = cvarTable ; i < cvarTableSize ; i++, cv++ ) {
 		Cvar_Register( cv->vmCvar, cv->cvarName, cv->defaultString, cv->cvarFlags );
 	}
@@ -2231,6 +2244,12 @@ void UI_UpdateCvars( void ) {
 	int i;
 	cvarTable_t *cv;
 
+	// no cvar has changed since the last update
+	if ( cvarModificationCount == cvar_modificationCount ) {
+		return;
+	}
+	cvarModificationCount = cvar_modificationCount;
+
 	for ( i = 0, cv = cvarTable ; i < cvarTableSize ; i++, cv++ ) {
 		Cvar_Update( cv->vmCvar );
 	}
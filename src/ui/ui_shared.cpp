@@ -89,6 +89,7 @@ bool Item_Bind_HandleKey( itemDef_t *item, int key, bool down );
 itemDef_t *Menu_SetPrevCursorItem( menuDef_t *menu );
 itemDef_t *Menu_SetNextCursorItem( menuDef_t *menu );
 static bool Menu_OverActiveItem( menuDef_t *menu, float x, float y );
+static void Script_ClearCache( void );
 
 #define MEM_POOL_SIZE  1024 * 1024 * 2
 
@@ -279,6 +280,7 @@ String_Init
 */
 void String_Init() {
 	int i;
+	Script_ClearCache();
 	for ( i = 0; i < HASH_TABLE_SIZE; i++ ) {
 		strHandle[i] = 0;
 	}
@@ -854,72 +856,29 @@ bool Rect_ContainsPoint( rectDef_t *rect, float x, float y ) {
 	return false;
 }
 
-int Menu_ItemsMatchingGroup( menuDef_t *menu, const char *name ) {
-
-	int count = 0;
-	int wildcard = -1;  // if wildcard is set, it's value is the number of characters to compare
-
-
+// if the name has a wildcard, the number of characters before it, otherwise -1
+static int Menu_GroupWildcard( const char *name ) {
 	const char* pdest = strstr( name, "*" ); // allow wildcard strings (ex.  "hide nb_*" would translate to "hide nb_pg1; hide nb_extra" etc)
 	if ( pdest ) {
-		wildcard = pdest - name;
-	}
-
-	for (int i = 0; i < menu->itemCount; i++ ) {
-		if ( wildcard != -1 ) {
-			if ( Q_strncmp( menu->items[i]->window.name, name, wildcard ) == 0 || ( menu->items[i]->window.group && Q_strncmp( menu->items[i]->window.group, name, wildcard ) == 0 ) ) {
-				count++;
-			}
-		} else {
-			if ( Q_stricmp( menu->items[i]->window.name, name ) == 0 || ( menu->items[i]->window.group && Q_stricmp( menu->items[i]->window.group, name ) == 0 ) ) {
-				count++;
-			}
-		}
+		return pdest - name;
 	}
-
-	return count;
+	return -1;
 }
 
-itemDef_t *Menu_GetMatchingItemByNumber( menuDef_t *menu, int index, const char *name ) {
-	int i;
-	int count = 0;
-
-	int wildcard = -1;  // if wildcard is set, it's value is the number of characters to compare
-
-	const char* pdest = strstr( name, "*" ); // allow wildcard strings (ex.  "hide nb_*" would translate to "hide nb_pg1; hide nb_extra" etc)
-	if ( pdest ) {
-		wildcard = pdest - name;
+static bool Item_MatchesGroup( itemDef_t *item, const char *name, int wildcard ) {
+	if ( wildcard != -1 ) {
+		return Q_strncmp( item->window.name, name, wildcard ) == 0 || ( item->window.group && Q_strncmp( item->window.group, name, wildcard ) == 0 );
 	}
-
-	for ( i = 0; i < menu->itemCount; i++ ) {
-		if ( wildcard != -1 ) {
-			if ( Q_strncmp( menu->items[i]->window.name, name, wildcard ) == 0 || ( menu->items[i]->window.group && Q_strncmp( menu->items[i]->window.group, name, wildcard ) == 0 ) ) {
-				if ( count == index ) {
-					return menu->items[i];
-				}
-				count++;
-			}
-		} else {
-			if ( Q_stricmp( menu->items[i]->window.name, name ) == 0 || ( menu->items[i]->window.group && Q_stricmp( menu->items[i]->window.group, name ) == 0 ) ) {
-				if ( count == index ) {
-					return menu->items[i];
-				}
-				count++;
-			}
-		}
-	}
-	return nullptr;
+	return Q_stricmp( item->window.name, name ) == 0 || ( item->window.group && Q_stricmp( item->window.group, name ) == 0 );
 }
 
 
-
-void Script_SetColor( itemDef_t *item, const char **args ) {
-	const char *name;
+void Script_SetColor( itemDef_t *item, const scriptDef_t *script ) {
 	int i;
-	float f;
 	vec4_t *out;
 	// expecting type of color to set and 4 args for the color
-	if ( String_Parse( args, &name ) ) {
+	if ( script->argc ) {
+		const char *name = script->args[0];
 		out = nullptr;
 		if ( Q_stricmp( name, "backcolor" ) == 0 ) {
 			out = &item->window.backColor;
@@ -932,31 +891,26 @@ void Script_SetColor( itemDef_t *item, const char **args ) {
 		}
 
 		if ( out ) {
-			for ( i = 0; i < 4; i++ ) {
-				if ( !Float_Parse( args, &f ) ) {
-					return;
-				}
-				( *out )[i] = f;
+			for ( i = 0; i < 4 && 1 + i < script->argc; i++ ) {
+				( *out )[i] = script->values[1 + i];
 			}
 		}
 	}
 }
 
-void Script_SetAsset( itemDef_t *item, const char **args ) {
-	const char *name;
+void Script_SetAsset( itemDef_t *item, const scriptDef_t *script ) {
 	// expecting name to set asset to
-	if ( String_Parse( args, &name ) ) {
+	if ( script->argc ) {
 		// check for a model
 		if ( item->type == ITEM_TYPE_MODEL ) {
 		}
 	}
 }
 
-void Script_SetBackground( itemDef_t *item, const char **args ) {
-	const char *name;
+void Script_SetBackground( itemDef_t *item, const scriptDef_t *script ) {
 	// expecting name to set asset to
-	if ( String_Parse( args, &name ) ) {
-		item->window.background = DC->registerShaderNoMip( name );
+	if ( script->argc ) {
+		item->window.background = DC->registerShaderNoMip( script->args[0] );
 	}
 }
 
@@ -979,39 +933,30 @@ itemDef_t *Menu_FindItemByName( menuDef_t *menu, const char *p ) {
 	return nullptr;
 }
 
-void Script_SetItemColor( itemDef_t *item, const char **args ) {
-	const char *itemname;
-	const char *name;
-	vec4_t color;
+void Script_SetItemColor( itemDef_t *item, const scriptDef_t *script ) {
 	int i;
 	vec4_t *out;
-	// expecting type of color to set and 4 args for the color
-	if ( String_Parse( args, &itemname ) && String_Parse( args, &name ) ) {
+	// expecting item name, type of color to set and 4 args for the color
+	if ( script->argc == 6 ) {
+		const char *name = script->args[1];
 		itemDef_t *item2;
 		int j;
-		int count = Menu_ItemsMatchingGroup( (menuDef_t *)item->parent, itemname );
 
-		if ( !Color_Parse( args, &color ) ) {
-			return;
-		}
-
-		for ( j = 0; j < count; j++ ) {
-			item2 = Menu_GetMatchingItemByNumber( (menuDef_t *)item->parent, j, itemname );
-			if ( item2 != nullptr ) {
-				out = nullptr;
-				if ( Q_stricmp( name, "backcolor" ) == 0 ) {
-					out = &item2->window.backColor;
-				} else if ( Q_stricmp( name, "forecolor" ) == 0 ) {
-					out = &item2->window.foreColor;
-					item2->window.flags |= WINDOW_FORECOLORSET;
-				} else if ( Q_stricmp( name, "bordercolor" ) == 0 ) {
-					out = &item2->window.borderColor;
-				}
+		for ( j = 0; j < script->itemCount; j++ ) {
+			item2 = script->items[j];
+			out = nullptr;
+			if ( Q_stricmp( name, "backcolor" ) == 0 ) {
+				out = &item2->window.backColor;
+			} else if ( Q_stricmp( name, "forecolor" ) == 0 ) {
+				out = &item2->window.foreColor;
+				item2->window.flags |= WINDOW_FORECOLORSET;
+			} else if ( Q_stricmp( name, "bordercolor" ) == 0 ) {
+				out = &item2->window.borderColor;
+			}
 
-				if ( out ) {
-					for ( i = 0; i < 4; i++ ) {
-						( *out )[i] = color[i];
-					}
+			if ( out ) {
+				for ( i = 0; i < 4; i++ ) {
+					( *out )[i] = script->values[2 + i];
 				}
 			}
 		}
@@ -1019,45 +964,38 @@ void Script_SetItemColor( itemDef_t *item, const char **args ) {
 }
 
 
-void Menu_ShowItemByName( menuDef_t *menu, const char *p, bool bShow ) {
-	itemDef_t *item;
-	int i;
-	int count = Menu_ItemsMatchingGroup( menu, p );
-	for ( i = 0; i < count; i++ ) {
-		item = Menu_GetMatchingItemByNumber( menu, i, p );
-		if ( item != nullptr ) {
-			if ( bShow ) {
-				item->window.flags |= WINDOW_VISIBLE;
-			} else {
-				item->window.flags &= ~WINDOW_VISIBLE;
-				// stop cinematics playing in the window
-				if ( item->window.cinematic >= 0 ) {
-					DC->stopCinematic( item->window.cinematic );
-					item->window.cinematic = -1;
-				}
-			}
+static void Item_Show( itemDef_t *item, bool bShow ) {
+	if ( bShow ) {
+		item->window.flags |= WINDOW_VISIBLE;
+	} else {
+		item->window.flags &= ~WINDOW_VISIBLE;
+		// stop cinematics playing in the window
+		if ( item->window.cinematic >= 0 ) {
+			DC->stopCinematic( item->window.cinematic );
+			item->window.cinematic = -1;
 		}
 	}
 }
 
-void Menu_FadeItemByName( menuDef_t *menu, const char *p, bool fadeOut ) {
-	itemDef_t *item;
-	int i;
-	int count = Menu_ItemsMatchingGroup( menu, p );
-	for ( i = 0; i < count; i++ ) {
-		item = Menu_GetMatchingItemByNumber( menu, i, p );
-		if ( item != nullptr ) {
-			if ( fadeOut ) {
-				item->window.flags |= ( WINDOW_FADINGOUT | WINDOW_VISIBLE );
-				item->window.flags &= ~WINDOW_FADINGIN;
-			} else {
-				item->window.flags |= ( WINDOW_VISIBLE | WINDOW_FADINGIN );
-				item->window.flags &= ~WINDOW_FADINGOUT;
-			}
+void Menu_ShowItemByName( menuDef_t *menu, const char *p, bool bShow ) {
+	int wildcard = Menu_GroupWildcard( p );
+	for (int i = 0; i < menu->itemCount; i++ ) {
+		if ( Item_MatchesGroup( menu->items[i], p, wildcard ) ) {
+			Item_Show( menu->items[i], bShow );
 		}
 	}
 }
 
+static void Item_Fade( itemDef_t *item, bool fadeOut ) {
+	if ( fadeOut ) {
+		item->window.flags |= ( WINDOW_FADINGOUT | WINDOW_VISIBLE );
+		item->window.flags &= ~WINDOW_FADINGIN;
+	} else {
+		item->window.flags |= ( WINDOW_VISIBLE | WINDOW_FADINGIN );
+		item->window.flags &= ~WINDOW_FADINGOUT;
+	}
+}
+
 menuDef_t *Menus_FindByName( const char *p ) {
 	int i;
 	for ( i = 0; i < menuCount; i++ ) {
@@ -1109,47 +1047,41 @@ void Menus_CloseAll() {
 }
 
 
-void Script_Show( itemDef_t *item, const char **args ) {
-	const char *name;
-	if ( String_Parse( args, &name ) ) {
-		Menu_ShowItemByName( (menuDef_t *)item->parent, name, true );
+void Script_Show( itemDef_t *item, const scriptDef_t *script ) {
+	for (int i = 0; i < script->itemCount; i++ ) {
+		Item_Show( script->items[i], true );
 	}
 }
 
-void Script_Hide( itemDef_t *item, const char **args ) {
-	const char *name;
-	if ( String_Parse( args, &name ) ) {
-		Menu_ShowItemByName( (menuDef_t *)item->parent, name, false );
+void Script_Hide( itemDef_t *item, const scriptDef_t *script ) {
+	for (int i = 0; i < script->itemCount; i++ ) {
+		Item_Show( script->items[i], false );
 	}
 }
 
-void Script_FadeIn( itemDef_t *item, const char **args ) {
-	const char *name;
-	if ( String_Parse( args, &name ) ) {
-		Menu_FadeItemByName( (menuDef_t *)item->parent, name, false );
+void Script_FadeIn( itemDef_t *item, const scriptDef_t *script ) {
+	for (int i = 0; i < script->itemCount; i++ ) {
+		Item_Fade( script->items[i], false );
 	}
 }
 
-void Script_FadeOut( itemDef_t *item, const char **args ) {
-	const char *name;
-	if ( String_Parse( args, &name ) ) {
-		Menu_FadeItemByName( (menuDef_t *)item->parent, name, true );
+void Script_FadeOut( itemDef_t *item, const scriptDef_t *script ) {
+	for (int i = 0; i < script->itemCount; i++ ) {
+		Item_Fade( script->items[i], true );
 	}
 }
 
 
 
-void Script_Open( itemDef_t *item, const char **args ) {
-	const char *name;
-	if ( String_Parse( args, &name ) ) {
-		Menus_OpenByName( name );
+void Script_Open( itemDef_t *item, const scriptDef_t *script ) {
+	if ( script->argc ) {
+		Menus_OpenByName( script->args[0] );
 	}
 }
 
-void Script_Close( itemDef_t *item, const char **args ) {
-	const char *name;
-	if ( String_Parse( args, &name ) ) {
-		Menus_CloseByName( name );
+void Script_Close( itemDef_t *item, const scriptDef_t *script ) {
+	if ( script->argc ) {
+		Menus_CloseByName( script->args[0] );
 	}
 }
 
@@ -1159,7 +1091,7 @@ void Script_Close( itemDef_t *item, const char **args ) {
 Script_Clipboard
 ==============
 */
-void Script_Clipboard( itemDef_t *item, const char **args ) {
+void Script_Clipboard( itemDef_t *item, const scriptDef_t *script ) {
 	char curscript[64];
 	Cvar_VariableStringBuffer( "cg_clipboardName", curscript, sizeof( curscript ) ); // grab the string the client set
 	Menu_ShowItemByName( (menuDef_t *)item->parent, curscript, true );
@@ -1178,12 +1110,13 @@ Script_NotebookShowpage
 	inc == 999	- key number.  +999 is jump to last page, -999 is jump to cover page
 ==============
 */
-void Script_NotebookShowpage( itemDef_t *item, const char **args ) {
+void Script_NotebookShowpage( itemDef_t *item, const scriptDef_t *script ) {
 	int i, inc, curpage, newpage = 0, pages;
 
 	pages = Cvar_VariableValue( "cg_notebookpages" );
 
-	if ( Int_Parse( args, &inc ) ) {
+	if ( script->argc ) {
+		inc = atoi( script->args[0] );
 
 		curpage = Cvar_VariableValue( "ui_notebookCurrentPage" );
 
@@ -1268,81 +1201,63 @@ void Script_NotebookShowpage( itemDef_t *item, const char **args ) {
 
 
 
-void Menu_TransitionItemByName( menuDef_t *menu, const char *p, rectDef_t rectFrom, rectDef_t rectTo, int time, float amt ) {
-	itemDef_t *item;
-	int i;
-	int count = Menu_ItemsMatchingGroup( menu, p );
-	for ( i = 0; i < count; i++ ) {
-		item = Menu_GetMatchingItemByNumber( menu, i, p );
-		if ( item != nullptr ) {
-			item->window.flags |= ( WINDOW_INTRANSITION | WINDOW_VISIBLE );
-			item->window.offsetTime = time;
-			memcpy( &item->window.rectClient, &rectFrom, sizeof( rectDef_t ) );
-			memcpy( &item->window.rectEffects, &rectTo, sizeof( rectDef_t ) );
-			item->window.rectEffects2.x = fabsf( rectTo.x - rectFrom.x ) / amt;
-			item->window.rectEffects2.y = fabsf( rectTo.y - rectFrom.y ) / amt;
-			item->window.rectEffects2.w = fabsf( rectTo.w - rectFrom.w ) / amt;
-			item->window.rectEffects2.h = fabsf( rectTo.h - rectFrom.h ) / amt;
-			Item_UpdatePosition( item );
-		}
-	}
+static void Item_Transition( itemDef_t *item, const rectDef_t &rectFrom, const rectDef_t &rectTo, int time, float amt ) {
+	item->window.flags |= ( WINDOW_INTRANSITION | WINDOW_VISIBLE );
+	item->window.offsetTime = time;
+	memcpy( &item->window.rectClient, &rectFrom, sizeof( rectDef_t ) );
+	memcpy( &item->window.rectEffects, &rectTo, sizeof( rectDef_t ) );
+	item->window.rectEffects2.x = fabsf( rectTo.x - rectFrom.x ) / amt;
+	item->window.rectEffects2.y = fabsf( rectTo.y - rectFrom.y ) / amt;
+	item->window.rectEffects2.w = fabsf( rectTo.w - rectFrom.w ) / amt;
+	item->window.rectEffects2.h = fabsf( rectTo.h - rectFrom.h ) / amt;
+	Item_UpdatePosition( item );
 }
 
 
-void Script_Transition( itemDef_t *item, const  char **args ) {
-	const char *name;
-	rectDef_t rectFrom, rectTo;
-	int time;
-	float amt;
-
-	if ( String_Parse( args, &name ) ) {
-		if ( Rect_Parse( args, &rectFrom ) && Rect_Parse( args, &rectTo ) && Int_Parse( args, &time ) && Float_Parse( args, &amt ) ) {
-			Menu_TransitionItemByName( (menuDef_t *)item->parent, name, rectFrom, rectTo, time, amt );
+void Script_Transition( itemDef_t *item, const scriptDef_t *script ) {
+	// name, two rects, time and amount
+	if ( script->argc == 11 ) {
+		const float *v = script->values;
+		const rectDef_t rectFrom = { v[1], v[2], v[3], v[4] };
+		const rectDef_t rectTo = { v[5], v[6], v[7], v[8] };
+		const int time = atoi( script->args[9] );
+		for (int i = 0; i < script->itemCount; i++ ) {
+			Item_Transition( script->items[i], rectFrom, rectTo, time, v[10] );
 		}
 	}
 }
 
 
-void Menu_OrbitItemByName( menuDef_t *menu, const char *p, float x, float y, float cx, float cy, int time ) {
-	itemDef_t *item;
-	int i;
-	int count = Menu_ItemsMatchingGroup( menu, p );
-	for ( i = 0; i < count; i++ ) {
-		item = Menu_GetMatchingItemByNumber( menu, i, p );
-		if ( item != nullptr ) {
-			item->window.flags |= ( WINDOW_ORBITING | WINDOW_VISIBLE );
-			item->window.offsetTime = time;
-			item->window.rectEffects.x = cx;
-			item->window.rectEffects.y = cy;
-			item->window.rectClient.x = x;
-			item->window.rectClient.y = y;
-			Item_UpdatePosition( item );
-		}
-	}
+static void Item_Orbit( itemDef_t *item, float x, float y, float cx, float cy, int time ) {
+	item->window.flags |= ( WINDOW_ORBITING | WINDOW_VISIBLE );
+	item->window.offsetTime = time;
+	item->window.rectEffects.x = cx;
+	item->window.rectEffects.y = cy;
+	item->window.rectClient.x = x;
+	item->window.rectClient.y = y;
+	Item_UpdatePosition( item );
 }
 
 
-void Script_Orbit( itemDef_t *item, const char **args ) {
-	const char *name;
-	float cx, cy, x, y;
-	int time;
-
-	if ( String_Parse( args, &name ) ) {
-		if ( Float_Parse( args, &x ) && Float_Parse( args, &y ) && Float_Parse( args, &cx ) && Float_Parse( args, &cy ) && Int_Parse( args, &time ) ) {
-			Menu_OrbitItemByName( (menuDef_t *)item->parent, name, x, y, cx, cy, time );
+void Script_Orbit( itemDef_t *item, const scriptDef_t *script ) {
+	// name, x, y, cx, cy and time
+	if ( script->argc == 6 ) {
+		const float *v = script->values;
+		const int time = atoi( script->args[5] );
+		for (int i = 0; i < script->itemCount; i++ ) {
+			Item_Orbit( script->items[i], v[1], v[2], v[3], v[4], time );
 		}
 	}
 }
 
 
 
-void Script_SetFocus( itemDef_t *item, const char **args ) {
-	const char *name;
+void Script_SetFocus( itemDef_t *item, const scriptDef_t *script ) {
 	itemDef_t *focusItem;
 
-	if ( String_Parse( args, &name ) ) {
-		focusItem = Menu_FindItemByName( (menuDef_t *)item->parent, name );
-		if ( focusItem && !( focusItem->window.flags & WINDOW_DECORATION ) && !( focusItem->window.flags & WINDOW_HASFOCUS ) ) {
+	if ( script->itemCount ) {
+		focusItem = script->items[0];
+		if ( !( focusItem->window.flags & WINDOW_DECORATION ) && !( focusItem->window.flags & WINDOW_HASFOCUS ) ) {
 			Menu_ClearFocus((menuDef_t *) item->parent );
 			focusItem->window.flags |= WINDOW_HASFOCUS;
 			if ( focusItem->onFocus ) {
@@ -1356,44 +1271,39 @@ void Script_SetFocus( itemDef_t *item, const char **args ) {
 }
 
 
-void Script_SetCvar( itemDef_t *item, const char **args ) {
-	const char *cvar, *val;
-	if ( String_Parse( args, &cvar ) && String_Parse( args, &val ) ) {
-		DC->setCVar( cvar, val );
+void Script_SetCvar( itemDef_t *item, const scriptDef_t *script ) {
+	if ( script->argc == 2 ) {
+		DC->setCVar( script->args[0], script->args[1] );
 	}
-
 }
 
-void Script_Exec( itemDef_t *item, const char **args ) {
-	const char *val;
-	if ( String_Parse( args, &val ) ) {
-		DC->executeText( EXEC_APPEND, va( "%s ; ", val ) );
+void Script_Exec( itemDef_t *item, const scriptDef_t *script ) {
+	if ( script->argc ) {
+		DC->executeText( EXEC_APPEND, va( "%s ; ", script->args[0] ) );
 	}
 }
 
-void Script_Play( itemDef_t *item, const char **args ) {
-	const char *val;
-	if ( String_Parse( args, &val ) ) {
-		DC->startLocalSound( DC->registerSound( val ), CHAN_LOCAL_SOUND );      // all sounds are not 3d
+void Script_Play( itemDef_t *item, const scriptDef_t *script ) {
+	if ( script->argc ) {
+		DC->startLocalSound( DC->registerSound( script->args[0] ), CHAN_LOCAL_SOUND );      // all sounds are not 3d
 	}
 }
 
-void Script_playLooped( itemDef_t *item, const char **args ) {
-	const char *val;
-	if ( String_Parse( args, &val ) ) {
-		DC->startBackgroundTrack( val, val, 0 );
+void Script_playLooped( itemDef_t *item, const scriptDef_t *script ) {
+	if ( script->argc ) {
+		DC->startBackgroundTrack( script->args[0], script->args[0], 0 );
 	}
 }
 
 // NERVE - SMF
-void Script_AddListItem( itemDef_t *item, const char **args ) {
-	const char *itemname, *val, *name;
+void Script_AddListItem( itemDef_t *item, const scriptDef_t *script ) {
 	itemDef_t *t;
 
-	if ( String_Parse( args, &itemname ) && String_Parse( args, &val ) && String_Parse( args, &name ) ) {
-		t = Menu_FindItemByName( (menuDef_t*)item->parent, itemname );
-		if ( t && t->special ) {
-			DC->feederAddItem( t->special, name, atoi( val ) );
+	// item name, index and text
+	if ( script->argc == 3 && script->itemCount ) {
+		t = script->items[0];
+		if ( t->special ) {
+			DC->feederAddItem( t->special, script->args[2], atoi( script->args[1] ) );
 		}
 	}
 }
@@ -1401,101 +1311,302 @@ void Script_AddListItem( itemDef_t *item, const char **args ) {
 
 commandDef_t commandList[] =
 {
-	{"fadein", &Script_FadeIn},                  // group/name
-	{"fadeout", &Script_FadeOut},                // group/name
-	{"show", &Script_Show},                      // group/name
-	{"hide", &Script_Hide},                      // group/name
-	{"setcolor", &Script_SetColor},              // works on this
-	{"open", &Script_Open},                      // menu
-	{"close", &Script_Close},                    // menu
-	{"clipboard", &Script_Clipboard},            // show the current clipboard group by name
-	{"showpage", &Script_NotebookShowpage},          //
-	{"setasset", &Script_SetAsset},              // works on this
-	{"setbackground", &Script_SetBackground},    // works on this
-	{"setitemcolor", &Script_SetItemColor},      // group/name
-
-	{"setfocus", &Script_SetFocus},
-
-	{"transition", &Script_Transition},          // group/name
-	{"setcvar", &Script_SetCvar},                // group/name
-	{"exec", &Script_Exec},                      // group/name
-	{"play", &Script_Play},                      // group/name
-	{"playlooped", &Script_playLooped},          // group/name
-	{"orbit", &Script_Orbit},                    // group/name
-	{"addlistitem", &Script_AddListItem}     // NERVE - SMF - special command to add text items to list box
+	{"fadein", &Script_FadeIn, 1, SCRIPT_TARGET_GROUP},                  // group/name
+	{"fadeout", &Script_FadeOut, 1, SCRIPT_TARGET_GROUP},                // group/name
+	{"show", &Script_Show, 1, SCRIPT_TARGET_GROUP},                      // group/name
+	{"hide", &Script_Hide, 1, SCRIPT_TARGET_GROUP},                      // group/name
+	{"setcolor", &Script_SetColor, 5, SCRIPT_TARGET_NONE},               // works on this
+	{"open", &Script_Open, 1, SCRIPT_TARGET_NONE},                       // menu
+	{"close", &Script_Close, 1, SCRIPT_TARGET_NONE},                     // menu
+	{"clipboard", &Script_Clipboard, 0, SCRIPT_TARGET_NONE},             // show the current clipboard group by name
+	{"showpage", &Script_NotebookShowpage, 1, SCRIPT_TARGET_NONE},       //
+	{"setasset", &Script_SetAsset, 1, SCRIPT_TARGET_NONE},               // works on this
+	{"setbackground", &Script_SetBackground, 1, SCRIPT_TARGET_NONE},     // works on this
+	{"setitemcolor", &Script_SetItemColor, 6, SCRIPT_TARGET_GROUP},      // group/name
+
+	{"setfocus", &Script_SetFocus, 1, SCRIPT_TARGET_ITEM},
+
+	{"transition", &Script_Transition, 11, SCRIPT_TARGET_GROUP},         // group/name
+	{"setcvar", &Script_SetCvar, 2, SCRIPT_TARGET_NONE},                 // group/name
+	{"exec", &Script_Exec, 1, SCRIPT_TARGET_NONE},                       // group/name
+	{"play", &Script_Play, 1, SCRIPT_TARGET_NONE},                       // group/name
+	{"playlooped", &Script_playLooped, 1, SCRIPT_TARGET_NONE},           // group/name
+	{"orbit", &Script_Orbit, 6, SCRIPT_TARGET_GROUP},                    // group/name
+	{"addlistitem", &Script_AddListItem, 3, SCRIPT_TARGET_ITEM}      // NERVE - SMF - special command to add text items to list box
 };
 
 int scriptCommandCount = sizeof( commandList ) / sizeof( commandDef_t );
 
 
-void Item_RunScript( itemDef_t *item, const char *s ) {
-	char script[1024];
-	int i;
-	bool bRan;
-	memset( script, 0, sizeof( script ) );
-	if ( item && s && s[0] ) {
-		Q_strcat( script, 1024, s );
-		const char* p = script;
-		while ( 1 ) {
-			const char *command;
-			// expect command then arguments, ; ends command, nullptr ends script
-			if ( !String_Parse( &p, &command ) ) {
-				return;
+/*
+Item scripts are compiled the first time they run in a menu into lists of
+scriptDef_t: each command looked up, its arguments parsed the way its handler
+reads them and the items they name found. The lists live in scriptPool until
+the menus are reloaded. A command that isn't in commandList is handed to
+DC->runScript with the text after it, as before, and the script carries on
+from wherever that leaves off, compiled from there the first time.
+*/
+
+#define SCRIPT_POOL_SIZE    ( 512 * 1024 )
+#define SCRIPT_HASH_SIZE    1024
+
+typedef struct compiledScript_s {
+	const char *text;               // the script, a String_Alloc string
+	menuDef_t *menu;                // the menu it runs in
+	scriptDef_t *first;
+	struct compiledScript_s *next;  // in the hash chain
+} compiledScript_t;
+
+alignas( 16 ) static char scriptPool[SCRIPT_POOL_SIZE];
+static int scriptPoolIndex;
+static compiledScript_t *scriptHash[SCRIPT_HASH_SIZE];
+static int scriptGeneration;        // bumped when the compiled scripts are thrown away
+
+static void *Script_Alloc( size_t size ) {
+	if ( scriptPoolIndex + size > SCRIPT_POOL_SIZE ) {
+		return nullptr;
+	}
+	void *p = &scriptPool[scriptPoolIndex];
+	scriptPoolIndex += ( size + 15 ) & ~15;
+	return p;
+}
+
+static void Script_ClearCache( void ) {
+	memset( scriptHash, 0, sizeof( scriptHash ) );
+	scriptPoolIndex = 0;
+	scriptGeneration++;
+}
+
+static const commandDef_t *Script_FindCommand( const char *name ) {
+	for ( int i = 0; i < scriptCommandCount; i++ ) {
+		if ( Q_stricmp( name, commandList[i].name ) == 0 ) {
+			return &commandList[i];
+		}
+	}
+	return nullptr;
+}
+
+static bool Script_IsColorName( const char *name ) {
+	return Q_stricmp( name, "backcolor" ) == 0 || Q_stricmp( name, "forecolor" ) == 0 || Q_stricmp( name, "bordercolor" ) == 0;
+}
+
+/*
+==============
+Script_ParseCommand
+
+Reads the command at *p and as many of its arguments as its handler would,
+stopping at the first that is missing. items has room for MAX_MENUITEMS.
+Returns false at the end of the script.
+==============
+*/
+static bool Script_ParseCommand( const char **p, menuDef_t *menu, scriptDef_t *script, itemDef_t **items ) {
+	const char *command;
+
+	memset( script, 0, sizeof( scriptDef_t ) );
+	script->items = items;
+	script->nextStart = -1;
+	do {
+		// expect command then arguments, ; ends command, nullptr ends script
+		if ( !String_Parse( p, &command ) ) {
+			return false;
+		}
+	} while ( command[0] == ';' && command[1] == '\0' );
+
+	script->command = Script_FindCommand( command );
+	if ( !script->command ) {
+		// not in our auto list, the arguments are left to DC->runScript
+		return true;
+	}
+
+	int count = script->command->args;
+	while ( script->argc < count && String_Parse( p, &script->args[script->argc] ) ) {
+		const char *arg = script->args[script->argc];
+		script->values[script->argc] = arg ? atof( arg ) : 0;
+		script->argc++;
+		// setcolor reads a color only for the colors it knows
+		if ( script->argc == 1 && script->command->handler == &Script_SetColor && !Script_IsColorName( arg ) ) {
+			count = 1;
+		}
+	}
+
+	if ( script->argc && menu ) {
+		if ( script->command->target == SCRIPT_TARGET_GROUP ) {
+			int wildcard = Menu_GroupWildcard( script->args[0] );
+			for ( int i = 0; i < menu->itemCount; i++ ) {
+				if ( Item_MatchesGroup( menu->items[i], script->args[0], wildcard ) ) {
+					items[script->itemCount++] = menu->items[i];
+				}
+			}
+		} else if ( script->command->target == SCRIPT_TARGET_ITEM ) {
+			itemDef_t *found = Menu_FindItemByName( menu, script->args[0] );
+			if ( found ) {
+				items[script->itemCount++] = found;
 			}
+		}
+	}
+	return true;
+}
 
-			if ( command[0] == ';' && command[1] == '\0' ) {
-				continue;
+// compiles text from p up to the end or the first command for DC->runScript
+static bool Script_Compile( const char *text, const char *p, menuDef_t *menu, scriptDef_t **first ) {
+	scriptDef_t parsed;
+	itemDef_t *items[MAX_MENUITEMS];
+	scriptDef_t **link = first;
+
+	*first = nullptr;
+	while ( Script_ParseCommand( &p, menu, &parsed, items ) ) {
+		scriptDef_t *script = (scriptDef_t *)Script_Alloc( sizeof( scriptDef_t ) );
+		if ( !script ) {
+			return false;
+		}
+		*script = parsed;
+		script->items = nullptr;
+		if ( parsed.itemCount ) {
+			script->items = (itemDef_t **)Script_Alloc( parsed.itemCount * sizeof( itemDef_t * ) );
+			if ( !script->items ) {
+				return false;
 			}
+			memcpy( script->items, items, parsed.itemCount * sizeof( itemDef_t * ) );
+		}
+		script->end = p ? p - text : -1;
+		*link = script;
+		link = &script->next;
+		if ( !script->command ) {
+			break;
+		}
+	}
+	return true;
+}
 
-			bRan = false;
-			for ( i = 0; i < scriptCommandCount; i++ ) {
-				if ( Q_stricmp( command, commandList[i].name ) == 0 ) {
-					( commandList[i].handler( item, &p ) );
-					bRan = true;
-					break;
+static compiledScript_t *Script_Find( const char *s, const char *text, menuDef_t *menu ) {
+	const int hash = ( ( (uintptr_t)s >> 4 ) ^ ( (uintptr_t)menu >> 6 ) ) & ( SCRIPT_HASH_SIZE - 1 );
+	compiledScript_t *compiled;
+
+	for ( compiled = scriptHash[hash]; compiled; compiled = compiled->next ) {
+		if ( compiled->text == s && compiled->menu == menu ) {
+			return compiled;
+		}
+	}
+
+	compiled = (compiledScript_t *)Script_Alloc( sizeof( compiledScript_t ) );
+	if ( !compiled || !Script_Compile( text, text, menu, &compiled->first ) ) {
+		return nullptr;
+	}
+	compiled->text = s;
+	compiled->menu = menu;
+	compiled->next = scriptHash[hash];
+	scriptHash[hash] = compiled;
+	return compiled;
+}
+
+// runs the script from p a command at a time, when it can't be compiled
+static void Item_RunScriptText( itemDef_t *item, const char *p ) {
+	scriptDef_t script;
+	itemDef_t *items[MAX_MENUITEMS];
+
+	while ( Script_ParseCommand( &p, (menuDef_t *)item->parent, &script, items ) ) {
+		if ( script.command ) {
+			script.command->handler( item, &script );
+		} else {
+			DC->runScript( &p );
+		}
+	}
+}
+
+void Item_RunScript( itemDef_t *item, const char *s ) {
+	char text[1024];
+
+	if ( !item || !s || !s[0] ) {
+		return;
+	}
+	Q_strncpyz( text, s, sizeof( text ) );
+	menuDef_t *menu = (menuDef_t *)item->parent;
+	const int generation = scriptGeneration;
+
+	compiledScript_t *compiled = Script_Find( s, text, menu );
+	if ( !compiled ) {
+		Item_RunScriptText( item, text );
+		return;
+	}
+
+	scriptDef_t *script = compiled->first;
+	while ( script ) {
+		int end = script->end;
+		if ( script->command ) {
+			script->command->handler( item, script );
+		} else {
+			const char *p = text + end;
+			DC->runScript( &p );
+			end = p ? p - text : -1;
+			if ( end != -1 && end != script->nextStart && generation == scriptGeneration ) {
+				if ( !Script_Compile( text, p, menu, &script->next ) ) {
+					script->next = nullptr;
+					script->nextStart = -1;
+					Item_RunScriptText( item, p );
+					return;
 				}
+				script->nextStart = end;
+			} else if ( end == -1 ) {
+				return;
 			}
-			// not in our auto list, pass to handler
-			if ( !bRan ) {
-				DC->runScript( &p );
+		}
+		if ( generation != scriptGeneration ) {
+			// the menus were reloaded under the script, which goes on from the text
+			if ( end != -1 ) {
+				Item_RunScriptText( item, text + end );
 			}
+			return;
 		}
+		script = script->next;
 	}
 }
 
 
-bool Item_EnableShowViaCvar( itemDef_t *item, int flag ) {
+// splits enableCvar into the values Item_EnableShowViaCvar compares the cvar with
+static void Item_ParseEnableValues( itemDef_t *item ) {
 	char script[1024];
-	memset( script, 0, sizeof( script ) );
-	if ( item && item->enableCvar && *item->enableCvar && item->cvarTest && *item->cvarTest ) {
-		char buff[1024];
-		Cvar_VariableStringBuffer( item->cvarTest, buff, sizeof( buff ) );
-
-		Q_strcat( script, 1024, item->enableCvar );
-		const char* p = script;
-		while ( 1 ) {
-			const char *val;
-			// expect value then ; or nullptr, nullptr ends list
-			if ( !String_Parse( &p, &val ) ) {
-				return ( item->cvarFlags & flag ) ? false : true;
-			}
+	const char *p, *val;
+	int count = 0;
 
+	item->enableValues = nullptr;
+	item->enableValueCount = 0;
+	for ( int pass = 0; pass < 2; pass++ ) {
+		Q_strncpyz( script, item->enableCvar, sizeof( script ) );
+		p = script;
+		count = 0;
+		// expect value then ; or nullptr, nullptr ends list
+		while ( String_Parse( &p, &val ) ) {
 			if ( val[0] == ';' && val[1] == '\0' ) {
 				continue;
 			}
-
-			// enable it if any of the values are true
-			if ( item->cvarFlags & flag ) {
-				if ( Q_stricmp( buff, val ) == 0 ) {
-					return true;
-				}
-			} else {
-				// disable it if any of the values are true
-				if ( Q_stricmp( buff, val ) == 0 ) {
-					return false;
-				}
+			if ( pass ) {
+				item->enableValues[count] = val;
+			}
+			count++;
+		}
+		if ( !pass ) {
+			if ( !count ) {
+				return;
 			}
+			item->enableValues = (const char **)UI_Alloc( count * sizeof( const char * ) );
+			if ( !item->enableValues ) {
+				return;
+			}
+		}
+	}
+	item->enableValueCount = count;
+}
 
+bool Item_EnableShowViaCvar( itemDef_t *item, int flag ) {
+	if ( item && item->enableCvar && *item->enableCvar && item->cvarTest && *item->cvarTest ) {
+		char buff[1024];
+		Cvar_VariableStringBuffer( item->cvarTest, buff, sizeof( buff ) );
+
+		for ( int i = 0; i < item->enableValueCount; i++ ) {
+			// enable it if any of the values are true, or disable it
+			if ( Q_stricmp( buff, item->enableValues[i] ) == 0 ) {
+				return ( item->cvarFlags & flag ) ? true : false;
+			}
 		}
 		return ( item->cvarFlags & flag ) ? false : true;
 	}
@@ -5355,6 +5466,7 @@ bool ItemParse_ownerdrawFlag( itemDef_t *item, int handle ) {
 bool ItemParse_enableCvar( itemDef_t *item, int handle ) {
 	if ( PC_Script_Parse( handle, &item->enableCvar ) ) {
 		item->cvarFlags = CVAR_ENABLE;
+		Item_ParseEnableValues( item );
 		return true;
 	}
 	return false;
@@ -5363,6 +5475,7 @@ bool ItemParse_enableCvar( itemDef_t *item, int handle ) {
 bool ItemParse_disableCvar( itemDef_t *item, int handle ) {
 	if ( PC_Script_Parse( handle, &item->enableCvar ) ) {
 		item->cvarFlags = CVAR_DISABLE;
+		Item_ParseEnableValues( item );
 		return true;
 	}
 	return false;
@@ -5371,6 +5484,7 @@ bool ItemParse_disableCvar( itemDef_t *item, int handle ) {
 bool ItemParse_showCvar( itemDef_t *item, int handle ) {
 	if ( PC_Script_Parse( handle, &item->enableCvar ) ) {
 		item->cvarFlags = CVAR_SHOW;
+		Item_ParseEnableValues( item );
 		return true;
 	}
 	return false;
@@ -5379,6 +5493,7 @@ bool ItemParse_showCvar( itemDef_t *item, int handle ) {
 bool ItemParse_hideCvar( itemDef_t *item, int handle ) {
 	if ( PC_Script_Parse( handle, &item->enableCvar ) ) {
 		item->cvarFlags = CVAR_HIDE;
+		Item_ParseEnableValues( item );
 		return true;
 	}
 	return false;
@@ -6008,6 +6123,7 @@ void Menu_PaintAll() {
 }
 
 void Menu_Reset(bool isHud) {
+	Script_ClearCache();
 	if (isHud){
 		hudMenuCount = 0;
 	} else {
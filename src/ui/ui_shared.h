@@ -111,12 +111,6 @@ If you have questions concerning this license or the applicable additional terms
 #define SLIDER_THUMB_HEIGHT 20.0
 #define NUM_CROSSHAIRS      10
 
-typedef struct {
-	const char *command;
-	const char *args[MAX_SCRIPT_ARGS];
-} scriptDef_t;
-
-
 typedef struct {
 	float x;    // horiz position
 	float y;    // vert position
@@ -266,6 +260,8 @@ typedef struct itemDef_s {
 	const char *cvar;               // associated cvar
 	const char *cvarTest;           // associated cvar for enable actions
 	const char *enableCvar;         // enable, disable, show, or hide based on value, this can contain a list
+	const char **enableValues;      // the values in enableCvar
+	int enableValueCount;
 	int cvarFlags;                  //	what type of action to take on cvarenables
 	sfxHandle_t focusSound;
 	int numColors;                  // number of color ranges
@@ -339,9 +335,29 @@ typedef struct {
 
 } cachedAssets_t;
 
-typedef struct {
+// what the first argument of a script command names
+#define SCRIPT_TARGET_NONE      0
+#define SCRIPT_TARGET_GROUP     1   // items by name or group, with wildcards
+#define SCRIPT_TARGET_ITEM      2   // the item with that name
+
+// a command of an item script, compiled: the arguments parsed and the items they name looked up
+typedef struct scriptDef_s {
+	const struct commandDef_s *command; // nullptr hands the command to DC->runScript
+	int end;                        // where the next command is read from, or where DC->runScript reads
+	int argc;                       // arguments read before the script ran out
+	const char *args[MAX_SCRIPT_ARGS];
+	float values[MAX_SCRIPT_ARGS];  // args as numbers
+	int itemCount;                  // items the first argument names
+	itemDef_t **items;
+	int nextStart;                  // after DC->runScript, where next was compiled from
+	struct scriptDef_s *next;
+} scriptDef_t;
+
+typedef struct commandDef_s {
 	const char *name;
-	void ( *handler )( itemDef_t *item, const char** args );
+	void ( *handler )( itemDef_t *item, const scriptDef_t *script );
+	int args;                       // arguments the command reads
+	int target;                     // SCRIPT_TARGET_
 } commandDef_t;
 
 typedef struct {
@@ -0,0 +1,547 @@
+#include "client/roq_decoder.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+const int ROQ_QUAD_INFO = 0x1001;
+const int ROQ_CODEBOOK = 0x1002;
+const int ROQ_QUAD_VQ = 0x1011;
+const int ROQ_PACKET = 0x1030;
+
+// the codebook the way cl_cin.cpp built it before the decoder, ROQ_GenYUVTables, yuv_to_rgb24 and VQ2TO4
+struct ReferenceCodeBook
+{
+    int yy[256], ub[256], ug[256], vg[256], vr[256];
+    uint32_t vq2[256 * 4];
+    uint32_t vq4[256 * 16];
+    uint32_t vq8[256 * 64];
+
+    ReferenceCodeBook() {
+        float t_ub = (1.77200f / 2.0f) * (float)(1 << 6) + 0.5f;
+        float t_vr = (1.40200f / 2.0f) * (float)(1 << 6) + 0.5f;
+        float t_ug = (0.34414f / 2.0f) * (float)(1 << 6) + 0.5f;
+        float t_vg = (0.71414f / 2.0f) * (float)(1 << 6) + 0.5f;
+        for (int i = 0; i < 256; i++) {
+            float x = (float)(2 * i - 255);
+            ub[i] = (int)((t_ub * x) + (1 << 5));
+            vr[i] = (int)((t_vr * x) + (1 << 5));
+            ug[i] = (int)((-t_ug * x));
+            vg[i] = (int)((-t_vg * x) + (1 << 5));
+            yy[i] = (int)((i << 6) | (i >> 2));
+        }
+        std::memset(vq2, 0, sizeof(vq2));
+        std::memset(vq4, 0, sizeof(vq4));
+        std::memset(vq8, 0, sizeof(vq8));
+    }
+
+    unsigned int yuv_to_rgb24(long y, long u, long v) const {
+        int r, g, b, YY = yy[y];
+        r = (YY + vr[v]) >> 6;
+        g = (YY + ug[u] + vg[v]) >> 6;
+        b = (YY + ub[u]) >> 6;
+        if (r < 0) r = 0;
+        if (g < 0) g = 0;
+        if (b < 0) b = 0;
+        if (r > 255) r = 255;
+        if (g > 255) g = 255;
+        if (b > 255) b = 255;
+        return 0xFF000000 | (b << 16) | (g << 8) | r;
+    }
+
+    void decode(const uint8_t* input, unsigned short roq_flags) {
+        int two, four;
+        if (!roq_flags) {
+            two = four = 256;
+        } else {
+            two = roq_flags >> 8;
+            if (!two) {
+                two = 256;
+            }
+            four = roq_flags & 0xff;
+        }
+        four *= 2;
+
+        unsigned int* ibptr = vq2;
+        for (int i = 0; i < two; i++) {
+            int y0 = *input++, y1 = *input++, y2 = *input++, y3 = *input++;
+            int cr = *input++, cb = *input++;
+            *ibptr++ = yuv_to_rgb24(y0, cr, cb);
+            *ibptr++ = yuv_to_rgb24(y1, cr, cb);
+            *ibptr++ = yuv_to_rgb24(y2, cr, cb);
+            *ibptr++ = yuv_to_rgb24(y3, cr, cb);
+        }
+
+        unsigned int* c = vq4;
+        unsigned int* d = vq8;
+        for (int i = 0; i < four; i++) {
+            unsigned int* a = vq2 + (*input++) * 4;
+            unsigned int* b = vq2 + (*input++) * 4;
+            for (int j = 0; j < 2; j++) {
+                *c++ = a[0]; *d++ = a[0]; *d++ = a[0];
+                *c++ = a[1]; *d++ = a[1]; *d++ = a[1];
+                *c++ = b[0]; *d++ = b[0]; *d++ = b[0];
+                *c++ = b[1]; *d++ = b[1]; *d++ = b[1];
+                *d++ = a[0]; *d++ = a[0]; *d++ = a[1]; *d++ = a[1];
+                *d++ = b[0]; *d++ = b[0]; *d++ = b[1]; *d++ = b[1];
+                a += 2;
+                b += 2;
+            }
+        }
+    }
+};
+
+// blitVQQuad32fs with its memcpy blits, on the decoder's codebook
+void referenceVQ(uint8_t** status, const uint8_t* data, int spl, const int* mcomp, const RoqDecoder& roq) {
+    const uint8_t* vq2 = (const uint8_t*)roq.codeBook2();
+    const uint8_t* vq4 = (const uint8_t*)roq.codeBook4();
+    const uint8_t* vq8 = (const uint8_t*)roq.codeBook8();
+    auto blit = [](const uint8_t* src, int srcPitch, uint8_t* dst, int dstPitch, int size) {
+        for (int i = 0; i < size; i++, src += srcPitch, dst += dstPitch) {
+            std::memcpy(dst, src, size * 4);
+        }
+    };
+
+    unsigned short newd = 0, celdata = 0;
+    unsigned int index = 0;
+    auto next = [&]() {
+        if (!newd) {
+            newd = 7;
+            celdata = data[0] + data[1] * 256;
+            data += 2;
+        } else {
+            newd--;
+        }
+        unsigned short code = (unsigned short)(celdata & 0xc000);
+        celdata <<= 2;
+        return code;
+    };
+    do {
+        switch (next()) {
+        case 0x8000:
+            blit(&vq8[*data++ * 256], 32, status[index], spl, 8);
+            index += 5;
+            break;
+        case 0xc000:
+            index++;
+            for (int i = 0; i < 4; i++) {
+                switch (next()) {
+                case 0x8000:
+                    blit(&vq4[*data++ * 64], 16, status[index], spl, 4);
+                    break;
+                case 0xc000:
+                    blit(&vq2[*data++ * 16], 8, status[index], spl, 2);
+                    blit(&vq2[*data++ * 16], 8, status[index] + 8, spl, 2);
+                    blit(&vq2[*data++ * 16], 8, status[index] + spl * 2, spl, 2);
+                    blit(&vq2[*data++ * 16], 8, status[index] + spl * 2 + 8, spl, 2);
+                    break;
+                case 0x4000:
+                    blit(status[index] + mcomp[*data++], spl, status[index], spl, 4);
+                    break;
+                }
+                index++;
+            }
+            break;
+        case 0x4000:
+            blit(status[index] + mcomp[*data++], spl, status[index], spl, 8);
+            index += 5;
+            break;
+        case 0x0000:
+            index += 5;
+            break;
+        }
+    } while (status[index] != nullptr);
+}
+
+// the frame buffers and quads of cl_cin.cpp, 32 bit pixels, for a square video
+struct Player
+{
+    int width = 0;
+    int height = 0;
+    int spl = 0;
+    int screenDelta = 0;
+    int numQuads = 0;
+    std::vector<uint8_t> linbuf;
+    std::vector<uint8_t*> status[2];
+    std::vector<int> blockX;                            // where each entry of status is, for the encoder
+    std::vector<int> blockY;
+    int mcomp[256];
+
+    void quadInfo(int w, int h) {
+        width = w;
+        height = h;
+        spl = w * 4;
+        screenDelta = h * spl;
+        numQuads = 0;
+        linbuf.assign(screenDelta * 2, 0);
+        for (int i = 0; i < 2; i++) {
+            status[i].clear();
+        }
+        blockX.clear();
+        blockY.clear();
+        // setupQuad and recurseQuad: each 8x8 block followed by its four 4x4 ones
+        for (int y = 0; y < h; y += 16) {
+            for (int x = 0; x < w; x += 16) {
+                for (int b = 0; b < 4; b++) {
+                    const int bx = x + (b & 1) * 8;
+                    const int by = y + (b >> 1) * 8;
+                    addBlock(bx, by);
+                    for (int s = 0; s < 4; s++) {
+                        addBlock(bx + (s & 1) * 4, by + (s >> 1) * 4);
+                    }
+                }
+            }
+        }
+        for (int i = 0; i < 2; i++) {
+            status[i].push_back(nullptr);
+        }
+    }
+
+    void addBlock(int x, int y) {
+        status[0].push_back(linbuf.data() + y * spl + x * 4);
+        status[1].push_back(linbuf.data() + y * spl + x * 4 + screenDelta);
+        blockX.push_back(x);
+        blockY.push_back(y);
+    }
+
+    // RoQInterrupt for ROQ_QUAD_VQ
+    template <typename Decode>
+    void frame(const uint8_t* data, unsigned flags, Decode decode) {
+        const int half = numQuads & 1;
+        const int normalBuffer0 = half ? -screenDelta : screenDelta;
+        const int xoff = (signed char)(flags >> 8);
+        const int yoff = (signed char)(flags & 0xff);
+        for (int y = 0; y < 16; y++) {
+            for (int x = 0; x < 16; x++) {
+                mcomp[x * 16 + y] = normalBuffer0 - ((y + yoff - 8) * spl + (x + xoff - 8) * 4);
+            }
+        }
+        decode(status[half].data(), data, spl, mcomp);
+        if (numQuads == 0) {
+            std::memcpy(linbuf.data() + screenDelta, linbuf.data(), screenDelta);
+        }
+        numQuads++;
+    }
+
+    const uint8_t* current() const {
+        return linbuf.data() + ((numQuads - 1) & 1) * screenDelta;
+    }
+};
+
+void putChunk(std::vector<uint8_t>& out, int id, const std::vector<uint8_t>& data, unsigned flags) {
+    const uint8_t header[8] = {
+        (uint8_t)id, (uint8_t)(id >> 8),
+        (uint8_t)data.size(), (uint8_t)(data.size() >> 8), (uint8_t)(data.size() >> 16), 0,
+        (uint8_t)flags, (uint8_t)(flags >> 8),
+    };
+    out.insert(out.end(), header, header + 8);
+    out.insert(out.end(), data.begin(), data.end());
+}
+
+// writes the two bit codes into little endian words ahead of their arguments, as decodeVQ reads them
+struct CodeWriter
+{
+    std::vector<uint8_t>& out;
+    size_t word = 0;
+    int used = 8;
+
+    void code(unsigned code) {
+        if (used == 8) {
+            word = out.size();
+            out.push_back(0);
+            out.push_back(0);
+            used = 0;
+        }
+        const unsigned bits = (out[word] | (out[word + 1] << 8)) | (code << (14 - 2 * used));
+        out[word] = (uint8_t)bits;
+        out[word + 1] = (uint8_t)(bits >> 8);
+        used++;
+    }
+
+    void arg() {
+        out.push_back((uint8_t)rand());
+    }
+};
+
+// a random VQ frame using every kind of code, motion compensation only away from the edges
+std::vector<uint8_t> randomFrame(const Player& layout) {
+    std::vector<uint8_t> data;
+    CodeWriter w{ data };
+    auto inside = [&](size_t block) {
+        return layout.blockX[block] >= 16 && layout.blockY[block] >= 16 &&
+               layout.blockX[block] + 24 <= layout.width && layout.blockY[block] + 24 <= layout.height;
+    };
+    for (size_t block = 0; block + 1 < layout.status[0].size(); block += 5) {
+        switch (rand() % 4) {
+        case 0:
+            w.code(0);
+            break;
+        case 1:
+            w.code(2);
+            w.arg();
+            break;
+        case 2:
+            if (inside(block)) {
+                w.code(1);
+                w.arg();
+            } else {
+                w.code(0);
+            }
+            break;
+        default:
+            w.code(3);
+            for (int i = 1; i <= 4; i++) {
+                switch (rand() % 4) {
+                case 0:
+                    w.code(2);
+                    w.arg();
+                    break;
+                case 1:
+                    w.code(3);
+                    for (int j = 0; j < 4; j++) {
+                        w.arg();
+                    }
+                    break;
+                case 2:
+                    if (inside(block + i)) {
+                        w.code(1);
+                        w.arg();
+                        break;
+                    }
+                    // fall through
+                default:
+                    w.code(0);
+                    break;
+                }
+            }
+            break;
+        }
+    }
+    return data;
+}
+
+std::vector<uint8_t> randomCodeBook(unsigned& flags) {
+    std::vector<uint8_t> data;
+    int two = 256;
+    int four = 256;
+    flags = 0;
+    if (rand() % 2) {
+        two = 1 + rand() % 256;
+        four = rand() % 256;
+        flags = ((two & 0xff) << 8) | four;
+    }
+    for (int i = 0; i < two * 6; i++) {
+        data.push_back((uint8_t)rand());
+    }
+    for (int i = 0; i < four * 4; i++) {
+        data.push_back((uint8_t)(rand() % two));
+    }
+    return data;
+}
+
+// a RoQ file of a video with a codebook every frame, the way the cinematics are made
+std::vector<uint8_t> randomRoQ(int width, int height, int frames) {
+    std::vector<uint8_t> roq = { 0x84, 0x10, 0xff, 0xff, 0xff, 0xff, 30, 0 };
+    putChunk(roq, ROQ_QUAD_INFO, { (uint8_t)width, (uint8_t)(width >> 8), (uint8_t)height, (uint8_t)(height >> 8), 8, 0, 4, 0 }, 0);
+
+    Player layout;
+    layout.quadInfo(width, height);
+    for (int f = 0; f < frames; f++) {
+        unsigned flags;
+        std::vector<uint8_t> codeBook = randomCodeBook(flags);
+        putChunk(roq, ROQ_CODEBOOK, codeBook, flags);
+        const unsigned motion = f ? (unsigned)(rand() % 5 - 2) & 0xff : 0;
+        putChunk(roq, ROQ_QUAD_VQ, randomFrame(layout), (motion << 8) | motion);
+    }
+    return roq;
+}
+
+// decodes the video of a RoQ file, calling shown after every frame, returns the number of frames
+template <typename Decode, typename Shown>
+int decodeRoQ(const std::vector<uint8_t>& roq, RoqDecoder& decoder, Player& player, bool simd, Decode decode, Shown shown) {
+    int frames = 0;
+    size_t pos = 8;
+    while (pos + 8 <= roq.size()) {
+        const uint8_t* chunk = &roq[pos];
+        const int id = chunk[0] | (chunk[1] << 8);
+        size_t size = chunk[2] | (chunk[3] << 8) | (chunk[4] << 16);
+        const unsigned flags = chunk[6] | (chunk[7] << 8);
+        if (id == ROQ_PACKET) {
+            size = 0;
+        }
+        if (pos + 8 + size > roq.size()) {
+            break;
+        }
+        const uint8_t* data = chunk + 8;
+        switch (id) {
+        case ROQ_QUAD_INFO:
+            player.quadInfo(data[0] | (data[1] << 8), data[2] | (data[3] << 8));
+            break;
+        case ROQ_CODEBOOK:
+            if (simd) {
+                decoder.decodeCodeBook(data, flags);
+            } else {
+                decoder.decodeCodeBookScalar(data, flags);
+            }
+            break;
+        case ROQ_QUAD_VQ:
+            player.frame(data, flags, decode);
+            shown(player);
+            frames++;
+            break;
+        }
+        pos += 8 + size;
+    }
+    return frames;
+}
+
+std::vector<uint8_t> readFile(const char* name) {
+    std::vector<uint8_t> bytes;
+    FILE* f = std::fopen(name, "rb");
+    if (f) {
+        uint8_t buffer[65536];
+        size_t n;
+        while ((n = std::fread(buffer, 1, sizeof(buffer), f)) > 0) {
+            bytes.insert(bytes.end(), buffer, buffer + n);
+        }
+        std::fclose(f);
+    }
+    return bytes;
+}
+
+}
+
+TEST_CASE( "roq decoder builds the codebook of the original decoder", "[roq_decoder]" ) {
+    srand(1234);
+    std::unique_ptr<ReferenceCodeBook> reference(new ReferenceCodeBook());
+    std::unique_ptr<RoqDecoder> simd(new RoqDecoder());
+    std::unique_ptr<RoqDecoder> scalar(new RoqDecoder());
+    simd->init();
+    scalar->init();
+
+    for (int book = 0; book < 50; book++) {
+        unsigned flags;
+        std::vector<uint8_t> data = randomCodeBook(flags);
+        if (book == 0) {
+            // the extremes of y, u and v, where the clamping is
+            for (int i = 0; i < 256 * 6; i++) {
+                data[i] = (i / 6) % 2 ? 255 : 0;
+                if (i % 6 >= 4 && (i / 12) % 2) {
+                    data[i] = 255 - data[i];
+                }
+            }
+        }
+        reference->decode(data.data(), (unsigned short)flags);
+        simd->decodeCodeBook(data.data(), flags);
+        scalar->decodeCodeBookScalar(data.data(), flags);
+
+        // partial codebooks keep the rest of the cells, so everything is compared
+        REQUIRE( std::memcmp(simd->codeBook2(), reference->vq2, sizeof(reference->vq2)) == 0 );
+        REQUIRE( std::memcmp(simd->codeBook4(), reference->vq4, sizeof(reference->vq4)) == 0 );
+        REQUIRE( std::memcmp(simd->codeBook8(), reference->vq8, sizeof(reference->vq8)) == 0 );
+        REQUIRE( std::memcmp(scalar->codeBook2(), reference->vq2, sizeof(reference->vq2)) == 0 );
+        REQUIRE( std::memcmp(scalar->codeBook4(), reference->vq4, sizeof(reference->vq4)) == 0 );
+        REQUIRE( std::memcmp(scalar->codeBook8(), reference->vq8, sizeof(reference->vq8)) == 0 );
+    }
+}
+
+TEST_CASE( "roq decoder draws the frames of the original decoder", "[roq_decoder]" ) {
+    srand(1234);
+    const std::vector<uint8_t> roq = randomRoQ(256, 128, 40);
+
+    // each run with its own decoder, the codebooks change as the video goes
+    auto run = [&](bool original) {
+        std::unique_ptr<RoqDecoder> decoder(new RoqDecoder());
+        decoder->init();
+        Player player;
+        std::vector<std::vector<uint8_t>> frames;
+        const int numFrames = decodeRoQ(roq, *decoder, player, !original,
+            [&](uint8_t** status, const uint8_t* data, int spl, const int* mcomp) {
+                if (original) {
+                    referenceVQ(status, data, spl, mcomp, *decoder);
+                } else {
+                    decoder->decodeVQ(status, data, spl, mcomp);
+                }
+            },
+            [&](const Player& p) {
+                frames.push_back(std::vector<uint8_t>(p.current(), p.current() + p.screenDelta));
+            });
+        REQUIRE( numFrames == 40 );
+        return frames;
+    };
+
+    const std::vector<std::vector<uint8_t>> frames = run(false);
+    const std::vector<std::vector<uint8_t>> original = run(true);
+    for (size_t f = 0; f < frames.size(); f++) {
+        REQUIRE( frames[f] == original[f] );
+    }
+    // and the frames aren't all the same, so the comparison means something
+    REQUIRE( frames[10] != frames[11] );
+}
+
+TEST_CASE( "roq decoder benchmark", "[roq_decoder][!benchmark]" ) {
+    srand(5678);
+    // ROQ_FILE names a cinematic to decode, the video of it; otherwise a made up one of the largest size
+    const char* name = std::getenv("ROQ_FILE");
+    std::vector<uint8_t> roq = name ? readFile(name) : std::vector<uint8_t>();
+    if (roq.empty()) {
+        roq = randomRoQ(512, 512, 60);
+    }
+
+    std::unique_ptr<RoqDecoder> decoder(new RoqDecoder());
+    decoder->init();
+    Player player;
+
+    auto decodeAll = [&](bool simd) {
+        return decodeRoQ(roq, *decoder, player, simd,
+            [&](uint8_t** status, const uint8_t* data, int spl, const int* mcomp) {
+                if (simd) {
+                    decoder->decodeVQ(status, data, spl, mcomp);
+                } else {
+                    referenceVQ(status, data, spl, mcomp, *decoder);
+                }
+            },
+            [](const Player&) {});
+    };
+
+    for (bool simd : { false, true }) {
+        const auto start = std::chrono::steady_clock::now();
+        int frames = 0;
+        for (int i = 0; i < 5; i++) {
+            frames += decodeAll(simd);
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        WARN( (simd ? "SSE decoder: " : "original decoder: ") << player.width << "x" << player.height << ", "
+              << (int)(frames / seconds) << " frames per second" );
+    }
+
+    BENCHMARK("original decoder") {
+        return decodeAll(false);
+    };
+
+    BENCHMARK("SSE decoder") {
+        return decodeAll(true);
+    };
+
+    std::vector<uint8_t> codeBook(256 * 6 + 256 * 4);
+    for (uint8_t& c : codeBook) {
+        c = (uint8_t)rand();
+    }
+
+    BENCHMARK("codebook scalar") {
+        decoder->decodeCodeBookScalar(codeBook.data(), 0);
+        return decoder->codeBook8()[64];
+    };
+
+    BENCHMARK("codebook SSE") {
+        decoder->decodeCodeBook(codeBook.data(), 0);
+        return decoder->codeBook8()[64];
+    };
+}
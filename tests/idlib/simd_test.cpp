@@ -0,0 +1,150 @@
+#include "idlib/math/Simd.h"
+#include "idlib/math/Simd_Generic.h"
+#include "idlib/math/Simd_SSE.h"
+#include "idlib/math/Vector.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+float randomFloat() {
+    return -1000.0f + 2000.0f * (rand() / (float)RAND_MAX);
+}
+
+std::vector<float> randomFloats(int count) {
+    std::vector<float> floats(count);
+    for (float& f : floats) {
+        f = randomFloat();
+    }
+    return floats;
+}
+
+}
+
+TEST_CASE( "simd detects the processor", "[simd]" ) {
+    const cpuid_t cpuid = idSIMD::GetProcessorId();
+    REQUIRE( cpuid != CPUID_NONE );
+
+    char string[256];
+    idSIMD::GetProcessorString(cpuid, string, sizeof(string));
+    REQUIRE( string[0] != 0 );
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+    // every x86-64 processor has these
+    REQUIRE( (cpuid & CPUID_SSE) );
+    REQUIRE( (cpuid & CPUID_SSE2) );
+    REQUIRE( (cpuid & CPUID_FTZ) );
+    REQUIRE( std::strstr(string, "SSE2") != nullptr );
+#endif
+    if (cpuid & CPUID_AVX2) {
+        REQUIRE( (cpuid & CPUID_AVX) );
+    }
+
+    idSIMD::Init();
+    idSIMD::InitProcessor("test", false);
+#ifdef ID_SIMD_SSE
+    REQUIRE( std::strcmp(SIMDProcessor->GetName(), "generic code") != 0 );
+#endif
+    idSIMD::InitProcessor("test", true);
+    REQUIRE( std::strcmp(SIMDProcessor->GetName(), "generic code") == 0 );
+    idSIMD::Shutdown();
+}
+
+#ifdef ID_SIMD_SSE
+
+TEST_CASE( "simd SSE kernels agree with the generic ones", "[simd]" ) {
+    srand(1234);
+    idSIMD_Generic generic;
+    idSIMD_SSE sse;
+
+    // every length around the unrolled blocks, from every start so the loads are unaligned too
+    std::vector<float> floats = randomFloats(3 * 80 + 3);
+    for (int count = 0; count < 80; count++) {
+        for (int start = 0; start < 3; start++) {
+            const float* src = floats.data() + start;
+            float min0, max0, min1, max1;
+            generic.MinMax(min0, max0, src, count);
+            sse.MinMax(min1, max1, src, count);
+            REQUIRE( min0 == min1 );
+            REQUIRE( max0 == max1 );
+
+            idVec2 min2[2], max2[2];
+            generic.MinMax(min2[0], max2[0], (const idVec2*)src, count);
+            sse.MinMax(min2[1], max2[1], (const idVec2*)src, count);
+            REQUIRE( min2[0] == min2[1] );
+            REQUIRE( max2[0] == max2[1] );
+
+            idVec3 min3[2], max3[2];
+            generic.MinMax(min3[0], max3[0], (const idVec3*)src, count);
+            sse.MinMax(min3[1], max3[1], (const idVec3*)src, count);
+            REQUIRE( min3[0] == min3[1] );
+            REQUIRE( max3[0] == max3[1] );
+        }
+    }
+
+    // the extremes in the last lanes and in the tail
+    std::vector<float> edges(13, 1.0f);
+    edges[11] = -5.0f;
+    edges[12] = 7.0f;
+    float min, max;
+    sse.MinMax(min, max, edges.data(), (int)edges.size());
+    REQUIRE( min == -5.0f );
+    REQUIRE( max == 7.0f );
+
+    std::vector<unsigned char> src(1000), dst0(1000), dst1(1000);
+    for (unsigned char& c : src) {
+        c = (unsigned char)rand();
+    }
+    for (int count : { 0, 1, 15, 16, 17, 255, 999 }) {
+        generic.Memcpy(dst0.data() + 1, src.data(), count);
+        sse.Memcpy(dst1.data() + 1, src.data(), count);
+        REQUIRE( dst0 == dst1 );
+        generic.Memset(dst0.data() + 1, count, count);
+        sse.Memset(dst1.data() + 1, count, count);
+        REQUIRE( dst0 == dst1 );
+    }
+}
+
+TEST_CASE( "simd benchmark", "[simd][!benchmark]" ) {
+    srand(5678);
+    idSIMD_Generic generic;
+    idSIMD_SSE sse;
+    const int count = 3 * 16384;
+    std::vector<float> floats = randomFloats(count);
+    std::vector<float> copy(count);
+
+    idSIMDProcessor* processors[] = { &generic, &sse };
+    for (idSIMDProcessor* p : processors) {
+        const std::string name = p->GetName();
+
+        BENCHMARK("MinMax float " + name) {
+            float min, max;
+            p->MinMax(min, max, floats.data(), count);
+            return min + max;
+        };
+
+        BENCHMARK("MinMax idVec2 " + name) {
+            idVec2 min, max;
+            p->MinMax(min, max, (const idVec2*)floats.data(), count / 2);
+            return min.x + max.y;
+        };
+
+        BENCHMARK("MinMax idVec3 " + name) {
+            idVec3 min, max;
+            p->MinMax(min, max, (const idVec3*)floats.data(), count / 3);
+            return min.x + max.z;
+        };
+
+        BENCHMARK("Memcpy " + name) {
+            p->Memcpy(copy.data(), floats.data(), count * sizeof(float));
+            return copy[count / 2];
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,336 @@
+#include "qcommon/box_filter.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+const float SURFACE_CLIP_EPSILON = 0.125f;
+
+float randomFloat(float lo, float hi) {
+    return lo + (hi - lo) * (rand() / (float)RAND_MAX);
+}
+
+struct Plane
+{
+    float normal[3];
+    float dist;
+};
+
+// the axial sides first, with the bounds, like the brushes of a bsp
+struct Brush
+{
+    float mins[3];
+    float maxs[3];
+    std::vector<Plane> sides;
+};
+
+Brush randomBrush(float extent, float maxSize) {
+    Brush b;
+    for (int i = 0; i < 3; i++) {
+        b.mins[i] = randomFloat(-extent, extent);
+        b.maxs[i] = b.mins[i] + randomFloat(1.0f, maxSize);
+    }
+    for (int i = 0; i < 3; i++) {
+        Plane lo = { { 0, 0, 0 }, -b.mins[i] };
+        lo.normal[i] = -1;
+        Plane hi = { { 0, 0, 0 }, b.maxs[i] };
+        hi.normal[i] = 1;
+        b.sides.push_back(lo);
+        b.sides.push_back(hi);
+    }
+    // and sometimes a slanted side cutting off a corner, through the middle of the brush
+    if (rand() % 2) {
+        Plane cut;
+        float length = 0;
+        for (int i = 0; i < 3; i++) {
+            cut.normal[i] = randomFloat(-1, 1);
+            length += cut.normal[i] * cut.normal[i];
+        }
+        length = std::sqrt(length);
+        cut.dist = 0;
+        for (int i = 0; i < 3; i++) {
+            cut.normal[i] /= length;
+            cut.dist += cut.normal[i] * (b.mins[i] + b.maxs[i]) * 0.5f;
+        }
+        b.sides.push_back(cut);
+    }
+    return b;
+}
+
+struct Trace
+{
+    float start[3];
+    float end[3];
+    float extents[3];
+};
+
+struct Result
+{
+    float fraction = 1;
+    int brush = -1;
+    int side = -1;
+    bool startsolid = false;
+    bool allsolid = false;
+
+    bool operator==(const Result& o) const {
+        // compared bit for bit, not within an epsilon
+        return std::memcmp(&fraction, &o.fraction, sizeof(fraction)) == 0 && brush == o.brush && side == o.side &&
+               startsolid == o.startsolid && allsolid == o.allsolid;
+    }
+};
+
+// CM_TraceThroughBrush for a box trace
+void traceThroughBrush(const Trace& tw, const Brush& brush, int brushNum, Result& result) {
+    float enterFrac = -1.0f;
+    float leaveFrac = 1.0f;
+    int clipSide = -1;
+    bool getout = false;
+    bool startout = false;
+
+    for (int i = 0; i < (int)brush.sides.size(); i++) {
+        const Plane& plane = brush.sides[i];
+        float dist = plane.dist;
+        for (int j = 0; j < 3; j++) {
+            dist += std::fabs(plane.normal[j]) * tw.extents[j];
+        }
+        const float d1 = tw.start[0] * plane.normal[0] + tw.start[1] * plane.normal[1] + tw.start[2] * plane.normal[2] - dist;
+        const float d2 = tw.end[0] * plane.normal[0] + tw.end[1] * plane.normal[1] + tw.end[2] * plane.normal[2] - dist;
+
+        if (d2 > 0) {
+            getout = true;
+        }
+        if (d1 > 0) {
+            startout = true;
+        }
+        if (d1 > 0 && (d2 >= SURFACE_CLIP_EPSILON || d2 >= d1)) {
+            return;
+        }
+        if (d1 <= 0 && d2 <= 0) {
+            continue;
+        }
+        if (d1 > d2) {
+            float f = (d1 - SURFACE_CLIP_EPSILON) / (d1 - d2);
+            if (f < 0) {
+                f = 0;
+            }
+            if (f > enterFrac) {
+                enterFrac = f;
+                clipSide = i;
+            }
+        } else {
+            float f = (d1 + SURFACE_CLIP_EPSILON) / (d1 - d2);
+            if (f > 1) {
+                f = 1;
+            }
+            if (f < leaveFrac) {
+                leaveFrac = f;
+            }
+        }
+    }
+
+    if (!startout) {
+        result.startsolid = true;
+        if (!getout) {
+            result.allsolid = true;
+            result.fraction = 0;
+            result.brush = brushNum;
+        }
+        return;
+    }
+    if (enterFrac < leaveFrac && enterFrac > -1 && enterFrac < result.fraction) {
+        result.fraction = enterFrac < 0 ? 0 : enterFrac;
+        result.brush = brushNum;
+        result.side = clipSide;
+    }
+}
+
+// CM_TraceThroughLeaf before the filter
+Result traceAll(const Trace& tw, const std::vector<Brush>& brushes) {
+    Result result;
+    for (int k = 0; k < (int)brushes.size(); k++) {
+        traceThroughBrush(tw, brushes[k], k, result);
+        if (!result.fraction) {
+            break;
+        }
+    }
+    return result;
+}
+
+// and with it, the trace grown the way CM_Trace grows it
+Result traceFiltered(const Trace& tw, const std::vector<Brush>& brushes, const BoxFilter& filter, int first) {
+    float extents[3];
+    for (int i = 0; i < 3; i++) {
+        extents[i] = tw.extents[i] + SURFACE_CLIP_EPSILON + 1.0f;
+    }
+    const BoxFilter::Sweep sweep = BoxFilter::sweep(tw.start, tw.end, extents);
+
+    Result result;
+    filter.forEach(sweep, first, (int)brushes.size(), [&](int k) {
+        traceThroughBrush(tw, brushes[k], k, result);
+        return result.fraction != 0;
+    });
+    return result;
+}
+
+Trace randomTrace(float extent) {
+    Trace tw;
+    const float size = rand() % 3 == 0 ? 0.0f : randomFloat(4.0f, 32.0f);
+    const float length = rand() % 2 ? randomFloat(0.0f, 64.0f) : randomFloat(64.0f, 4096.0f);
+    float dir[3];
+    for (int i = 0; i < 3; i++) {
+        tw.start[i] = randomFloat(-extent, extent);
+        tw.extents[i] = size;
+        dir[i] = randomFloat(-1, 1);
+    }
+    // some traces are straight down or level, like gravity and hitscan weapons
+    switch (rand() % 4) {
+    case 0:
+        dir[0] = dir[1] = 0;
+        dir[2] = -1;
+        break;
+    case 1:
+        dir[2] = 0;
+        break;
+    }
+    const float norm = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+    for (int i = 0; i < 3; i++) {
+        tw.end[i] = tw.start[i] + dir[i] / norm * length;
+    }
+    return tw;
+}
+
+// a leaf of a large map, brushes up to 256 units in a 4096 unit cube
+std::vector<Brush> randomLeaf(int numBrushes, BoxFilter& filter, int& first) {
+    std::vector<Brush> brushes;
+    first = filter.beginList();
+    for (int k = 0; k < numBrushes; k++) {
+        brushes.push_back(randomBrush(2048.0f, 256.0f));
+        filter.add(brushes.back().mins, brushes.back().maxs);
+    }
+    return brushes;
+}
+
+}
+
+TEST_CASE( "box filter keeps lists apart and skips empty boxes", "[box_filter]" ) {
+    BoxFilter filter;
+    filter.clear();
+
+    const float mins[3] = { -8, -8, -8 };
+    const float maxs[3] = { 8, 8, 8 };
+    const int first = filter.beginList();
+    filter.add(mins, maxs);
+    filter.addEmpty();
+    filter.add(mins, maxs);
+
+    // the second list starts on the next group of four
+    const int second = filter.beginList();
+    REQUIRE( first == 0 );
+    REQUIRE( second == 4 );
+    filter.add(mins, maxs);
+    REQUIRE( filter.size() == 5 );
+
+    const float start[3] = { -100, 0, 0 };
+    const float end[3] = { 100, 0, 0 };
+    const float extents[3] = { 0, 0, 0 };
+    const BoxFilter::Sweep sweep = BoxFilter::sweep(start, end, extents);
+
+    std::vector<int> visited;
+    filter.forEach(sweep, first, 3, [&](int k) {
+        visited.push_back(k);
+        return true;
+    });
+    REQUIRE( visited == std::vector<int>({ 0, 2 }) );
+
+    // stopping early
+    visited.clear();
+    filter.forEach(sweep, first, 3, [&](int k) {
+        visited.push_back(k);
+        return false;
+    });
+    REQUIRE( visited == std::vector<int>({ 0 }) );
+
+    visited.clear();
+    filter.forEach(sweep, second, 1, [&](int k) {
+        visited.push_back(k);
+        return true;
+    });
+    REQUIRE( visited == std::vector<int>({ 0 }) );
+}
+
+TEST_CASE( "box filter slab test skips boxes a diagonal trace passes by", "[box_filter]" ) {
+    BoxFilter filter;
+    filter.clear();
+    const int first = filter.beginList();
+
+    // on the diagonal, and off it in the corners of the trace's bounds
+    const float onMins[3] = { 40, 40, -8 }, onMaxs[3] = { 60, 60, 8 };
+    const float offMins[3] = { 80, 0, -8 }, offMaxs[3] = { 100, 20, 8 };
+    filter.add(onMins, onMaxs);
+    filter.add(offMins, offMaxs);
+
+    const float start[3] = { 0, 0, 0 };
+    const float end[3] = { 100, 100, 0 };
+    const float extents[3] = { 2, 2, 2 };
+    const BoxFilter::Sweep sweep = BoxFilter::sweep(start, end, extents);
+    REQUIRE( filter.touches(sweep, first) );
+    REQUIRE( !filter.touches(sweep, first + 1) );
+
+    // a point trace that doesn't move is left to the bounds
+    const BoxFilter::Sweep still = BoxFilter::sweep(onMins, onMins, extents);
+    REQUIRE( filter.touches(still, first) );
+    REQUIRE( !filter.touches(still, first + 1) );
+}
+
+TEST_CASE( "box filter leaves brush traces bit for bit the same", "[box_filter]" ) {
+    srand(1234);
+    BoxFilter filter;
+    filter.clear();
+
+    int hits = 0;
+    for (int leaf = 0; leaf < 20; leaf++) {
+        int first;
+        std::vector<Brush> brushes = randomLeaf(1 + rand() % 300, filter, first);
+        for (int i = 0; i < 2000; i++) {
+            const Trace tw = randomTrace(2048.0f);
+            const Result all = traceAll(tw, brushes);
+            REQUIRE( traceFiltered(tw, brushes, filter, first) == all );
+            hits += all.brush >= 0;
+        }
+    }
+    // enough of the traces hit something for the comparison to mean anything
+    REQUIRE( hits > 1000 );
+}
+
+TEST_CASE( "box filter benchmark", "[box_filter][!benchmark]" ) {
+    srand(5678);
+    BoxFilter filter;
+    filter.clear();
+    int first;
+    std::vector<Brush> brushes = randomLeaf(256, filter, first);
+    std::vector<Trace> traces;
+    for (int i = 0; i < 1000; i++) {
+        traces.push_back(randomTrace(2048.0f));
+    }
+
+    BENCHMARK("every brush") {
+        float fraction = 0;
+        for (const Trace& tw : traces) {
+            fraction += traceAll(tw, brushes).fraction;
+        }
+        return fraction;
+    };
+
+    BENCHMARK("packed bounds first") {
+        float fraction = 0;
+        for (const Trace& tw : traces) {
+            fraction += traceFiltered(tw, brushes, filter, first).fraction;
+        }
+        return fraction;
+    };
+}
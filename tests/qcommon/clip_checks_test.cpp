@@ -0,0 +1,41 @@
+#include "qcommon/clip_checks.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE( "clip checks mark each brush and patch once per trace", "[clip_checks]" ) {
+    ClipChecks checks;
+    checks.reset(4, 2);
+
+    checks.begin();
+    CHECK(checks.markBrush(1));
+    CHECK_FALSE(checks.markBrush(1));
+    CHECK(checks.markBrush(2));
+    CHECK(checks.markPatch(1));
+    CHECK_FALSE(checks.markPatch(1));
+
+    // brushes and patches are marked separately
+    CHECK(checks.markPatch(0));
+    CHECK(checks.markBrush(0));
+
+    // the next trace starts with nothing marked
+    checks.begin();
+    CHECK(checks.markBrush(1));
+    CHECK(checks.markBrush(2));
+    CHECK(checks.markPatch(1));
+    CHECK_FALSE(checks.markPatch(1));
+}
+
+TEST_CASE( "clip checks forget everything on reset", "[clip_checks]" ) {
+    ClipChecks checks;
+    checks.reset(2, 1);
+    checks.begin();
+    CHECK(checks.markBrush(0));
+    CHECK(checks.markPatch(0));
+
+    // a new map can be bigger, and none of it is marked
+    checks.reset(3, 1);
+    checks.begin();
+    CHECK(checks.markBrush(0));
+    CHECK(checks.markBrush(2));
+    CHECK(checks.markPatch(0));
+}
@@ -0,0 +1,60 @@
+#include "qcommon/command_args.h"
+
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+typedef CommandArgs<16, 64> Args;
+
+std::vector<std::string> tokenize(const char* text) {
+    static Args args;
+    args.tokenize(text);
+    std::vector<std::string> tokens;
+    for (int i = 0; i < args.argc(); i++) {
+        tokens.push_back(args.argv(i));
+    }
+    return tokens;
+}
+
+}
+
+TEST_CASE( "command args split on whitespace, quotes and comments", "[command_args]" ) {
+    REQUIRE(tokenize(nullptr).empty());
+    REQUIRE(tokenize("   \t ").empty());
+    REQUIRE(tokenize("bind  x \"+attack; +jump\"") == std::vector<std::string>({ "bind", "x", "+attack; +jump" }));
+    REQUIRE(tokenize("say\"hi there\"you") == std::vector<std::string>({ "say", "hi there", "you" }));
+    REQUIRE(tokenize("set a \"\"") == std::vector<std::string>({ "set", "a", "" }));
+    REQUIRE(tokenize("echo \"open") == std::vector<std::string>({ "echo", "open" }));
+    REQUIRE(tokenize("echo a// the rest") == std::vector<std::string>({ "echo", "a" }));
+    REQUIRE(tokenize("echo /* not this */ b/*or this*/c") == std::vector<std::string>({ "echo", "b", "c" }));
+    REQUIRE(tokenize("echo /* open") == std::vector<std::string>({ "echo" }));
+    REQUIRE(tokenize("connect 10.0.0.1:27960/x") == std::vector<std::string>({ "connect", "10.0.0.1:27960/x" }));
+}
+
+TEST_CASE( "command args stop at their limits and are independent of each other", "[command_args]" ) {
+    // no more than 16 arguments
+    std::string many;
+    for (int i = 0; i < 20; i++) {
+        many += std::to_string(i) + " ";
+    }
+    std::vector<std::string> tokens = tokenize(many.c_str());
+    REQUIRE(tokens.size() == 16);
+    REQUIRE(tokens.back() == "15");
+
+    // nor more than 64 characters, counting the 0s
+    tokens = tokenize(("a " + std::string(100, 'b') + " c").c_str());
+    REQUIRE(tokens.size() == 2);
+    REQUIRE(tokens[1] == std::string(61, 'b'));
+
+    Args outer;
+    Args inner;
+    outer.tokenize("map castle");
+    inner.tokenize("updatescreen");
+    REQUIRE(outer.argc() == 2);
+    REQUIRE(std::string(outer.argv(1)) == "castle");
+    REQUIRE(std::string(outer.argv(2)) == "");
+    REQUIRE(std::string(outer.argv(-1)) == "");
+    REQUIRE(inner.argc() == 1);
+}
@@ -0,0 +1,247 @@
+#include "qcommon/command_buffer.h"
+#include "qcommon/command_args.h"
+
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <strings.h>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+const int MAX_CMD_BUFFER = 16384;
+const int MAX_CMD_LINE = 1024;
+
+void add(CommandBuffer<MAX_CMD_BUFFER>& buffer, const std::string& text) {
+    buffer.append(text.data(), (int)text.size());
+}
+
+std::vector<std::string> takeAll(CommandBuffer<MAX_CMD_BUFFER>& buffer, int lineSize = MAX_CMD_LINE) {
+    std::vector<std::string> lines;
+    std::vector<char> line(lineSize);
+    while (buffer.size()) {
+        const int length = buffer.takeCommand(line.data(), lineSize);
+        REQUIRE((int)strlen(line.data()) == length);
+        lines.push_back(line.data());
+    }
+    return lines;
+}
+
+// the commands of a config, keyed the way the console matches them
+struct Command {
+    Command* next;
+    Command* hashNext;
+    const char* name;
+    int calls;
+};
+
+int hashName(const char* name, int size) {
+    int hash = 0;
+    for (int i = 0; name[i]; i++) {
+        hash += tolower((unsigned char)name[i]) * (i + 119);
+    }
+    return hash & (size - 1);
+}
+
+}
+
+TEST_CASE( "command buffer splits commands on ; outside quotes and on line ends", "[command_buffer]" ) {
+    CommandBuffer<MAX_CMD_BUFFER> buffer;
+    REQUIRE(buffer.size() == 0);
+
+    add(buffer, "bind x \"+attack;+jump\"; echo a\necho b\r\n\nwait");
+    REQUIRE(takeAll(buffer) == std::vector<std::string>({ "bind x \"+attack;+jump\"", " echo a", "echo b", "", "", "wait" }));
+    REQUIRE(buffer.size() == 0);
+
+    // inserted in front of what is left, the way exec does
+    add(buffer, "one\ntwo\n");
+    std::vector<char> line(MAX_CMD_LINE);
+    buffer.takeCommand(line.data(), MAX_CMD_LINE);
+    REQUIRE(std::string(line.data()) == "one");
+    buffer.prepend("\n", 1);
+    buffer.prepend("exec'd", 6);
+    REQUIRE(takeAll(buffer) == std::vector<std::string>({ "exec'd", "two" }));
+}
+
+TEST_CASE( "command buffer cuts long commands and wraps around its end", "[command_buffer]" ) {
+    CommandBuffer<MAX_CMD_BUFFER> buffer;
+
+    // cut at the line size less one, dropping the character it was cut at
+    add(buffer, std::string(20, 'a') + "b" + std::string(5, 'c') + ";d");
+    REQUIRE(takeAll(buffer, 21) == std::vector<std::string>({ std::string(20, 'a'), "ccccc", "d" }));
+    add(buffer, std::string(20, 'a'));
+    REQUIRE(takeAll(buffer, 21) == std::vector<std::string>({ std::string(20, 'a') }));
+
+    // commands that keep meeting the end of the ring, added at either side
+    std::vector<char> line(MAX_CMD_LINE);
+    std::vector<std::string> appended;
+    for (int round = 0; round < 3000; round++) {
+        const std::string command = "set v" + std::to_string(round) + " " + std::string(round % 37, 'x');
+        const std::string text = command + "\n";
+        if (round % 5 == 0) {
+            buffer.prepend(text.data(), (int)text.size());
+            buffer.takeCommand(line.data(), MAX_CMD_LINE);
+            REQUIRE(std::string(line.data()) == command);
+        } else {
+            add(buffer, text);
+            appended.push_back(command);
+        }
+        if (round % 3 == 2) {
+            REQUIRE(takeAll(buffer) == appended);
+            appended.clear();
+        }
+    }
+}
+
+TEST_CASE( "command buffer benchmark", "[command_buffer][!benchmark]" ) {
+    // the commands and cvars of a running game, and a config that sets them the ways
+    // configs do: seta, binds and bare cvar names
+    std::vector<std::string> commandNames = { "seta", "set", "bind", "exec", "vstr", "echo", "wait" };
+    for (int i = 0; commandNames.size() < 400; i++) {
+        commandNames.push_back("cmd_" + std::to_string(i));
+    }
+    std::vector<std::string> cvarNames;
+    for (int i = 0; i < 800; i++) {
+        cvarNames.push_back("cv_" + std::to_string(i));
+    }
+    std::string config;
+    for (int i = 0; config.size() < MAX_CMD_BUFFER - 100; i++) {
+        const std::string& cvar = cvarNames[i * 7 % cvarNames.size()];
+        switch (i % 3) {
+        case 0: config += "seta " + cvar + " \"" + std::to_string(i) + "\"\n"; break;
+        case 1: config += "bind F" + std::to_string(i % 12) + " \"vstr " + cvar + "\"\n"; break;
+        default: config += cvar + " " + std::to_string(i) + "\n"; break;
+        }
+    }
+    // a script firing short commands a few at a time
+    std::string burst;
+    for (int i = 0; i < 50; i++) {
+        burst += "cmd_" + std::to_string(i * 13 % 300) + " 1; " + cvarNames[i] + " 0; echo x\n";
+    }
+
+    std::vector<Command> commands(commandNames.size());
+    Command* list = nullptr;
+    for (size_t i = 0; i < commands.size(); i++) {
+        commands[i] = { list, nullptr, commandNames[i].c_str(), 0 };
+        list = &commands[i];
+    }
+    const int HASH_SIZE = 512;
+    std::vector<Command*> hashed(HASH_SIZE, nullptr);
+    for (Command& command : commands) {
+        const int hash = hashName(command.name, HASH_SIZE);
+        command.hashNext = hashed[hash];
+        hashed[hash] = &command;
+    }
+    // cvars were hashed before, and are looked up the same way by both
+    std::vector<Command> cvars(cvarNames.size());
+    std::vector<Command*> cvarHashed(256, nullptr);
+    for (size_t i = 0; i < cvars.size(); i++) {
+        const int hash = hashName(cvarNames[i].c_str(), 256);
+        cvars[i] = { nullptr, cvarHashed[hash], cvarNames[i].c_str(), 0 };
+        cvarHashed[hash] = &cvars[i];
+    }
+    auto cvarCommand = [&cvarHashed](const char* name) {
+        for (Command* cvar = cvarHashed[hashName(name, 256)]; cvar; cvar = cvar->hashNext) {
+            if (!strcasecmp(name, cvar->name)) {
+                cvar->calls++;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    static CommandArgs<1024, 8192 + 1024> args;
+
+    BENCHMARK("config and bursts moving the text down and searching the command list") {
+        static char text[MAX_CMD_BUFFER];
+        int size = 0;
+        int executed = 0;
+        for (const std::string* script : { &config, &burst, &burst, &burst, &burst }) {
+            memcpy(text + size, script->data(), script->size());
+            size += (int)script->size();
+            char line[MAX_CMD_LINE];
+            while (size) {
+                int quotes = 0;
+                int i;
+                for (i = 0; i < size; i++) {
+                    if (text[i] == '"') {
+                        quotes++;
+                    }
+                    if (!(quotes & 1) && text[i] == ';') {
+                        break;
+                    }
+                    if (text[i] == '\n' || text[i] == '\r') {
+                        break;
+                    }
+                }
+                if (i >= MAX_CMD_LINE - 1) {
+                    i = MAX_CMD_LINE - 1;
+                }
+                memcpy(line, text, i);
+                line[i] = 0;
+                if (i == size) {
+                    size = 0;
+                } else {
+                    i++;
+                    size -= i;
+                    memmove(text, text + i, size);
+                }
+
+                args.tokenize(line);
+                if (!args.argc()) {
+                    continue;
+                }
+                Command** prev;
+                Command* command = nullptr;
+                for (prev = &list; *prev; prev = &(*prev)->next) {
+                    if (!strcasecmp(args.argv(0), (*prev)->name)) {
+                        command = *prev;
+                        *prev = command->next;
+                        command->next = list;
+                        list = command;
+                        break;
+                    }
+                }
+                if (command) {
+                    command->calls++;
+                } else {
+                    cvarCommand(args.argv(0));
+                }
+                executed++;
+            }
+        }
+        return executed;
+    };
+
+    BENCHMARK("config and bursts taken off a ring and looked up by hash") {
+        static CommandBuffer<MAX_CMD_BUFFER> buffer;
+        int executed = 0;
+        for (const std::string* script : { &config, &burst, &burst, &burst, &burst }) {
+            buffer.append(script->data(), (int)script->size());
+            char line[MAX_CMD_LINE];
+            while (buffer.size()) {
+                buffer.takeCommand(line, sizeof(line));
+
+                args.tokenize(line);
+                if (!args.argc()) {
+                    continue;
+                }
+                Command* command = hashed[hashName(args.argv(0), HASH_SIZE)];
+                for (; command; command = command->hashNext) {
+                    if (!strcasecmp(args.argv(0), command->name)) {
+                        break;
+                    }
+                }
+                if (command) {
+                    command->calls++;
+                } else {
+                    cvarCommand(args.argv(0));
+                }
+                executed++;
+            }
+        }
+        return executed;
+    };
+}
@@ -0,0 +1,219 @@
+#include "qcommon/condition_table.h"
+
+#include <cstdlib>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+typedef ConditionTable<256, 1024> Table;
+
+const int NUM_CONDITIONS = 8;
+
+// conditions 0-3 are bitflags, 4-7 are values, like weapon, enemy position, mounted and so on
+int typeOf(int condition) {
+    return condition < 4 ? Table::BITFLAGS : Table::VALUE;
+}
+
+Table::Test test(int rule, int condition, int value0, int value1 = 0) {
+    return { rule, condition, typeOf(condition), { value0, value1 } };
+}
+
+// the tests of each rule, for testing rule by rule
+std::vector<std::vector<Table::Test>> byRule(const std::vector<Table::Test>& tests, int numRules) {
+    std::vector<std::vector<Table::Test>> rules(numRules);
+    for (const Table::Test& t : tests) {
+        rules[t.rule].push_back(t);
+    }
+    return rules;
+}
+
+// what BG_FirstValidItem did before the table, one rule after another
+int linearFirst(const std::vector<std::vector<Table::Test>>& rules, const int (*values)[2]) {
+    for (size_t rule = 0; rule < rules.size(); rule++) {
+        bool pass = true;
+        for (const Table::Test& t : rules[rule]) {
+            const int* value = values[t.condition];
+            if (t.type == Table::BITFLAGS) {
+                pass = (value[0] & t.value[0]) || (value[1] & t.value[1]);
+            } else {
+                pass = value[0] == t.value[0];
+            }
+            if (!pass) {
+                break;
+            }
+        }
+        if (pass) {
+            return (int)rule;
+        }
+    }
+    return -1;
+}
+
+// a script shaped like the locomotion ones in wolfanim.script: an item for each
+// group of weapons (the scripts "set weapons" defines), some also testing being
+// underwater or mounted, then a default
+std::vector<Table::Test> randomScript(int numRules) {
+    static const int defines[8][2] = {
+        { 0x0000000e, 0 }, { 0x000000f0, 0 }, { 0x00000f00, 0 }, { 0x0000f000, 0 },
+        { 0x00ff0000, 0 }, { 0x0f000000, 0 }, { 0x70000000, 0x1 }, { 0, 0xfe },
+    };
+    std::vector<Table::Test> tests;
+    for (int rule = 0; rule < numRules - 1; rule++) {
+        const int* weapons = defines[rand() % 8];
+        tests.push_back(test(rule, 0, weapons[0], weapons[1]));
+        if (rand() % 3 == 0) {
+            tests.push_back(test(rule, 4 + rand() % 2, rand() % 3));
+        }
+        if (rand() % 4 == 0) {
+            tests.push_back(test(rule, 1, 1 << (rand() % 5)));
+        }
+    }
+    return tests;
+}
+
+void randomValues(int values[NUM_CONDITIONS][2]) {
+    for (int c = 0; c < NUM_CONDITIONS; c++) {
+        if (typeOf(c) == Table::BITFLAGS) {
+            int bit = rand() % 40;
+            values[c][0] = bit < 32 ? 1 << bit : 0;
+            values[c][1] = bit < 32 ? 0 : 1 << (bit - 32);
+        } else {
+            values[c][0] = rand() % 3;
+            values[c][1] = 0;
+        }
+    }
+}
+
+}
+
+TEST_CASE( "condition table picks the first passing rule", "[condition_table]" ) {
+    Table table;
+    table.clear();
+    Table::RuleSet set;
+
+    std::vector<Table::Test> tests = {
+        test(0, 0, 0x4),                // rule 0: weapon bit 2 and mounted
+        test(0, 4, 1),
+        test(1, 0, 0x6),                // rule 1: weapon bit 1 or 2
+        test(2, 1, 0, 0x1),             // rule 2: enemy position bit 32
+        test(2, 5, 2),
+        test(2, 5, 2),                  // tested twice, both must pass
+        test(3, 6, 0),                  // rule 3: condition 6 is 0
+    };
+    REQUIRE( table.compile(set, 4, tests.data(), (int)tests.size()) );
+    REQUIRE( set.compiled );
+
+    int values[NUM_CONDITIONS][2] = {};
+    REQUIRE( table.evaluate(set, values) == 3 );
+
+    values[6][0] = 1;
+    REQUIRE( table.evaluate(set, values) == -1 );
+
+    values[0][0] = 0x4;
+    REQUIRE( table.evaluate(set, values) == 1 );
+
+    values[4][0] = 1;
+    REQUIRE( table.evaluate(set, values) == 0 );
+
+    values[0][0] = 0;
+    values[1][1] = 0x1;
+    values[5][0] = 2;
+    REQUIRE( table.evaluate(set, values) == 2 );
+
+    // a rule without tests always passes
+    Table::RuleSet defaults;
+    std::vector<Table::Test> noTests;
+    REQUIRE( table.compile(defaults, 2, noTests.data(), 0) );
+    REQUIRE( table.evaluate(defaults, values) == 0 );
+
+    Table::RuleSet empty;
+    REQUIRE( table.compile(empty, 0, noTests.data(), 0) );
+    REQUIRE( table.evaluate(empty, values) == -1 );
+}
+
+TEST_CASE( "condition table agrees with testing rule by rule", "[condition_table]" ) {
+    srand(1234);
+    Table table;
+    table.clear();
+
+    for (int script = 0; script < 20; script++) {
+        int numRules = 1 + rand() % Table::MAX_RULES;
+        std::vector<Table::Test> tests = randomScript(numRules);
+        std::vector<std::vector<Table::Test>> rules = byRule(tests, numRules);
+        Table::RuleSet set;
+        REQUIRE( table.compile(set, numRules, tests.data(), (int)tests.size()) );
+
+        for (int i = 0; i < 500; i++) {
+            int values[NUM_CONDITIONS][2];
+            randomValues(values);
+            REQUIRE( table.evaluate(set, values) == linearFirst(rules, values) );
+        }
+    }
+}
+
+TEST_CASE( "condition table reports rule sets that don't fit", "[condition_table]" ) {
+    ConditionTable<4, 8> small;
+    small.clear();
+    ConditionTable<4, 8>::RuleSet set;
+
+    std::vector<ConditionTable<4, 8>::Test> tests;
+    for (int rule = 0; rule < 9; rule++) {
+        tests.push_back({ rule, 4, ConditionTable<4, 8>::VALUE, { rule, 0 } });
+    }
+    REQUIRE( !small.compile(set, 9, tests.data(), (int)tests.size()) );
+    REQUIRE( !set.compiled );
+    REQUIRE( small.testsUsed() == 0 );
+
+    tests.pop_back();
+    REQUIRE( small.compile(set, 8, tests.data(), (int)tests.size()) );
+    REQUIRE( small.testsUsed() == 8 );
+    REQUIRE( small.conditionsUsed() == 1 );
+
+    REQUIRE( !small.compile(set, 33, tests.data(), (int)tests.size()) );
+}
+
+TEST_CASE( "condition table benchmark", "[condition_table][!benchmark]" ) {
+    const int numScripts = 64;
+    srand(5678);
+
+    static Table table;
+    table.clear();
+    std::vector<std::vector<std::vector<Table::Test>>> scripts;
+    std::vector<Table::RuleSet> sets(numScripts);
+    for (int s = 0; s < numScripts; s++) {
+        int numRules = 8 + rand() % 16;
+        std::vector<Table::Test> tests = randomScript(numRules);
+        scripts.push_back(byRule(tests, numRules));
+        table.compile(sets[s], numRules, tests.data(), (int)tests.size());
+    }
+    std::vector<std::vector<int>> clients;
+    for (int c = 0; c < 64; c++) {
+        int values[NUM_CONDITIONS][2];
+        randomValues(values);
+        clients.push_back(std::vector<int>(&values[0][0], &values[0][0] + NUM_CONDITIONS * 2));
+    }
+
+    BENCHMARK("rule by rule") {
+        int found = 0;
+        for (const std::vector<int>& client : clients) {
+            const int (*values)[2] = (const int (*)[2])client.data();
+            for (int s = 0; s < numScripts; s++) {
+                found += linearFirst(scripts[s], values);
+            }
+        }
+        return found;
+    };
+
+    BENCHMARK("decision table") {
+        int found = 0;
+        for (const std::vector<int>& client : clients) {
+            const int (*values)[2] = (const int (*)[2])client.data();
+            for (int s = 0; s < numScripts; s++) {
+                found += table.evaluate(sets[s], values);
+            }
+        }
+        return found;
+    };
+}
@@ -0,0 +1,110 @@
+#include "qcommon/fixed_pool.h"
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+struct Item
+{
+    int value;
+};
+
+std::vector<int> walk(FixedPool<Item, 8>& pool) {
+    std::vector<int> values;
+    for (Item* item = pool.first(); item; item = pool.next()) {
+        values.push_back(item->value);
+    }
+    return values;
+}
+
+}
+
+TEST_CASE( "fixed pool iterates in allocation order", "[fixed_pool]" ) {
+    FixedPool<Item, 8> pool;
+
+    Item* items[8];
+    for (int i = 0; i < 8; i++) {
+        items[i] = pool.alloc();
+        items[i]->value = i;
+    }
+    REQUIRE( pool.full() );
+    REQUIRE( pool.alloc() == nullptr );
+    REQUIRE( pool.getStats().failures == 1 );
+
+    pool.free(items[0]);
+    pool.free(items[3]);
+    REQUIRE( pool.oldest()->value == 1 );
+
+    Item* reused = pool.alloc();
+    reused->value = 8;
+    REQUIRE( walk(pool) == std::vector<int>{ 1, 2, 4, 5, 6, 7, 8 } );
+
+    REQUIRE( pool.count() == 7 );
+    REQUIRE( pool.getStats().highWater == 8 );
+}
+
+TEST_CASE( "fixed pool handles detect reuse", "[fixed_pool]" ) {
+    FixedPool<Item, 8> pool;
+
+    Item* item = pool.alloc();
+    FixedPool<Item, 8>::Handle handle = pool.handleFor(item);
+    REQUIRE( handle > 0 );
+    REQUIRE( pool.get(handle) == item );
+    REQUIRE( pool.get(0) == nullptr );
+    REQUIRE( pool.get(-1) == nullptr );
+
+    pool.free(item);
+    REQUIRE( pool.get(handle) == nullptr );
+
+    // the same slot comes back, but the old handle stays dead
+    Item* again = pool.alloc();
+    REQUIRE( again == item );
+    REQUIRE( pool.get(handle) == nullptr );
+    REQUIRE( pool.get(pool.handleFor(again)) == again );
+}
+
+TEST_CASE( "fixed pool tolerates changes while iterating", "[fixed_pool]" ) {
+    FixedPool<Item, 8> pool;
+
+    for (int i = 0; i < 4; i++) {
+        pool.alloc()->value = i;
+    }
+
+    // free the odd items and spawn a new one from each even item,
+    // stealing the oldest once the pool is full
+    std::vector<int> visited;
+    int next = 4;
+    for (Item* item = pool.first(); item; item = pool.next()) {
+        visited.push_back(item->value);
+        if (item->value & 1) {
+            pool.free(item);
+        } else if (item->value < 16) {
+            if (pool.full()) {
+                pool.steal(pool.oldest());
+            }
+            pool.alloc()->value = next;
+            next += 2;
+        }
+    }
+
+    REQUIRE( visited == std::vector<int>{ 0, 1, 2, 3, 4, 6, 8, 10, 12, 14, 16, 18 } );
+    REQUIRE( walk(pool) == std::vector<int>{ 4, 6, 8, 10, 12, 14, 16, 18 } );
+    REQUIRE( pool.getStats().steals == 2 );
+}
+
+TEST_CASE( "fixed pool survives many alloc/free cycles", "[fixed_pool]" ) {
+    FixedPool<Item, 8> pool;
+
+    // forces the order array to be compacted many times
+    for (int i = 0; i < 1000; i++) {
+        if (pool.full()) {
+            pool.steal(pool.oldest());
+        }
+        pool.alloc()->value = i;
+    }
+
+    REQUIRE( walk(pool) == std::vector<int>{ 992, 993, 994, 995, 996, 997, 998, 999 } );
+    REQUIRE( pool.getStats().steals == 992 );
+    REQUIRE( pool.getStats().allocs == 1000 );
+}
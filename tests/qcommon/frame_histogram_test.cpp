@@ -0,0 +1,45 @@
+#include "qcommon/frame_histogram.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE( "frame histogram buckets by powers of two", "[frame_histogram]" ) {
+    REQUIRE(FrameHistogram::bucketFor(0) == 0);
+    REQUIRE(FrameHistogram::bucketFor(63) == 0);
+    REQUIRE(FrameHistogram::bucketFor(64) == 1);
+    REQUIRE(FrameHistogram::bucketFor(127) == 1);
+    REQUIRE(FrameHistogram::bucketFor(128) == 2);
+    REQUIRE(FrameHistogram::bucketFor(1 << 30) == FrameHistogram::NUM_BUCKETS - 1);
+
+    for (int b = 0; b < FrameHistogram::NUM_BUCKETS - 1; b++) {
+        REQUIRE(FrameHistogram::bucketFor(FrameHistogram::lowerBound(b)) == b);
+        REQUIRE(FrameHistogram::bucketFor(FrameHistogram::upperBound(b) - 1) == b);
+    }
+}
+
+TEST_CASE( "frame histogram tracks min, max, mean and percentiles", "[frame_histogram]" ) {
+    FrameHistogram h;
+    REQUIRE(h.percentile(50) == 0);
+    REQUIRE(h.mean() == 0.0f);
+
+    // 90 frames of ~1ms and 10 hitches of 40ms
+    for (int i = 0; i < 90; i++) {
+        h.add(1000);
+    }
+    for (int i = 0; i < 10; i++) {
+        h.add(40000);
+    }
+    h.add(-5);      // clock went backwards, counts as zero
+
+    REQUIRE(h.count == 101);
+    REQUIRE(h.minUsec == 0);
+    REQUIRE(h.maxUsec == 40000);
+    REQUIRE(h.total == 90 * 1000 + 10 * 40000);
+
+    // the median lands in the 1ms bucket, the tail in the hitch bucket, clamped to the max
+    REQUIRE(h.percentile(50) == FrameHistogram::upperBound(FrameHistogram::bucketFor(1000)));
+    REQUIRE(h.percentile(99) == 40000);
+
+    h.clear();
+    REQUIRE(h.count == 0);
+    REQUIRE(h.maxUsec == 0);
+}
@@ -0,0 +1,124 @@
+#include "qcommon/glyph_batch.h"
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+struct Quad {
+    float x, y;
+    float w, h;
+    float s1, t1;
+    float s2, t2;
+    uint8_t modulate[4];
+};
+
+struct Submitted {
+    int shader;
+    std::vector<Quad> quads;
+};
+
+std::vector<Submitted> submitted;
+
+void submit(int shader, const Quad* quads, int count) {
+    submitted.push_back({ shader, std::vector<Quad>(quads, quads + count) });
+}
+
+const float white[4] = { 1, 1, 1, 1 };
+
+}
+
+TEST_CASE( "glyph atlas lays pages out in a power of two grid", "[glyph_batch]" ) {
+    for (int pages = 1; pages <= 16; pages++) {
+        const GlyphAtlas atlas = GlyphAtlas::layout(pages, 256, 256, 2048);
+        REQUIRE(atlas.valid());
+        REQUIRE(atlas.cols * atlas.rows >= pages);
+        // no bigger than it has to be
+        REQUIRE(atlas.cols * atlas.rows < pages * 2);
+        REQUIRE((atlas.cols & (atlas.cols - 1)) == 0);
+        REQUIRE((atlas.rows & (atlas.rows - 1)) == 0);
+        REQUIRE(atlas.cols >= atlas.rows);
+        REQUIRE(atlas.width == atlas.cols * 256);
+        REQUIRE(atlas.height == atlas.rows * 256);
+
+        // every page has a cell of its own
+        for (int a = 0; a < pages; a++) {
+            REQUIRE(atlas.row(a) < atlas.rows);
+            for (int b = 0; b < a; b++) {
+                REQUIRE((atlas.col(a) != atlas.col(b) || atlas.row(a) != atlas.row(b)));
+            }
+        }
+    }
+
+    REQUIRE(!GlyphAtlas::layout(0, 256, 256, 2048).valid());
+    REQUIRE(!GlyphAtlas::layout(16, 256, 256, 512).valid());
+    REQUIRE(GlyphAtlas::layout(4, 256, 256, 512).valid());
+}
+
+TEST_CASE( "glyph atlas moves texture coordinates into the page's cell", "[glyph_batch]" ) {
+    const GlyphAtlas atlas = GlyphAtlas::layout(3, 256, 256, 2048);
+    REQUIRE(atlas.cols == 2);
+    REQUIRE(atlas.rows == 2);
+
+    float s = 0.25f, t = 0.5f;
+    atlas.remap(0, s, t);
+    REQUIRE(s == 0.125f);
+    REQUIRE(t == 0.25f);
+
+    s = 0.25f, t = 0.5f;
+    atlas.remap(2, s, t);
+    REQUIRE(s == 0.125f);
+    REQUIRE(t == 0.75f);
+
+    s = 1.0f, t = 1.0f;
+    atlas.remap(1, s, t);
+    REQUIRE(s == 1.0f);
+    REQUIRE(t == 0.5f);
+}
+
+TEST_CASE( "quad batch submits runs of one shader in order", "[glyph_batch]" ) {
+    submitted.clear();
+    {
+        QuadBatch<Quad, 4> batch(submit);
+        for (int i = 0; i < 6; i++) {
+            batch.add(1, (float)i, 0, 8, 8, 0, 0, 1, 1, white);
+        }
+        batch.add(2, 6, 0, 8, 8, 0, 0, 1, 1, white);
+        batch.add(1, 7, 0, 8, 8, 0, 0, 1, 1, white);
+        REQUIRE(submitted.size() == 3);
+    }
+    // and the rest when it goes out of scope
+    REQUIRE(submitted.size() == 4);
+
+    const int shaders[] = { 1, 1, 2, 1 };
+    const size_t sizes[] = { 4, 2, 1, 1 };
+    float x = 0;
+    for (int i = 0; i < 4; i++) {
+        REQUIRE(submitted[i].shader == shaders[i]);
+        REQUIRE(submitted[i].quads.size() == sizes[i]);
+        for (const Quad& quad : submitted[i].quads) {
+            REQUIRE(quad.x == x);
+            x++;
+        }
+    }
+}
+
+TEST_CASE( "quad batch clamps colors to bytes", "[glyph_batch]" ) {
+    submitted.clear();
+    QuadBatch<Quad, 4> batch(submit);
+    const float color[4] = { -0.5f, 0.5f, 1.0f, 2.0f };
+    batch.add(1, 0, 0, 8, 8, 0.25f, 0.5f, 0.75f, 1.0f, color);
+    REQUIRE(batch.size() == 1);
+    batch.flush();
+    REQUIRE(batch.size() == 0);
+    batch.flush();
+
+    REQUIRE(submitted.size() == 1);
+    const Quad& quad = submitted[0].quads[0];
+    REQUIRE(quad.modulate[0] == 0);
+    REQUIRE(quad.modulate[1] == 127);
+    REQUIRE(quad.modulate[2] == 255);
+    REQUIRE(quad.modulate[3] == 255);
+    REQUIRE(quad.s1 == 0.25f);
+    REQUIRE(quad.t2 == 1.0f);
+}
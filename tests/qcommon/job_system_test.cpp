@@ -0,0 +1,211 @@
+#include "qcommon/job_system.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE( "jobs submitted against a fence have all run when it is done", "[job_system]" ) {
+    for (int workers : { 0, 1, 4 }) {
+        JobSystem jobs;
+        jobs.start(workers);
+        REQUIRE(jobs.workers() == workers);
+        REQUIRE(jobs.threadIndex() == 0);
+
+        std::atomic<int> count{0};
+        JobSystem::Fence fence;
+        REQUIRE(fence.done());
+        for (int i = 0; i < 1000; i++) {
+            jobs.submit([&count] { count++; }, &fence);
+        }
+        jobs.wait(fence);
+        REQUIRE(fence.done());
+        REQUIRE(count == 1000);
+
+        // jobs that submit jobs
+        JobSystem::Fence nested;
+        for (int i = 0; i < 100; i++) {
+            jobs.submit([&jobs, &count, &nested] {
+                for (int j = 0; j < 10; j++) {
+                    jobs.submit([&count] { count++; }, &nested);
+                }
+            }, &nested);
+        }
+        jobs.wait(nested);
+        REQUIRE(count == 2000);
+    }
+}
+
+TEST_CASE( "background jobs run on a worker, or on the waiting thread without workers", "[job_system]" ) {
+    for (int workers : { 0, 1, 4 }) {
+        JobSystem jobs;
+        jobs.start(workers);
+
+        std::atomic<int> ranOn{-2};
+        JobSystem::Fence fence;
+        jobs.submitBackground([&jobs, &ranOn] { ranOn = jobs.threadIndex(); }, &fence);
+
+        // waiting for other jobs on the main thread never picks it up
+        std::atomic<int> count{0};
+        jobs.parallelFor(0, 1000, 10, [&count](int first, int last) { count += last - first; });
+        REQUIRE(count == 1000);
+        if (workers) {
+            REQUIRE(ranOn != 0);
+        }
+
+        jobs.wait(fence);
+        REQUIRE(fence.done());
+        if (workers) {
+            REQUIRE(ranOn >= 1);
+        } else {
+            REQUIRE(ranOn == 0);
+        }
+    }
+}
+
+TEST_CASE( "parallel for covers every index once", "[job_system]" ) {
+    for (int workers : { 0, 3 }) {
+        JobSystem jobs;
+        jobs.start(workers);
+        for (int grain : { 1, 7, 64, 5000 }) {
+            // Catch's assertions aren't thread safe, so the jobs only record what they saw
+            std::vector<std::atomic<int>> hits(1000);
+            std::atomic<bool> chunked{true};
+            jobs.parallelFor(0, 1000, grain, [&hits, &chunked, grain](int first, int last) {
+                if (first >= last || last - first > grain) {
+                    chunked = false;
+                }
+                for (int i = first; i < last; i++) {
+                    hits[i]++;
+                }
+            });
+            REQUIRE(chunked);
+            for (const std::atomic<int>& hit : hits) {
+                REQUIRE(hit == 1);
+            }
+        }
+
+        // nothing to do
+        bool called = false;
+        jobs.parallelFor(10, 10, 4, [&called](int, int) { called = true; });
+        REQUIRE(!called);
+    }
+}
+
+TEST_CASE( "task graph runs jobs after the ones that precede them", "[job_system]" ) {
+    JobSystem jobs;
+    jobs.start(4);
+
+    // a diamond of layers: every job of a layer needs every job of the one before
+    const int layers = 5;
+    const int width = 8;
+    std::atomic<int> finished[layers] = {};
+    std::atomic<bool> ordered{true};
+    JobSystem::TaskGraph graph;
+    std::vector<int> previous;
+    for (int layer = 0; layer < layers; layer++) {
+        std::vector<int> current;
+        for (int i = 0; i < width; i++) {
+            const int id = graph.add([&finished, &ordered, layer] {
+                if (layer > 0 && finished[layer - 1] != width) {
+                    ordered = false;
+                }
+                finished[layer]++;
+            });
+            for (int before : previous) {
+                graph.precede(before, id);
+            }
+            current.push_back(id);
+        }
+        previous = current;
+    }
+    REQUIRE(graph.size() == layers * width);
+
+    // and again, the graph is reusable
+    for (int run = 0; run < 2; run++) {
+        for (std::atomic<int>& layer : finished) {
+            layer = 0;
+        }
+        JobSystem::Fence fence;
+        graph.run(jobs, fence);
+        jobs.wait(fence);
+        REQUIRE(ordered);
+        for (const std::atomic<int>& layer : finished) {
+            REQUIRE(layer == width);
+        }
+    }
+}
+
+TEST_CASE( "end of frame waits for the frame's jobs and resets scratch memory", "[job_system]" ) {
+    JobSystem jobs;
+    jobs.start(2);
+
+    std::atomic<int> count{0};
+    std::atomic<bool> aligned{true};
+    std::atomic<bool> indexed{true};
+    for (int i = 0; i < 64; i++) {
+        jobs.submit([&jobs, &count, &aligned, &indexed] {
+            if (jobs.threadIndex() < 0 || jobs.threadIndex() > jobs.workers()) {
+                indexed = false;
+            }
+            double* values = jobs.scratch().alloc<double>(100);
+            void* vec = jobs.scratch().alloc(48, 64);
+            if ((uintptr_t)values % 16 != 0 || (uintptr_t)vec % 64 != 0) {
+                aligned = false;
+            }
+            values[99] = 1.0;
+            count++;
+        }, &jobs.frame());
+    }
+    jobs.endFrame();
+    REQUIRE(count == 64);
+    REQUIRE(aligned);
+    REQUIRE(indexed);
+    REQUIRE(jobs.frame().done());
+    REQUIRE(jobs.scratch().used() == 0);
+
+    // a thread that didn't start the jobs can still submit them
+    std::atomic<int> outside{0};
+    int otherIndex = 0;
+    std::thread other([&jobs, &outside, &otherIndex] {
+        otherIndex = jobs.threadIndex();
+        JobSystem::Fence fence;
+        for (int i = 0; i < 100; i++) {
+            jobs.submit([&outside] { outside++; }, &fence);
+        }
+        jobs.wait(fence);
+    });
+    other.join();
+    REQUIRE(otherIndex == -1);
+    REQUIRE(outside == 100);
+
+    // stopping finishes what was queued
+    for (int i = 0; i < 100; i++) {
+        jobs.submit([&count] { count++; });
+    }
+    jobs.stop();
+    REQUIRE(!jobs.running());
+    REQUIRE(count == 164);
+}
+
+TEST_CASE( "scratch allocator grows and keeps its largest block", "[job_system]" ) {
+    ScratchAllocator scratch;
+    REQUIRE(scratch.used() == 0);
+
+    char* a = (char*)scratch.alloc(10);
+    char* b = (char*)scratch.alloc(10);
+    REQUIRE((uintptr_t)a % 16 == 0);
+    REQUIRE(b == a + 16);
+    REQUIRE(scratch.used() == 20);
+
+    // more than a block
+    char* big = (char*)scratch.alloc(ScratchAllocator::BLOCK_SIZE * 3, 128);
+    REQUIRE((uintptr_t)big % 128 == 0);
+    big[ScratchAllocator::BLOCK_SIZE * 3 - 1] = 1;
+
+    scratch.reset();
+    REQUIRE(scratch.used() == 0);
+    // which fits now without growing
+    REQUIRE((char*)scratch.alloc(ScratchAllocator::BLOCK_SIZE * 3, 128) == big);
+}
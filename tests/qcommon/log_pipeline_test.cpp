@@ -0,0 +1,147 @@
+#include "qcommon/log_pipeline.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+struct Line {
+    std::string text;
+    int severity;
+    int subsystem;
+    int flags;
+};
+
+std::vector<Line> drainAll(LogPipeline& log) {
+    std::vector<Line> lines;
+    log.drain([&lines](const LogPipeline::Record& record) {
+        lines.push_back({ std::string(record.text, record.length), record.severity, record.subsystem, record.flags });
+    });
+    return lines;
+}
+
+bool push(LogPipeline& log, const std::string& text) {
+    return log.push(1, 0, 0, text.data(), (int)text.size());
+}
+
+}
+
+TEST_CASE( "log pipeline hands messages back in the order they were pushed", "[log_pipeline]" ) {
+    LogPipeline log;
+    REQUIRE(drainAll(log).empty());
+
+    REQUIRE(log.push(0, 3, 1, "first\n", 6));
+    REQUIRE(log.push(2, 5, 0, "second\n", 7));
+    const std::vector<Line> lines = drainAll(log);
+    REQUIRE(lines.size() == 2);
+    REQUIRE(lines[0].text == "first\n");
+    REQUIRE(lines[0].severity == 0);
+    REQUIRE(lines[0].subsystem == 3);
+    REQUIRE(lines[0].flags == 1);
+    REQUIRE(lines[1].text == "second\n");
+    REQUIRE(lines[1].severity == 2);
+    REQUIRE(lines[1].subsystem == 5);
+    REQUIRE(drainAll(log).empty());
+    REQUIRE(log.takeDropped() == 0);
+}
+
+TEST_CASE( "log pipeline filters on severity and subsystem", "[log_pipeline]" ) {
+    LogPipeline log;
+    REQUIRE(log.enabled(0, 0));
+    REQUIRE(log.enabled(0, 31));
+
+    log.setFilter(1, (1u << 2) | (1u << 4));
+    REQUIRE(!log.enabled(0, 2));
+    REQUIRE(log.enabled(1, 2));
+    REQUIRE(log.enabled(3, 4));
+    REQUIRE(!log.enabled(3, 0));
+    REQUIRE(!log.enabled(3, 3));
+}
+
+TEST_CASE( "log pipeline drops and counts what doesn't fit and wraps around", "[log_pipeline]" ) {
+    LogPipeline log(1024);
+    const std::string text(100, 'x');
+
+    // every message takes a header as well, so not ten of them
+    int pushed = 0;
+    while (push(log, text + std::to_string(pushed))) {
+        pushed++;
+    }
+    REQUIRE(pushed > 1);
+    REQUIRE(pushed < 10);
+    REQUIRE(!push(log, text));
+    REQUIRE(log.takeDropped() == 2);
+    REQUIRE(log.takeDropped() == 0);
+
+    std::vector<Line> lines = drainAll(log);
+    REQUIRE((int)lines.size() == pushed);
+    REQUIRE(lines.back().text == text + std::to_string(pushed - 1));
+
+    // lengths that don't divide the ring, so that messages keep meeting its end
+    int next = 0;
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(push(log, std::string(37 + round % 50, 'a' + i) + std::to_string(next + i)));
+        }
+        lines = drainAll(log);
+        REQUIRE(lines.size() == 3);
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(lines[i].text == std::string(37 + round % 50, 'a' + i) + std::to_string(next + i));
+        }
+        next += 3;
+    }
+}
+
+TEST_CASE( "log pipeline merges threads in order and reuses the rings of finished ones", "[log_pipeline]" ) {
+    LogPipeline log;
+    const int threads = 4;
+    const int messages = 2000;
+
+    // drained as they arrive, as the writer does
+    std::vector<Line> lines;
+    std::atomic<int> running{threads};
+    std::vector<std::thread> printers;
+    for (int t = 0; t < threads; t++) {
+        printers.emplace_back([&log, &running, t] {
+            for (int i = 0; i < messages; i++) {
+                const std::string text = std::to_string(t) + " " + std::to_string(i) + "\n";
+                while (!log.push(1, t, 0, text.data(), (int)text.size())) {
+                    std::this_thread::yield();
+                }
+            }
+            running--;
+        });
+    }
+    while (running > 0) {
+        for (Line& line : drainAll(log)) {
+            lines.push_back(line);
+        }
+    }
+    for (std::thread& printer : printers) {
+        printer.join();
+    }
+    for (Line& line : drainAll(log)) {
+        lines.push_back(line);
+    }
+    log.takeDropped();
+
+    REQUIRE((int)lines.size() == threads * messages);
+    std::vector<int> next(threads, 0);
+    for (const Line& line : lines) {
+        REQUIRE(line.text == std::to_string(line.subsystem) + " " + std::to_string(next[line.subsystem]) + "\n");
+        next[line.subsystem]++;
+    }
+    // fewer if one finished before another started
+    const int rings = log.ringCount();
+    REQUIRE(rings <= threads);
+
+    // new threads take over the drained rings rather than adding their own
+    for (int t = 0; t < 3; t++) {
+        std::thread([&log] { push(log, "again\n"); }).join();
+        REQUIRE(drainAll(log).size() == 1);
+    }
+    REQUIRE(log.ringCount() == rings);
+}
@@ -0,0 +1,98 @@
+#include "qcommon/name_index.h"
+
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+enum { CLASSNAME, TARGETNAME, NUM_KEYS };
+
+bool sameName(const char* a, const char* b) {
+    for (; *a && tolower(*a) == tolower(*b); a++, b++) {
+    }
+    return tolower(*a) == tolower(*b);
+}
+
+// what G_Find does with the index: walk the candidates and compare the names
+std::vector<int> findAll(const NameIndex<NUM_KEYS>& index, int key, const char* name) {
+    std::vector<int> found;
+    for (int item : index.candidates(key, name)) {
+        const char* s = index.get(key, item);
+        if (s && sameName(s, name)) {
+            found.push_back(item);
+        }
+    }
+    return found;
+}
+
+}
+
+TEST_CASE( "name index finds items by name", "[name_index]" ) {
+    NameIndex<NUM_KEYS> index(64);
+
+    index.set(CLASSNAME, 5, "func_door");
+    index.set(CLASSNAME, 2, "func_door");
+    index.set(CLASSNAME, 9, "trigger_once");
+    index.set(TARGETNAME, 2, "door1");
+
+    REQUIRE(findAll(index, CLASSNAME, "func_door") == std::vector<int>({ 2, 5 }));
+    REQUIRE(findAll(index, CLASSNAME, "FUNC_DOOR") == std::vector<int>({ 2, 5 }));
+    REQUIRE(findAll(index, CLASSNAME, "trigger_once") == std::vector<int>({ 9 }));
+    REQUIRE(findAll(index, CLASSNAME, "door1").empty());
+    REQUIRE(findAll(index, TARGETNAME, "door1") == std::vector<int>({ 2 }));
+    REQUIRE(NameIndex<NUM_KEYS>::hash("Door1") == NameIndex<NUM_KEYS>::hash("dOOR1"));
+}
+
+TEST_CASE( "name index follows renames and removals", "[name_index]" ) {
+    NameIndex<NUM_KEYS> index(64);
+    const char* door = "func_door";
+
+    REQUIRE(index.set(CLASSNAME, 3, door));
+    REQUIRE_FALSE(index.set(CLASSNAME, 3, door));      // same pointer, nothing to do
+
+    index.set(CLASSNAME, 3, "func_button");
+    REQUIRE(findAll(index, CLASSNAME, "func_door").empty());
+    REQUIRE(findAll(index, CLASSNAME, "func_button") == std::vector<int>({ 3 }));
+
+    index.set(CLASSNAME, 3, nullptr);
+    REQUIRE(findAll(index, CLASSNAME, "func_button").empty());
+    REQUIRE(index.get(CLASSNAME, 3) == nullptr);
+
+    index.set(CLASSNAME, 4, door);
+    index.clear();
+    REQUIRE(findAll(index, CLASSNAME, "func_door").empty());
+}
+
+TEST_CASE( "name index matches a linear scan", "[name_index]" ) {
+    const int numItems = 1024;
+    NameIndex<NUM_KEYS> index(numItems);
+    std::mt19937 rng(7);
+
+    std::vector<std::string> pool;
+    for (int i = 0; i < 200; i++) {
+        pool.push_back("target" + std::to_string(i));
+    }
+    std::vector<const char*> names(numItems, nullptr);
+    std::uniform_int_distribution<int> pick(0, (int)pool.size());
+    std::uniform_int_distribution<int> item(0, numItems - 1);
+
+    for (int step = 0; step < 20000; step++) {
+        int i = item(rng);
+        int p = pick(rng);
+        names[i] = p == (int)pool.size() ? nullptr : pool[p].c_str();
+        index.set(TARGETNAME, i, names[i]);
+    }
+
+    for (const std::string& name : pool) {
+        std::vector<int> expected;
+        for (int i = 0; i < numItems; i++) {
+            if (names[i] && name == names[i]) {
+                expected.push_back(i);
+            }
+        }
+        REQUIRE(findAll(index, TARGETNAME, name.c_str()) == expected);
+    }
+}
@@ -0,0 +1,91 @@
+#include "qcommon/profiler.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+// zones recorded on the calling thread, after the profiler was cleared
+std::vector<Profiler::Zone> myZones() {
+    return Profiler::get().zones(Profiler::get().thread());
+}
+
+}
+
+TEST_CASE( "profiler records nested zones", "[profiler]" ) {
+    Profiler& profiler = Profiler::get();
+    profiler.clear();
+    profiler.setEnabled(true);
+    {
+        ProfileZone outer("outer");
+        {
+            ProfileZone inner("inner");
+        }
+        ProfileZone second("second");
+    }
+    profiler.setEnabled(false);
+    {
+        ProfileZone ignored("ignored");
+    }
+
+    std::vector<Profiler::Zone> zones = myZones();
+    REQUIRE(zones.size() == 3);
+
+    // zones are recorded as they end, children first
+    REQUIRE(std::string(zones[0].name) == "inner");
+    REQUIRE(std::string(zones[1].name) == "second");
+    REQUIRE(std::string(zones[2].name) == "outer");
+    for (const Profiler::Zone& zone : zones) {
+        REQUIRE(zone.start <= zone.end);
+        REQUIRE(zone.start >= zones[2].start);
+        REQUIRE(zone.end <= zones[2].end);
+    }
+}
+
+TEST_CASE( "profiler keeps the newest zones when the ring wraps", "[profiler]" ) {
+    Profiler& profiler = Profiler::get();
+    profiler.clear();
+    Profiler::Timeline& timeline = profiler.thread();
+
+    const int extra = 100;
+    for (int i = 0; i < Profiler::RING_SIZE + extra; i++) {
+        profiler.record(timeline, "zone", i, i + 1);
+    }
+
+    // the oldest slot is the one the owner would overwrite next, so it is left out
+    std::vector<Profiler::Zone> zones = myZones();
+    REQUIRE(zones.size() == Profiler::RING_SIZE - 1);
+    REQUIRE(zones.front().start == extra + 1);
+    REQUIRE(zones.back().start == Profiler::RING_SIZE + extra - 1);
+}
+
+TEST_CASE( "profiler writes a chrome trace per thread", "[profiler]" ) {
+    Profiler& profiler = Profiler::get();
+    profiler.clear();
+    profiler.setThreadName("test main");
+    profiler.setEnabled(true);
+    {
+        ProfileZone zone("main \"quoted\" zone");
+    }
+    std::thread worker([&profiler]() {
+        profiler.setThreadName("worker");
+        ProfileZone zone("worker zone");
+    });
+    worker.join();
+    profiler.setEnabled(false);
+
+    std::string trace = profiler.chromeTrace();
+    REQUIRE(trace.find("{\"traceEvents\":[") == 0);
+    REQUIRE(trace.find("\"args\":{\"name\":\"test main\"}") != std::string::npos);
+    REQUIRE(trace.find("\"args\":{\"name\":\"worker\"}") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"main \\\"quoted\\\" zone\",\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"worker zone\",\"ph\":\"X\"") != std::string::npos);
+
+    // the worker's zone is on its own timeline
+    size_t workerZone = trace.find("\"worker zone\"");
+    size_t mainZone = trace.find("quoted");
+    REQUIRE(trace.substr(workerZone, 60).find("\"tid\":1,") == std::string::npos);
+    REQUIRE(trace.substr(mainZone, 60).find("\"tid\":1,") != std::string::npos);
+}
@@ -0,0 +1,156 @@
+#include "qcommon/save_codec.h"
+
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+// mostly zero, with the odd field and string filled in, like a saved entity
+std::vector<uint8_t> makeRecord(std::mt19937& rng, int size) {
+    std::vector<uint8_t> record(size, 0);
+    std::uniform_int_distribution<int> pos(0, size - 1);
+    std::uniform_int_distribution<int> len(1, 24);
+    std::uniform_int_distribution<int> byte(0, 255);
+    for (int fields = size / 64; fields > 0; fields--) {
+        int start = pos(rng);
+        int end = std::min(size, start + len(rng));
+        for (int i = start; i < end; i++) {
+            record[i] = (uint8_t)byte(rng);
+        }
+    }
+    return record;
+}
+
+std::vector<uint8_t> zeroRunRoundTrip(const std::vector<uint8_t>& raw) {
+    std::vector<uint8_t> encoded(SaveCodec_ZeroRunBound((int)raw.size()));
+    int length = SaveCodec_EncodeZeroRuns(raw.data(), (int)raw.size(), encoded.data(), (int)encoded.size());
+    REQUIRE(length >= 0);
+
+    std::vector<uint8_t> decoded(raw.size());
+    REQUIRE(SaveCodec_DecodeZeroRuns(encoded.data(), length, decoded.data(), (int)decoded.size()) == (int)raw.size());
+    return decoded;
+}
+
+std::vector<uint8_t> lzRoundTrip(const std::vector<uint8_t>& raw) {
+    std::vector<uint8_t> compressed(SaveCodec_LZBound((int)raw.size()));
+    int length = SaveCodec_CompressLZ(raw.data(), (int)raw.size(), compressed.data(), (int)compressed.size());
+    REQUIRE(length >= 0);
+
+    std::vector<uint8_t> decompressed(raw.size());
+    REQUIRE(SaveCodec_DecompressLZ(compressed.data(), length, decompressed.data(), (int)decompressed.size()) == (int)raw.size());
+    return decompressed;
+}
+
+}
+
+TEST_CASE( "zero run codec round trips", "[save_codec]" ) {
+    std::mt19937 rng(1234);
+
+    REQUIRE(zeroRunRoundTrip({}).empty());
+    REQUIRE(zeroRunRoundTrip(std::vector<uint8_t>(5000, 0)) == std::vector<uint8_t>(5000, 0));
+    REQUIRE(zeroRunRoundTrip(std::vector<uint8_t>(5000, 7)) == std::vector<uint8_t>(5000, 7));
+
+    // short zero runs stay inside literals, and the tail may be a short zero run
+    std::vector<uint8_t> mixed = { 1, 0, 2, 0, 0, 3, 0, 0, 0, 0, 0, 4, 0, 0 };
+    REQUIRE(zeroRunRoundTrip(mixed) == mixed);
+
+    for (int size : { 1, 15, 16, 17, 100, 1000, 9000 }) {
+        std::vector<uint8_t> record = makeRecord(rng, size);
+        REQUIRE(zeroRunRoundTrip(record) == record);
+    }
+}
+
+TEST_CASE( "zero run codec handles the worst case", "[save_codec]" ) {
+    // alternating bytes never form a zero run worth a token
+    std::vector<uint8_t> raw(4096);
+    for (size_t i = 0; i < raw.size(); i++) {
+        raw[i] = (i & 1) ? 0 : 0xff;
+    }
+    REQUIRE(zeroRunRoundTrip(raw) == raw);
+
+    // and runs of exactly the minimum length split every literal
+    for (size_t i = 0; i < raw.size(); i++) {
+        raw[i] = (i % (SAVECODEC_MIN_ZERO_RUN + 1)) ? 0 : 0xff;
+    }
+    REQUIRE(zeroRunRoundTrip(raw) == raw);
+}
+
+TEST_CASE( "zero run codec rejects bad input", "[save_codec]" ) {
+    std::vector<uint8_t> out(16);
+
+    // zero run longer than the output
+    const uint8_t tooLong[] = { (uint8_t)((17 << 1) | 1) };
+    REQUIRE(SaveCodec_DecodeZeroRuns(tooLong, sizeof(tooLong), out.data(), (int)out.size()) == -1);
+
+    // literal run past the end of the input
+    const uint8_t truncated[] = { 4 << 1, 1, 2 };
+    REQUIRE(SaveCodec_DecodeZeroRuns(truncated, sizeof(truncated), out.data(), (int)out.size()) == -1);
+
+    // output buffer too small to encode into
+    std::vector<uint8_t> raw(64, 9);
+    REQUIRE(SaveCodec_EncodeZeroRuns(raw.data(), (int)raw.size(), out.data(), (int)out.size()) == -1);
+}
+
+TEST_CASE( "lz codec round trips", "[save_codec]" ) {
+    std::mt19937 rng(99);
+
+    REQUIRE(lzRoundTrip({}).empty());
+    REQUIRE(lzRoundTrip({ 1, 2, 3 }) == std::vector<uint8_t>({ 1, 2, 3 }));
+
+    // long overlapping matches
+    REQUIRE(lzRoundTrip(std::vector<uint8_t>(10000, 42)) == std::vector<uint8_t>(10000, 42));
+
+    // a stream of records, with repeats between them
+    std::vector<uint8_t> stream;
+    std::vector<uint8_t> record = makeRecord(rng, 2000);
+    for (int i = 0; i < 20; i++) {
+        if (i % 3 == 0) {
+            record = makeRecord(rng, 2000);
+        }
+        stream.insert(stream.end(), record.begin(), record.end());
+    }
+    REQUIRE(lzRoundTrip(stream) == stream);
+
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<uint8_t> noise(70000);
+    for (uint8_t& b : noise) {
+        b = (uint8_t)byte(rng);
+    }
+    REQUIRE(lzRoundTrip(noise) == noise);
+}
+
+TEST_CASE( "lz codec rejects bad input", "[save_codec]" ) {
+    std::vector<uint8_t> out(64);
+
+    // match offset before the start of the output
+    const uint8_t badOffset[] = { 0x10, 'a', 8, 0 };
+    REQUIRE(SaveCodec_DecompressLZ(badOffset, sizeof(badOffset), out.data(), (int)out.size()) == -1);
+
+    // literals past the end of the input
+    const uint8_t truncated[] = { 0x50, 'a', 'b' };
+    REQUIRE(SaveCodec_DecompressLZ(truncated, sizeof(truncated), out.data(), (int)out.size()) == -1);
+}
+
+TEST_CASE( "save codec benchmark", "[save_codec][!benchmark]" ) {
+    std::mt19937 rng(5);
+    std::vector<uint8_t> record = makeRecord(rng, 8192);
+    std::vector<uint8_t> encoded(SaveCodec_ZeroRunBound((int)record.size()));
+    std::vector<uint8_t> decoded(record.size());
+
+    int length = SaveCodec_EncodeZeroRuns(record.data(), (int)record.size(), encoded.data(), (int)encoded.size());
+
+    BENCHMARK( "encode zero runs" ) {
+        return SaveCodec_EncodeZeroRuns(record.data(), (int)record.size(), encoded.data(), (int)encoded.size());
+    };
+
+    BENCHMARK( "decode zero runs" ) {
+        return SaveCodec_DecodeZeroRuns(encoded.data(), length, decoded.data(), (int)decoded.size());
+    };
+
+    std::vector<uint8_t> compressed(SaveCodec_LZBound((int)record.size()));
+    BENCHMARK( "lz compress" ) {
+        return SaveCodec_CompressLZ(record.data(), (int)record.size(), compressed.data(), (int)compressed.size());
+    };
+}
@@ -0,0 +1,167 @@
+#include "qcommon/slot_mask.h"
+
+#include <cstdlib>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+// laid out like GameEntity: the shared state first, the game's fields after it,
+// the flags G_RunFrame reads spread over the struct
+struct Entity
+{
+    int number;
+    int eType;
+    int eFlags;
+    char state[500];
+    bool linked;
+    char shared[200];
+    bool inuse;
+    int flags;
+    int eventTime;
+    char fields[600];
+    int nextthink;
+    char more[700];
+    Entity* tagParent;
+};
+
+const int MAX_ENTITIES = 1024;
+
+std::vector<int> visited(const SlotMask<MAX_ENTITIES>& mask, int end) {
+    std::vector<int> slots;
+    mask.forEach(end, [&slots](int i) { slots.push_back(i); });
+    return slots;
+}
+
+// what G_RunFrame does for an entity it runs, less the running
+int run(const Entity& ent, int time) {
+    int work = ent.eType + (ent.flags & 1);
+    if (ent.tagParent) {
+        work++;
+    }
+    if (ent.eventTime && time - ent.eventTime > 300) {
+        work++;
+    }
+    if (ent.linked && ent.nextthink <= time) {
+        work++;
+    }
+    return work;
+}
+
+}
+
+TEST_CASE( "slot mask records which slots are used", "[slot_mask]" ) {
+    SlotMask<MAX_ENTITIES> mask;
+    REQUIRE(mask.count() == 0);
+    REQUIRE(visited(mask, MAX_ENTITIES).empty());
+
+    const int used[] = { 0, 1, 63, 64, 65, 127, 500, 1023 };
+    for (int i : used) {
+        mask.set(i, true);
+    }
+    mask.set(2, false);
+    REQUIRE(mask.count() == 8);
+    REQUIRE(mask.test(63));
+    REQUIRE(!mask.test(62));
+    REQUIRE(visited(mask, MAX_ENTITIES) == std::vector<int>(std::begin(used), std::end(used)));
+    // only below the end
+    REQUIRE(visited(mask, 65) == std::vector<int>({ 0, 1, 63, 64 }));
+
+    mask.set(64, false);
+    REQUIRE(!mask.test(64));
+    REQUIRE(mask.count() == 7);
+    mask.clear();
+    REQUIRE(mask.count() == 0);
+}
+
+TEST_CASE( "slot mask walk sees slots used and freed on the way", "[slot_mask]" ) {
+    SlotMask<MAX_ENTITIES> mask;
+    for (int i = 0; i < 200; i += 2) {
+        mask.set(i, true);
+    }
+    int end = 200;
+
+    std::vector<int> slots;
+    mask.forEach(end, [&](int i) {
+        slots.push_back(i);
+        if (i == 10) {
+            // freeing one further on, and the one being run
+            mask.set(12, false);
+            mask.set(10, false);
+            // using one further on, and one already passed
+            mask.set(13, true);
+            mask.set(3, true);
+        }
+        if (i == 62) {
+            mask.set(63, true);
+        }
+        if (i == 198) {
+            // spawning past the end moves it
+            mask.set(250, true);
+            end = 251;
+        }
+    });
+
+    std::vector<int> expected;
+    for (int i = 0; i < 200; i += 2) {
+        if (i == 12) {
+            expected.push_back(13);
+            continue;
+        }
+        expected.push_back(i);
+        if (i == 62) {
+            expected.push_back(63);
+        }
+    }
+    expected.push_back(250);
+    REQUIRE(slots == expected);
+}
+
+TEST_CASE( "slot mask benchmark", "[slot_mask][!benchmark]" ) {
+    // a level that has spawned up to its last slot and freed most of the temporary
+    // entities since; the rest of the frame has pushed it out of the nearer caches,
+    // which taking turns between copies of it does as well
+    const int LEVELS = 16;
+    std::vector<std::vector<Entity>> levels(LEVELS, std::vector<Entity>(MAX_ENTITIES));
+    std::vector<SlotMask<MAX_ENTITIES>> masks(LEVELS);
+    srand(1234);
+    for (int level = 0; level < LEVELS; level++) {
+        for (int i = 0; i < MAX_ENTITIES; i++) {
+            Entity& ent = levels[level][i];
+            ent.number = i;
+            ent.inuse = i < 64 || rand() % 100 < 30;
+            ent.eType = rand() % 8;
+            ent.flags = rand();
+            ent.eventTime = rand() % 2 ? 0 : 1000;
+            ent.linked = true;
+            ent.nextthink = rand() % 5000;
+            ent.tagParent = nullptr;
+            masks[level].set(i, ent.inuse);
+        }
+    }
+    const int end = MAX_ENTITIES;
+
+    int level = 0;
+    BENCHMARK("1024 entities testing inuse in each") {
+        const std::vector<Entity>& entities = levels[level++ % LEVELS];
+        int work = 0;
+        for (int i = 0; i < end; i++) {
+            if (!entities[i].inuse) {
+                continue;
+            }
+            work += run(entities[i], 2000);
+        }
+        return work;
+    };
+
+    BENCHMARK("1024 entities walking the slot mask") {
+        const std::vector<Entity>& entities = levels[level % LEVELS];
+        const SlotMask<MAX_ENTITIES>& mask = masks[level++ % LEVELS];
+        int work = 0;
+        mask.forEach(end, [&](int i) {
+            work += run(entities[i], 2000);
+        });
+        return work;
+    };
+}
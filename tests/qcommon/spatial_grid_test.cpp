@@ -0,0 +1,116 @@
+#include "qcommon/spatial_grid.h"
+
+#include <cstdlib>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+struct TestBox
+{
+    float mins[3];
+    float maxs[3];
+};
+
+TestBox randomBox(float extent, float maxSize) {
+    TestBox b;
+    for (int i = 0; i < 3; i++) {
+        float size = maxSize * (rand() / (float)RAND_MAX);
+        b.mins[i] = -extent + 2.0f * extent * (rand() / (float)RAND_MAX);
+        b.maxs[i] = b.mins[i] + size;
+    }
+    return b;
+}
+
+bool overlaps(const TestBox& a, const TestBox& b) {
+    for (int i = 0; i < 3; i++) {
+        if (a.mins[i] > b.maxs[i] || a.maxs[i] < b.mins[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+TEST_CASE( "spatial grid matches a linear scan", "[spatial_grid]" ) {
+    const int numItems = 256;
+    srand(1234);
+
+    std::vector<TestBox> items;
+    SpatialGrid grid(numItems);
+    for (int i = 0; i < numItems; i++) {
+        items.push_back(randomBox(4096.0f, i % 16 == 0 ? 3000.0f : 128.0f));
+        if (i % 32 == 1) {
+            grid.insertAlways(i);
+        } else {
+            grid.insert(i, items[i].mins, items[i].maxs);
+        }
+    }
+    REQUIRE( grid.debug_getItemCount() == numItems );
+
+    int found[numItems];
+    for (int q = 0; q < 2000; q++) {
+        TestBox query = randomBox(4096.0f, q % 10 == 0 ? 5000.0f : 300.0f);
+        int count = grid.query(query.mins, query.maxs, found, numItems);
+
+        std::vector<int> expected;
+        for (int i = 0; i < numItems; i++) {
+            if (i % 32 == 1 || overlaps(items[i], query)) {
+                expected.push_back(i);
+            }
+        }
+
+        REQUIRE( std::vector<int>(found, found + count) == expected );
+    }
+}
+
+TEST_CASE( "spatial grid clear", "[spatial_grid]" ) {
+    SpatialGrid grid(4);
+    float mins[3] = { 0, 0, 0 };
+    float maxs[3] = { 10, 10, 10 };
+    int found[4];
+
+    grid.insert(2, mins, maxs);
+    REQUIRE( grid.query(mins, maxs, found, 4) == 1 );
+    REQUIRE( found[0] == 2 );
+
+    grid.clear();
+    REQUIRE( grid.query(mins, maxs, found, 4) == 0 );
+}
+
+TEST_CASE( "spatial grid benchmark", "[spatial_grid][!benchmark]" ) {
+    const int numItems = 256;
+    srand(5678);
+
+    std::vector<TestBox> items;
+    SpatialGrid grid(numItems);
+    for (int i = 0; i < numItems; i++) {
+        items.push_back(randomBox(4096.0f, 64.0f));
+        grid.insert(i, items[i].mins, items[i].maxs);
+    }
+    std::vector<TestBox> queries;
+    for (int q = 0; q < 1024; q++) {
+        queries.push_back(randomBox(4096.0f, 96.0f));
+    }
+
+    BENCHMARK("linear scan") {
+        int hits = 0;
+        for (const TestBox& query : queries) {
+            for (const TestBox& item : items) {
+                hits += overlaps(item, query);
+            }
+        }
+        return hits;
+    };
+
+    BENCHMARK("grid query") {
+        int hits = 0;
+        int found[numItems];
+        for (const TestBox& query : queries) {
+            hits += grid.query(query.mins, query.maxs, found, numItems);
+        }
+        return hits;
+    };
+}
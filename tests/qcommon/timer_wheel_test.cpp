@@ -0,0 +1,146 @@
+#include "qcommon/timer_wheel.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+const int MAX_ENTITIES = 1024;
+
+std::vector<int> advance(TimerWheel<MAX_ENTITIES>& wheel, int time) {
+    std::vector<int> due;
+    wheel.advance(time, [&due](int id) { due.push_back(id); });
+    std::sort(due.begin(), due.end());
+    return due;
+}
+
+}
+
+TEST_CASE( "timer wheel hands ids back once their time has come", "[timer_wheel]" ) {
+    TimerWheel<MAX_ENTITIES> wheel;
+    wheel.reset(1000);
+    REQUIRE(wheel.time() == 1000);
+
+    // one at each level, one past the top and one already late
+    wheel.schedule(1, 1010);
+    wheel.schedule(2, 1000 + 3000);
+    wheel.schedule(3, 1000 + 200000);
+    wheel.schedule(4, 1000 + 10000000);
+    wheel.schedule(5, 1000 + 100000000);
+    wheel.schedule(6, 900);
+    REQUIRE(wheel.scheduled(3));
+    REQUIRE(wheel.when(3) == 201000);
+    REQUIRE(!wheel.scheduled(7));
+
+    REQUIRE(advance(wheel, 1000) == std::vector<int>({ 6 }));
+    REQUIRE(!wheel.scheduled(6));
+    REQUIRE(advance(wheel, 1009).empty());
+    REQUIRE(advance(wheel, 1010) == std::vector<int>({ 1 }));
+    REQUIRE(advance(wheel, 3999).empty());
+    REQUIRE(advance(wheel, 50000) == std::vector<int>({ 2 }));
+    REQUIRE(advance(wheel, 201000) == std::vector<int>({ 3 }));
+    REQUIRE(advance(wheel, 10000999).empty());
+    REQUIRE(advance(wheel, 10001000) == std::vector<int>({ 4 }));
+    REQUIRE(advance(wheel, 200000000) == std::vector<int>({ 5 }));
+
+    // cancelled and moved
+    wheel.schedule(1, 200000100);
+    wheel.schedule(2, 200000100);
+    wheel.cancel(1);
+    wheel.schedule(2, 200000050);
+    REQUIRE(advance(wheel, 200000050) == std::vector<int>({ 2 }));
+    REQUIRE(advance(wheel, 300000000).empty());
+}
+
+TEST_CASE( "timer wheel agrees with looking at every time", "[timer_wheel]" ) {
+    TimerWheel<MAX_ENTITIES> wheel;
+    std::vector<int> times(MAX_ENTITIES, 0);       // 0 for not scheduled
+    srand(99);
+
+    int now = 5000;
+    wheel.reset(now);
+    for (int frame = 0; frame < 5000; frame++) {
+        // think again at all sorts of distances, from the due ones as a game does
+        for (int i = 0; i < 40; i++) {
+            const int id = rand() % MAX_ENTITIES;
+            const int spread[] = { 1, 100, 5000, 300000, 30000000 };
+            if (rand() % 10 == 0) {
+                wheel.cancel(id);
+                times[id] = 0;
+            } else {
+                times[id] = now + 1 + rand() % spread[rand() % 5];
+                wheel.schedule(id, times[id]);
+            }
+        }
+        now += frame % 100 == 99 ? 1 + rand() % 100000 : 1 + rand() % 100;
+
+        std::vector<int> expected;
+        for (int id = 0; id < MAX_ENTITIES; id++) {
+            if (times[id] && times[id] <= now) {
+                expected.push_back(id);
+            }
+        }
+        std::vector<int> due;
+        wheel.advance(now, [&](int id) {
+            due.push_back(id);
+            times[id] = id % 3 == 0 ? now + 50 : 0;
+            if (times[id]) {
+                wheel.schedule(id, times[id]);
+            }
+        });
+        std::sort(due.begin(), due.end());
+        REQUIRE(due == expected);
+        int wrong = 0;
+        for (int id = 0; id < MAX_ENTITIES; id++) {
+            if (wheel.scheduled(id) != (times[id] != 0)) {
+                wrong++;
+            }
+        }
+        REQUIRE(wrong == 0);
+    }
+}
+
+TEST_CASE( "timer wheel benchmark", "[timer_wheel][!benchmark]" ) {
+    // a large level of mostly idle thinkers, checked each 50ms frame: a few due every
+    // frame, the rest seconds to minutes away
+    struct Entity {
+        int nextthink;
+        char fields[1500];
+    };
+    std::vector<Entity> entities(MAX_ENTITIES);
+    TimerWheel<MAX_ENTITIES> wheel;
+    srand(1234);
+    int time = 10000;
+    wheel.reset(time);
+    for (int i = 0; i < MAX_ENTITIES; i++) {
+        entities[i].nextthink = time + 1 + rand() % 60000;
+        wheel.schedule(i, entities[i].nextthink);
+    }
+
+    int scanTime = time;
+    BENCHMARK("1024 thinkers comparing nextthink in each") {
+        scanTime += 50;
+        int due = 0;
+        for (Entity& ent : entities) {
+            if (ent.nextthink > 0 && ent.nextthink <= scanTime) {
+                ent.nextthink = scanTime + 1 + rand() % 60000;
+                due++;
+            }
+        }
+        return due;
+    };
+
+    int wheelTime = time;
+    BENCHMARK("1024 thinkers advancing the timer wheel") {
+        wheelTime += 50;
+        int due = 0;
+        wheel.advance(wheelTime, [&](int id) {
+            wheel.schedule(id, wheelTime + 1 + rand() % 60000);
+            due++;
+        });
+        return due;
+    };
+}
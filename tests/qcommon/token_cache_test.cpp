@@ -0,0 +1,126 @@
+#include "qcommon/token_cache.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+// a menu file's worth of tokens, as the preprocessor hands them out
+TokenStream makeStream() {
+    TokenStream stream;
+    stream.setDefines(1234);
+    stream.addSource("ui/main.menu", 0xdeadbeef);
+    stream.addSource("ui/menudef.h", 42);
+    stream.add(4, 0, 0, 0.0f, 1, "menuDef");
+    stream.add(5, 1, 0, 0.0f, 2, "{");
+    stream.add(4, 0, 0, 0.0f, 3, "name");
+    stream.add(1, 0, 0, 0.0f, 3, "main");
+    stream.add(3, 0x1808, 640, 640.0f, 4, "640");
+    stream.add(3, 0x2808, 0, 0.5f, 5, "0.5");
+    stream.add(1, 0, 0, 0.0f, 6, "");
+    stream.add(5, 2, 0, 0.0f, 7, "}");
+    return stream;
+}
+
+void requireSame(const TokenStream& a, const TokenStream& b) {
+    REQUIRE(a.size() == b.size());
+    for (int i = 0; i < a.size(); i++) {
+        const TokenStream::Token& x = a.token(i);
+        const TokenStream::Token& y = b.token(i);
+        REQUIRE(x.type == y.type);
+        REQUIRE(x.subtype == y.subtype);
+        REQUIRE(x.intvalue == y.intvalue);
+        REQUIRE(x.floatvalue == y.floatvalue);
+        REQUIRE(x.line == y.line);
+        REQUIRE(std::string(a.string(x)) == b.string(y));
+    }
+    REQUIRE(a.sources().size() == b.sources().size());
+    for (size_t i = 0; i < a.sources().size(); i++) {
+        REQUIRE(a.sources()[i].name == b.sources()[i].name);
+        REQUIRE(a.sources()[i].checksum == b.sources()[i].checksum);
+    }
+}
+
+}
+
+TEST_CASE( "token stream survives a round trip", "[token_cache]" ) {
+    const TokenStream stream = makeStream();
+    std::vector<uint8_t> data;
+    stream.write(data);
+
+    TokenStream copy;
+    REQUIRE(copy.read(data.data(), data.size()));
+    requireSame(stream, copy);
+
+    // an empty stream too
+    TokenStream empty;
+    empty.write(data);
+    REQUIRE(copy.read(data.data(), data.size()));
+    REQUIRE(copy.size() == 0);
+}
+
+TEST_CASE( "token stream cuts strings to the token buffer", "[token_cache]" ) {
+    TokenStream stream;
+    const std::string longString(3000, 'x');
+    stream.add(1, 0, 0, 0.0f, 1, longString.c_str());
+    REQUIRE(std::string(stream.string(stream.token(0))).size() == TokenStream::MAX_STRING - 1);
+}
+
+TEST_CASE( "token stream rejects damaged buffers", "[token_cache]" ) {
+    const TokenStream stream = makeStream();
+    std::vector<uint8_t> data;
+    stream.write(data);
+
+    TokenStream copy;
+    // every truncation
+    for (size_t size = 0; size < data.size(); size++) {
+        REQUIRE(!copy.read(data.data(), size));
+        REQUIRE(copy.size() == 0);
+        REQUIRE(copy.sources().empty());
+    }
+    // every flipped byte
+    for (size_t i = 0; i < data.size(); i++) {
+        std::vector<uint8_t> damaged = data;
+        damaged[i] ^= 0x10;
+        REQUIRE(!copy.read(damaged.data(), damaged.size()));
+    }
+}
+
+TEST_CASE( "token stream is only up to date with the same sources and defines", "[token_cache]" ) {
+    const TokenStream stream = makeStream();
+    std::map<std::string, uint32_t> files = { { "ui/main.menu", 0xdeadbeef }, { "ui/menudef.h", 42 } };
+    auto checksumOf = [&](const char* name, uint32_t& checksum) {
+        auto it = files.find(name);
+        if (it == files.end()) {
+            return false;
+        }
+        checksum = it->second;
+        return true;
+    };
+
+    REQUIRE(stream.upToDate(1234, checksumOf));
+    REQUIRE(!stream.upToDate(1235, checksumOf));
+
+    files["ui/menudef.h"] = 43;
+    REQUIRE(!stream.upToDate(1234, checksumOf));
+
+    files["ui/menudef.h"] = 42;
+    files.erase("ui/main.menu");
+    REQUIRE(!stream.upToDate(1234, checksumOf));
+
+    // a stream that never saw a file can't say whether it's current
+    TokenStream empty;
+    REQUIRE(!empty.upToDate(0, checksumOf));
+
+    // nor can one from another version of the format
+    std::vector<uint8_t> data;
+    stream.write(data);
+    data[4] = 2;
+    const uint32_t h = TokenStream::hash(data.data(), data.size() - 4);
+    std::memcpy(&data[data.size() - 4], &h, 4);
+    TokenStream copy;
+    REQUIRE(!copy.read(data.data(), data.size()));
+}
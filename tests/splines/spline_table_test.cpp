@@ -0,0 +1,194 @@
+#include "splines/spline_table.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace {
+
+struct Point
+{
+    float v[3];
+};
+
+float randomFloat(float lo, float hi) {
+    return lo + (hi - lo) * (rand() / (float)RAND_MAX);
+}
+
+// sampled like idSplineList::buildSpline
+std::vector<Point> samplePath(int controlPoints, float granularity) {
+    std::vector<Point> control;
+    for (int i = 0; i < controlPoints; i++) {
+        control.push_back({ { randomFloat(-2048, 2048), randomFloat(-2048, 2048), randomFloat(-256, 256) } });
+    }
+    std::vector<Point> samples;
+    for (int i = 3; i < controlPoints; i++) {
+        for (float tension = 0.0f; tension < 1.001f; tension += granularity) {
+            float w[4];
+            SplineWeights(tension, w);
+            Point p = { { 0, 0, 0 } };
+            for (int j = 0; j < 4; j++) {
+                for (int k = 0; k < 3; k++) {
+                    p.v[k] += control[i - 3 + j].v[k] * w[j];
+                }
+            }
+            samples.push_back(p);
+        }
+    }
+    return samples;
+}
+
+ArcLengthTable buildTable(const std::vector<Point>& samples) {
+    ArcLengthTable table;
+    for (const Point& p : samples) {
+        table.add(p.v[0], p.v[1], p.v[2]);
+    }
+    return table;
+}
+
+float segmentLength(const std::vector<Point>& samples, int i) {
+    float d = 0;
+    for (int k = 0; k < 3; k++) {
+        d += (samples[i + 1].v[k] - samples[i].v[k]) * (samples[i + 1].v[k] - samples[i].v[k]);
+    }
+    return std::sqrt(d);
+}
+
+// what idSplinePosition::getPosition did on every query: measure the path up to the distance
+Point walk(const std::vector<Point>& samples, float d) {
+    float along = 0;
+    for (int i = 0; i + 1 < (int)samples.size(); i++) {
+        const float length = segmentLength(samples, i);
+        if (along + length >= d) {
+            const float frac = length > 0 ? (d - along) / length : 0;
+            Point p;
+            for (int k = 0; k < 3; k++) {
+                p.v[k] = samples[i].v[k] + (samples[i + 1].v[k] - samples[i].v[k]) * frac;
+            }
+            return p;
+        }
+        along += length;
+    }
+    return samples.back();
+}
+
+Point lookup(const std::vector<Point>& samples, const ArcLengthTable& table, float d) {
+    int segment;
+    float frac;
+    table.locate(d, segment, frac);
+    Point p = samples[segment];
+    if (frac > 0) {
+        for (int k = 0; k < 3; k++) {
+            p.v[k] += (samples[segment + 1].v[k] - p.v[k]) * frac;
+        }
+    }
+    return p;
+}
+
+}
+
+TEST_CASE( "spline weights are the uniform cubic B-spline basis", "[spline_table]" ) {
+    for (float t = 0.0f; t < 1.001f; t += 0.025f) {
+        float w[4];
+        SplineWeights(t, w);
+        REQUIRE(std::fabs(w[0] + w[1] + w[2] + w[3] - 1.0f) < 1e-5f);
+        REQUIRE(std::fabs(w[0] - std::pow(1 - t, 3) / 6) < 1e-5f);
+        REQUIRE(std::fabs(w[1] - (3 * std::pow(t, 3) - 6 * std::pow(t, 2) + 4) / 6) < 1e-5f);
+        REQUIRE(std::fabs(w[2] - (-3 * std::pow(t, 3) + 3 * std::pow(t, 2) + 3 * t + 1) / 6) < 1e-5f);
+        REQUIRE(std::fabs(w[3] - std::pow(t, 3) / 6) < 1e-5f);
+    }
+}
+
+TEST_CASE( "arc length table finds the same point as walking the path", "[spline_table]" ) {
+    srand(1234);
+    const std::vector<Point> samples = samplePath(12, 0.025f);
+    const ArcLengthTable table = buildTable(samples);
+    REQUIRE(table.size() == (int)samples.size());
+
+    float total = 0;
+    for (int i = 0; i + 1 < (int)samples.size(); i++) {
+        total += segmentLength(samples, i);
+    }
+    REQUIRE(std::fabs(table.total() - total) < total * 1e-5f);
+
+    for (int i = 0; i < 1000; i++) {
+        const float d = randomFloat(0, table.total());
+        const Point a = walk(samples, d);
+        const Point b = lookup(samples, table, d);
+        for (int k = 0; k < 3; k++) {
+            REQUIRE(std::fabs(a.v[k] - b.v[k]) < 0.05f);
+        }
+    }
+}
+
+TEST_CASE( "arc length table clamps to the ends of the path", "[spline_table]" ) {
+    ArcLengthTable table;
+    int segment;
+    float frac;
+
+    // nothing to find
+    table.locate(10, segment, frac);
+    REQUIRE(segment == 0);
+    REQUIRE(frac == 0);
+
+    table.add(0, 0, 0);
+    table.add(3, 4, 0);
+    table.add(3, 4, 0);         // no length
+    table.add(3, 4, 10);
+    REQUIRE(table.total() == 15);
+    REQUIRE(table.distance(2) == 5);
+
+    table.locate(-1, segment, frac);
+    REQUIRE(segment == 0);
+    REQUIRE(frac == 0);
+
+    table.locate(2.5f, segment, frac);
+    REQUIRE(segment == 0);
+    REQUIRE(frac == 0.5f);
+
+    // the end of a segment is found in it, not at the start of the next
+    table.locate(5, segment, frac);
+    REQUIRE(segment == 0);
+    REQUIRE(frac == 1);
+
+    table.locate(10, segment, frac);
+    REQUIRE(segment == 2);
+    REQUIRE(frac == 0.5f);
+
+    table.locate(20, segment, frac);
+    REQUIRE(segment == 3);
+    REQUIRE(frac == 0);
+
+    table.clear();
+    REQUIRE(table.size() == 0);
+    REQUIRE(table.total() == 0);
+}
+
+TEST_CASE( "spline camera benchmark", "[spline_table][!benchmark]" ) {
+    srand(5678);
+    // a long scripted camera path
+    const std::vector<Point> samples = samplePath(40, 0.025f);
+    const ArcLengthTable table = buildTable(samples);
+    std::vector<float> queries;
+    for (int i = 0; i < 1000; i++) {
+        queries.push_back(randomFloat(0, table.total()));
+    }
+
+    BENCHMARK("1000 camera queries walking the path") {
+        float sum = 0;
+        for (float d : queries) {
+            sum += walk(samples, d).v[0];
+        }
+        return sum;
+    };
+
+    BENCHMARK("1000 camera queries with the table") {
+        float sum = 0;
+        for (float d : queries) {
+            sum += lookup(samples, table, d).v[0];
+        }
+        return sum;
+    };
+}